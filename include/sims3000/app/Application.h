@@ -36,6 +36,7 @@
 #include "sims3000/transport/RailSystem.h"
 #include "sims3000/port/PortSystem.h"
 #include "sims3000/services/ServicesSystem.h"
+#include "sims3000/sim/TaskScheduler.h"
 
 #include <memory>
 #include <string>
@@ -252,6 +253,10 @@ private:
     std::unique_ptr<SystemManager> m_systems;
     std::unique_ptr<ToonPipeline> m_toonPipeline;
 
+    // Worker pool lent to systems with intra-tick parallel work (client only).
+    // Declared before the demo systems so it outlives them.
+    std::unique_ptr<sim::TaskScheduler> m_taskScheduler;
+
     // Networking (server XOR client, not both)
     std::unique_ptr<NetworkServer> m_networkServer;
     std::unique_ptr<NetworkClient> m_networkClient;
@@ -6,6 +6,12 @@
  * buildings when preconditions are met. Each overseer gets staggered scans
  * to distribute CPU load across ticks.
  *
+ * Scans walk ZoneSystem's per-overseer, per-type spawn candidate sets
+ * rather than the zone grid, so their cost follows the number of
+ * Designated tiles, not the map area. Each set is walked from a rotating
+ * cursor and the zone types take turns, so tiles that fail their checks
+ * do not starve the ones after them.
+ *
  * @see /docs/epics/epic-4/tickets.md (ticket 4-026)
  */
 
@@ -17,7 +23,10 @@
 #include <sims3000/building/BuildingTemplate.h>
 #include <sims3000/building/BuildingGrid.h>
 #include <sims3000/building/TemplateSelector.h>
+#include <sims3000/zone/ZoneTypes.h>
+#include <array>
 #include <cstdint>
+#include <vector>
 
 // Forward declarations
 namespace sims3000 {
@@ -44,8 +53,8 @@ struct SpawningConfig {
  * @brief Scans designated zones and spawns buildings when preconditions are met.
  *
  * Each tick, checks if any overseer's staggered scan interval has arrived.
- * For eligible overseers, iterates the zone grid looking for Designated zones
- * where buildings can spawn, selects a template, and creates the building.
+ * For eligible overseers, walks the overseer's Designated tiles looking for
+ * ones where buildings can spawn, selects a template, and creates the building.
  */
 class BuildingSpawningLoop {
 public:
@@ -103,17 +112,36 @@ private:
     SpawningConfig m_config;
     uint32_t m_total_spawned = 0;
 
+    /// Where each candidate set's next scan starts, per [overseer][zone type]
+    std::vector<std::array<uint32_t, zone::ZONE_TYPE_COUNT>> m_cursors;
+
+    /// Zone type each overseer's next scan starts with
+    std::vector<uint8_t> m_next_type;
+
     /**
      * @brief Scan and spawn buildings for a single overseer.
      *
-     * Iterates the zone grid looking for Designated zones owned by this player.
-     * For each valid position, checks spawn preconditions, selects a template,
-     * and spawns the building. Stops after max_spawns_per_scan.
+     * Takes one candidate per zone type in turn from the overseer's spawn
+     * candidate sets. For each, checks spawn preconditions, selects a
+     * template, and spawns the building. Stops after max_spawns_per_scan.
+     * Types without demand are skipped outright.
+     *
+     * Each type makes at most as many visits as its set held when the
+     * scan started. That bounds the work, but is not a once-per-candidate
+     * guarantee: a spawn swap-removes its tile, and when the cursor wraps
+     * past the shrunken end a candidate already visited this scan can
+     * come up again.
      *
      * @param player_id Overseer ID to scan for.
      * @param current_tick Current simulation tick.
      */
     void scan_for_overseer(uint8_t player_id, uint32_t current_tick);
+
+    /**
+     * @brief Check, select a template for and spawn at one tile.
+     * @return true if a building was spawned.
+     */
+    bool try_spawn_at(int32_t x, int32_t y, uint8_t player_id, uint32_t current_tick);
 };
 
 } // namespace building
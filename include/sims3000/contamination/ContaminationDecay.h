@@ -59,7 +59,8 @@ uint8_t calculate_decay_rate(const DecayTileInfo& info);
  * - Otherwise: calculate decay rate based on environmental factors
  * - Apply decay using grid.apply_decay()
  *
- * Only processes tiles with contamination > 0 for efficiency.
+ * Only processes tiles with contamination > 0, and skips 16x16 blocks the
+ * grid's activity mask reports as clean.
  *
  * @param grid Contamination grid to update.
  * @param tile_info Array of per-tile decay modifiers (can be nullptr for uniform decay).
@@ -7,6 +7,14 @@
  * resolution with LandValue. Each cell stores a contamination level (0-255)
  * and a dominant contamination type (uint8_t).
  *
+ * Levels and types are stored as separate planes (structure of arrays),
+ * so overlays, stats and full-grid kernels read a contiguous byte plane
+ * directly, with no copy.
+ *
+ * Each buffer also carries a TileActivityMask counting non-zero tiles per
+ * 16x16 block, kept current by every write, so spread and decay can skip
+ * clean regions of the map.
+ *
  * Memory budget: 2 bytes/cell * 2 buffers = 4 bytes/cell.
  * - 128x128: ~64KB
  * - 256x256: ~256KB
@@ -21,6 +29,8 @@
 #ifndef SIMS3000_CONTAMINATION_CONTAMINATIONGRID_H
 #define SIMS3000_CONTAMINATION_CONTAMINATIONGRID_H
 
+#include <sims3000/core/TileActivityMask.h>
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -29,7 +39,10 @@ namespace contamination {
 
 /**
  * @struct ContaminationCell
- * @brief Single cell in the contamination grid.
+ * @brief Value of a single cell in the contamination grid.
+ *
+ * The grid itself stores levels and types in separate planes; this is
+ * the per-cell view of the two.
  */
 struct ContaminationCell {
     uint8_t level = 0;         ///< 0-255 contamination level
@@ -42,7 +55,8 @@ static_assert(sizeof(ContaminationCell) == 2, "ContaminationCell must be 2 bytes
  * @class ContaminationGrid
  * @brief Dense 2D double-buffered grid storing contamination data for all tiles.
  *
- * Row-major layout: index = y * width + x
+ * Row-major layout: index = y * width + x, in four planes (current and
+ * previous level, current and previous type).
  *
  * Double-buffering protocol:
  * 1. At the start of each tick, call swap_buffers()
@@ -136,11 +150,53 @@ public:
      */
     uint8_t get_dominant_type_previous_tick(int32_t x, int32_t y) const;
 
+    /**
+     * @brief Get raw pointer to the previous tick level plane.
+     *
+     * Row-major, width * height bytes. Used by full-grid kernels
+     * (contamination spread) that read every cell of the previous tick.
+     * Invalidated by swap_buffers().
+     */
+    const uint8_t* get_previous_level_data() const;
+
+    /**
+     * @brief Get raw pointer to the previous tick dominant type plane.
+     *
+     * Row-major, width * height bytes. Invalidated by swap_buffers().
+     */
+    const uint8_t* get_previous_type_data() const;
+
+    /**
+     * @brief Add a run of contamination along one row of the current buffer.
+     *
+     * Equivalent to calling add_contamination(x + i, y, amounts[i], types[i])
+     * for every i in [0, count) whose amount is non-zero, in a single pass.
+     *
+     * @param x First column of the run.
+     * @param y Row of the run.
+     * @param count Number of tiles; the run must lie within the grid.
+     * @param amounts count amounts.
+     * @param types count contributing types.
+     */
+    void add_contamination_span(int32_t x, int32_t y, uint32_t count,
+                                const uint8_t* amounts, const uint8_t* types);
+
+    /**
+     * @brief Get the non-zero block mask of the current buffer.
+     */
+    const TileActivityMask& get_activity() const;
+
+    /**
+     * @brief Get the non-zero block mask of the previous tick buffer.
+     */
+    const TileActivityMask& get_previous_activity() const;
+
     /**
      * @brief Swap the current and previous buffers.
      *
-     * Call this at the start of each simulation tick. Uses std::swap
-     * on the underlying vectors for O(1) pointer swap.
+     * Call this at the start of each simulation tick. Swaps the level
+     * and type planes and the activity masks (std::vector swap, O(1)
+     * pointer exchange).
      */
     void swap_buffers();
 
@@ -166,20 +222,31 @@ public:
     /**
      * @brief Recalculate cached aggregate statistics.
      *
-     * Updates total_contamination and toxic_tiles from current buffer.
+     * Updates total_contamination and toxic_tiles from current buffer
+     * with vectorized reductions over the level plane.
      */
     void update_stats();
 
     /**
      * @brief Get raw pointer to level data from current buffer (for overlays).
      *
-     * Note: Since cells are stored as ContaminationCell structs, this extracts
-     * levels into a separate contiguous buffer for overlay rendering.
+     * Returns the current level plane directly (no copy). The pointer
+     * refers to the other plane after swap_buffers(), so re-fetch it
+     * each tick.
      *
      * @return Pointer to contiguous uint8_t level data.
      */
     const uint8_t* get_level_data() const;
 
+    /**
+     * @brief Get raw pointer to dominant type data from current buffer.
+     *
+     * Same layout and lifetime as get_level_data().
+     *
+     * @return Pointer to contiguous uint8_t type data.
+     */
+    const uint8_t* get_type_data() const;
+
     /**
      * @brief Reset both buffers to zero.
      */
@@ -196,15 +263,16 @@ public:
 private:
     uint16_t m_width;                                ///< Grid width in tiles
     uint16_t m_height;                               ///< Grid height in tiles
-    std::vector<ContaminationCell> m_grid;            ///< Current tick buffer
-    std::vector<ContaminationCell> m_previous_grid;   ///< Previous tick buffer
+    std::vector<uint8_t> m_levels;                   ///< Current tick level plane
+    std::vector<uint8_t> m_types;                    ///< Current tick dominant type plane
+    std::vector<uint8_t> m_previous_levels;          ///< Previous tick level plane
+    std::vector<uint8_t> m_previous_types;           ///< Previous tick dominant type plane
+    TileActivityMask m_activity;                     ///< Non-zero blocks of m_levels
+    TileActivityMask m_previous_activity;            ///< Non-zero blocks of m_previous_levels
 
     uint32_t m_total_contamination = 0;              ///< Sum of all contamination levels
     uint32_t m_toxic_tiles = 0;                      ///< Count of tiles above threshold
 
-    mutable std::vector<uint8_t> m_level_cache;      ///< Cache for get_level_data()
-    mutable bool m_level_cache_dirty = true;         ///< Whether cache needs rebuild
-
     /**
      * @brief Calculate the linear index for a coordinate pair.
      * @param x X coordinate (column).
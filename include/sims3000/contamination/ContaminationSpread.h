@@ -46,6 +46,14 @@ constexpr uint8_t CONTAM_SPREAD_THRESHOLD = 32;
  * 3. Applies all deltas to the current buffer in a single pass
  *
  * This ensures spread results are independent of iteration order.
+ * Where several sources reach a tile, the type of the one latest in
+ * row-major order is used.
+ *
+ * Implemented as a row-oriented gather over padded level/type planes,
+ * vectorized with saturating byte arithmetic (AVX2 or SSE2 when the
+ * target supports it, scalar otherwise); all paths give identical results.
+ * Only blocks active in the previous tick's activity mask, plus a
+ * one-block halo, are visited.
  *
  * @param grid The contamination grid to update.
  */
@@ -73,6 +73,16 @@ public:
      */
     const char* getName() const override { return "ContaminationSystem"; }
 
+    /**
+     * @brief Declare tick() data access for the parallel scheduler.
+     * @return Reads sources (entities, traffic, terrain); writes the contamination grid.
+     */
+    SystemAccess getAccess() const override {
+        return SystemAccess::declare(
+            SimResource::Entities | SimResource::TrafficFlow | SimResource::Terrain,
+            SimResource::ContaminationGrid);
+    }
+
     // Grid access
 
     /**
@@ -0,0 +1,115 @@
+/**
+ * @file BytePlane.h
+ * @brief Vectorized reductions over contiguous byte planes.
+ *
+ * Per-tile simulation layers (contamination, disorder) store their levels
+ * as one byte per tile in a row-major plane. These helpers compute the
+ * aggregate statistics those layers cache, 16 bytes at a time with SSE2
+ * (baseline on x86-64) and with a scalar loop elsewhere or when
+ * SIMS3000_NO_SIMD is defined. All paths return identical results.
+ */
+
+#ifndef SIMS3000_CORE_BYTEPLANE_H
+#define SIMS3000_CORE_BYTEPLANE_H
+
+#include <cstddef>
+#include <cstdint>
+
+#if !defined(SIMS3000_NO_SIMD) && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define SIMS3000_BYTEPLANE_SSE2 1
+#endif
+
+namespace sims3000 {
+
+#if defined(SIMS3000_BYTEPLANE_SSE2)
+namespace detail {
+/// Add the two 64-bit lanes of a SAD accumulator.
+inline uint64_t byte_plane_hsum(__m128i acc) {
+    alignas(16) uint64_t lanes[2];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    return lanes[0] + lanes[1];
+}
+} // namespace detail
+#endif
+
+/**
+ * @brief Sum of all bytes in the plane.
+ */
+inline uint32_t byte_plane_sum(const uint8_t* data, size_t count) {
+    uint64_t total = 0;
+    size_t i = 0;
+#if defined(SIMS3000_BYTEPLANE_SSE2)
+    // SAD against zero sums each 8-byte half into a 64-bit lane
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        acc = _mm_add_epi64(acc, _mm_sad_epu8(v, zero));
+    }
+    total = detail::byte_plane_hsum(acc);
+#endif
+    for (; i < count; ++i) {
+        total += data[i];
+    }
+    return static_cast<uint32_t>(total);
+}
+
+/**
+ * @brief Number of bytes in the plane that are >= threshold.
+ */
+inline uint32_t byte_plane_count_at_least(const uint8_t* data, size_t count,
+                                          uint8_t threshold) {
+    uint64_t matches = 0;
+    size_t i = 0;
+#if defined(SIMS3000_BYTEPLANE_SSE2)
+    // v >= t  <=>  max(v, t) == v; matching lanes become 1 and are summed
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi8(1);
+    const __m128i t = _mm_set1_epi8(static_cast<char>(threshold));
+    __m128i acc = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const __m128i ge = _mm_cmpeq_epi8(_mm_max_epu8(v, t), v);
+        acc = _mm_add_epi64(acc, _mm_sad_epu8(_mm_and_si128(ge, one), zero));
+    }
+    matches = detail::byte_plane_hsum(acc);
+#endif
+    for (; i < count; ++i) {
+        if (data[i] >= threshold) {
+            ++matches;
+        }
+    }
+    return static_cast<uint32_t>(matches);
+}
+
+/**
+ * @brief Largest byte in the plane (0 for an empty plane).
+ */
+inline uint8_t byte_plane_max(const uint8_t* data, size_t count) {
+    uint8_t result = 0;
+    size_t i = 0;
+#if defined(SIMS3000_BYTEPLANE_SSE2)
+    __m128i acc = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16) {
+        acc = _mm_max_epu8(acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+    }
+    // Fold 16 lanes down to 1
+    acc = _mm_max_epu8(acc, _mm_srli_si128(acc, 8));
+    acc = _mm_max_epu8(acc, _mm_srli_si128(acc, 4));
+    acc = _mm_max_epu8(acc, _mm_srli_si128(acc, 2));
+    acc = _mm_max_epu8(acc, _mm_srli_si128(acc, 1));
+    result = static_cast<uint8_t>(_mm_cvtsi128_si32(acc) & 0xFF);
+#endif
+    for (; i < count; ++i) {
+        if (data[i] > result) {
+            result = data[i];
+        }
+    }
+    return result;
+}
+
+} // namespace sims3000
+
+#endif // SIMS3000_CORE_BYTEPLANE_H
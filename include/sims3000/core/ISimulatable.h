@@ -7,6 +7,7 @@
 #define SIMS3000_CORE_ISIMULATABLE_H
 
 #include "sims3000/core/ISimulationTime.h"
+#include "sims3000/core/SystemAccess.h"
 
 namespace sims3000 {
 
@@ -42,6 +43,14 @@ public:
      * @return System name
      */
     virtual const char* getName() const { return "UnnamedSystem"; }
+
+    /**
+     * Declare the shared resources this system reads and writes in tick().
+     * Systems that do not conflict may be ticked concurrently by the
+     * scheduler. Default is exclusive (always runs alone).
+     * @return Access declaration
+     */
+    virtual SystemAccess getAccess() const { return SystemAccess::make_exclusive(); }
 };
 
 } // namespace sims3000
@@ -0,0 +1,98 @@
+/**
+ * @file SystemAccess.h
+ * @brief Declared data access for ISimulatable systems.
+ *
+ * Each system may declare which shared simulation resources (grids,
+ * component sets) it reads and writes during tick(). The tick scheduler
+ * uses these declarations to run systems that do not conflict on the
+ * same tick concurrently, while systems that do conflict keep their
+ * serial priority order.
+ *
+ * Two systems conflict when either one writes a resource the other
+ * reads or writes. Systems that declare nothing are treated as
+ * exclusive: they conflict with every other system and always run
+ * alone, exactly as they would in a serial scheduler.
+ */
+
+#ifndef SIMS3000_CORE_SYSTEMACCESS_H
+#define SIMS3000_CORE_SYSTEMACCESS_H
+
+#include <cstdint>
+
+namespace sims3000 {
+
+/**
+ * @enum SimResource
+ * @brief Bit flags identifying shared simulation data.
+ *
+ * A resource stands for every piece of state owned by the matching
+ * subsystem (its grid plus any per-tile caches), not just one array.
+ */
+enum class SimResource : uint64_t {
+    None             = 0,
+    Terrain          = 1ull << 0,   ///< TerrainGrid, water distance field
+    Entities         = 1ull << 1,   ///< Shared ECS registry components
+    EnergyCoverage   = 1ull << 2,   ///< Energy coverage grid and pools
+    FluidCoverage    = 1ull << 3,   ///< Fluid coverage grid and pools
+    PathwayNetwork   = 1ull << 4,   ///< PathwayGrid, NetworkGraph, ProximityCache
+    TrafficFlow      = 1ull << 5,   ///< Per-road traffic / congestion state
+    ZoneGrid         = 1ull << 6,   ///< Zone designations
+    BuildingGrid     = 1ull << 7,   ///< Building occupancy
+    ContaminationGrid = 1ull << 8,  ///< Contamination overlay
+    DisorderGrid     = 1ull << 9,   ///< Disorder overlay
+    LandValueGrid    = 1ull << 10,  ///< Land value overlay
+    ServiceCoverage  = 1ull << 11,  ///< Service coverage grids
+    Population       = 1ull << 12,  ///< Population / employment data
+    Economy          = 1ull << 13,  ///< Treasury, tribute, budgets
+    Ports            = 1ull << 14   ///< Ports and trade state
+};
+
+/// Combine resource flags.
+constexpr SimResource operator|(SimResource a, SimResource b) {
+    return static_cast<SimResource>(static_cast<uint64_t>(a) | static_cast<uint64_t>(b));
+}
+
+/**
+ * @struct SystemAccess
+ * @brief Read/write resource sets declared by a system.
+ */
+struct SystemAccess {
+    uint64_t reads = 0;      ///< Resources read during tick()
+    uint64_t writes = 0;     ///< Resources written during tick()
+    bool exclusive = true;   ///< Undeclared: conflicts with everything
+
+    /**
+     * @brief Create an access declaration from resource sets.
+     * @param read_set Resources read during tick().
+     * @param write_set Resources written during tick().
+     * @return Non-exclusive access declaration.
+     */
+    static constexpr SystemAccess declare(SimResource read_set, SimResource write_set) {
+        return SystemAccess{static_cast<uint64_t>(read_set),
+                            static_cast<uint64_t>(write_set), false};
+    }
+
+    /**
+     * @brief Create an exclusive access declaration (runs alone).
+     */
+    static constexpr SystemAccess make_exclusive() {
+        return SystemAccess{0, 0, true};
+    }
+
+    /**
+     * @brief Check whether two systems may not run concurrently.
+     * @param other The other system's declaration.
+     * @return true if either is exclusive, or one writes what the other touches.
+     */
+    constexpr bool conflicts_with(const SystemAccess& other) const {
+        if (exclusive || other.exclusive) {
+            return true;
+        }
+        return (writes & (other.reads | other.writes)) != 0 ||
+               (other.writes & reads) != 0;
+    }
+};
+
+} // namespace sims3000
+
+#endif // SIMS3000_CORE_SYSTEMACCESS_H
@@ -0,0 +1,145 @@
+/**
+ * @file TileActivityMask.h
+ * @brief Per-block occupancy counts for sparse per-tile byte layers.
+ *
+ * Divides a grid into TILE_BLOCK_SIZE x TILE_BLOCK_SIZE blocks and counts
+ * the non-zero tiles in each. Grids report every level change through
+ * on_tile_changed(), so a block becomes active when its first tile rises
+ * above zero and inactive when its last tile returns to zero.
+ *
+ * Whole-grid passes (spread, decay) visit only active blocks, plus a
+ * one-block halo when they write to neighbouring tiles, so a mostly
+ * clean map costs one flag test per block instead of one per tile.
+ */
+
+#ifndef SIMS3000_CORE_TILEACTIVITYMASK_H
+#define SIMS3000_CORE_TILEACTIVITYMASK_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sims3000 {
+
+/// log2 of the block edge length
+constexpr uint32_t TILE_BLOCK_SHIFT = 4;
+
+/// Block edge length in tiles
+constexpr uint32_t TILE_BLOCK_SIZE = 1u << TILE_BLOCK_SHIFT;
+
+/**
+ * @class TileActivityMask
+ * @brief Counts of non-zero tiles per 16x16 block.
+ */
+class TileActivityMask {
+public:
+    TileActivityMask() = default;
+
+    /**
+     * @brief Construct an all-inactive mask covering a width x height grid.
+     */
+    TileActivityMask(uint16_t width, uint16_t height)
+        : m_blocks_x((static_cast<uint32_t>(width) + TILE_BLOCK_SIZE - 1) >> TILE_BLOCK_SHIFT)
+        , m_blocks_y((static_cast<uint32_t>(height) + TILE_BLOCK_SIZE - 1) >> TILE_BLOCK_SHIFT)
+        , m_counts(static_cast<size_t>(m_blocks_x) * m_blocks_y, 0)
+    {
+    }
+
+    /** @brief Number of block columns. */
+    uint32_t blocks_x() const { return m_blocks_x; }
+
+    /** @brief Number of block rows. */
+    uint32_t blocks_y() const { return m_blocks_y; }
+
+    /**
+     * @brief Record a tile level change.
+     *
+     * Only zero / non-zero transitions touch the counts. Coordinates must
+     * be in bounds (grids call this after their own bounds check).
+     */
+    void on_tile_changed(int32_t x, int32_t y, uint8_t before, uint8_t after) {
+        if ((before != 0) == (after != 0)) {
+            return;
+        }
+        uint16_t& count = m_counts[block_index(static_cast<uint32_t>(x) >> TILE_BLOCK_SHIFT,
+                                               static_cast<uint32_t>(y) >> TILE_BLOCK_SHIFT)];
+        if (after != 0) {
+            if (count++ == 0) {
+                ++m_active_blocks;
+            }
+        } else if (--count == 0) {
+            --m_active_blocks;
+        }
+    }
+
+    /** @brief True if the block holds at least one non-zero tile. */
+    bool is_block_active(uint32_t bx, uint32_t by) const {
+        return m_counts[block_index(bx, by)] != 0;
+    }
+
+    /** @brief Number of non-zero tiles in the block. */
+    uint32_t block_count(uint32_t bx, uint32_t by) const {
+        return m_counts[block_index(bx, by)];
+    }
+
+    /** @brief Number of active blocks. */
+    uint32_t active_block_count() const { return m_active_blocks; }
+
+    /**
+     * @brief Flag every block that is active or 8-adjacent to an active block.
+     *
+     * @param halo Resized to blocks_x() * blocks_y(); halo[by * blocks_x() + bx]
+     *        is 1 for flagged blocks and 0 otherwise.
+     */
+    void build_halo(std::vector<uint8_t>& halo) const {
+        halo.assign(m_counts.size(), 0);
+        if (m_active_blocks == 0) {
+            return;
+        }
+        for (uint32_t by = 0; by < m_blocks_y; ++by) {
+            for (uint32_t bx = 0; bx < m_blocks_x; ++bx) {
+                if (m_counts[block_index(bx, by)] == 0) {
+                    continue;
+                }
+                const uint32_t x0 = bx > 0 ? bx - 1 : 0;
+                const uint32_t x1 = std::min(bx + 1, m_blocks_x - 1);
+                const uint32_t y0 = by > 0 ? by - 1 : 0;
+                const uint32_t y1 = std::min(by + 1, m_blocks_y - 1);
+                for (uint32_t hy = y0; hy <= y1; ++hy) {
+                    for (uint32_t hx = x0; hx <= x1; ++hx) {
+                        halo[block_index(hx, hy)] = 1;
+                    }
+                }
+            }
+        }
+    }
+
+    /** @brief Mark every block inactive. */
+    void clear() {
+        std::fill(m_counts.begin(), m_counts.end(), static_cast<uint16_t>(0));
+        m_active_blocks = 0;
+    }
+
+    /** @brief Exchange contents with another mask (O(1)). */
+    void swap(TileActivityMask& other) {
+        std::swap(m_blocks_x, other.m_blocks_x);
+        std::swap(m_blocks_y, other.m_blocks_y);
+        m_counts.swap(other.m_counts);
+        std::swap(m_active_blocks, other.m_active_blocks);
+    }
+
+private:
+    size_t block_index(uint32_t bx, uint32_t by) const {
+        return static_cast<size_t>(by) * m_blocks_x + bx;
+    }
+
+    uint32_t m_blocks_x = 0;
+    uint32_t m_blocks_y = 0;
+    std::vector<uint16_t> m_counts;    ///< Non-zero tiles per block (max 256)
+    uint32_t m_active_blocks = 0;      ///< Blocks with a non-zero count
+};
+
+} // namespace sims3000
+
+#endif // SIMS3000_CORE_TILEACTIVITYMASK_H
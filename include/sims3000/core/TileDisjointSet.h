@@ -0,0 +1,501 @@
+/**
+ * @file TileDisjointSet.h
+ * @brief Dynamic connected components over 4-connected tiles.
+ *
+ * Tracks which tiles of a utility network (conduits plus producers) are
+ * connected to each other, and whether each component contains a source
+ * (nexus, extractor, reservoir). Used by the utility systems to answer
+ * "is this tile's network fed?" without a BFS from the producers.
+ *
+ * - insert() unions the tile with its occupied neighbours: near O(1)
+ *   (union by size + path halving).
+ * - erase() may split a component. Searches from the removed tile's
+ *   neighbours run interleaved and stop as soon as they all meet or only
+ *   one is still growing, so the cost is bounded by the smaller pieces.
+ *   Only those pieces are relabelled; the largest keeps its root.
+ * - has_source() / component_size() read per-root counters.
+ *
+ * Member tiles point at union-find nodes rather than being the nodes, so
+ * a relabelled piece can move to fresh nodes while the tree it left keeps
+ * serving the largest piece. Orphaned nodes are reclaimed by a periodic
+ * compaction once they outnumber members.
+ *
+ * Const queries never compress paths, so they are safe to call from
+ * concurrent readers; union by size keeps trees O(log n) deep.
+ *
+ * Per-tile arrays are allocated on first insert, like TilePositionIndex,
+ * so unused instances (players not in the game) cost nothing.
+ */
+
+#ifndef SIMS3000_CORE_TILEDISJOINTSET_H
+#define SIMS3000_CORE_TILEDISJOINTSET_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sims3000 {
+
+/**
+ * @class TileDisjointSet
+ * @brief Map-sized union-find over member tiles with per-component source counts.
+ */
+class TileDisjointSet {
+public:
+    /// Parent value of a tile that is not a member.
+    static constexpr uint32_t INVALID = UINT32_MAX;
+
+    TileDisjointSet() = default;
+
+    TileDisjointSet(uint32_t width, uint32_t height) {
+        resize(width, height);
+    }
+
+    /**
+     * @brief Resize to a new map and drop all members.
+     */
+    void resize(uint32_t width, uint32_t height) {
+        m_width = width;
+        m_height = height;
+        m_node.clear();
+        m_node.shrink_to_fit();
+        m_parent.clear();
+        m_parent.shrink_to_fit();
+        m_size.clear();
+        m_size.shrink_to_fit();
+        m_sources.clear();
+        m_sources.shrink_to_fit();
+        m_is_source.clear();
+        m_is_source.shrink_to_fit();
+        m_epoch_grid.clear();
+        m_epoch_grid.shrink_to_fit();
+        m_search.clear();
+        m_search.shrink_to_fit();
+        m_epoch = 0;
+        m_members = 0;
+        m_components = 0;
+    }
+
+    /// Remove all members (keeps allocations).
+    void clear() {
+        if (m_node.empty()) {
+            return;
+        }
+        std::fill(m_node.begin(), m_node.end(), INVALID);
+        std::fill(m_is_source.begin(), m_is_source.end(), 0);
+        m_parent.clear();
+        m_size.clear();
+        m_sources.clear();
+        m_members = 0;
+        m_components = 0;
+    }
+
+    /**
+     * @brief Add (x, y) as a member and union it with member neighbours.
+     * @return true if the tile was added; false if already a member or out of bounds.
+     */
+    bool insert(uint32_t x, uint32_t y) {
+        if (!in_bounds(x, y)) {
+            return false;
+        }
+        allocate();
+        uint32_t idx = index(x, y);
+        if (m_node[idx] != INVALID) {
+            return false;
+        }
+        uint32_t node = new_node();
+        m_size[node] = 1;
+        m_node[idx] = node;
+        m_is_source[idx] = 0;
+        ++m_members;
+        ++m_components;
+
+        uint32_t neighbours[4];
+        uint32_t count = member_neighbours(x, y, neighbours);
+        for (uint32_t i = 0; i < count; ++i) {
+            unite(node, m_node[neighbours[i]]);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Remove (x, y), splitting its component if it was a bridge.
+     *
+     * One search per member neighbour advances a tile at a time in turn
+     * (as in NetworkGraph::remove_pathway_tile). Searches that reach each
+     * other's tiles merge; one that runs dry first has found a piece that
+     * split off and is moved to a new root. The loop stops once a single
+     * search group is left, leaving the largest piece unvisited under the
+     * old root with its size and source count reduced.
+     *
+     * @return true if a member was removed.
+     */
+    bool erase(uint32_t x, uint32_t y) {
+        if (!contains(x, y)) {
+            return false;
+        }
+        uint32_t idx = index(x, y);
+        uint32_t starts[4];
+        uint32_t count = member_neighbours(x, y, starts);
+
+        uint32_t root = find_compress(m_node[idx]);
+        --m_size[root];
+        m_sources[root] -= m_is_source[idx];
+        m_node[idx] = INVALID;
+        m_is_source[idx] = 0;
+        --m_members;
+
+        if (count == 0) {
+            --m_components;
+        } else if (count > 1) {
+            split(root, starts, count);
+        }
+        if (m_parent.size() > 2 * static_cast<size_t>(m_members) + m_compact_slack) {
+            compact();
+        }
+        return true;
+    }
+
+    /**
+     * @brief Mark or unmark a member tile as a source.
+     * @return true if the member's flag changed.
+     */
+    bool set_source(uint32_t x, uint32_t y, bool is_source) {
+        if (!contains(x, y)) {
+            return false;
+        }
+        uint32_t idx = index(x, y);
+        uint8_t flag = is_source ? 1 : 0;
+        if (m_is_source[idx] == flag) {
+            return false;
+        }
+        m_is_source[idx] = flag;
+        uint32_t root = find_compress(m_node[idx]);
+        if (is_source) {
+            ++m_sources[root];
+        } else {
+            --m_sources[root];
+        }
+        return true;
+    }
+
+    /// Check whether (x, y) is a member.
+    bool contains(uint32_t x, uint32_t y) const {
+        return in_bounds(x, y) && !m_node.empty() &&
+               m_node[index(x, y)] != INVALID;
+    }
+
+    /// Check whether (x, y) is a member marked as a source.
+    bool is_source(uint32_t x, uint32_t y) const {
+        return contains(x, y) && m_is_source[index(x, y)] != 0;
+    }
+
+    /**
+     * @brief Component id (root node) of (x, y), or INVALID if not a member.
+     *
+     * Ids are stable until the next insert or erase.
+     */
+    uint32_t find(uint32_t x, uint32_t y) const {
+        if (!contains(x, y)) {
+            return INVALID;
+        }
+        uint32_t node = m_node[index(x, y)];
+        while (m_parent[node] != node) {
+            node = m_parent[node];
+        }
+        return node;
+    }
+
+    /// True if (x, y) is a member whose component contains a source.
+    bool has_source(uint32_t x, uint32_t y) const {
+        uint32_t root = find(x, y);
+        return root != INVALID && m_sources[root] > 0;
+    }
+
+    /// Number of member tiles in the component of (x, y), or 0.
+    uint32_t component_size(uint32_t x, uint32_t y) const {
+        uint32_t root = find(x, y);
+        return root != INVALID ? m_size[root] : 0;
+    }
+
+    /// True if both tiles are members of the same component.
+    bool connected(uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1) const {
+        uint32_t a = find(x0, y0);
+        return a != INVALID && a == find(x1, y1);
+    }
+
+    /// Number of member tiles.
+    uint32_t size() const { return m_members; }
+
+    /// Number of components.
+    uint32_t component_count() const { return m_components; }
+
+    bool empty() const { return m_members == 0; }
+
+    uint32_t width() const { return m_width; }
+    uint32_t height() const { return m_height; }
+
+    /**
+     * @brief Visit every member tile in the component of (x, y), breadth-first.
+     *
+     * The set must not be modified during iteration.
+     *
+     * @param fn Callable as fn(uint32_t x, uint32_t y).
+     */
+    template <typename Fn>
+    void for_each_in_component(uint32_t x, uint32_t y, Fn&& fn) {
+        if (!contains(x, y)) {
+            return;
+        }
+        const uint32_t epoch = next_epoch();
+        uint32_t start = index(x, y);
+        m_frontier.clear();
+        m_frontier.push_back(start);
+        m_epoch_grid[start] = epoch;
+        for (size_t head = 0; head < m_frontier.size(); ++head) {
+            uint32_t cur = m_frontier[head];
+            uint32_t cx = cur % m_width;
+            uint32_t cy = cur / m_width;
+            uint32_t adj[4];
+            uint32_t adj_count = member_neighbours(cx, cy, adj);
+            for (uint32_t a = 0; a < adj_count; ++a) {
+                if (m_epoch_grid[adj[a]] != epoch) {
+                    m_epoch_grid[adj[a]] = epoch;
+                    m_frontier.push_back(adj[a]);
+                }
+            }
+            fn(cx, cy);
+        }
+    }
+
+private:
+    bool in_bounds(uint32_t x, uint32_t y) const {
+        return x < m_width && y < m_height;
+    }
+
+    uint32_t index(uint32_t x, uint32_t y) const {
+        return y * m_width + x;
+    }
+
+    void allocate() {
+        if (!m_node.empty()) {
+            return;
+        }
+        size_t tiles = static_cast<size_t>(m_width) * m_height;
+        m_node.assign(tiles, INVALID);
+        m_is_source.assign(tiles, 0);
+        m_epoch_grid.assign(tiles, 0);
+        m_search.assign(tiles, 0);
+        m_compact_slack = tiles / 8 + 64;
+    }
+
+    /// Append a parentless node with empty counters.
+    uint32_t new_node() {
+        uint32_t node = static_cast<uint32_t>(m_parent.size());
+        m_parent.push_back(node);
+        m_size.push_back(0);
+        m_sources.push_back(0);
+        return node;
+    }
+
+    /**
+     * @brief Interleaved split search after removing a tile from `root`.
+     * @param starts The removed tile's member neighbours (2 to 4).
+     */
+    void split(uint32_t root, const uint32_t* starts, uint32_t count) {
+        const uint32_t epoch = next_epoch();
+        size_t heads[4] = { 0, 0, 0, 0 };
+        uint8_t group[4] = { 0, 1, 2, 3 };
+        bool finished[4] = { false, false, false, false };
+        auto find_group = [&group](uint32_t s) {
+            while (group[s] != s) {
+                s = group[s];
+            }
+            return s;
+        };
+
+        uint32_t live_groups = count;
+        for (uint32_t s = 0; s < count; ++s) {
+            m_epoch_grid[starts[s]] = epoch;
+            m_search[starts[s]] = static_cast<uint8_t>(s);
+            m_queues[s].clear();
+            m_queues[s].push_back(starts[s]);
+        }
+
+        while (live_groups > 1) {
+            for (uint32_t s = 0; s < count && live_groups > 1; ++s) {
+                if (find_group(s) != s || finished[s]) {
+                    continue;
+                }
+                // Advance this group by one tile from any of its queues
+                uint32_t source = count;
+                for (uint32_t q = 0; q < count; ++q) {
+                    if (find_group(q) == s && heads[q] < m_queues[q].size()) {
+                        source = q;
+                        break;
+                    }
+                }
+                if (source == count) {
+                    // Exhausted without meeting the others: this piece split off
+                    finished[s] = true;
+                    --live_groups;
+                    relabel_piece(root, s, group, count);
+                    continue;
+                }
+
+                uint32_t cur = m_queues[source][heads[source]++];
+                uint32_t adj[4];
+                uint32_t adj_count = member_neighbours(cur % m_width, cur / m_width, adj);
+                for (uint32_t a = 0; a < adj_count; ++a) {
+                    if (m_epoch_grid[adj[a]] != epoch) {
+                        m_epoch_grid[adj[a]] = epoch;
+                        m_search[adj[a]] = static_cast<uint8_t>(source);
+                        m_queues[source].push_back(adj[a]);
+                        continue;
+                    }
+                    uint32_t other = find_group(m_search[adj[a]]);
+                    if (other != s) {
+                        // Met another search: same piece, merge the groups
+                        group[other] = static_cast<uint8_t>(s);
+                        --live_groups;
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Move the tiles found by search group `s` to a new root node.
+     *
+     * Their old nodes stay in `root`'s tree, so parent chains of the tiles
+     * left behind are untouched.
+     */
+    void relabel_piece(uint32_t root, uint32_t s, const uint8_t* group, uint32_t count) {
+        uint32_t piece_root = INVALID;
+        uint32_t moved = 0;
+        uint32_t sources = 0;
+        for (uint32_t q = 0; q < count; ++q) {
+            uint32_t g = q;
+            while (group[g] != g) {
+                g = group[g];
+            }
+            if (g != s) {
+                continue;
+            }
+            for (uint32_t tile : m_queues[q]) {
+                uint32_t node = new_node();
+                if (piece_root == INVALID) {
+                    piece_root = node;
+                }
+                m_parent[node] = piece_root;
+                m_node[tile] = node;
+                sources += m_is_source[tile];
+            }
+            moved += static_cast<uint32_t>(m_queues[q].size());
+        }
+        m_size[piece_root] = moved;
+        m_sources[piece_root] = sources;
+        m_size[root] -= moved;
+        m_sources[root] -= sources;
+        ++m_components;
+    }
+
+    /// Rebuild the node forest from the member tiles, one flat tree per component.
+    void compact() {
+        m_parent.clear();
+        m_size.clear();
+        m_sources.clear();
+        const uint32_t epoch = next_epoch();
+        for (uint32_t start = 0; start < m_node.size(); ++start) {
+            if (m_node[start] == INVALID || m_epoch_grid[start] == epoch) {
+                continue;
+            }
+            uint32_t root = new_node();
+            uint32_t sources = 0;
+            m_frontier.clear();
+            m_frontier.push_back(start);
+            m_epoch_grid[start] = epoch;
+            for (size_t head = 0; head < m_frontier.size(); ++head) {
+                uint32_t cur = m_frontier[head];
+                uint32_t node = head == 0 ? root : new_node();
+                m_parent[node] = root;
+                m_node[cur] = node;
+                sources += m_is_source[cur];
+
+                uint32_t adj[4];
+                uint32_t adj_count = member_neighbours(cur % m_width, cur / m_width, adj);
+                for (uint32_t a = 0; a < adj_count; ++a) {
+                    if (m_epoch_grid[adj[a]] != epoch) {
+                        m_epoch_grid[adj[a]] = epoch;
+                        m_frontier.push_back(adj[a]);
+                    }
+                }
+            }
+            m_size[root] = static_cast<uint32_t>(m_frontier.size());
+            m_sources[root] = sources;
+        }
+    }
+
+    uint32_t next_epoch() {
+        if (m_epoch == UINT32_MAX) {
+            std::fill(m_epoch_grid.begin(), m_epoch_grid.end(), 0);
+            m_epoch = 0;
+        }
+        return ++m_epoch;
+    }
+
+    /// Collect 4-neighbours of (x, y) that are members. Returns the count.
+    uint32_t member_neighbours(uint32_t x, uint32_t y, uint32_t out[4]) const {
+        uint32_t count = 0;
+        uint32_t idx = index(x, y);
+        if (x + 1 < m_width && m_node[idx + 1] != INVALID) out[count++] = idx + 1;
+        if (x > 0 && m_node[idx - 1] != INVALID) out[count++] = idx - 1;
+        if (y + 1 < m_height && m_node[idx + m_width] != INVALID) out[count++] = idx + m_width;
+        if (y > 0 && m_node[idx - m_width] != INVALID) out[count++] = idx - m_width;
+        return count;
+    }
+
+    uint32_t find_compress(uint32_t idx) {
+        while (m_parent[idx] != idx) {
+            m_parent[idx] = m_parent[m_parent[idx]];  // path halving
+            idx = m_parent[idx];
+        }
+        return idx;
+    }
+
+    void unite(uint32_t a, uint32_t b) {
+        a = find_compress(a);
+        b = find_compress(b);
+        if (a == b) {
+            return;
+        }
+        if (m_size[a] < m_size[b]) {
+            std::swap(a, b);
+        }
+        m_parent[b] = a;
+        m_size[a] += m_size[b];
+        m_sources[a] += m_sources[b];
+        --m_components;
+    }
+
+    uint32_t m_width = 0;
+    uint32_t m_height = 0;
+    uint32_t m_members = 0;
+    uint32_t m_components = 0;
+    uint32_t m_epoch = 0;
+    size_t m_compact_slack = 0;          ///< Orphaned nodes tolerated beyond members
+    std::vector<uint32_t> m_node;        ///< Per tile: union-find node, INVALID if not a member
+    std::vector<uint32_t> m_parent;      ///< Per node: parent node
+    std::vector<uint32_t> m_size;        ///< Per node: member count (valid at roots)
+    std::vector<uint32_t> m_sources;     ///< Per node: source member count (valid at roots)
+    std::vector<uint8_t> m_is_source;    ///< Per tile: 1 if this member is a source
+    std::vector<uint32_t> m_epoch_grid;  ///< Per tile: visit stamps for searches
+    std::vector<uint8_t> m_search;       ///< Per tile: split search that reached it
+    std::vector<uint32_t> m_frontier;    ///< Search scratch (reused)
+    std::vector<uint32_t> m_queues[4];   ///< Split search queues (reused)
+};
+
+} // namespace sims3000
+
+#endif // SIMS3000_CORE_TILEDISJOINTSET_H
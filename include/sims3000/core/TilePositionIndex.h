@@ -0,0 +1,210 @@
+/**
+ * @file TilePositionIndex.h
+ * @brief Dense tile -> entity id index with bit-scan iteration.
+ *
+ * Replaces per-player std::unordered_map<uint64_t, uint32_t> position maps
+ * in the utility systems (energy, fluid). Each index covers the whole map:
+ * - an occupancy bitset (1 bit per tile) for fast membership tests and
+ *   ordered iteration via bit-scan over occupied words;
+ * - an entity id per tile, allocated on first insert so that unused
+ *   indices (e.g. players not in the game) cost only the bitset.
+ *
+ * Lookups are a single array access with no hashing. Iteration visits
+ * occupied tiles in row-major order, which makes traversal order
+ * deterministic across platforms (unordered_map order is not).
+ *
+ * Positions outside the map are rejected by set() and report absent.
+ */
+
+#ifndef SIMS3000_CORE_TILEPOSITIONINDEX_H
+#define SIMS3000_CORE_TILEPOSITIONINDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace sims3000 {
+
+/**
+ * @brief Index of the lowest set bit in a non-zero 64-bit word.
+ * @param word Non-zero word.
+ * @return Bit index (0-63).
+ */
+inline uint32_t lowest_set_bit(uint64_t word) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return static_cast<uint32_t>(index);
+#else
+    return static_cast<uint32_t>(__builtin_ctzll(word));
+#endif
+}
+
+/**
+ * @class TilePositionIndex
+ * @brief Map-sized tile -> entity id index with an occupancy bitset.
+ *
+ * One index holds one kind of structure for one player (e.g. player 2's
+ * conduits). At most one entity per tile; set() on an occupied tile
+ * replaces the id, matching the map semantics it replaces.
+ */
+class TilePositionIndex {
+public:
+    /// Returned by get() for unoccupied or out-of-bounds tiles.
+    static constexpr uint32_t INVALID_ID = UINT32_MAX;
+
+    TilePositionIndex() = default;
+
+    /**
+     * @brief Create an empty index covering a width x height map.
+     * @param width Map width in tiles.
+     * @param height Map height in tiles.
+     */
+    TilePositionIndex(uint32_t width, uint32_t height) {
+        resize(width, height);
+    }
+
+    /**
+     * @brief Resize to a new map and drop all entries.
+     * @param width Map width in tiles.
+     * @param height Map height in tiles.
+     */
+    void resize(uint32_t width, uint32_t height) {
+        m_width = width;
+        m_height = height;
+        size_t tiles = static_cast<size_t>(width) * height;
+        m_bits.assign((tiles + 63) / 64, 0);
+        m_ids.clear();
+        m_ids.shrink_to_fit();
+        m_count = 0;
+    }
+
+    /**
+     * @brief Store entity_id at (x, y).
+     * @return true if the tile was previously unoccupied.
+     *         false if it was occupied (id replaced) or out of bounds.
+     */
+    bool set(uint32_t x, uint32_t y, uint32_t entity_id) {
+        if (!in_bounds(x, y)) {
+            return false;
+        }
+        if (m_ids.empty()) {
+            m_ids.assign(static_cast<size_t>(m_width) * m_height, INVALID_ID);
+        }
+        size_t idx = index(x, y);
+        m_ids[idx] = entity_id;
+        uint64_t mask = 1ull << (idx & 63);
+        uint64_t& word = m_bits[idx >> 6];
+        if (word & mask) {
+            return false;
+        }
+        word |= mask;
+        ++m_count;
+        return true;
+    }
+
+    /**
+     * @brief Remove the entry at (x, y).
+     * @return true if an entry was removed.
+     */
+    bool erase(uint32_t x, uint32_t y) {
+        if (!contains(x, y)) {
+            return false;
+        }
+        size_t idx = index(x, y);
+        m_bits[idx >> 6] &= ~(1ull << (idx & 63));
+        m_ids[idx] = INVALID_ID;
+        --m_count;
+        return true;
+    }
+
+    /// Remove all entries (keeps allocations).
+    void clear() {
+        if (m_count == 0) {
+            return;
+        }
+        for (size_t w = 0; w < m_bits.size(); ++w) {
+            uint64_t word = m_bits[w];
+            while (word != 0) {
+                m_ids[(w << 6) + lowest_set_bit(word)] = INVALID_ID;
+                word &= word - 1;
+            }
+            m_bits[w] = 0;
+        }
+        m_count = 0;
+    }
+
+    /// Check whether (x, y) holds an entry.
+    bool contains(uint32_t x, uint32_t y) const {
+        if (!in_bounds(x, y)) {
+            return false;
+        }
+        size_t idx = index(x, y);
+        return (m_bits[idx >> 6] >> (idx & 63)) & 1u;
+    }
+
+    /// Get the entity id at (x, y), or INVALID_ID if none.
+    uint32_t get(uint32_t x, uint32_t y) const {
+        if (!contains(x, y)) {
+            return INVALID_ID;
+        }
+        return m_ids[index(x, y)];
+    }
+
+    /// Number of occupied tiles.
+    uint32_t size() const { return m_count; }
+
+    /// True if no tile is occupied.
+    bool empty() const { return m_count == 0; }
+
+    uint32_t width() const { return m_width; }
+    uint32_t height() const { return m_height; }
+
+    /**
+     * @brief Visit every occupied tile in row-major order.
+     *
+     * Skips empty 64-tile words entirely and walks set bits with a
+     * bit-scan. The index must not be modified during iteration.
+     *
+     * @param fn Callable as fn(uint32_t x, uint32_t y, uint32_t entity_id).
+     */
+    template <typename Fn>
+    void for_each(Fn&& fn) const {
+        if (m_count == 0) {
+            return;
+        }
+        for (size_t w = 0; w < m_bits.size(); ++w) {
+            uint64_t word = m_bits[w];
+            while (word != 0) {
+                size_t idx = (w << 6) + lowest_set_bit(word);
+                word &= word - 1;
+                fn(static_cast<uint32_t>(idx % m_width),
+                   static_cast<uint32_t>(idx / m_width),
+                   m_ids[idx]);
+            }
+        }
+    }
+
+private:
+    bool in_bounds(uint32_t x, uint32_t y) const {
+        return x < m_width && y < m_height;
+    }
+
+    size_t index(uint32_t x, uint32_t y) const {
+        return static_cast<size_t>(y) * m_width + x;
+    }
+
+    uint32_t m_width = 0;
+    uint32_t m_height = 0;
+    uint32_t m_count = 0;
+    std::vector<uint64_t> m_bits;    ///< Occupancy, 1 bit per tile (row-major)
+    std::vector<uint32_t> m_ids;     ///< Entity id per tile (allocated on first set)
+};
+
+} // namespace sims3000
+
+#endif // SIMS3000_CORE_TILEPOSITIONINDEX_H
@@ -0,0 +1,273 @@
+/**
+ * @file UtilityNetwork.h
+ * @brief Shared coverage/connectivity helpers for conduit-based utilities.
+ *
+ * Energy and fluid both distribute a resource from producer tiles through
+ * a 4-connected conduit network, stamping square coverage radii onto a
+ * per-tile owner grid. UtilityNetwork<Traits> is a set of stateless
+ * helpers for the pieces that are identical in both:
+ * - mark_coverage_radius(): square stamp onto the coverage grid
+ * - flood(): BFS through conduits from a seeded frontier
+ * - reset_connections() / connect(): conduit is_connected bookkeeping
+ * - update_active_states(): conduit is_active from connection + generation
+ * - preview_delta(): tiles a hypothetical conduit would add
+ * - aggregate_consumption(): demand of consumers inside coverage
+ *
+ * It is not a shared network model. Each system still owns its state and
+ * drives these helpers itself:
+ * - EnergySystem keeps per-tile coverage reference counts so conduits and
+ *   nexuses can be stamped and released incrementally; fluid rebuilds
+ *   coverage from scratch and stamps straight into its grid.
+ * - Pool state machines and distribution stay per system: energy has
+ *   priority rationing and collapse events, fluid has reservoir
+ *   buffering and all-or-nothing distribution with no rationing.
+ * - Seeding rules (which producers feed the network) differ by design.
+ * Folding those into the template would force one model onto both.
+ *
+ * Traits requirements:
+ * @code
+ *     struct Traits {
+ *         using Grid = ...;               // set/get_coverage_owner/is_in_coverage
+ *         using ConduitComponent = ...;   // coverage_radius, is_connected, is_active
+ *         using ConsumerComponent = ...;  // demand read via Traits::demand()
+ *         static constexpr uint8_t DEFAULT_CONDUIT_RADIUS = ...;
+ *         static uint32_t demand(const ConsumerComponent& c);
+ *     };
+ * @endcode
+ *
+ * All coordinates are tile coordinates; owner_id is the 1-based overseer
+ * id stored in the coverage grid (player + 1).
+ */
+
+#ifndef SIMS3000_CORE_UTILITYNETWORK_H
+#define SIMS3000_CORE_UTILITYNETWORK_H
+
+#include <sims3000/core/TilePositionIndex.h>
+#include <entt/entt.hpp>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace sims3000 {
+
+template <typename Traits>
+class UtilityNetwork {
+public:
+    using Grid = typename Traits::Grid;
+    using ConduitComponent = typename Traits::ConduitComponent;
+    using ConsumerComponent = typename Traits::ConsumerComponent;
+
+    /// Pack tile coordinates into a frontier key (x high, y low).
+    static uint64_t pack(uint32_t x, uint32_t y) {
+        return (static_cast<uint64_t>(x) << 32) | static_cast<uint64_t>(y);
+    }
+    static uint32_t unpack_x(uint64_t packed) {
+        return static_cast<uint32_t>(packed >> 32);
+    }
+    static uint32_t unpack_y(uint64_t packed) {
+        return static_cast<uint32_t>(packed & 0xFFFFFFFF);
+    }
+
+    /**
+     * @brief Mark a square of radius tiles around (cx, cy), clamped to the map.
+     */
+    static void mark_coverage_radius(Grid& grid, uint32_t cx, uint32_t cy,
+                                     uint8_t radius, uint8_t owner_id,
+                                     uint32_t map_width, uint32_t map_height) {
+        uint32_t min_x, min_y, max_x, max_y;
+        if (!clamp_square(cx, cy, radius, map_width, map_height,
+                          min_x, min_y, max_x, max_y)) {
+            return;
+        }
+        for (uint32_t y = min_y; y <= max_y; ++y) {
+            for (uint32_t x = min_x; x <= max_x; ++x) {
+                grid.set(x, y, owner_id);
+            }
+        }
+    }
+
+    /**
+     * @brief Clear is_connected on every conduit in the index.
+     */
+    static void reset_connections(entt::registry* registry,
+                                  const TilePositionIndex& conduits) {
+        if (!registry) {
+            return;
+        }
+        conduits.for_each([registry](uint32_t, uint32_t, uint32_t entity_id) {
+            auto* conduit = try_get_conduit(registry, entity_id);
+            if (conduit) {
+                conduit->is_connected = false;
+            }
+        });
+    }
+
+    /**
+     * @brief Mark a conduit connected and return its coverage radius.
+     *
+     * Falls back to Traits::DEFAULT_CONDUIT_RADIUS if the entity or its
+     * component is unavailable.
+     */
+    static uint8_t connect(entt::registry* registry, uint32_t entity_id) {
+        auto* conduit = try_get_conduit(registry, entity_id);
+        if (!conduit) {
+            return Traits::DEFAULT_CONDUIT_RADIUS;
+        }
+        conduit->is_connected = true;
+        return conduit->coverage_radius;
+    }
+
+    /**
+     * @brief Breadth-first flood through the conduit network.
+     *
+     * Starting from the tiles already in frontier (packed keys), visits
+     * every 4-neighbour that holds a conduit, is not yet visited and
+     * passes can_extend. visit() must mark the tile visited; the helper
+     * then appends it to the frontier. frontier is left holding every
+     * tile reached, so callers can reuse its capacity.
+     *
+     * @param frontier   Seed tiles in, all reached tiles out.
+     * @param conduits   Conduit positions for this owner.
+     * @param can_extend bool(x, y): ownership boundary check.
+     * @param is_visited bool(x, y): true if already seeded or reached.
+     * @param visit      void(x, y, entity_id): connect a reached conduit.
+     */
+    template <typename CanExtend, typename IsVisited, typename Visit>
+    static void flood(std::vector<uint64_t>& frontier,
+                      const TilePositionIndex& conduits,
+                      uint32_t map_width, uint32_t map_height,
+                      CanExtend&& can_extend, IsVisited&& is_visited,
+                      Visit&& visit) {
+        // 4-directional neighbor offsets: right, left, down, up
+        static const int32_t dx[] = { 1, -1, 0, 0 };
+        static const int32_t dy[] = { 0, 0, 1, -1 };
+
+        for (size_t head = 0; head < frontier.size(); ++head) {
+            uint32_t cx = unpack_x(frontier[head]);
+            uint32_t cy = unpack_y(frontier[head]);
+
+            for (int i = 0; i < 4; ++i) {
+                int64_t nx = static_cast<int64_t>(cx) + dx[i];
+                int64_t ny = static_cast<int64_t>(cy) + dy[i];
+                if (nx < 0 || nx >= static_cast<int64_t>(map_width) ||
+                    ny < 0 || ny >= static_cast<int64_t>(map_height)) {
+                    continue;
+                }
+                uint32_t nbx = static_cast<uint32_t>(nx);
+                uint32_t nby = static_cast<uint32_t>(ny);
+                if (is_visited(nbx, nby) || !can_extend(nbx, nby)) {
+                    continue;
+                }
+                uint32_t conduit_id = conduits.get(nbx, nby);
+                if (conduit_id == TilePositionIndex::INVALID_ID) {
+                    continue;
+                }
+                visit(nbx, nby, conduit_id);
+                frontier.push_back(pack(nbx, nby));
+            }
+        }
+    }
+
+    /**
+     * @brief Set is_active = is_connected && has_generation on every conduit.
+     */
+    static void update_active_states(entt::registry* registry,
+                                     const TilePositionIndex& conduits,
+                                     bool has_generation) {
+        if (!registry) {
+            return;
+        }
+        conduits.for_each([registry, has_generation](uint32_t, uint32_t, uint32_t entity_id) {
+            auto* conduit = try_get_conduit(registry, entity_id);
+            if (conduit) {
+                conduit->is_active = (conduit->is_connected && has_generation);
+            }
+        });
+    }
+
+    /**
+     * @brief Tiles within radius of (x, y) not already covered by owner_id.
+     */
+    static std::vector<std::pair<uint32_t, uint32_t>> preview_delta(
+        const Grid& grid, uint32_t x, uint32_t y, uint8_t radius,
+        uint8_t owner_id, uint32_t map_width, uint32_t map_height) {
+        std::vector<std::pair<uint32_t, uint32_t>> delta;
+        uint32_t min_x, min_y, max_x, max_y;
+        if (!clamp_square(x, y, radius, map_width, map_height,
+                          min_x, min_y, max_x, max_y)) {
+            return delta;
+        }
+        for (uint32_t ty = min_y; ty <= max_y; ++ty) {
+            for (uint32_t tx = min_x; tx <= max_x; ++tx) {
+                if (grid.get_coverage_owner(tx, ty) != owner_id) {
+                    delta.emplace_back(tx, ty);
+                }
+            }
+        }
+        return delta;
+    }
+
+    /// Total demand and count of consumers inside coverage.
+    struct Consumption {
+        uint32_t total = 0;
+        uint32_t count = 0;
+    };
+
+    /**
+     * @brief Sum Traits::demand() over consumers whose tile is covered by owner_id.
+     */
+    static Consumption aggregate_consumption(const entt::registry& registry,
+                                             const Grid& grid,
+                                             const TilePositionIndex& consumers,
+                                             uint8_t owner_id) {
+        Consumption result;
+        consumers.for_each([&](uint32_t x, uint32_t y, uint32_t entity_id) {
+            if (!grid.is_in_coverage(x, y, owner_id)) {
+                return;
+            }
+            auto entity = static_cast<entt::entity>(entity_id);
+            if (!registry.valid(entity)) {
+                return;
+            }
+            const auto* consumer = registry.try_get<ConsumerComponent>(entity);
+            if (!consumer) {
+                return;
+            }
+            result.total += Traits::demand(*consumer);
+            ++result.count;
+        });
+        return result;
+    }
+
+private:
+    static ConduitComponent* try_get_conduit(entt::registry* registry, uint32_t entity_id) {
+        if (!registry) {
+            return nullptr;
+        }
+        auto entity = static_cast<entt::entity>(entity_id);
+        if (!registry->valid(entity)) {
+            return nullptr;
+        }
+        return registry->try_get<ConduitComponent>(entity);
+    }
+
+    static bool clamp_square(uint32_t cx, uint32_t cy, uint8_t radius,
+                             uint32_t map_width, uint32_t map_height,
+                             uint32_t& min_x, uint32_t& min_y,
+                             uint32_t& max_x, uint32_t& max_y) {
+        if (map_width == 0 || map_height == 0) {
+            return false;
+        }
+        uint64_t hi_x = static_cast<uint64_t>(cx) + radius;
+        uint64_t hi_y = static_cast<uint64_t>(cy) + radius;
+        min_x = (cx > radius) ? cx - radius : 0;
+        min_y = (cy > radius) ? cy - radius : 0;
+        max_x = static_cast<uint32_t>(hi_x < map_width ? hi_x : map_width - 1);
+        max_y = static_cast<uint32_t>(hi_y < map_height ? hi_y : map_height - 1);
+        return min_x <= max_x && min_y <= max_y;
+    }
+};
+
+} // namespace sims3000
+
+#endif // SIMS3000_CORE_UTILITYNETWORK_H
@@ -6,6 +6,12 @@
  * with LandValue. Systems read from the previous tick's buffer while writing
  * to the current tick's buffer, avoiding read-write conflicts.
  *
+ * Each buffer is a single contiguous byte plane, so whole-grid passes
+ * (stats, spread, overlays) stream memory linearly and can be vectorized
+ * without stride. swap_buffers() exchanges the planes without copying.
+ * Each buffer also carries a TileActivityMask of non-zero 16x16 blocks,
+ * kept current by every write, so spread can skip clean regions.
+ *
  * Memory budget: 1 byte/cell * 2 buffers = 2 bytes/cell.
  * - 128x128: ~32KB
  * - 256x256: ~128KB
@@ -20,6 +26,8 @@
 #ifndef SIMS3000_DISORDER_DISORDERGRID_H
 #define SIMS3000_DISORDER_DISORDERGRID_H
 
+#include <sims3000/core/TileActivityMask.h>
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -118,7 +126,7 @@ public:
      * @brief Swap the current and previous buffers.
      *
      * Call this at the start of each simulation tick. Uses std::swap
-     * on the underlying vectors for O(1) pointer swap.
+     * on the underlying vectors (and activity masks) for O(1) pointer swap.
      */
     void swap_buffers();
 
@@ -151,9 +159,27 @@ public:
     /**
      * @brief Get raw pointer to current buffer data (for overlay rendering).
      * @return Pointer to the first element of the current buffer.
+     * @note Invalidated by swap_buffers().
      */
     const uint8_t* get_raw_data() const;
 
+    /**
+     * @brief Get raw pointer to the previous tick buffer (for plane kernels).
+     * @return Pointer to the first element of the previous buffer.
+     * @note Invalidated by swap_buffers().
+     */
+    const uint8_t* get_previous_raw_data() const;
+
+    /**
+     * @brief Get the non-zero block mask of the current buffer.
+     */
+    const TileActivityMask& get_activity() const;
+
+    /**
+     * @brief Get the non-zero block mask of the previous tick buffer.
+     */
+    const TileActivityMask& get_previous_activity() const;
+
     /**
      * @brief Reset both buffers to zero.
      */
@@ -172,6 +198,8 @@ private:
     uint16_t m_height;                   ///< Grid height in tiles
     std::vector<uint8_t> m_grid;         ///< Current tick buffer
     std::vector<uint8_t> m_previous_grid;///< Previous tick buffer
+    TileActivityMask m_activity;         ///< Non-zero blocks of m_grid
+    TileActivityMask m_previous_activity;///< Non-zero blocks of m_previous_grid
 
     // Cached stats
     uint32_t m_total_disorder = 0;       ///< Sum of all disorder levels
@@ -36,6 +36,10 @@ constexpr uint8_t SPREAD_THRESHOLD = 64;
  *    - delta[source] -= spread * num_valid_non_water_neighbors
  * 3. Apply deltas: set_level(x,y, clamp(level + delta, 0, 255))
  *
+ * Only 16x16 blocks the grid's activity mask reports as non-zero are
+ * scanned for sources, and deltas are applied within those blocks plus
+ * a one-block halo.
+ *
  * @param grid The disorder grid to spread (reads and writes current buffer).
  * @param water_mask Optional water mask. If provided, water_mask[y*width+x]
  *        indicates water tiles that block spread.
@@ -50,6 +50,12 @@ public:
     void tick(const ISimulationTime& time) override;
     int getPriority() const override { return 70; }
     const char* getName() const override { return "DisorderSystem"; }
+    SystemAccess getAccess() const override {
+        // Reads land value (E10-074) and enforcer coverage (E10-076)
+        return SystemAccess::declare(
+            SimResource::Entities | SimResource::LandValueGrid | SimResource::ServiceCoverage,
+            SimResource::DisorderGrid);
+    }
 
     /**
      * @brief Get const reference to the disorder grid.
@@ -0,0 +1,41 @@
+/**
+ * @file EnergyNetworkTraits.h
+ * @brief UtilityNetwork specialization traits for the energy matrix.
+ *
+ * Binds the shared UtilityNetwork<Traits> coverage/connectivity helpers to
+ * energy component and grid types. Seeding (nexus positions with
+ * NexusTypeConfig radii), refcounted coverage stamping and priority
+ * rationing remain in EnergySystem.
+ *
+ * @see sims3000/core/UtilityNetwork.h
+ */
+
+#pragma once
+
+#include <sims3000/core/UtilityNetwork.h>
+#include <sims3000/energy/CoverageGrid.h>
+#include <sims3000/energy/EnergyComponent.h>
+#include <sims3000/energy/EnergyConduitComponent.h>
+#include <cstdint>
+
+namespace sims3000 {
+namespace energy {
+
+struct EnergyNetworkTraits {
+    using Grid = CoverageGrid;
+    using ConduitComponent = EnergyConduitComponent;
+    using ConsumerComponent = EnergyComponent;
+
+    /// Matches EnergyConduitComponent::coverage_radius default
+    static constexpr uint8_t DEFAULT_CONDUIT_RADIUS = 3;
+
+    static uint32_t demand(const EnergyComponent& consumer) {
+        return consumer.energy_required;
+    }
+};
+
+/// Energy instantiation of the shared utility network helpers.
+using EnergyNetwork = UtilityNetwork<EnergyNetworkTraits>;
+
+} // namespace energy
+} // namespace sims3000
@@ -25,10 +25,13 @@
 #include <sims3000/energy/CoverageGrid.h>
 #include <sims3000/energy/PerPlayerEnergyPool.h>
 #include <sims3000/energy/EnergyEnums.h>
+#include <sims3000/energy/EnergyPriorities.h>
 #include <sims3000/energy/EnergyProducerComponent.h>
 #include <sims3000/energy/EnergyEvents.h>
 #include <sims3000/energy/IContaminationSource.h>
 #include <sims3000/building/ForwardDependencyInterfaces.h>
+#include <sims3000/core/TileDisjointSet.h>
+#include <sims3000/core/TilePositionIndex.h>
 #include <entt/entt.hpp>
 #include <cstdint>
 #include <unordered_map>
@@ -44,6 +47,8 @@ namespace terrain {
 namespace sims3000 {
 namespace energy {
 
+struct EnergyComponent;
+
 /// Maximum number of players (overseers) supported
 constexpr uint8_t MAX_PLAYERS = 4;
 
@@ -126,6 +131,8 @@ public:
      * Must be called before is_powered, get_energy_required, or
      * get_energy_received will return real values. If not set (or set
      * to nullptr), those methods return safe defaults (false / 0).
+     * Changing the registry rebuilds the pool running totals on the next
+     * calculate_pool().
      *
      * @param registry Non-owning pointer to the ECS registry.
      */
@@ -201,7 +208,8 @@ public:
      *
      * Iterates all registered nexus entity IDs for the given owner,
      * fetches the EnergyProducerComponent from the registry, and calls
-     * update_nexus_output on each.
+     * update_nexus_output on each. The owner's running generation total
+     * is refreshed from the new outputs in the same pass.
      *
      * Requires set_registry() to have been called. No-op if registry is nullptr.
      *
@@ -213,6 +221,7 @@ public:
      * @brief Get total energy generation for a player.
      *
      * Sums current_output from all registered nexus entities for the owner.
+     * This is the from-scratch sum; calculate_pool() uses the running total.
      * Requires set_registry() to have been called. Returns 0 if registry is nullptr.
      *
      * @param owner Player ID (0-3).
@@ -378,6 +387,8 @@ public:
      *
      * Stores the mapping from (x,y) -> entity_id in the per-player consumer
      * position map. This enables coverage-based aggregation of energy demand.
+     * Also files the consumer into its rationing priority bucket, using the
+     * EnergyComponent priority if the registry has one (default otherwise).
      *
      * @param entity_id Entity ID of the consumer.
      * @param owner Owning player ID (0-3).
@@ -390,7 +401,8 @@ public:
     /**
      * @brief Unregister a consumer entity's grid position.
      *
-     * Removes the mapping for (x,y) from the per-player consumer position map.
+     * Removes the mapping for (x,y) from the per-player consumer position map
+     * and the consumer's rationing bucket.
      *
      * @param entity_id Entity ID of the consumer (used for validation).
      * @param owner Owning player ID (0-3).
@@ -400,6 +412,23 @@ public:
     void unregister_consumer_position(uint32_t entity_id, uint8_t owner,
                                       uint32_t x, uint32_t y);
 
+    /**
+     * @brief Notify the system that a consumer's energy_required or priority changed.
+     *
+     * Re-reads the consumer's EnergyComponent and adjusts the owner's
+     * running consumption total and its rationing bucket in O(1). Must be
+     * called whenever either field is modified after
+     * register_consumer_position(); the pool does not poll consumer
+     * components.
+     *
+     * @param entity_id Entity ID of the consumer (must match the tile).
+     * @param owner Owning player ID (0-3).
+     * @param x X coordinate (column) of the consumer.
+     * @param y Y coordinate (row) of the consumer.
+     */
+    void on_consumer_demand_changed(uint32_t entity_id, uint8_t owner,
+                                    uint32_t x, uint32_t y);
+
     /**
      * @brief Get the number of registered consumer positions for a player.
      * @param owner Player ID (0-3).
@@ -413,6 +442,7 @@ public:
      * Iterates all registered consumer positions for the given owner,
      * checks if each position is in coverage (overseer_id = owner + 1),
      * and sums the energy_required from each consumer's EnergyComponent.
+     * This is the from-scratch sum; calculate_pool() uses the running total.
      *
      * Requires set_registry() to have been called. Returns 0 if registry
      * is nullptr.
@@ -459,6 +489,32 @@ public:
      */
     uint32_t get_coverage_count(uint8_t owner) const;
 
+    // =========================================================================
+    // Network components
+    // =========================================================================
+
+    /**
+     * @brief Check if the conduit or nexus at (x, y) is in a network fed by a nexus.
+     *
+     * Answered from the persistent union-find over conduit and nexus
+     * tiles, so it reflects placements immediately (before the next
+     * tick applies coverage).
+     *
+     * @param x X coordinate (column).
+     * @param y Y coordinate (row).
+     * @param owner Player ID (0-3).
+     * @return true if (x, y) holds a conduit or nexus whose component
+     *         contains at least one nexus.
+     */
+    bool is_connected_to_nexus(uint32_t x, uint32_t y, uint8_t owner) const;
+
+    /**
+     * @brief Number of separate conduit/nexus networks for a player.
+     * @param owner Player ID (0-3).
+     * @return Connected component count (0 if owner invalid).
+     */
+    uint32_t get_network_component_count(uint8_t owner) const;
+
     // =========================================================================
     // Pool state machine (Ticket 5-013)
     // =========================================================================
@@ -529,12 +585,36 @@ public:
      * - nexus_count = get_nexus_count(owner)
      * - consumer_count = get_consumer_count(owner)
      *
+     * Generation and consumption come from running totals rather than a
+     * walk over every nexus and consumer:
+     * - generation is refreshed by update_all_nexus_outputs() (aging) and
+     *   rebuilt after nexus registration changes
+     * - consumption is adjusted when consumers are registered/unregistered,
+     *   when a consumer tile gains or loses coverage, and when
+     *   on_consumer_demand_changed() reports an in-place edit
+     *
+     * Writes through get_coverage_grid_mut() or mark_coverage_radius()
+     * bypass the coverage hooks, so they mark the totals for a rebuild.
+     * In debug builds (SIMS3000_DEBUG) the totals are checked against a
+     * from-scratch recomputation.
+     *
      * Called by tick() phase 3 after nexus outputs and consumption are calculated.
      *
      * @param owner Player ID (0-3).
      */
     void calculate_pool(uint8_t owner);
 
+    /**
+     * @brief Check the running pool totals against a from-scratch sum.
+     *
+     * Totals already marked for a rebuild count as matching.
+     *
+     * @param owner Player ID (0-3).
+     * @return true if generation and consumption totals match
+     *         get_total_generation() and aggregate_consumption().
+     */
+    bool verify_pool_totals(uint8_t owner) const;
+
     // =========================================================================
     // Pool queries
     // =========================================================================
@@ -601,8 +681,9 @@ public:
     /**
      * @brief Mark coverage as dirty for a specific player.
      *
-     * When coverage is dirty, the next tick will recompute the coverage
-     * BFS for that player.
+     * Forces a full coverage rebuild on the next tick. Conduit changes
+     * do not need this; they are queued and applied incrementally
+     * (see update_coverage_incremental()).
      *
      * @param owner Player ID (0-3).
      */
@@ -611,30 +692,62 @@ public:
     /**
      * @brief Check if coverage is dirty for a specific player.
      *
+     * Dirty means either a full rebuild is pending or queued conduit
+     * changes have not been applied yet.
+     *
      * @param owner Player ID (0-3).
      * @return true if coverage needs recomputation.
      */
     bool is_coverage_dirty(uint8_t owner) const;
 
+    /**
+     * @brief Apply queued conduit changes to coverage without a full rebuild.
+     *
+     * Each queued tile is re-examined against the current conduit map:
+     * - A new conduit whose network component contains a nexus floods
+     *   outward, connecting it and any unconnected conduits it now joins.
+     * - A removed connected conduit releases its radius; neighbouring
+     *   pieces whose component (after the union-find split) no longer
+     *   contains a nexus are disconnected.
+     *
+     * Coverage is reference counted per tile, so overlapping radii are
+     * released correctly. The result matches recalculate_coverage().
+     * Falls back to recalculate_coverage() if a full rebuild is pending.
+     * Clears the dirty flag.
+     *
+     * @param owner Player ID (0-3).
+     */
+    void update_coverage_incremental(uint8_t owner);
+
+    /**
+     * @brief Get how many connected nexuses/conduits cover a tile.
+     *
+     * @param x X coordinate (column).
+     * @param y Y coordinate (row).
+     * @param owner Player ID (0-3).
+     * @return Coverage reference count (0 if uncovered or out of bounds).
+     */
+    uint32_t get_coverage_ref_count(uint32_t x, uint32_t y, uint8_t owner) const;
+
     // =========================================================================
     // Event handlers (Ticket 5-015)
     // =========================================================================
 
     /**
-     * @brief Handle conduit placed event - marks coverage dirty for owner.
+     * @brief Handle conduit placed event - queues an incremental coverage update.
      *
-     * Called when a conduit is placed on the grid. Sets the coverage dirty
-     * flag for the owning player so coverage is recalculated on next tick.
+     * Called when a conduit is placed on the grid. Queues the tile for
+     * update_coverage_incremental() on next tick and marks coverage dirty.
      *
      * @param event The ConduitPlacedEvent with entity, owner, and position.
      */
     void on_conduit_placed(const ConduitPlacedEvent& event);
 
     /**
-     * @brief Handle conduit removed event - marks coverage dirty for owner.
+     * @brief Handle conduit removed event - queues an incremental coverage update.
      *
-     * Called when a conduit is removed from the grid. Sets the coverage dirty
-     * flag for the owning player so coverage is recalculated on next tick.
+     * Called when a conduit is removed from the grid. Queues the tile for
+     * update_coverage_incremental() on next tick and marks coverage dirty.
      *
      * @param event The ConduitRemovedEvent with entity, owner, and position.
      */
@@ -711,7 +824,8 @@ public:
      * @brief Get mutable reference to the coverage grid.
      *
      * Used by internal subsystems (BFS, tick) and tests to modify
-     * coverage directly.
+     * coverage directly. Marks the consumption totals of every player for
+     * a rebuild on the next calculate_pool().
      *
      * @return Mutable reference to CoverageGrid.
      */
@@ -829,7 +943,8 @@ public:
      * @brief Recalculate coverage for a specific player via BFS flood-fill.
      *
      * Algorithm:
-     * 1. Clear all existing coverage for this owner.
+     * 1. Clear all existing coverage, reference counts and connected
+     *    sources for this owner.
      * 2. Seed BFS frontier from all nexus positions for this player.
      *    Each nexus marks its coverage_radius around itself.
      * 3. BFS through conduit network: for each frontier position, check
@@ -838,6 +953,10 @@ public:
      *    to the frontier.
      * 4. Continue until frontier is empty.
      *
+     * Every stamped radius adds one reference per tile, which lets
+     * update_coverage_incremental() later release radii individually.
+     * Discards any queued incremental changes and clears the dirty flag.
+     *
      * Performance: O(conduits), not O(grid cells).
      * Target: <10ms for 512x512 with 5,000 conduits.
      *
@@ -957,13 +1076,22 @@ public:
      * @brief Apply priority-based rationing during energy deficit.
      *
      * Called from distribute_energy() when pool.surplus < 0 (deficit/collapse).
-     * Collects all consumers in coverage for the owner, sorts them by
-     * priority ascending (1=Critical first, 4=Low last) with entity_id
-     * tie-breaking, then allocates available energy (pool.total_generated)
-     * to consumers in priority order until exhausted.
+     * Allocates available energy (pool.total_generated) to consumers in
+     * coverage in priority order (1=Critical first, 4=Low last) with
+     * entity_id tie-breaking. A consumer that does not fit is unpowered and
+     * allocation continues with the next one.
+     *
+     * Consumers are kept in persistent per-priority buckets that track
+     * their in-coverage demand sum, updated on registration, demand,
+     * priority and coverage changes. The first bucket that does not fit
+     * whole is found by binary search over the bucket sums; buckets before
+     * it are powered and only it is walked greedily. Later buckets are
+     * walked only if their smallest demand fits what is left, otherwise
+     * they are unpowered. A bucket whose powered/unpowered outcome and
+     * members are unchanged since the last pass is not touched at all.
      *
      * Consumers that receive full allocation are powered; others are unpowered.
-     * Consumers outside coverage are always unpowered (handled by distribute_energy).
+     * Consumers outside coverage are always unpowered.
      *
      * @param owner Player ID (0-3).
      *
@@ -1116,6 +1244,157 @@ private:
      */
     static uint32_t unpack_y(uint64_t packed);
 
+    // =========================================================================
+    // Incremental coverage helpers
+    // =========================================================================
+
+    /// Kind of coverage source occupying a tile in m_source_kind.
+    enum SourceKind : uint8_t {
+        SOURCE_NONE = 0,     ///< Not a connected source
+        SOURCE_NEXUS = 1,    ///< Nexus (always connected)
+        SOURCE_CONDUIT = 2   ///< Conduit reachable from a nexus
+    };
+
+    /**
+     * @brief Add one coverage reference to every tile in a square radius.
+     *
+     * Tiles going from 0 to 1 references are claimed in the coverage grid.
+     */
+    void stamp_coverage(uint8_t owner, uint32_t cx, uint32_t cy, uint8_t radius);
+
+    /**
+     * @brief Release one coverage reference from every tile in a square radius.
+     *
+     * Tiles dropping to 0 references are handed to another player that
+     * still covers them, or cleared.
+     */
+    void unstamp_coverage(uint8_t owner, uint32_t cx, uint32_t cy, uint8_t radius);
+
+    /// Reset all source/refcount state for owner and release its grid tiles.
+    void reset_coverage_state(uint8_t owner);
+
+    /// Mark a conduit tile as a connected source and stamp its radius.
+    void connect_conduit(uint8_t owner, uint32_t x, uint32_t y, uint32_t entity_id);
+
+    /**
+     * @brief Connect every unvisited conduit reachable from the frontier.
+     *
+     * Runs the shared UtilityNetwork flood with m_source_kind as the
+     * visited set; frontier is left holding every tile reached.
+     */
+    void flood_conduits(uint8_t owner, std::vector<uint64_t>& frontier);
+
+    /// Release a connected conduit tile and clear its is_connected flag.
+    void disconnect_conduit(uint8_t owner, uint32_t x, uint32_t y);
+
+    /// Flood from a newly placed conduit if it touches a connected source.
+    void apply_conduit_added(uint8_t owner, uint32_t x, uint32_t y, uint32_t entity_id);
+
+    /// Release a removed conduit and drop pieces that lost their nexus.
+    void apply_conduit_removed(uint8_t owner, uint32_t x, uint32_t y);
+
+    /// Queue a tile for update_coverage_incremental() and mark dirty.
+    void queue_conduit_change(uint8_t owner, uint32_t x, uint32_t y);
+
+    /// Queue a full rebuild for owner and mark dirty.
+    void request_coverage_rebuild(uint8_t owner);
+
+    // =========================================================================
+    // Pool running totals (Ticket 5-012)
+    // =========================================================================
+
+    /**
+     * @brief Write a coverage grid tile, moving any consumer demand on it.
+     *
+     * All internal coverage writes go through here so the previous and
+     * new owners' consumption totals stay current.
+     */
+    void set_coverage_owner(uint32_t x, uint32_t y, uint8_t owner_id);
+
+    /// energy_required of a consumer entity, or 0 if unavailable.
+    uint32_t read_consumer_demand(uint32_t entity_id) const;
+
+    /// Recompute owner's consumption total and per-tile demand from scratch.
+    void rebuild_consumption_total(uint8_t owner);
+
+    /// Recompute owner's generation total and recorded outputs from scratch.
+    void rebuild_generation_total(uint8_t owner);
+
+    /// TrackedEntity::tile of a nexus without a registered position.
+    static constexpr uint32_t NO_TILE = UINT32_MAX;
+
+    /// Registered consumer or nexus, indexed by entity index (entt::to_entity).
+    struct TrackedEntity {
+        uint32_t entity_id = INVALID_ENTITY_ID;  ///< Full entity ID; INVALID if none
+        uint32_t tile = NO_TILE;                 ///< y * map_width + x
+        uint32_t ration_index = 0;               ///< Consumers: index in rationing bucket
+        uint8_t ration_bucket = 0;               ///< Consumers: rationing bucket
+        uint8_t owner = 0;
+    };
+
+    /// Tracking slot for an entity ID, grown on demand.
+    static TrackedEntity& tracked_slot(std::vector<TrackedEntity>& tracked, uint32_t entity_id);
+
+    /// Tracking slot for an entity ID, or nullptr if it is not tracked there.
+    static const TrackedEntity* find_tracked(const std::vector<TrackedEntity>& tracked,
+                                             uint32_t entity_id);
+
+    // =========================================================================
+    // Rationing buckets (Ticket 5-019)
+    // =========================================================================
+
+    /// Consumer entry in a rationing bucket, ordered by (priority, entity_id).
+    struct RationEntry {
+        uint32_t entity_id;
+        uint32_t tile;       ///< y * map_width + x
+        uint32_t demand;     ///< energy_required the bucket sums include
+        uint8_t priority;    ///< Priority the entry was filed under
+        bool covered;        ///< Tile is in the owner's coverage
+    };
+
+    /// Outcome last written to every consumer in a bucket.
+    enum class RationState : uint8_t {
+        Stale,      ///< Members changed or mixed outcome: walk on the next pass
+        Powered,    ///< Covered consumers powered, uncovered unpowered
+        Unpowered   ///< All consumers unpowered
+    };
+
+    /// Rationing bucket with running in-coverage demand.
+    struct RationBucket {
+        std::vector<RationEntry> entries;   ///< Sorted unless `sorted` is false
+        uint64_t demand = 0;                ///< Sum of covered entries' demand
+        uint32_t min_demand = UINT32_MAX;   ///< Lower bound on covered demand
+        bool sorted = true;
+        RationState state = RationState::Stale;
+    };
+
+    /// Buckets 0..ENERGY_PRIORITY_LOW hold one priority each; the last
+    /// bucket holds any higher value, still ordered by (priority, entity_id).
+    static constexpr uint8_t RATION_OVERFLOW_BUCKET = ENERGY_PRIORITY_LOW + 1;
+    static constexpr uint8_t RATION_BUCKET_COUNT = RATION_OVERFLOW_BUCKET + 1;
+
+    /// Append a consumer to its priority bucket (tile demand and coverage as recorded).
+    void file_ration_entry(uint8_t owner, uint32_t entity_id, uint32_t tile,
+                           uint8_t priority);
+
+    /// Remove a consumer from its bucket by its tracked slot (swap-and-pop).
+    void unfile_ration_entry(uint8_t owner, uint32_t entity_id);
+
+    /// Bucket entry of a filed consumer, or nullptr.
+    RationEntry* find_ration_entry(uint8_t owner, uint32_t entity_id);
+
+    /// Update a filed consumer's demand and/or coverage in its bucket sums.
+    void update_ration_entry(uint8_t owner, RationEntry& entry, uint32_t demand, bool covered);
+
+    /// Re-read every entry's demand and coverage (after a totals rebuild).
+    void rebuild_ration_buckets(uint8_t owner);
+
+    /// Write `state` to every consumer in a bucket unless it already holds.
+    void set_ration_state(uint8_t owner, uint8_t bucket_index, RationState state);
+
+    /// Greedily power a bucket's consumers in order; returns what is left.
+    uint64_t allocate_ration_bucket(uint8_t owner, uint8_t bucket_index, uint64_t available);
+
     // ECS registry pointer for component queries (non-owning, may be nullptr)
     entt::registry* m_registry;
 
@@ -1128,20 +1407,61 @@ private:
     // Per-player coverage dirty flags
     bool m_coverage_dirty[MAX_PLAYERS];
 
+    // Per-player flag: next coverage update must be a full rebuild
+    bool m_coverage_rebuild[MAX_PLAYERS];
+
+    // Per-player conduit tiles (packed) awaiting an incremental update
+    std::vector<uint64_t> m_pending_conduit_tiles[MAX_PLAYERS];
+
+    // Per-player, per-tile count of connected sources covering the tile
+    std::vector<uint16_t> m_coverage_refs[MAX_PLAYERS];
+
+    // Per-player, per-tile SourceKind of connected sources
+    std::vector<uint8_t> m_source_kind[MAX_PLAYERS];
+
+    // Per-player, per-tile radius stamped by the source (for release)
+    std::vector<uint8_t> m_source_radius[MAX_PLAYERS];
+
+    // Scratch state for coverage flood/search (reused across calls)
+    std::vector<uint64_t> m_scratch_tiles;
+    std::vector<uint64_t> m_scratch_piece;
+
+    // Per-player running generation and consumption totals (see calculate_pool)
+    uint32_t m_generated_total[MAX_PLAYERS];
+    uint32_t m_consumed_total[MAX_PLAYERS];
+
+    // Per-player flags: running total must be rebuilt from scratch
+    bool m_generation_stale[MAX_PLAYERS];
+    bool m_consumption_stale[MAX_PLAYERS];
+
+    // Per-player, per-tile energy_required recorded for the consumer there
+    std::vector<uint32_t> m_consumer_demand[MAX_PLAYERS];
+
+    // Registered consumers and nexuses by entity index
+    std::vector<TrackedEntity> m_tracked_consumers;
+    std::vector<TrackedEntity> m_tracked_nexuses;
+
+    // Per-player rationing buckets, indexed by priority (see RationEntry)
+    RationBucket m_ration_buckets[MAX_PLAYERS][RATION_BUCKET_COUNT];
+
     // Per-player nexus entity ID lists
     std::vector<uint32_t> m_nexus_ids[MAX_PLAYERS];
 
     // Per-player consumer entity ID lists
     std::vector<uint32_t> m_consumer_ids[MAX_PLAYERS];
 
-    // Per-player consumer spatial lookup: packed(x,y) -> entity_id (Ticket 5-011)
-    std::unordered_map<uint64_t, uint32_t> m_consumer_positions[MAX_PLAYERS];
+    // Per-player consumer spatial lookup: dense (x,y) -> entity_id (Ticket 5-011)
+    TilePositionIndex m_consumer_positions[MAX_PLAYERS];
+
+    // Per-player conduit spatial lookup: dense (x,y) -> entity_id (Ticket 5-014)
+    TilePositionIndex m_conduit_positions[MAX_PLAYERS];
 
-    // Per-player conduit spatial lookup: packed(x,y) -> entity_id (Ticket 5-014)
-    std::unordered_map<uint64_t, uint32_t> m_conduit_positions[MAX_PLAYERS];
+    // Per-player nexus spatial lookup: dense (x,y) -> entity_id (Ticket 5-014)
+    TilePositionIndex m_nexus_positions[MAX_PLAYERS];
 
-    // Per-player nexus spatial lookup: packed(x,y) -> entity_id (Ticket 5-014)
-    std::unordered_map<uint64_t, uint32_t> m_nexus_positions[MAX_PLAYERS];
+    // Per-player connected components over conduit + nexus tiles.
+    // Nexus tiles are sources; updated immediately on (un)registration.
+    TileDisjointSet m_network_sets[MAX_PLAYERS];
 
     // Terrain query interface (non-owning, may be nullptr)
     terrain::ITerrainQueryable* m_terrain;
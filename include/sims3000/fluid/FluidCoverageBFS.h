@@ -21,7 +21,10 @@
  *
  * Performance target: <10ms for 512x512 with 5,000 conduits
  *
- * @see EnergySystem.cpp recalculate_coverage() for the energy BFS pattern
+ * The conduit flood, coverage stamping and connection bookkeeping come from
+ * the shared UtilityNetwork helpers (FluidNetwork); only seeding is fluid-specific.
+ *
+ * @see UtilityNetwork.h for the shared coverage/connectivity helpers
  * @see FluidCoverageGrid.h for the grid API
  * @see FluidConduitComponent.h for conduit data
  * @see FluidProducerComponent.h for producer data
@@ -30,9 +33,10 @@
 #pragma once
 
 #include <sims3000/fluid/FluidCoverageGrid.h>
+#include <sims3000/fluid/FluidNetworkTraits.h>
+#include <sims3000/core/TilePositionIndex.h>
 #include <entt/entt.hpp>
 #include <cstdint>
-#include <unordered_map>
 
 namespace sims3000 {
 namespace fluid {
@@ -45,13 +49,13 @@ namespace fluid {
  * operate as a standalone helper without needing access to FluidSystem
  * internals directly.
  *
- * Position maps use packed 64-bit keys: (x << 32) | y
+ * Position indices are dense map-sized TilePositionIndex instances.
  */
 struct BFSContext {
     FluidCoverageGrid& grid;                                        ///< Coverage grid to write to
-    const std::unordered_map<uint64_t, uint32_t>& extractor_positions;  ///< Packed(x,y) -> entity_id for extractors
-    const std::unordered_map<uint64_t, uint32_t>& reservoir_positions;  ///< Packed(x,y) -> entity_id for reservoirs
-    const std::unordered_map<uint64_t, uint32_t>& conduit_positions;    ///< Packed(x,y) -> entity_id for conduits
+    const TilePositionIndex& extractor_positions;                   ///< (x,y) -> entity_id for extractors
+    const TilePositionIndex& reservoir_positions;                   ///< (x,y) -> entity_id for reservoirs
+    const TilePositionIndex& conduit_positions;                     ///< (x,y) -> entity_id for conduits
     entt::registry* registry;                                       ///< ECS registry for component queries
     uint8_t owner;                                                  ///< Player ID (0-3)
     uint32_t map_width;                                             ///< Map width in tiles
@@ -66,7 +70,7 @@ struct BFSContext {
  * @return Packed 64-bit key (x in upper 32 bits, y in lower 32 bits).
  */
 inline uint64_t pack_pos(uint32_t x, uint32_t y) {
-    return (static_cast<uint64_t>(x) << 32) | static_cast<uint64_t>(y);
+    return FluidNetwork::pack(x, y);
 }
 
 /**
@@ -75,7 +79,7 @@ inline uint64_t pack_pos(uint32_t x, uint32_t y) {
  * @return The X coordinate.
  */
 inline uint32_t unpack_x(uint64_t packed) {
-    return static_cast<uint32_t>(packed >> 32);
+    return FluidNetwork::unpack_x(packed);
 }
 
 /**
@@ -84,7 +88,7 @@ inline uint32_t unpack_x(uint64_t packed) {
  * @return The Y coordinate.
  */
 inline uint32_t unpack_y(uint64_t packed) {
-    return static_cast<uint32_t>(packed & 0xFFFFFFFF);
+    return FluidNetwork::unpack_y(packed);
 }
 
 /**
@@ -0,0 +1,41 @@
+/**
+ * @file FluidNetworkTraits.h
+ * @brief UtilityNetwork specialization traits for the fluid network.
+ *
+ * Binds the shared UtilityNetwork<Traits> coverage/connectivity helpers to
+ * fluid component and grid types. Seeding (extractors and reservoirs),
+ * reservoir buffering and all-or-nothing distribution (CCR-002) remain
+ * in FluidSystem / FluidCoverageBFS.
+ *
+ * @see sims3000/core/UtilityNetwork.h
+ */
+
+#pragma once
+
+#include <sims3000/core/UtilityNetwork.h>
+#include <sims3000/fluid/FluidCoverageGrid.h>
+#include <sims3000/fluid/FluidComponent.h>
+#include <sims3000/fluid/FluidConduitComponent.h>
+#include <cstdint>
+
+namespace sims3000 {
+namespace fluid {
+
+struct FluidNetworkTraits {
+    using Grid = FluidCoverageGrid;
+    using ConduitComponent = FluidConduitComponent;
+    using ConsumerComponent = FluidComponent;
+
+    /// Fallback radius when a conduit entity has no component
+    static constexpr uint8_t DEFAULT_CONDUIT_RADIUS = 2;
+
+    static uint32_t demand(const FluidComponent& consumer) {
+        return consumer.fluid_required;
+    }
+};
+
+/// Fluid instantiation of the shared utility network helpers.
+using FluidNetwork = UtilityNetwork<FluidNetworkTraits>;
+
+} // namespace fluid
+} // namespace sims3000
@@ -30,6 +30,8 @@
 #include <sims3000/fluid/FluidConduitComponent.h>
 #include <sims3000/fluid/FluidEvents.h>
 #include <sims3000/building/ForwardDependencyInterfaces.h>
+#include <sims3000/core/TileDisjointSet.h>
+#include <sims3000/core/TilePositionIndex.h>
 #include <entt/entt.hpp>
 #include <cstdint>
 #include <unordered_map>
@@ -389,11 +391,50 @@ public:
 
     /**
      * @brief Check if coverage is dirty for a specific player.
+     *
+     * True after any conduit, extractor or reservoir edit until the next
+     * tick, as before network components were tracked. Conduit edits in a
+     * network with no extractor or reservoir are included even though
+     * they cannot change coverage; is_network_dirty() reports those alone.
+     *
      * @param owner Player ID (0-3).
      * @return true if coverage needs recomputation.
      */
     bool is_coverage_dirty(uint8_t owner) const;
 
+    /**
+     * @brief Check if a player has conduit edits confined to unsourced networks.
+     *
+     * These edits cannot change coverage, so the next tick clears the
+     * flag without re-running the BFS. Always false for invalid owners.
+     *
+     * @param owner Player ID (0-3).
+     * @return true if such edits are pending since the last tick.
+     */
+    bool is_network_dirty(uint8_t owner) const;
+
+    /**
+     * @brief Check if the structure at (x, y) is in a network with a fluid source.
+     *
+     * Answered from the persistent union-find over conduit, extractor and
+     * reservoir tiles. A source is any extractor or reservoir, whether or
+     * not the extractor is currently operational.
+     *
+     * @param x X coordinate (column).
+     * @param y Y coordinate (row).
+     * @param owner Player ID (0-3).
+     * @return true if (x, y) holds a network structure whose component
+     *         contains an extractor or reservoir.
+     */
+    bool is_connected_to_source(uint32_t x, uint32_t y, uint8_t owner) const;
+
+    /**
+     * @brief Number of separate conduit/extractor/reservoir networks for a player.
+     * @param owner Player ID (0-3).
+     * @return Connected component count (0 if owner invalid).
+     */
+    uint32_t get_network_component_count(uint8_t owner) const;
+
     // =========================================================================
     // Pool queries
     // =========================================================================
@@ -795,6 +836,14 @@ private:
      */
     static uint32_t unpack_y(uint64_t packed);
 
+    /**
+     * @brief Sync network set membership at (x, y) with the position indices.
+     *
+     * A tile is a member if it holds a conduit, extractor or reservoir,
+     * and a source if it holds an extractor or reservoir.
+     */
+    void sync_network_tile(uint8_t owner, uint32_t x, uint32_t y);
+
     // =========================================================================
     // Private members
     // =========================================================================
@@ -814,26 +863,32 @@ private:
     /// Per-player fluid pools
     PerPlayerFluidPool m_pools[MAX_PLAYERS];
 
-    /// Per-player coverage dirty flags
+    /// Per-player coverage dirty flags (BFS re-runs on next tick)
     bool m_coverage_dirty[MAX_PLAYERS];
 
+    /// Per-player flags for conduit edits in unsourced networks (no BFS needed)
+    bool m_network_dirty[MAX_PLAYERS];
+
     /// Per-player extractor entity ID lists
     std::vector<uint32_t> m_extractor_ids[MAX_PLAYERS];
 
     /// Per-player reservoir entity ID lists
     std::vector<uint32_t> m_reservoir_ids[MAX_PLAYERS];
 
-    /// Per-player extractor spatial lookup: packed(x,y) -> entity_id
-    std::unordered_map<uint64_t, uint32_t> m_extractor_positions[MAX_PLAYERS];
+    /// Per-player extractor spatial lookup: dense (x,y) -> entity_id
+    TilePositionIndex m_extractor_positions[MAX_PLAYERS];
+
+    /// Per-player reservoir spatial lookup: dense (x,y) -> entity_id
+    TilePositionIndex m_reservoir_positions[MAX_PLAYERS];
 
-    /// Per-player reservoir spatial lookup: packed(x,y) -> entity_id
-    std::unordered_map<uint64_t, uint32_t> m_reservoir_positions[MAX_PLAYERS];
+    /// Per-player conduit spatial lookup: dense (x,y) -> entity_id
+    TilePositionIndex m_conduit_positions[MAX_PLAYERS];
 
-    /// Per-player conduit spatial lookup: packed(x,y) -> entity_id
-    std::unordered_map<uint64_t, uint32_t> m_conduit_positions[MAX_PLAYERS];
+    /// Per-player consumer spatial lookup: dense (x,y) -> entity_id
+    TilePositionIndex m_consumer_positions[MAX_PLAYERS];
 
-    /// Per-player consumer spatial lookup: packed(x,y) -> entity_id
-    std::unordered_map<uint64_t, uint32_t> m_consumer_positions[MAX_PLAYERS];
+    /// Per-player connected components over conduit/extractor/reservoir tiles
+    TileDisjointSet m_network_sets[MAX_PLAYERS];
 
     /// Per-player consumer entity ID lists
     std::vector<uint32_t> m_consumer_ids[MAX_PLAYERS];
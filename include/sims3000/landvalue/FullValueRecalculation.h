@@ -11,6 +11,10 @@
  *
  * Final value is clamped to [0, 255].
  *
+ * Two entry points: the per-tile LandValueTileInput form, and a fused
+ * kernel that reads the source planes in place (no per-tile input
+ * buffer) through per-factor lookup tables.
+ *
  * @see E10-105
  */
 
@@ -38,6 +42,45 @@ struct LandValueTileInput {
     uint8_t contam_level;      ///< From ContaminationGrid previous tick
 };
 
+/**
+ * @struct LandValueInputPlanes
+ * @brief Source planes read in place by the fused recalculation.
+ *
+ * Each plane covers the whole grid, row-major (index = y * width + x).
+ * Terrain types are read with a byte stride so the plane can point
+ * straight into TerrainGrid::tiles.
+ */
+struct LandValueInputPlanes {
+    const uint8_t* terrain_types = nullptr;    ///< e.g. &TerrainGrid::tiles[0].terrain_type
+    uint32_t terrain_stride = 1;               ///< Bytes between tiles (sizeof(TerrainComponent) for TerrainGrid)
+    const uint8_t* water_distances = nullptr;  ///< WaterDistanceField::distances
+    const uint8_t* road_distances = nullptr;   ///< ProximityCache::get_distance_data()
+    const uint8_t* disorder_levels = nullptr;  ///< DisorderGrid::get_previous_raw_data()
+    const uint8_t* contam_levels = nullptr;    ///< ContaminationGrid::get_previous_level_data()
+};
+
+/**
+ * @struct LandValueTables
+ * @brief Signed contribution of each factor, indexed by its input byte.
+ *
+ * Built once from the per-factor functions, so a table lookup always
+ * agrees with calculate_tile_value(). Penalties are stored negated. The
+ * terrain bonus splits into a type term and a water term because their
+ * sum (-30..+55) never reaches the int8_t clamp.
+ */
+struct LandValueTables {
+    int16_t terrain[256];        ///< By terrain type (water distance excluded)
+    int16_t water[256];          ///< By water distance
+    int16_t road[256];           ///< By road distance
+    int16_t disorder[256];       ///< By disorder level (negated penalty)
+    int16_t contamination[256];  ///< By contamination level (negated penalty)
+};
+
+/**
+ * @brief Get the shared lookup tables (built on first use).
+ */
+const LandValueTables& get_land_value_tables();
+
 /**
  * @brief Calculate land value for a single tile.
  *
@@ -75,6 +118,36 @@ void recalculate_all_values(LandValueGrid& grid,
                              const LandValueTileInput* tile_inputs,
                              uint32_t tile_count);
 
+/**
+ * @brief Recalculate the entire grid straight from the source planes.
+ *
+ * Same result as calculate_tile_value() for every tile. Each row is
+ * summed through the lookup tables into a small int16_t buffer, then
+ * clamped and narrowed to bytes with SIMD saturating packs.
+ *
+ * @param grid Land value grid to update.
+ * @param planes Source planes, each covering grid width * height tiles.
+ * @note No-op if any plane is null.
+ */
+void recalculate_all_values(LandValueGrid& grid, const LandValueInputPlanes& planes);
+
+/**
+ * @brief Recalculate a rectangle of the grid from the source planes.
+ *
+ * Same kernel as the whole-grid form; tiles outside the rectangle are
+ * left untouched. The rectangle is clipped to the grid.
+ *
+ * @param grid Land value grid to update.
+ * @param planes Source planes, each covering grid width * height tiles.
+ * @param x Left column.
+ * @param y Top row.
+ * @param width Width in tiles.
+ * @param height Height in tiles.
+ * @note No-op if any plane is null.
+ */
+void recalculate_values_in_rect(LandValueGrid& grid, const LandValueInputPlanes& planes,
+                                uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+
 } // namespace landvalue
 } // namespace sims3000
 
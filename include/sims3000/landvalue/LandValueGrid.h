@@ -93,6 +93,16 @@ public:
      */
     void set_value(int32_t x, int32_t y, uint8_t value);
 
+    /**
+     * @brief Set count consecutive total values of row y starting at x.
+     * @param x First column.
+     * @param y Row.
+     * @param values Land values 0-255.
+     * @param count Number of values; the span must lie within the row.
+     * @note No-op if the span is out of bounds.
+     */
+    void set_values(int32_t x, int32_t y, const uint8_t* values, uint32_t count);
+
     /**
      * @brief Subtract from land value with saturating arithmetic.
      *
@@ -11,7 +11,17 @@
  * - apply_contamination_penalty: subtract contamination penalty (E10-104)
  *
  * Phase implementations are stubs in this skeleton; they will be
- * filled in by later tickets.
+ * filled in by later tickets. Once set_sources() has been given every
+ * input, tick() instead runs the fused kernel (FullValueRecalculation.h)
+ * straight from the source grids, incrementally:
+ * - the first tick after set_sources() recomputes the whole grid;
+ * - later ticks recompute only dirty 16x16 blocks: areas reported through
+ *   on_terrain_modified()/on_pathway_changed() (plus the reach of the
+ *   water and road bonuses), and blocks where the previous tick's
+ *   disorder or contamination is, or was last time, non-zero;
+ * - RECONCILE_BLOCK_ROWS_PER_TICK block rows are also recomputed every
+ *   tick, cycling over the map, so anything missed is repaired within
+ *   one sweep.
  */
 
 #ifndef SIMS3000_LANDVALUE_LANDVALUESYSTEM_H
@@ -20,11 +30,44 @@
 #include <cstdint>
 
 #include "sims3000/core/ISimulatable.h"
+#include "sims3000/landvalue/FullValueRecalculation.h"
 #include "sims3000/landvalue/LandValueGrid.h"
+#include "sims3000/terrain/TerrainEvents.h"
+
+#include <vector>
 
 namespace sims3000 {
+namespace terrain {
+struct TerrainGrid;
+struct WaterDistanceField;
+}
+namespace transport {
+class ProximityCache;
+}
+namespace disorder {
+class DisorderGrid;
+}
+namespace contamination {
+class ContaminationGrid;
+}
+
 namespace landvalue {
 
+/**
+ * @struct LandValueSources
+ * @brief Grids land value is computed from (not owned).
+ *
+ * Each must match the land value grid's dimensions. Disorder and
+ * contamination are read from their previous tick buffers.
+ */
+struct LandValueSources {
+    const terrain::TerrainGrid* terrain = nullptr;
+    const terrain::WaterDistanceField* water = nullptr;
+    const transport::ProximityCache* roads = nullptr;
+    const disorder::DisorderGrid* disorder = nullptr;
+    const contamination::ContaminationGrid* contamination = nullptr;
+};
+
 /**
  * @class LandValueSystem
  * @brief Manages land value recalculation each simulation tick.
@@ -50,7 +93,8 @@ public:
     /**
      * @brief Called once per simulation tick (20 Hz).
      *
-     * Executes the following phases in order:
+     * With complete sources, recomputes the dirty blocks (the whole grid
+     * on the first tick). Otherwise executes the following phases in order:
      * 1. reset_values() - reset all values to neutral (128)
      * 2. apply_terrain_bonus() - add terrain-based bonuses
      * 3. apply_road_bonus() - add road proximity bonuses
@@ -73,6 +117,61 @@ public:
      */
     const char* getName() const override { return "LandValueSystem"; }
 
+    /**
+     * @brief Declare tick() data access for the parallel scheduler.
+     * @return Reads terrain, pathways, disorder and contamination; writes land value.
+     */
+    SystemAccess getAccess() const override {
+        return SystemAccess::declare(
+            SimResource::Terrain | SimResource::PathwayNetwork |
+            SimResource::DisorderGrid | SimResource::ContaminationGrid,
+            SimResource::LandValueGrid);
+    }
+
+    // Inputs
+
+    /**
+     * @brief Set the grids land value is computed from.
+     * @param sources Source grids; any null or mismatched source keeps
+     *                tick() on the phase stubs.
+     */
+    void set_sources(const LandValueSources& sources);
+
+    // Change notifications
+
+    /// Farthest distance at which water or road proximity changes a value
+    static constexpr int32_t FACTOR_REACH = 3;
+
+    /// Block rows recomputed every tick regardless of dirty state
+    static constexpr uint32_t RECONCILE_BLOCK_ROWS_PER_TICK = 1;
+
+    /**
+     * @brief Terrain changed; recompute the area plus FACTOR_REACH.
+     *
+     * Generated and SeaLevelChanged events dirty the whole grid.
+     */
+    void on_terrain_modified(const terrain::TerrainModifiedEvent& event);
+
+    /**
+     * @brief A pathway was placed or removed; recompute within FACTOR_REACH.
+     */
+    void on_pathway_changed(int32_t x, int32_t y);
+
+    /**
+     * @brief Mark a tile rectangle for recomputation next tick (clipped to the grid).
+     */
+    void mark_dirty(int32_t x, int32_t y, int32_t width, int32_t height);
+
+    /**
+     * @brief Mark the whole grid for recomputation next tick.
+     */
+    void mark_all_dirty();
+
+    /**
+     * @brief Number of 16x16 blocks recomputed by the last tick.
+     */
+    uint32_t get_last_recomputed_blocks() const;
+
     // Grid access
 
     /**
@@ -102,10 +201,16 @@ public:
 
 private:
     /**
-     * @brief Recalculate all land values from scratch.
-     * Stub for now; implemented by E10-105.
+     * @brief Point planes at the current source buffers.
+     * @return false if the sources are incomplete or mismatched.
+     */
+    bool gather_planes(LandValueInputPlanes& planes) const;
+
+    /**
+     * @brief Recompute the dirty blocks (all blocks after set_sources()).
+     * @return false (grid untouched) if the sources are incomplete or mismatched.
      */
-    void recalculate();
+    bool recalculate();
 
     /**
      * @brief Apply terrain-based value bonuses.
@@ -132,6 +237,14 @@ private:
     void apply_contamination_penalty();
 
     LandValueGrid m_grid;  ///< Land value grid
+    LandValueSources m_sources;  ///< Input grids (not owned)
+
+    uint32_t m_blocks_x;                   ///< Block columns
+    uint32_t m_blocks_y;                   ///< Block rows
+    std::vector<uint8_t> m_dirty_blocks;   ///< 1 = recompute next tick
+    std::vector<uint8_t> m_penalty_blocks; ///< 1 = disorder/contamination non-zero at last recompute
+    uint32_t m_reconcile_row = 0;          ///< Next block row of the reconciliation sweep
+    uint32_t m_last_recomputed_blocks = 0; ///< Blocks recomputed by the last tick
 };
 
 } // namespace landvalue
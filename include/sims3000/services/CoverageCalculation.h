@@ -12,6 +12,14 @@
  * 4. Apply linear falloff: strength = effectiveness * (1.0 - dist/radius)
  * 5. Convert to uint8_t (0-255)
  * 6. Use max-value overlap: grid[x,y] = max(grid[x,y], calculated_value)
+ *
+ * Steps 2-6 run on precomputed byte stamps: buildings are grouped by
+ * (radius, effectiveness), each group's diamond is built once with the
+ * exact per-tile values above, and stamps are blitted row by row with a
+ * vectorized max. A group dense enough that its stamps would cover the map
+ * several times over instead takes a manhattan distance transform from all
+ * of its buildings at once (O(map) per group) and maps distance through the
+ * same falloff profile. Both paths produce identical grids.
  */
 
 #pragma once
@@ -59,6 +67,42 @@ struct ServiceBuildingData {
  */
 float calculate_falloff(float effectiveness, int distance, int radius);
 
+/**
+ * @enum CoverageMethod
+ * @brief How calculate_radius_coverage() applies a group of buildings.
+ */
+enum class CoverageMethod : uint8_t {
+    Auto = 0,              ///< Pick per group by stamp area vs map area
+    Stamp = 1,             ///< Always blit per-building stamps
+    DistanceTransform = 2  ///< Always use the distance transform for in-map buildings
+};
+
+/// Auto uses the distance transform once a group's stamps would cover
+/// the map this many times over
+constexpr uint32_t DISTANCE_TRANSFORM_COVER_FACTOR = 12;
+
+/**
+ * @struct CoverageStamp
+ * @brief Precomputed coverage footprint for one (radius, effectiveness) pair.
+ */
+struct CoverageStamp {
+    int32_t radius = 0;
+    std::vector<uint8_t> profile;  ///< Coverage value by manhattan distance, [0, radius]
+    std::vector<uint8_t> mask;     ///< (2*radius+1)^2 values, row-major, building at center
+};
+
+/**
+ * @brief Build the coverage stamp for a building.
+ *
+ * Each value equals what the per-tile formula yields at that offset:
+ * round(calculate_falloff(effectiveness / 255, distance, radius) * 255).
+ *
+ * @param radius Coverage radius in tiles (<= 0 gives an empty stamp).
+ * @param effectiveness Building effectiveness (0-255).
+ * @return The stamp.
+ */
+CoverageStamp build_coverage_stamp(int radius, uint8_t effectiveness);
+
 /**
  * @brief Calculate radius-based coverage for all buildings and apply to grid.
  *
@@ -75,12 +119,42 @@ float calculate_falloff(float effectiveness, int distance, int radius);
  *
  * @param grid The coverage grid to populate (will be cleared first)
  * @param buildings Vector of service building data to calculate coverage from
+ * @param method Stamp / distance-transform selection (result is the same)
  *
  * @note Currently treats all tiles as owned by all players.
  *       TODO: Add owner_id check when zone ownership grid is implemented.
  */
 void calculate_radius_coverage(ServiceCoverageGrid& grid,
-                                const std::vector<ServiceBuildingData>& buildings);
+                                const std::vector<ServiceBuildingData>& buildings,
+                                CoverageMethod method = CoverageMethod::Auto);
+
+/**
+ * @brief Max one building's coverage into the grid without clearing it.
+ *
+ * Incremental counterpart of calculate_radius_coverage(): adding every
+ * building of a cleared grid one by one gives the same result.
+ * Inactive buildings and buildings without a radius are ignored.
+ *
+ * @param grid The coverage grid to update.
+ * @param building The building being added.
+ */
+void add_building_coverage(ServiceCoverageGrid& grid, const ServiceBuildingData& building);
+
+/**
+ * @brief Take one building's coverage back out of the grid.
+ *
+ * Only tiles where the removed building's value equals the current value
+ * (it was the max, or tied for it) can drop. Those tiles are recomputed
+ * from the providers whose diamonds reach them; every other tile is left
+ * alone, so the cost is local to the removed building.
+ *
+ * @param grid The coverage grid to update.
+ * @param removed The building being removed (as it was when added).
+ * @param providers The grid's buildings after the removal.
+ */
+void remove_building_coverage(ServiceCoverageGrid& grid,
+                              const ServiceBuildingData& removed,
+                              const std::vector<ServiceBuildingData>& providers);
 
 } // namespace services
 } // namespace sims3000
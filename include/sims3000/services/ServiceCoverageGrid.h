@@ -117,6 +117,18 @@ public:
      */
     bool is_valid(uint32_t x, uint32_t y) const;
 
+    /**
+     * @brief Get the row-major cell array (width * height bytes).
+     *
+     * For bulk writers such as the coverage stamp blitter.
+     *
+     * @return Pointer to the first cell.
+     */
+    const uint8_t* get_raw_data() const;
+
+    /** @copydoc get_raw_data() const */
+    uint8_t* get_raw_data();
+
 private:
     /**
      * @brief Calculate the linear index for a coordinate pair.
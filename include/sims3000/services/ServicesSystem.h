@@ -9,6 +9,12 @@
  * E9-011: Per-type-per-player dirty flags and lazy-allocated coverage grids.
  * Only recalculates coverage for grids marked dirty.
  *
+ * Service buildings are kept in a provider registry per type+player, fed
+ * by ServiceBuildingPlacedEvent / ServiceBuildingRemovedEvent. Placing,
+ * removing or re-powering one provider queues a single-stamp update that
+ * the next tick applies to its grid; only grids marked dirty are rebuilt
+ * from the whole registry.
+ *
  * Implements ISimulatable at priority 55.
  * Runs after PopulationSystem (50), before EconomySystem (60).
  *
@@ -19,16 +25,24 @@
 
 #include <sims3000/core/ISimulatable.h>
 #include <sims3000/services/ServiceTypes.h>
+#include <sims3000/services/CoverageCalculation.h>
 #include <array>
 #include <cstdint>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace sims3000 {
+namespace sim {
+class TaskScheduler;  // forward declaration
+}
+
 namespace services {
 
-// Forward declaration - will be implemented in a later ticket
+// Forward declarations
 class ServiceCoverageGrid;
+struct ServiceBuildingPlacedEvent;
+struct ServiceBuildingRemovedEvent;
 
 /**
  * @class ServicesSystem
@@ -73,6 +87,14 @@ public:
      */
     const char* getName() const override { return "ServicesSystem"; }
 
+    /**
+     * @brief Declare tick() data access for the parallel scheduler.
+     * @return Reads service building entities; writes service coverage grids.
+     */
+    SystemAccess getAccess() const override {
+        return SystemAccess::declare(SimResource::Entities, SimResource::ServiceCoverage);
+    }
+
     // =========================================================================
     // Lifecycle
     // =========================================================================
@@ -91,7 +113,7 @@ public:
     /**
      * @brief Clean up all system state.
      *
-     * Releases coverage grids and clears tracked entities.
+     * Releases coverage grids, tracked entities and registered providers.
      */
     void cleanup();
 
@@ -102,8 +124,10 @@ public:
     /**
      * @brief Handle a building being constructed.
      *
-     * Adds the service building entity to per-player tracking vectors
-     * and marks coverage as dirty for recalculation.
+     * Adds the service building entity to per-player tracking vectors.
+     * A registered provider already has its stamp queued by
+     * on_service_building_placed(); for any other entity the service type
+     * is unknown, so every type is marked dirty for the owner.
      *
      * Will later subscribe to BuildingConstructedEvent.
      *
@@ -115,8 +139,9 @@ public:
     /**
      * @brief Handle a building being deconstructed/demolished.
      *
-     * Removes the service building entity from per-player tracking vectors
-     * and marks coverage as dirty for recalculation.
+     * Removes the service building entity from per-player tracking vectors.
+     * A registered provider is unregistered and only its own type+player
+     * grid is updated; otherwise every type is marked dirty for the owner.
      *
      * Will later subscribe to BuildingDeconstructedEvent.
      *
@@ -128,8 +153,9 @@ public:
     /**
      * @brief Handle a building's power state changing.
      *
-     * Marks coverage as dirty so effectiveness is recalculated
-     * on the next tick.
+     * A registered provider has its stamp re-applied to its own type+player
+     * grid on the next tick; otherwise every type is marked dirty for the
+     * owner.
      *
      * Will later subscribe to power change events.
      *
@@ -138,6 +164,60 @@ public:
      */
     void on_building_power_changed(uint32_t entity_id, uint8_t owner_id);
 
+    // =========================================================================
+    // Provider Registry
+    // =========================================================================
+
+    /**
+     * @brief Register a placed service building as a coverage provider.
+     *
+     * The provider starts active at full effectiveness. Its stamp is added
+     * to its type+player grid on the next tick. Already-registered entity
+     * IDs and invalid owners are ignored.
+     *
+     * @param event The placement event.
+     */
+    void on_service_building_placed(const ServiceBuildingPlacedEvent& event);
+
+    /**
+     * @brief Unregister a removed service building.
+     *
+     * The provider is looked up by entity_id; its coverage is taken out of
+     * its grid on the next tick. Unknown entity IDs are ignored.
+     *
+     * @param event The removal event.
+     */
+    void on_service_building_removed(const ServiceBuildingRemovedEvent& event);
+
+    /**
+     * @brief Update a provider's effectiveness and operational state.
+     *
+     * Queues the old stamp's removal and the new stamp's addition.
+     * No-op for unknown entity IDs or an unchanged state.
+     *
+     * @param entity_id The provider's entity ID.
+     * @param effectiveness New effectiveness (0-255).
+     * @param is_active Whether the provider is operational (powered, staffed).
+     * @return true if the provider is registered.
+     */
+    bool set_provider_state(uint32_t entity_id, uint8_t effectiveness, bool is_active);
+
+    /**
+     * @brief Get the registered providers of a service type for a player.
+     *
+     * @param type The service type.
+     * @param player_id The player ID.
+     * @return The providers (empty for invalid arguments).
+     */
+    const std::vector<ServiceBuildingData>& get_providers(ServiceType type, uint8_t player_id) const;
+
+    /**
+     * @brief Number of whole-grid rebuilds since init().
+     *
+     * Single-provider updates do not count.
+     */
+    uint32_t get_full_rebuild_count() const { return m_full_rebuild_count; }
+
     // =========================================================================
     // Dirty Flag Management (E9-011)
     // =========================================================================
@@ -164,6 +244,8 @@ public:
     /**
      * @brief Check if a specific service type's coverage is dirty for a player.
      *
+     * Queued single-provider updates count as dirty.
+     *
      * @param type The service type to check.
      * @param player_id The player to check.
      * @return true if coverage needs recalculation.
@@ -174,12 +256,22 @@ public:
      * @brief Recalculate coverage for all dirty grids.
      *
      * Iterates all type+player combinations and recalculates any
-     * that are marked dirty. Marks them clean after recalculation.
+     * that are marked dirty from the provider registry. Marks them clean
+     * after recalculation. Clean grids with queued provider updates apply
+     * them stamp by stamp instead. Grids are independent, so with a task
+     * scheduler set they are updated in parallel.
      *
      * Called automatically from tick().
      */
     void recalculate_if_dirty();
 
+    /**
+     * @brief Recalculate dirty grids on a worker pool (nullptr = tick thread).
+     *
+     * Not owned. Must not be the scheduler that is running this tick.
+     */
+    void set_task_scheduler(sim::TaskScheduler* scheduler);
+
     // =========================================================================
     // Queries
     // =========================================================================
@@ -224,6 +316,7 @@ private:
     uint32_t m_map_width = 0;
     uint32_t m_map_height = 0;
     bool m_initialized = false;
+    sim::TaskScheduler* m_scheduler = nullptr;
 
     /// Per-player tracked service building entity IDs
     /// Index 0 = player 0, up to MAX_PLAYERS-1
@@ -236,6 +329,42 @@ private:
     /// Per-player, per-type dirty flags
     /// Indexed as [SERVICE_TYPE][PLAYER_ID]
     bool m_dirty[SERVICE_TYPE_COUNT][MAX_PLAYERS] = {};
+
+    /// A queued single-provider grid update
+    struct ProviderUpdate {
+        ServiceBuildingData data;  ///< Provider state being added or removed
+        bool add;                  ///< true = add stamp, false = remove it
+    };
+
+    /// Where a registered provider lives in m_providers
+    struct ProviderSlot {
+        uint8_t type;
+        uint8_t owner;
+        uint32_t index;
+    };
+
+    /// Registered providers, indexed as [SERVICE_TYPE][PLAYER_ID]
+    std::vector<ServiceBuildingData> m_providers[SERVICE_TYPE_COUNT][MAX_PLAYERS];
+
+    /// Entity ID of each m_providers entry
+    std::vector<uint32_t> m_provider_ids[SERVICE_TYPE_COUNT][MAX_PLAYERS];
+
+    /// Entity ID -> registry slot
+    std::unordered_map<uint32_t, ProviderSlot> m_provider_slots;
+
+    /// Updates to apply on the next tick, indexed as [SERVICE_TYPE][PLAYER_ID]
+    std::vector<ProviderUpdate> m_pending[SERVICE_TYPE_COUNT][MAX_PLAYERS];
+
+    uint32_t m_full_rebuild_count = 0;
+
+    /// Unregister a provider; returns false if entity_id is not registered
+    bool remove_provider(uint32_t entity_id);
+
+    /// Queue a provider update, or mark the grid dirty if it has no grid yet
+    void queue_update(uint8_t type, uint8_t player_id, const ServiceBuildingData& data, bool add);
+
+    /// Drop every provider and queued update
+    void clear_providers();
 };
 
 } // namespace services
@@ -10,7 +10,17 @@
  * Implements ISimulationTime to provide read-only timing information
  * to systems during their tick() calls.
  *
+ * Systems are grouped into stages from their declared SystemAccess:
+ * a system's stage is one past the latest stage of any higher-priority
+ * system it conflicts with. With worker threads enabled, the systems of
+ * a stage run concurrently on a TaskScheduler; stages run in order.
+ * Conflicting systems therefore keep their serial priority order and
+ * the tick result is identical to a serial run. Without workers (the
+ * default) every system runs on the calling thread in priority order.
+ *
  * @see ISimulatable
+ * @see SystemAccess
+ * @see TaskScheduler
  * @see ISimulationTime
  */
 
@@ -21,8 +31,10 @@
 #include "sims3000/core/ISimulationTime.h"
 #include "sims3000/sim/SimulationSpeed.h"
 #include "sims3000/sim/SimulationEvents.h"
+#include "sims3000/sim/TaskScheduler.h"
 
 #include <algorithm>
+#include <memory>
 #include <vector>
 
 namespace sims3000 {
@@ -75,6 +87,36 @@ public:
      */
     size_t system_count() const;
 
+    // =========================================================================
+    // Parallel scheduling
+    // =========================================================================
+
+    /**
+     * @brief Set the number of worker threads used to tick independent systems.
+     *
+     * 0 (the default) disables the pool and ticks every system serially
+     * on the calling thread.
+     *
+     * @param count Number of background worker threads.
+     */
+    void set_worker_count(uint32_t count);
+
+    /**
+     * @brief Get the number of worker threads.
+     * @return Worker thread count (0 when running serially).
+     */
+    uint32_t get_worker_count() const;
+
+    /**
+     * @brief Get the number of stages in the current schedule.
+     *
+     * The schedule is rebuilt lazily on the first update() after the
+     * system list changes.
+     *
+     * @return Stage count (equals system_count() when nothing can overlap).
+     */
+    size_t get_stage_count() const;
+
     // =========================================================================
     // Speed control (E10-002)
     // =========================================================================
@@ -175,12 +217,28 @@ public:
     double getTotalTime() const override;
 
 private:
+    /**
+     * @brief Sort systems by priority and group them into conflict-free stages.
+     */
+    void rebuild_schedule();
+
+    /**
+     * @brief Tick every system once, stage by stage.
+     */
+    void run_systems();
+
     /// Registered systems (sorted by priority before ticking)
     std::vector<ISimulatable*> m_systems;
 
     /// Whether the system list needs re-sorting
     bool m_sorted = false;
 
+    /// Systems grouped into stages; systems within a stage may run concurrently
+    std::vector<std::vector<ISimulatable*>> m_stages;
+
+    /// Worker pool for concurrent stages (nullptr = serial)
+    std::unique_ptr<TaskScheduler> m_scheduler;
+
     /// Accumulated time from update() calls (seconds)
     float m_accumulator = 0.0f;
 
@@ -0,0 +1,120 @@
+/**
+ * @file TaskScheduler.h
+ * @brief Work-stealing thread pool for intra-tick parallelism.
+ *
+ * TaskScheduler owns a fixed set of worker threads, each with its own
+ * task deque. A batch submitted via parallel_for() is dealt round-robin
+ * across the deques (including one for the calling thread); a thread
+ * pops from the back of its own deque and, when empty, steals from the
+ * front of the others. The calling thread participates in the batch
+ * and parallel_for() returns only after every task has finished.
+ *
+ * The pool is fork-join only: tasks must not call parallel_for() on the
+ * same scheduler.
+ *
+ * @see SimulationCore
+ */
+
+#ifndef SIMS3000_SIM_TASKSCHEDULER_H
+#define SIMS3000_SIM_TASKSCHEDULER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sims3000 {
+namespace sim {
+
+/**
+ * @class TaskScheduler
+ * @brief Fixed-size work-stealing pool with a blocking parallel_for.
+ */
+class TaskScheduler {
+public:
+    /**
+     * @brief Create a scheduler with the given number of worker threads.
+     *
+     * A worker count of 0 creates no threads; parallel_for() then runs
+     * every task on the calling thread in index order.
+     *
+     * @param worker_count Number of background worker threads.
+     */
+    explicit TaskScheduler(uint32_t worker_count);
+
+    /**
+     * @brief Stop and join all worker threads.
+     */
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    /**
+     * @brief Run fn(i) for every i in [0, count) and wait for completion.
+     *
+     * If any task throws, the first exception is rethrown on the calling
+     * thread after the whole batch has finished.
+     *
+     * @param count Number of tasks.
+     * @param fn Task body, invoked once per index.
+     */
+    void parallel_for(size_t count, const std::function<void(size_t)>& fn);
+
+    /**
+     * @brief Get the number of background worker threads.
+     * @return Worker thread count (the caller thread is not included).
+     */
+    uint32_t worker_count() const;
+
+    /**
+     * @brief Get the number of tasks executed by stealing since creation.
+     * @return Steal count (diagnostic only).
+     */
+    uint64_t steal_count() const;
+
+private:
+    /// A single queued task: index into the active batch.
+    struct Task {
+        size_t index;
+    };
+
+    /// Per-thread task deque. Owner pops back, thieves pop front.
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    void worker_loop(uint32_t queue_index);
+    bool try_pop_own(uint32_t queue_index, Task& out);
+    bool try_steal(uint32_t thief_index, Task& out);
+    void run_task(const Task& task);
+
+    std::vector<std::unique_ptr<WorkerQueue>> m_queues;  ///< [0] = caller, [1..] = workers
+    std::vector<std::thread> m_threads;
+
+    std::mutex m_wake_mutex;
+    std::condition_variable m_wake_cv;      ///< Workers sleep here between batches
+    std::condition_variable m_done_cv;      ///< Caller sleeps here until batch completes
+    uint64_t m_batch_generation = 0;        ///< Incremented per batch (guarded by m_wake_mutex)
+    bool m_stopping = false;                ///< Set in destructor (guarded by m_wake_mutex)
+
+    const std::function<void(size_t)>* m_batch_fn = nullptr;  ///< Active batch body
+    std::atomic<size_t> m_remaining{0};     ///< Unfinished tasks in the active batch
+    std::atomic<uint64_t> m_steals{0};
+
+    std::mutex m_error_mutex;
+    std::exception_ptr m_first_error;
+};
+
+} // namespace sim
+} // namespace sims3000
+
+#endif // SIMS3000_SIM_TASKSCHEDULER_H
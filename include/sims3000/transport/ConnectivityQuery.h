@@ -74,8 +74,8 @@ public:
      * @param y Y coordinate.
      * @return The network_id at the position, or 0 if no pathway exists there.
      */
-    uint16_t get_network_id_at(const PathwayGrid& grid, const NetworkGraph& graph,
-                                int32_t x, int32_t y) const;
+    NetworkId get_network_id_at(const PathwayGrid& grid, const NetworkGraph& graph,
+                                 int32_t x, int32_t y) const;
 };
 
 } // namespace transport
@@ -7,13 +7,20 @@
  *
  * Cost = base_cost(type) + congestion_penalty + decay_penalty
  *
+ * EdgeCostPlane stores that cost per tile in a dense row-major array so
+ * pathfinding can weight steps without touching component maps, and
+ * tracks the cheapest stored cost for an admissible A* heuristic.
+ *
  * Uses canonical alien terminology per /docs/canon/terminology.yaml
  */
 
 #pragma once
 
 #include <sims3000/transport/TransportEnums.h>
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <vector>
 
 namespace sims3000 {
 namespace transport {
@@ -72,5 +79,111 @@ inline uint32_t calculate_edge_cost(PathwayType type, uint8_t congestion_level,
     return base + congestion_penalty + decay_penalty;
 }
 
+/**
+ * @class EdgeCostPlane
+ * @brief Dense per-tile cost of entering a pathway tile.
+ *
+ * A value of 0 means "no cost recorded" (no pathway, or not yet set).
+ * A histogram of stored costs keeps min_cost() O(1) amortized, so a
+ * heuristic of manhattan_distance * min_cost() stays admissible as
+ * congestion raises and lowers individual tiles.
+ */
+class EdgeCostPlane {
+public:
+    EdgeCostPlane() = default;
+
+    /**
+     * @brief Construct an empty plane for a width x height grid.
+     */
+    EdgeCostPlane(uint32_t width, uint32_t height)
+        : width_(width)
+        , height_(height)
+        , costs_(static_cast<size_t>(width) * height, 0)
+    {
+    }
+
+    uint32_t width() const { return width_; }
+    uint32_t height() const { return height_; }
+
+    /**
+     * @brief Cost of entering (x, y), or 0 if unset / out of bounds.
+     */
+    uint16_t get_cost(int32_t x, int32_t y) const {
+        if (!in_bounds(x, y)) {
+            return 0;
+        }
+        return costs_[index(x, y)];
+    }
+
+    /**
+     * @brief Set the cost of entering (x, y). A cost of 0 clears the tile.
+     * @return true if the stored value changed.
+     */
+    bool set_cost(int32_t x, int32_t y, uint16_t cost) {
+        if (!in_bounds(x, y)) {
+            return false;
+        }
+        uint16_t& slot = costs_[index(x, y)];
+        if (slot == cost) {
+            return false;
+        }
+        if (slot != 0) {
+            --counts_[slot];
+        }
+        if (cost != 0) {
+            if (cost >= counts_.size()) {
+                counts_.resize(static_cast<size_t>(cost) + 1, 0);
+            }
+            ++counts_[cost];
+            if (min_cost_ == 0 || cost < min_cost_) {
+                min_cost_ = cost;
+            }
+        }
+        if (slot == min_cost_ && counts_[slot] == 0) {
+            // Cheapest bucket emptied; find the next one up
+            min_cost_ = 0;
+            for (size_t c = static_cast<size_t>(slot) + 1; c < counts_.size(); ++c) {
+                if (counts_[c] != 0) {
+                    min_cost_ = static_cast<uint16_t>(c);
+                    break;
+                }
+            }
+        }
+        slot = cost;
+        return true;
+    }
+
+    /** @brief Clear the cost at (x, y). */
+    void clear_cost(int32_t x, int32_t y) { set_cost(x, y, 0); }
+
+    /**
+     * @brief Smallest non-zero cost currently stored (0 if the plane is empty).
+     */
+    uint16_t min_cost() const { return min_cost_; }
+
+    /** @brief Clear every tile. */
+    void clear() {
+        std::fill(costs_.begin(), costs_.end(), static_cast<uint16_t>(0));
+        counts_.clear();
+        min_cost_ = 0;
+    }
+
+private:
+    bool in_bounds(int32_t x, int32_t y) const {
+        return x >= 0 && y >= 0 &&
+               static_cast<uint32_t>(x) < width_ && static_cast<uint32_t>(y) < height_;
+    }
+
+    size_t index(int32_t x, int32_t y) const {
+        return static_cast<size_t>(y) * width_ + static_cast<size_t>(x);
+    }
+
+    uint32_t width_ = 0;
+    uint32_t height_ = 0;
+    std::vector<uint16_t> costs_;      ///< Row-major cost per tile (0 = unset)
+    std::vector<uint32_t> counts_;     ///< Number of tiles holding each cost
+    uint16_t min_cost_ = 0;            ///< Smallest cost with a non-zero count
+};
+
 } // namespace transport
 } // namespace sims3000
@@ -8,11 +8,19 @@
  *
  * No per-vehicle simulation (CCR-006). Flow is aggregate only.
  *
+ * Two forms are provided: propagate() over a sparse position -> flow map,
+ * and propagate() over a FlowPlane, a dense double-buffered grid that
+ * keeps a per-tile neighbour mask and a compact list of pathway tiles in
+ * step with placement and removal. The dense form gives the same result
+ * without per-tick allocation or hash lookups, and its cost follows the
+ * pathway count rather than the map size.
+ *
  * Uses canonical alien terminology per /docs/canon/terminology.yaml
  */
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <unordered_map>
 #include <vector>
@@ -21,6 +29,7 @@ namespace sims3000 {
 namespace transport {
 
 class PathwayGrid;  // forward declaration
+class FlowPropagation;  // forward declaration
 
 /**
  * @struct FlowPropagationConfig
@@ -30,6 +39,106 @@ struct FlowPropagationConfig {
     float spread_rate = 0.20f;  ///< Fraction of flow that spreads to neighbors per tick (20%)
 };
 
+/// FlowPlane neighbour mask bits (pathway present in that direction)
+constexpr uint8_t FLOW_NEIGHBOR_N = 1u << 0;
+constexpr uint8_t FLOW_NEIGHBOR_S = 1u << 1;
+constexpr uint8_t FLOW_NEIGHBOR_E = 1u << 2;
+constexpr uint8_t FLOW_NEIGHBOR_W = 1u << 3;
+
+/**
+ * @class FlowPlane
+ * @brief Dense double-buffered flow storage for pathway tiles.
+ *
+ * Flow lives in two planes padded by a one-tile zero border, so the
+ * diffusion kernel reads all four neighbours without bounds checks and
+ * writes the other plane. Each pathway tile also has a slot in a compact
+ * list; slots let callers keep parallel per-pathway arrays:
+ * - add_tile() appends a slot (the new tile_count() - 1).
+ * - remove_tile() moves the last slot into the freed one, like a
+ *   vector swap-and-pop, so mirror it the same way.
+ *
+ * Non-pathway tiles always hold zero flow.
+ */
+class FlowPlane {
+public:
+    /// get_slot() result for tiles without a pathway
+    static constexpr uint32_t NO_SLOT = UINT32_MAX;
+
+    FlowPlane() = default;
+
+    /**
+     * @brief Construct an empty plane for a width x height map.
+     */
+    FlowPlane(uint32_t width, uint32_t height);
+
+    /**
+     * @brief Register a pathway tile (no-op if present or out of bounds).
+     *
+     * Starts at zero flow and updates the neighbour masks around it.
+     */
+    void add_tile(int32_t x, int32_t y);
+
+    /**
+     * @brief Unregister a pathway tile and drop its flow.
+     */
+    void remove_tile(int32_t x, int32_t y);
+
+    bool has_tile(int32_t x, int32_t y) const;
+
+    /** @brief Slot of a pathway tile, or NO_SLOT. */
+    uint32_t get_slot(int32_t x, int32_t y) const;
+
+    /** @brief Number of pathway tiles (slots are 0..tile_count()-1). */
+    uint32_t tile_count() const;
+
+    /** @brief Tile index (y * width + x) held by a slot. */
+    uint32_t get_slot_tile(uint32_t slot) const;
+
+    /** @brief FLOW_NEIGHBOR_* bits for pathway neighbours of (x, y). */
+    uint8_t get_neighbor_mask(int32_t x, int32_t y) const;
+
+    /** @brief Current flow at (x, y); 0 for non-pathway tiles. */
+    uint32_t get_flow(int32_t x, int32_t y) const;
+
+    /** @brief Set current flow at a pathway tile (ignored elsewhere). */
+    void set_flow(int32_t x, int32_t y, uint32_t flow);
+
+    uint32_t get_slot_flow(uint32_t slot) const;
+    void set_slot_flow(uint32_t slot, uint32_t flow);
+
+    /** @brief Zero the current flow of every pathway tile. */
+    void clear_flow();
+
+    uint32_t width() const { return width_; }
+    uint32_t height() const { return height_; }
+
+private:
+    friend class FlowPropagation;
+
+    bool in_bounds(int32_t x, int32_t y) const;
+    std::size_t padded_index(int32_t x, int32_t y) const;
+
+    uint32_t width_ = 0;
+    uint32_t height_ = 0;
+    uint32_t padded_width_ = 0;            ///< width_ + 2
+
+    std::vector<uint32_t> flow_[2];        ///< Padded flow planes; flow_[front_] is current
+    uint32_t front_ = 0;
+    std::vector<uint32_t> road_;           ///< Padded: UINT32_MAX on pathway tiles, else 0
+    std::vector<uint32_t> share_;          ///< Padded kernel scratch: flow sent to each neighbour
+    std::vector<uint32_t> spent_;          ///< Padded kernel scratch: flow leaving each tile
+    std::vector<uint8_t> neighbor_mask_;   ///< Per tile FLOW_NEIGHBOR_* bits
+    std::vector<uint32_t> slot_of_;        ///< Per tile slot, or NO_SLOT
+
+    std::vector<uint32_t> slot_tiles_;     ///< Per slot tile index
+    std::vector<uint32_t> slot_padded_;    ///< Per slot padded index
+
+    // Per row pathway count and column span; the kernel visits only spans
+    std::vector<uint32_t> row_count_;
+    std::vector<int32_t> row_min_x_;
+    std::vector<int32_t> row_max_x_;
+};
+
 /**
  * @class FlowPropagation
  * @brief Propagates traffic flow across connected pathways via diffusion.
@@ -64,6 +173,23 @@ public:
         const FlowPropagationConfig& config = FlowPropagationConfig{}
     );
 
+    /**
+     * @brief Propagate flow across a dense plane in place.
+     *
+     * Same model and integer rounding as the map form, computed as a
+     * gather: each tile keeps its flow minus what it spread, plus the
+     * per-neighbour share of each pathway neighbour. Cost is linear in
+     * the pathway tiles (and the row spans they occupy); nothing is
+     * allocated. spread_rate is expected in [0, 1].
+     *
+     * @param plane  Flow plane; the result becomes its current flow.
+     * @param config Propagation configuration (spread rate).
+     */
+    void propagate(
+        FlowPlane& plane,
+        const FlowPropagationConfig& config = FlowPropagationConfig{}
+    );
+
 private:
     /**
      * @brief Get connected neighbor positions with pathways (N/S/E/W).
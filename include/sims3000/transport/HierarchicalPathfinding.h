@@ -0,0 +1,210 @@
+/**
+ * @file HierarchicalPathfinding.h
+ * @brief Chunked (HPA*) pathfinding over the pathway grid
+ *
+ * Partitions the PathwayGrid into PATH_CHUNK_SIZE x PATH_CHUNK_SIZE chunks.
+ * Every run of pathway tiles crossing a chunk border gets one portal tile
+ * on each side (the middle of the run), and each chunk caches the
+ * in-chunk travel cost between all of its portals.
+ *
+ * A query searches the small portal graph first, then refines only the
+ * chunks on the chosen route by walking the per-portal BFS trees cached
+ * with the costs. Routes inside one chunk fall back to flat A*
+ * (Pathfinding).
+ *
+ * Results are near-optimal: a route that would briefly leave a chunk and
+ * re-enter it is not captured by the cached in-chunk costs, and crossings
+ * are pinned to run midpoints. Reachability matches flat A* exactly.
+ *
+ * Chunks are rebuilt lazily: on_pathway_placed()/on_pathway_removed()
+ * mark the touched chunk (and its neighbour across a border) dirty, and
+ * the next query rebuilds only dirty chunks.
+ *
+ * Uses canonical alien terminology per /docs/canon/terminology.yaml
+ */
+
+#pragma once
+
+#include <sims3000/transport/Pathfinding.h>
+#include <sims3000/transport/TransportEvents.h>
+#include <cstdint>
+#include <vector>
+
+namespace sims3000 {
+namespace transport {
+
+/// log2 of the pathfinding chunk edge length
+constexpr uint32_t PATH_CHUNK_SHIFT = 4;
+
+/// Pathfinding chunk edge length in tiles
+constexpr uint32_t PATH_CHUNK_SIZE = 1u << PATH_CHUNK_SHIFT;
+
+/**
+ * @class HierarchicalPathfinding
+ * @brief Portal-graph route planner with lazy per-chunk updates.
+ *
+ * Holds its own search scratch, so keep one instance per thread and
+ * reuse it across queries (same as Pathfinding).
+ */
+class HierarchicalPathfinding {
+public:
+    HierarchicalPathfinding() = default;
+
+    /**
+     * @brief Construct a planner for a width x height grid (all chunks dirty).
+     *
+     * A planner sized differently from the grid passed to find_path()
+     * re-sizes itself on that query.
+     */
+    HierarchicalPathfinding(uint32_t width, uint32_t height);
+
+    /**
+     * @brief Find a route using the portal graph.
+     *
+     * Same validation and network_id early exit as Pathfinding::find_path().
+     *
+     * @param start Starting grid position (must be a pathway tile).
+     * @param end   Ending grid position (must be a pathway tile).
+     * @param grid  PathwayGrid for tile lookups.
+     * @param graph NetworkGraph for connectivity (network_id) checks.
+     * @return PathResult with found flag, full tile path, and total cost.
+     */
+    PathResult find_path(
+        const GridPosition& start,
+        const GridPosition& end,
+        const PathwayGrid& grid,
+        const NetworkGraph& graph
+    );
+
+    /**
+     * @brief Mark the chunks affected by a tile change as dirty.
+     *
+     * Marks the tile's chunk, plus the neighbouring chunk when the tile
+     * lies on a chunk border (its portal runs are shared).
+     */
+    void on_pathway_changed(int32_t x, int32_t y);
+
+    /** @brief on_pathway_changed() for a placed pathway. */
+    void on_pathway_placed(const PathwayPlacedEvent& event);
+
+    /** @brief on_pathway_changed() for a removed pathway. */
+    void on_pathway_removed(const PathwayRemovedEvent& event);
+
+    /** @brief Mark every chunk dirty (e.g. after loading a save). */
+    void mark_all_dirty();
+
+    /**
+     * @brief Rebuild portals and in-chunk costs for all dirty chunks.
+     *
+     * Called by find_path(); public so callers can pay the cost up front.
+     */
+    void rebuild_dirty_chunks(const PathwayGrid& grid);
+
+    /** @brief Number of chunks waiting for a rebuild. */
+    uint32_t get_dirty_chunk_count() const;
+
+    /** @brief Number of portal tiles across all clean chunks. */
+    uint32_t get_portal_count() const;
+
+private:
+    /// Cached portal data for one chunk
+    struct Chunk {
+        std::vector<GridPosition> portals;  ///< Portal tiles, indexed by slot
+        std::vector<uint32_t> costs;    ///< portals.size()^2 in-chunk costs (UINT32_MAX = unreachable)
+        std::vector<uint8_t> toward;    ///< portals.size() * CHUNK_TILES: direction of the next step toward each portal
+        bool dirty = true;
+    };
+
+    /// Portal-graph open-set entry
+    struct HeapEntry {
+        uint32_t f_cost;
+        uint32_t g_cost;
+        uint32_t node;
+    };
+
+    /// Per-node search state; valid when the stamp equals generation_
+    struct NodeState {
+        uint32_t seen = 0;
+        uint32_t closed = 0;
+        uint32_t g_cost = 0;
+        uint32_t parent = 0;
+    };
+
+    /// Tiles per chunk (scratch array size)
+    static constexpr uint32_t CHUNK_TILES = PATH_CHUNK_SIZE * PATH_CHUNK_SIZE;
+
+    /// Upper bound on portals per chunk: 4 sides of at most 8 separate runs
+    static constexpr uint32_t MAX_CHUNK_PORTALS = 4 * (PATH_CHUNK_SIZE / 2);
+
+    /// portal_slot_ value for tiles that are not portals
+    static constexpr uint8_t NO_PORTAL = UINT8_MAX;
+
+    void resize(uint32_t width, uint32_t height);
+    void mark_chunk_dirty(uint32_t cx, uint32_t cy);
+    void rebuild_chunk(const PathwayGrid& grid, uint32_t cx, uint32_t cy);
+
+    /**
+     * @brief Add the run midpoints along one chunk side as portals.
+     *
+     * Walks tiles (x0 + k*step_x, y0 + k*step_y) for k < length and
+     * their neighbours offset by (across_x, across_y) in the next chunk.
+     */
+    void collect_border_portals(const PathwayGrid& grid, uint32_t chunk_index,
+                                int32_t x0, int32_t y0, int32_t step_x, int32_t step_y,
+                                uint32_t length, int32_t across_x, int32_t across_y);
+
+    /**
+     * @brief BFS from a tile through pathway tiles of its own chunk.
+     *
+     * Fills bfs_dist_ (steps, UINT32_MAX if unreached) and bfs_back_
+     * (direction of the step back toward the source), both indexed by
+     * local tile (ly * PATH_CHUNK_SIZE + lx).
+     */
+    void chunk_bfs(const PathwayGrid& grid, const GridPosition& source);
+
+    uint32_t chunk_of(const GridPosition& pos) const;
+    static uint32_t local_of(const GridPosition& pos);
+    uint32_t tile_of(const GridPosition& pos) const;
+
+    /**
+     * @brief Append the route from -> to (excluding from) to path.
+     *
+     * Tiles in different chunks are an adjacent border crossing; otherwise
+     * the walk follows back, the BFS tree rooted at to.
+     */
+    void refine_segment(const GridPosition& from, const GridPosition& to,
+                        const uint8_t* back, std::vector<GridPosition>& path) const;
+
+    void heap_push(const HeapEntry& entry);
+    HeapEntry heap_pop();
+
+    /// std heap comparator: lower f on top, then deeper g
+    static bool heap_after(const HeapEntry& a, const HeapEntry& b);
+
+    uint32_t width_ = 0;
+    uint32_t height_ = 0;
+    uint32_t chunks_x_ = 0;
+    uint32_t chunks_y_ = 0;
+    std::vector<Chunk> chunks_;
+    std::vector<uint32_t> dirty_chunks_;   ///< Indices of chunks with dirty set
+    std::vector<uint8_t> portal_slot_;     ///< Per tile: index in its chunk's portals, or NO_PORTAL
+
+    // Chunk BFS scratch
+    uint32_t bfs_dist_[CHUNK_TILES];
+    uint8_t bfs_back_[CHUNK_TILES];
+    uint16_t bfs_queue_[CHUNK_TILES];
+    uint32_t goal_dist_[CHUNK_TILES];      ///< Distances to the query end within its chunk
+    uint8_t goal_back_[CHUNK_TILES];       ///< Steps toward the query end within its chunk
+
+    // Portal-graph search scratch. Node id = chunk * MAX_CHUNK_PORTALS + slot,
+    // followed by one start and one end node for the current query.
+    std::vector<NodeState> nodes_;
+    std::vector<HeapEntry> heap_;
+    std::vector<uint32_t> route_;          ///< Abstract route (node ids), end to start
+    uint32_t generation_ = 0;
+
+    Pathfinding flat_;                     ///< Fallback for routes inside one chunk
+};
+
+} // namespace transport
+} // namespace sims3000
@@ -7,13 +7,25 @@
  * connections between adjacent road tiles. Connected component IDs are assigned
  * via BFS to enable O(1) connectivity queries.
  *
+ * Node indices and network IDs are 32-bit so a fully paved 512x512 map
+ * (262,144 tiles) fits. Positions map to nodes through a dense
+ * tile-indexed array rather than a hash map.
+ *
+ * Edges come from one of two sources. Graphs built from tiles
+ * (rebuild_from_grid(), add_pathway_tile()) keep a fixed 4-slot neighbor
+ * list per node that tile edits patch in O(1). Graphs built with
+ * add_edge() keep compressed sparse row arrays (one offsets array plus
+ * one flat neighbor array). A graph cannot mix the two.
+ *
  * @see /docs/epics/epic-7/tickets.md (ticket E7-008)
  */
 
 #pragma once
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <utility>
 #include <vector>
-#include <unordered_map>
 
 namespace sims3000 {
 namespace transport {
@@ -42,17 +54,43 @@ struct GridPositionHash {
     }
 };
 
+/// Index of a node in a NetworkGraph
+using NodeIndex = uint32_t;
+
+/// Connected component ID (0 = unassigned)
+using NetworkId = uint32_t;
+
+/// Returned by NetworkGraph::get_node_index() for positions without a node
+constexpr NodeIndex INVALID_NODE_INDEX = UINT32_MAX;
+
+/**
+ * @struct NodeSpan
+ * @brief Read-only view of one node's neighbor indices.
+ */
+struct NodeSpan {
+    const NodeIndex* first = nullptr;
+    const NodeIndex* last = nullptr;
+
+    const NodeIndex* begin() const { return first; }
+    const NodeIndex* end() const { return last; }
+    size_t size() const { return static_cast<size_t>(last - first); }
+    bool empty() const { return first == last; }
+    NodeIndex operator[](size_t i) const { return first[i]; }
+};
+
 /**
  * @struct NetworkNode
  * @brief A node in the transport network graph.
  *
  * Stores the grid position, indices of neighboring nodes, and the
  * connected component network_id (assigned by assign_network_ids).
+ * Returned by value from NetworkGraph::get_node(); neighbor_indices
+ * points into the graph and is invalidated by any graph edit.
  */
 struct NetworkNode {
     GridPosition position;
-    std::vector<uint16_t> neighbor_indices;
-    uint16_t network_id = 0;
+    NodeSpan neighbor_indices;
+    NetworkId network_id = 0;
 };
 
 /**
@@ -79,17 +117,30 @@ public:
 
     /**
      * @brief Add a node at the given grid position.
-     * @param pos The grid position for the new node.
-     * @return Index of the newly added node.
+     *
+     * The tile index grows to cover the position; rebuild_from_grid()
+     * sizes it to the grid up front. In a tile-built graph the node is
+     * linked to its N/S/E/W nodes (network IDs are not updated).
+     *
+     * @param pos The grid position for the new node (must be non-negative).
+     * @return Index of the newly added (or existing) node, or
+     *         INVALID_NODE_INDEX for a negative position.
      */
-    uint16_t add_node(const GridPosition& pos);
+    NodeIndex add_node(const GridPosition& pos);
 
     /**
      * @brief Add a bidirectional edge between two nodes.
+     *
+     * Edges are staged and folded into the CSR arrays on the next
+     * neighbor query or assign_network_ids(); duplicates are dropped then.
+     * Rejected in a tile-built graph, whose edges follow tile adjacency.
+     *
      * @param node_a Index of the first node.
      * @param node_b Index of the second node.
+     * @return false if an index is invalid, the nodes are the same, or
+     *         the graph's edges come from tiles.
      */
-    void add_edge(uint16_t node_a, uint16_t node_b);
+    bool add_edge(NodeIndex node_a, NodeIndex node_b);
 
     // =========================================================================
     // Queries
@@ -108,14 +159,14 @@ public:
      * @param pos The grid position to query.
      * @return The network_id (0 if position not found or not yet assigned).
      */
-    uint16_t get_network_id(const GridPosition& pos) const;
+    NetworkId get_network_id(const GridPosition& pos) const;
 
     /**
      * @brief Get the node index for a grid position.
      * @param pos The grid position to query.
-     * @return The node index, or UINT16_MAX if not found.
+     * @return The node index, or INVALID_NODE_INDEX if not found.
      */
-    uint16_t get_node_index(const GridPosition& pos) const;
+    NodeIndex get_node_index(const GridPosition& pos) const;
 
     /**
      * @brief Get the total number of nodes in the graph.
@@ -124,11 +175,18 @@ public:
     size_t node_count() const;
 
     /**
-     * @brief Get a const reference to a node by index.
+     * @brief Get a view of a node by index.
+     * @param index The node index.
+     * @return NetworkNode view (see NetworkNode for lifetime).
+     */
+    NetworkNode get_node(NodeIndex index) const;
+
+    /**
+     * @brief Get the neighbor indices of a node.
      * @param index The node index.
-     * @return Const reference to the NetworkNode.
+     * @return View into the graph's adjacency, invalidated by graph edits.
      */
-    const NetworkNode& get_node(uint16_t index) const;
+    NodeSpan get_neighbors(NodeIndex index) const;
 
     // =========================================================================
     // Network ID assignment
@@ -147,13 +205,13 @@ public:
      * @param network_id The network ID to query.
      * @return Vector of GridPositions in that network (empty if none found).
      */
-    std::vector<GridPosition> get_network_positions(uint16_t network_id) const;
+    std::vector<GridPosition> get_network_positions(NetworkId network_id) const;
 
     /**
      * @brief Get the total number of distinct connected component networks.
      * @return Number of networks (each with a unique non-zero network_id).
      */
-    uint16_t get_network_count() const;
+    NetworkId get_network_count() const;
 
     // =========================================================================
     // Grid rebuild (Ticket E7-009)
@@ -176,10 +234,135 @@ public:
      */
     void rebuild_from_grid(const PathwayGrid& grid);
 
+    // =========================================================================
+    // Incremental maintenance
+    // =========================================================================
+
+    /**
+     * @brief Add a pathway tile and connect it to its N/S/E/W neighbors.
+     *
+     * Components touching the new tile are merged into the largest of
+     * them; only the smaller components are relabeled. A tile with no
+     * pathway neighbors gets a fresh network_id.
+     *
+     * Tile operations define edges by 4-adjacency, as rebuild_from_grid()
+     * does, and are rejected in a graph built with add_edge().
+     *
+     * @param pos Tile position (must be non-negative).
+     * @param relabeled If non-null, receives every position whose
+     *        network_id changed, including the new tile.
+     * @return Index of the new node, the existing index if the tile was
+     *         already present (nothing changes then), or INVALID_NODE_INDEX
+     *         for a negative position or a graph built with add_edge().
+     */
+    NodeIndex add_pathway_tile(const GridPosition& pos,
+                               std::vector<GridPosition>* relabeled = nullptr);
+
+    /**
+     * @brief Remove a pathway tile and split its component if needed.
+     *
+     * Runs interleaved BFS from the removed tile's neighbors. Searches
+     * that meet are merged; a search that runs out of tiles first has
+     * found a piece that split off, which gets a new network_id. The last
+     * remaining search keeps the old ID without being walked to the end,
+     * so the cost is proportional to the pieces that split off rather
+     * than the whole network.
+     *
+     * The last node is moved into the removed node's index.
+     *
+     * @param pos Tile position.
+     * @param relabeled If non-null, receives every position whose
+     *        network_id changed (the removed tile is not included).
+     * @return true if a node was removed; false if none was present or
+     *         the graph was built with add_edge().
+     */
+    bool remove_pathway_tile(const GridPosition& pos,
+                             std::vector<GridPosition>* relabeled = nullptr);
+
 private:
-    std::vector<NetworkNode> nodes_;
-    std::unordered_map<GridPosition, uint16_t, GridPositionHash> position_to_node_;
-    uint16_t next_network_id_ = 1;
+    /// Where a graph's edges come from (fixed by the first edge operation)
+    enum class EdgeSource : uint8_t {
+        None,       ///< No edges yet
+        Manual,     ///< add_edge(): CSR arrays
+        Tiles       ///< Tile adjacency: per-node TileAdjacency
+    };
+
+    /// Up to 4 neighbor indices of a tile node, in N, W, E, S order
+    struct TileAdjacency {
+        NodeIndex neighbors[4];
+        uint8_t count = 0;
+    };
+
+    /**
+     * @brief Grow the tile index to cover at least width x height tiles.
+     */
+    void reserve_tiles(uint32_t width, uint32_t height);
+
+    /**
+     * @brief Fold staged edges into the CSR arrays (no-op when clean).
+     */
+    void compact_edges() const;
+
+    /**
+     * @brief Switch to tile adjacency, linking existing nodes on first use.
+     * @return false if the graph's edges come from add_edge().
+     */
+    bool use_tile_edges();
+
+    /** @brief Recompute one node's neighbor slots from the tile index. */
+    void link_tile(NodeIndex index);
+
+    /** @brief Recompute the neighbor slots of every node next to pos. */
+    void link_tile_neighbors(const GridPosition& pos);
+
+    /** @brief Take an unused network ID (reusing released ones first). */
+    NetworkId allocate_network_id();
+
+    /** @brief Return an emptied network ID for reuse. */
+    void release_network_id(NetworkId id);
+
+    /**
+     * @brief Collect the up to 4 pathway neighbors of a tile.
+     * @return Number of neighbors written to out.
+     */
+    int tile_neighbors(const GridPosition& pos, NodeIndex out[4]) const;
+
+    /**
+     * @brief Relabel the component containing start from one ID to another.
+     */
+    void relabel_component(NodeIndex start, NetworkId from, NetworkId to,
+                           std::vector<GridPosition>* relabeled);
+
+    std::vector<GridPosition> positions_;   ///< Per node: grid position
+    std::vector<NetworkId> network_ids_;    ///< Per node: component ID
+
+    EdgeSource edge_source_ = EdgeSource::None;
+
+    // Tile adjacency: one entry per node, patched by tile edits
+    std::vector<TileAdjacency> tile_adjacency_;
+
+    // CSR adjacency: neighbors of node i are neighbors_[offsets_[i] .. offsets_[i+1]).
+    // Rebuilt lazily from pending_edges_ so queries stay const.
+    mutable std::vector<uint32_t> offsets_;
+    mutable std::vector<NodeIndex> neighbors_;
+    mutable std::vector<std::pair<NodeIndex, NodeIndex>> pending_edges_;
+
+    // Dense tile index: tile_to_node_[y * tile_width_ + x], INVALID_NODE_INDEX if empty
+    std::vector<NodeIndex> tile_to_node_;
+    uint32_t tile_width_ = 0;
+    uint32_t tile_height_ = 0;
+
+    NetworkId next_network_id_ = 1;
+    NetworkId network_count_ = 0;                ///< Live components
+    std::vector<uint32_t> network_sizes_;        ///< Nodes per network ID
+    std::vector<NetworkId> free_network_ids_;    ///< Released IDs for reuse
+
+    // Scratch for incremental relabeling
+    std::vector<NodeIndex> frontier_;
+    std::vector<NodeIndex> split_queues_[4];     ///< Per neighbor search in remove_pathway_tile
+    std::vector<uint32_t> visit_stamp_;          ///< Per node: search generation
+    std::vector<uint8_t> visit_search_;          ///< Per node: search that reached it
+    uint32_t visit_generation_ = 0;
 };
 
 } // namespace transport
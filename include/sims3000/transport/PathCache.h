@@ -3,8 +3,12 @@
  * @brief PathCache for frequently-queried routes (Epic 7, Ticket E7-041)
  *
  * Caches pathfinding results (PathResult) keyed by start/end GridPosition pairs.
- * Entries expire after max_age_ticks. The entire cache is invalidated when the
- * network changes (pathways added or removed).
+ * Entries expire after max_age_ticks. Each entry records the network IDs of
+ * its endpoints and a 64-bit mask of the regions its route touches, so a
+ * pathway edit evicts only the entries it can affect instead of the whole
+ * cache. Entries are indexed by region bit and by network, so an eviction
+ * visits only the entries it removes. The cache holds at most max_entries
+ * and evicts least recently used.
  *
  * Uses canonical alien terminology per /docs/canon/terminology.yaml
  */
@@ -14,7 +18,9 @@
 #include <sims3000/transport/Pathfinding.h>
 #include <sims3000/transport/NetworkGraph.h>
 #include <cstdint>
+#include <list>
 #include <unordered_map>
+#include <vector>
 
 namespace sims3000 {
 namespace transport {
@@ -48,11 +54,25 @@ struct PathCacheKeyHash {
 
 /**
  * @struct CachedPath
- * @brief A cached pathfinding result with timestamp.
+ * @brief A cached pathfinding result with timestamp and dependencies.
  */
 struct CachedPath {
     PathResult result;           ///< The cached pathfinding result
     uint32_t cached_at_tick = 0; ///< Tick when this result was cached
+    NetworkId start_network = 0; ///< Network of start when cached (0 = unknown)
+    NetworkId end_network = 0;   ///< Network of end when cached (0 = unknown)
+    uint64_t region_mask = 0;    ///< Regions touched by start, end and the route
+};
+
+/**
+ * @struct PathCacheStats
+ * @brief Lookup and eviction counters for a PathCache.
+ */
+struct PathCacheStats {
+    uint64_t hits = 0;           ///< get() calls that returned an entry
+    uint64_t misses = 0;         ///< get() calls with no entry or an expired one
+    uint64_t evictions = 0;      ///< Entries dropped to stay within max_entries
+    uint64_t invalidations = 0;  ///< Entries dropped by invalidate_*()
 };
 
 /**
@@ -61,7 +81,19 @@ struct CachedPath {
  *
  * Stores PathResult entries keyed by (start, end) positions.
  * Entries are valid for max_age_ticks before being considered stale.
- * The entire cache is invalidated when the network topology changes.
+ *
+ * The map is split into an 8x8 grid of square regions, one per mask bit.
+ * set_map_size() sizes regions to ceil(max(width, height) / 8) tiles so
+ * no two regions share a bit; until then regions are
+ * PATH_CACHE_REGION_SIZE tiles. Positions past the last region clamp to
+ * it, which only causes extra evictions, never stale hits.
+ *
+ * Invalidation rules for a pathway edit at tile T:
+ * - Removal: invalidate_region(T). A cached route that avoids T is still
+ *   walkable and still shortest, even if the removal split its network.
+ * - Placement: invalidate_region(T) plus invalidate_network() for the
+ *   network T joined. New tiles can shorten routes anywhere in that
+ *   network and can connect networks that a cached miss was between.
  */
 class PathCache {
 public:
@@ -70,13 +102,39 @@ public:
      *
      * @param max_age_ticks Maximum age of cached entries in ticks (default 100).
      */
-    explicit PathCache(uint32_t max_age_ticks = 100);
+    explicit PathCache(uint32_t max_age_ticks = 100,
+                       size_t max_entries = DEFAULT_MAX_ENTRIES);
+
+    /// Default bound on cached entries
+    static constexpr size_t DEFAULT_MAX_ENTRIES = 4096;
+
+    /// Edge length of an invalidation region in tiles before set_map_size()
+    static constexpr uint32_t PATH_CACHE_REGION_SIZE = 16;
+
+    /// Regions per map side (8x8 regions, one per region_mask bit)
+    static constexpr uint32_t PATH_CACHE_REGIONS_PER_SIDE = 8;
+
+    /**
+     * @brief Size regions so the 8x8 region grid covers the map.
+     *
+     * Drops all entries, since their region masks no longer apply.
+     *
+     * @param width Map width in tiles.
+     * @param height Map height in tiles.
+     */
+    void set_map_size(uint32_t width, uint32_t height);
+
+    /**
+     * @brief Get the edge length of an invalidation region in tiles.
+     */
+    uint32_t region_size() const;
 
     /**
      * @brief Look up a cached path result.
      *
      * Returns nullptr if the entry does not exist or has expired
-     * (current_tick - cached_at_tick >= max_age_ticks).
+     * (current_tick - cached_at_tick >= max_age_ticks). A hit marks the
+     * entry most recently used.
      *
      * @param start Starting grid position.
      * @param end Ending grid position.
@@ -89,7 +147,9 @@ public:
     /**
      * @brief Store a path result in the cache.
      *
-     * Overwrites any existing entry for the same key.
+     * Overwrites any existing entry for the same key. Without a graph the
+     * endpoint networks are unknown, and every invalidate_network() call
+     * evicts the entry.
      *
      * @param start Starting grid position.
      * @param end Ending grid position.
@@ -99,14 +159,47 @@ public:
     void put(const GridPosition& start, const GridPosition& end,
              const PathResult& result, uint32_t current_tick);
 
+    /**
+     * @brief Store a path result, recording endpoint networks from graph.
+     */
+    void put(const GridPosition& start, const GridPosition& end,
+             const PathResult& result, uint32_t current_tick,
+             const NetworkGraph& graph);
+
     /**
      * @brief Invalidate all cached paths.
      *
-     * Should be called when the network topology changes (pathways
-     * added or removed), as cached routes may no longer be valid.
+     * Use after bulk changes (full network rebuild, load).
      */
     void invalidate();
 
+    /**
+     * @brief Evict entries whose route or endpoints touch the region of pos.
+     * @return Number of entries evicted.
+     */
+    size_t invalidate_region(const GridPosition& pos);
+
+    /**
+     * @brief Evict entries with an endpoint in network_id or unknown network.
+     * @return Number of entries evicted.
+     */
+    size_t invalidate_network(NetworkId network_id);
+
+    /**
+     * @brief Region bit for a tile position.
+     */
+    uint64_t region_bit(const GridPosition& pos) const;
+
+    /**
+     * @brief Get lookup and eviction counters.
+     */
+    const PathCacheStats& get_stats() const;
+
+    /**
+     * @brief Get the entry bound.
+     */
+    size_t max_entries() const;
+
     /**
      * @brief Get the number of entries currently in the cache.
      * @return Number of cached entries.
@@ -114,8 +207,40 @@ public:
     size_t size() const;
 
 private:
-    std::unordered_map<PathCacheKey, CachedPath, PathCacheKeyHash> cache_;
+    /// Cached entry plus its positions in the recency list and indexes
+    struct Slot {
+        PathCacheKey key;
+        CachedPath entry;
+        std::list<uint32_t>::iterator lru_it;
+        std::vector<uint32_t> region_pos;    ///< Per set mask bit (ascending): index in region list
+        uint32_t network_pos[2] = { 0, 0 };  ///< Index in start/end network list
+    };
+
+    /// Store an entry with known endpoint networks
+    void store(const GridPosition& start, const GridPosition& end, const PathResult& result,
+               uint32_t current_tick, NetworkId start_network, NetworkId end_network);
+
+    /// Add a slot to the region and network indexes
+    void link(uint32_t slot);
+
+    /// Remove a slot from the region and network indexes (swap-and-pop)
+    void unlink(uint32_t slot);
+
+    /// Drop a slot from the cache entirely
+    void evict(uint32_t slot);
+
+    std::unordered_map<PathCacheKey, uint32_t, PathCacheKeyHash> cache_;   ///< Key -> slot
+    std::vector<Slot> slots_;
+    std::vector<uint32_t> free_slots_;
+    mutable std::list<uint32_t> lru_;       ///< Slots, most recent at front
+    mutable PathCacheStats stats_;
+
+    std::vector<uint32_t> region_slots_[64];                          ///< Slots per mask bit
+    std::unordered_map<NetworkId, std::vector<uint32_t>> network_slots_; ///< Slots per endpoint network (0 = unknown)
+
+    uint32_t region_size_ = PATH_CACHE_REGION_SIZE;
     uint32_t max_age_ticks_;
+    size_t max_entries_;
 };
 
 } // namespace transport
@@ -7,13 +7,19 @@
  *
  * Performance target: <5ms per path on 512x512 grid.
  *
+ * A Pathfinding instance owns its search scratch (dense per-tile arrays and
+ * a 4-ary heap), so repeated queries through one instance do not allocate
+ * once the arrays have grown to the map size.
+ *
  * Uses canonical alien terminology per /docs/canon/terminology.yaml
  */
 
 #pragma once
 
 #include <sims3000/transport/NetworkGraph.h>
+#include <sims3000/transport/EdgeCost.h>
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 namespace sims3000 {
@@ -31,15 +37,26 @@ struct PathResult {
     uint32_t total_cost = 0;             ///< Total path cost
 };
 
+/// Start/end pair for batched queries
+using PathQuery = std::pair<GridPosition, GridPosition>;
+
 /**
  * @class Pathfinding
  * @brief A* pathfinding on the transport pathway grid.
  *
  * Finds shortest paths between pathway tiles using A* with Manhattan
- * distance heuristic and basic edge cost (10 per step).
+ * distance heuristic and basic edge cost (10 per step). With a cost plane
+ * attached (set_cost_plane()), each step instead costs the plane's value
+ * for the tile entered, and the heuristic scales Manhattan distance by
+ * the plane's minimum cost so it stays admissible.
  *
  * Early exit: if start and end are on different network_ids (connected
  * components), returns immediately with found=false.
+ *
+ * Per-tile search state lives in dense arrays indexed by y * width + x.
+ * Entries are validated by a generation stamp, so starting a new search
+ * is O(1) instead of clearing the arrays. Keep one instance per thread
+ * and reuse it across queries.
  */
 class Pathfinding {
 public:
@@ -67,25 +84,94 @@ public:
         const NetworkGraph& graph
     );
 
+    /**
+     * @brief Run find_path() for each query, reusing the search scratch.
+     *
+     * results is resized to queries.size(); existing PathResult path
+     * buffers are reused, so a caller that keeps its results vector
+     * between batches avoids per-path allocation.
+     *
+     * @param queries Start/end pairs.
+     * @param grid    PathwayGrid for neighbor lookups.
+     * @param graph   NetworkGraph for connectivity (network_id) checks.
+     * @param results Output, results[i] answers queries[i].
+     */
+    void find_paths(
+        const std::vector<PathQuery>& queries,
+        const PathwayGrid& grid,
+        const NetworkGraph& graph,
+        std::vector<PathResult>& results
+    );
+
+    /**
+     * @brief Weight steps by a per-tile cost plane (nullptr = 10 per step).
+     *
+     * The plane is not owned and must outlive subsequent queries. Tiles
+     * with no recorded cost are charged the plane's minimum cost.
+     */
+    void set_cost_plane(const EdgeCostPlane* plane) { cost_plane_ = plane; }
+
 private:
+    /// Open-set entry; stale entries are skipped when popped
+    struct HeapEntry {
+        uint32_t f_cost;    ///< g_cost + heuristic
+        uint32_t g_cost;    ///< Cost from start when pushed
+        uint32_t tile;      ///< Tile index (y * width + x)
+    };
+
+    /**
+     * @brief Shared body of find_path()/find_paths(); writes into result.
+     */
+    void search(
+        const GridPosition& start,
+        const GridPosition& end,
+        const PathwayGrid& grid,
+        const NetworkGraph& graph,
+        PathResult& result
+    );
+
+    /**
+     * @brief Size the scratch arrays to the grid and advance the generation.
+     */
+    void begin_search(const PathwayGrid& grid);
+
+    void heap_push(const HeapEntry& entry);
+    HeapEntry heap_pop();
+
+    /// True if a is expanded before b (lower f, then deeper g)
+    static bool heap_less(const HeapEntry& a, const HeapEntry& b) {
+        return a.f_cost < b.f_cost || (a.f_cost == b.f_cost && a.g_cost > b.g_cost);
+    }
+
     /**
      * @brief Manhattan distance heuristic.
      * @param a First position.
      * @param b Second position.
-     * @return Manhattan distance between a and b.
+     * @return Manhattan distance between a and b times the cheapest step cost.
      */
-    static uint32_t heuristic(const GridPosition& a, const GridPosition& b);
+    uint32_t heuristic(const GridPosition& a, const GridPosition& b) const;
 
     /**
      * @brief Edge cost between adjacent tiles.
      *
-     * Base cost = 10. Will be enhanced by E7-024.
+     * Base cost = 10, or the cost plane's value for the destination tile.
      *
      * @param from Source position.
      * @param to   Destination position.
      * @return Edge traversal cost.
      */
-    static uint32_t edge_cost(const GridPosition& from, const GridPosition& to);
+    uint32_t edge_cost(const GridPosition& from, const GridPosition& to) const;
+
+    const EdgeCostPlane* cost_plane_ = nullptr;  ///< Optional per-tile step costs
+    uint32_t min_step_cost_ = 10;          ///< Cheapest step this search (heuristic scale)
+
+    std::vector<uint32_t> seen_stamp_;     ///< == generation_ when g_cost_/parent_ are valid
+    std::vector<uint32_t> closed_stamp_;   ///< == generation_ once a tile is expanded
+    std::vector<uint32_t> g_cost_;         ///< Best known cost from start
+    std::vector<uint32_t> parent_;         ///< Predecessor tile index
+    std::vector<HeapEntry> heap_;          ///< 4-ary min-heap (open set)
+    uint32_t generation_ = 0;              ///< Current search stamp
+    uint32_t width_ = 0;                   ///< Grid width the arrays were sized for
 };
 
 } // namespace transport
@@ -7,11 +7,18 @@
  * Distance values are stored as uint8_t, capped at 255 (meaning no pathway
  * within 255 tiles).
  *
- * Memory: 1 byte per tile
+ * Memory: 1 byte per tile (plus 1 byte per tile of update scratch)
  * - 128x128:   16KB
  * - 256x256:   64KB
  * - 512x512:  256KB
  *
+ * After the first rebuild, single pathway edits are applied locally:
+ * - Placement lowers distances by BFS from the new tile, stopping where
+ *   nothing improves.
+ * - Removal re-evaluates only the tiles whose distance the removed tile
+ *   could have supplied (within the 254-tile tracked range), re-seeded
+ *   from the surrounding unaffected distances.
+ *
  * @see /docs/canon/decisions/CCR-007 (Manhattan distance specification)
  */
 
@@ -31,8 +38,9 @@ class PathwayGrid;  // forward declare
  * The cache is rebuilt from a PathwayGrid using multi-source BFS.
  * After a rebuild, get_distance() returns O(1) lookups.
  *
- * The dirty flag indicates when the cache needs rebuilding (e.g., after
- * pathways are added or removed from the grid).
+ * The dirty flag indicates when the cache needs a full rebuild (initial
+ * state, or bulk changes). Single edits on a clean cache go through
+ * on_pathway_added()/on_pathway_removed() instead and leave it clean.
  */
 class ProximityCache {
 public:
@@ -68,6 +76,14 @@ public:
      */
     uint8_t get_distance(int32_t x, int32_t y) const;
 
+    /**
+     * @brief Get the raw distance plane (row-major, width * height bytes).
+     *
+     * Same values as get_distance(); the pointer stays valid for the
+     * cache's lifetime.
+     */
+    const uint8_t* get_distance_data() const;
+
     // ========================================================================
     // Rebuild
     // ========================================================================
@@ -82,6 +98,24 @@ public:
      */
     void rebuild_if_dirty(const PathwayGrid& grid);
 
+    /**
+     * @brief Update distances for a pathway placed at (x, y).
+     *
+     * Bounded BFS that only visits tiles whose distance drops. No-op while
+     * dirty (the pending rebuild covers it) or out of bounds.
+     */
+    void on_pathway_added(int32_t x, int32_t y);
+
+    /**
+     * @brief Update distances for a pathway removed from (x, y).
+     *
+     * Re-evaluates the tiles whose recorded distance equals their
+     * Manhattan distance to (x, y), i.e. those the removed tile could
+     * have been nearest to, from their unaffected neighbours. No-op
+     * while dirty or out of bounds.
+     */
+    void on_pathway_removed(int32_t x, int32_t y);
+
     // ========================================================================
     // Dirty tracking
     // ========================================================================
@@ -127,7 +161,13 @@ private:
      */
     void rebuild(const PathwayGrid& grid);
 
+    /// Largest finite distance; 255 means none in range
+    static constexpr uint8_t MAX_TRACKED_DISTANCE = 254;
+
     std::vector<uint8_t> distance_cache_;  ///< 1 byte per tile (Manhattan distance)
+    std::vector<uint8_t> affected_;        ///< Removal scratch: 1 while a tile is being re-evaluated
+    std::vector<uint32_t> queue_;          ///< BFS scratch (tile indices)
+    std::vector<uint32_t> buckets_[MAX_TRACKED_DISTANCE + 1];  ///< Removal scratch: tiles by distance
     bool dirty_ = true;                    ///< True if cache needs rebuilding
     uint32_t width_ = 0;                   ///< Cache width in tiles
     uint32_t height_ = 0;                  ///< Cache height in tiles
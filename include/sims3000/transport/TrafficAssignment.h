@@ -0,0 +1,197 @@
+/**
+ * @file TrafficAssignment.h
+ * @brief Origin-destination traffic assignment over the pathway network
+ *
+ * Routes trips from origin zones (habitation) to destination zones
+ * (exchange/fabrication) and produces a traffic volume per pathway tile.
+ *
+ * A round:
+ * 1. Snapshots the NetworkGraph (node positions, CSR adjacency, network
+ *    IDs) with a free-flow cost and capacity per node, so pathway edits
+ *    while the round is in progress do not disturb it.
+ * 2. Generates trips: each origin's trips are split across the
+ *    destinations in its network in proportion to their attraction.
+ * 3. Runs Frank-Wolfe: each iteration prices every node with the BPR
+ *    function of the current volumes, grows one Dijkstra tree per origin
+ *    centroid and loads its trips onto the tree (all-or-nothing), then
+ *    moves the volumes toward that loading by a line search on the
+ *    Beckmann objective. iterations = 1 is plain all-or-nothing.
+ *
+ * Trees are grown in parallel across origins on an optional
+ * TaskScheduler. step() works through origins in batches until its
+ * wall-clock (or origin) budget is spent, so a round spreads over as many
+ * ticks as it needs. Loads are summed in fixed point, so results do not
+ * depend on the worker count or on how a round was sliced.
+ *
+ * Uses canonical alien terminology per /docs/canon/terminology.yaml
+ */
+
+#pragma once
+
+#include <sims3000/transport/NetworkGraph.h>
+#include <cstdint>
+#include <vector>
+
+namespace sims3000 {
+namespace sim {
+class TaskScheduler;  // forward declaration
+}
+
+namespace transport {
+
+/**
+ * @struct TripZone
+ * @brief A zone centroid that produces or attracts trips.
+ */
+struct TripZone {
+    GridPosition access;   ///< Pathway tile the zone's trips enter/leave by
+    uint32_t trips = 0;    ///< Trips produced (origin) or attraction weight (destination)
+};
+
+/**
+ * @struct TrafficAssignmentConfig
+ * @brief Tuning for TrafficAssignment.
+ */
+struct TrafficAssignmentConfig {
+    uint32_t iterations = 4;            ///< Frank-Wolfe iterations per round (1 = all-or-nothing)
+    float bpr_alpha = 0.15f;            ///< Node cost = free_flow * (1 + alpha * (volume / capacity)^4)
+    uint32_t time_budget_us = 1000;     ///< Wall-clock budget per step() (0 = unlimited)
+    uint32_t max_origins_per_step = 0;  ///< Origin trees per step() (0 = unlimited)
+};
+
+/**
+ * @class TrafficAssignment
+ * @brief Time-sliced, parallel Frank-Wolfe traffic assignment.
+ *
+ * Usage: begin_round(), then step() once per tick until it returns true;
+ * the finished volumes stay readable until the next round finishes.
+ */
+class TrafficAssignment {
+public:
+    TrafficAssignment() = default;
+
+    void set_config(const TrafficAssignmentConfig& config);
+    const TrafficAssignmentConfig& get_config() const;
+
+    /**
+     * @brief Grow origin trees on this scheduler (nullptr = calling thread).
+     *
+     * The scheduler is not owned. TaskScheduler is fork-join only, so do
+     * not pass the one the calling system is itself running on.
+     */
+    void set_task_scheduler(sim::TaskScheduler* scheduler);
+
+    /**
+     * @brief Start a new round, discarding any round in progress.
+     *
+     * Zones whose access tile is not a graph node are skipped, as are
+     * destinations no origin can reach.
+     *
+     * @param graph          Network to route on (snapshotted).
+     * @param free_flow_cost Per node index: cost of entering the node uncongested.
+     * @param capacity       Per node index: volume at which BPR cost is 1.15x free flow.
+     * @param origins        Trip-producing zones.
+     * @param destinations   Trip-attracting zones.
+     */
+    void begin_round(const NetworkGraph& graph,
+                     const std::vector<uint32_t>& free_flow_cost,
+                     const std::vector<uint32_t>& capacity,
+                     const std::vector<TripZone>& origins,
+                     const std::vector<TripZone>& destinations);
+
+    /**
+     * @brief Advance the current round within the configured budget.
+     * @return true if the round finished during this call.
+     */
+    bool step();
+
+    /** @brief True while a round is in progress. */
+    bool is_running() const;
+
+    /** @brief Frank-Wolfe iteration of the round in progress. */
+    uint32_t get_iteration() const;
+
+    /** @brief Number of rounds finished since construction. */
+    uint32_t get_round_count() const;
+
+    /**
+     * @brief Relative gap of the last finished round's final iteration.
+     *
+     * (cost of current volumes - cost of the all-or-nothing loading) /
+     * cost of current volumes; 0 means user equilibrium.
+     */
+    double get_relative_gap() const;
+
+    /** @brief Tile of each entry in get_result_volumes(). */
+    const std::vector<GridPosition>& get_result_positions() const;
+
+    /** @brief Trips through each tile in the last finished round. */
+    const std::vector<uint32_t>& get_result_volumes() const;
+
+private:
+    /// Loads are summed in units of 1 / TRIP_SCALE trips
+    static constexpr uint64_t TRIP_SCALE = 256;
+
+    /// Dijkstra open-set entry
+    struct HeapEntry {
+        float dist;
+        uint32_t node;
+    };
+
+    /// Per-slot tree scratch; slot k grows the trees of origins o with o % slots == k
+    struct Slot {
+        std::vector<float> dist;
+        std::vector<uint32_t> parent;
+        std::vector<uint32_t> stamp;    ///< == generation when dist/parent/load are valid
+        std::vector<uint64_t> load;     ///< Fixed-point trips through the subtree
+        std::vector<uint64_t> aux;      ///< Fixed-point all-or-nothing volumes this iteration
+        std::vector<uint32_t> order;    ///< Settled nodes in settle order
+        std::vector<HeapEntry> heap;
+        uint32_t generation = 0;
+    };
+
+    void begin_iteration();
+    void finish_iteration();
+    void grow_tree(uint32_t origin, Slot& slot);
+
+    /// BPR cost of one node at volume
+    double node_cost(uint32_t node, double volume) const;
+
+    /// std heap comparator: lower dist on top, then lower node
+    static bool heap_after(const HeapEntry& a, const HeapEntry& b);
+
+    TrafficAssignmentConfig config_;
+    sim::TaskScheduler* scheduler_ = nullptr;
+
+    // Graph snapshot
+    std::vector<GridPosition> positions_;
+    std::vector<uint32_t> offsets_;        ///< CSR: neighbors of n are [offsets_[n], offsets_[n+1])
+    std::vector<uint32_t> neighbors_;
+    std::vector<float> free_flow_;
+    std::vector<float> capacity_;
+
+    // Demand: origin o sends demand_trips_[k] to demand_nodes_[k]
+    // for k in [demand_offsets_[o], demand_offsets_[o+1])
+    std::vector<uint32_t> origin_nodes_;
+    std::vector<uint32_t> demand_offsets_;
+    std::vector<uint32_t> demand_nodes_;
+    std::vector<uint64_t> demand_trips_;
+
+    // Frank-Wolfe state
+    std::vector<float> cost_;              ///< Node cost at volume_ (read by all slots)
+    std::vector<double> volume_;           ///< Current volumes (trips)
+    std::vector<double> target_;           ///< All-or-nothing volumes of this iteration
+    std::vector<Slot> slots_;
+    uint32_t next_origin_ = 0;
+    uint32_t iteration_ = 0;
+    bool running_ = false;
+
+    // Last finished round
+    std::vector<GridPosition> result_positions_;
+    std::vector<uint32_t> result_volumes_;
+    double relative_gap_ = 0.0;
+    uint32_t round_count_ = 0;
+};
+
+} // namespace transport
+} // namespace sims3000
@@ -10,14 +10,20 @@
  * - FlowPropagation: traffic flow diffusion
  * - CongestionCalculator: congestion from flow vs capacity
  * - PathwayDecay: pathway health degradation
+ * - HierarchicalPathfinding: chunked route queries
+ * - EdgeCostPlane: per-tile routing cost (type, congestion, decay)
+ * - PathCache: recent find_path() results, invalidated per region/network
+ * - TrafficAssignment: zone-to-zone trips routed over the network graph
  *
  * Implements ISimulatable (duck-typed) at priority 45.
  * Implements ITransportProvider via delegation to TransportProviderImpl.
  *
  * Tick phases:
- * 1. Rebuild network graph + proximity cache if dirty
+ * 1. Rebuild network graph + proximity cache if dirty (edits after the
+ *    first build update both in place)
  * 2. Clear previous tick flow
- * 3. Propagate flow (diffusion model)
+ * 3. Propagate flow (diffusion model), then advance trip assignment;
+ *    a finished assignment round replaces flow_current on its tiles
  * 4. Calculate congestion from flow vs capacity
  * 5. Apply decay (every 100 ticks)
  * 6. Emit events (clear at tick start)
@@ -28,7 +34,11 @@
 #pragma once
 
 #include <sims3000/transport/PathwayGrid.h>
+#include <sims3000/transport/HierarchicalPathfinding.h>
+#include <sims3000/transport/EdgeCost.h>
+#include <sims3000/transport/PathCache.h>
 #include <sims3000/transport/ProximityCache.h>
+#include <sims3000/transport/TrafficAssignment.h>
 #include <sims3000/transport/NetworkGraph.h>
 #include <sims3000/transport/TransportProviderImpl.h>
 #include <sims3000/transport/FlowPropagation.h>
@@ -40,9 +50,7 @@
 #include <sims3000/transport/PathwayTypeConfig.h>
 #include <sims3000/building/ForwardDependencyInterfaces.h>
 #include <cstdint>
-#include <unordered_map>
 #include <vector>
-#include <utility>
 
 namespace sims3000 {
 namespace transport {
@@ -176,6 +184,91 @@ public:
      */
     const NetworkGraph& get_network_graph() const;
 
+    // =========================================================================
+    // Routing
+    // =========================================================================
+
+    /**
+     * @brief Find a route between two pathway tiles.
+     *
+     * Uses the chunked route planner, which is kept in step with pathway
+     * placement and removal. Returns found=false until the network graph
+     * has been built by the first tick.
+     *
+     * Results are cached; an edit evicts only the cached routes it can
+     * affect (see PathCache.h for the rules).
+     *
+     * @param start Starting pathway tile.
+     * @param end   Ending pathway tile.
+     * @return PathResult with found flag, path, and total cost.
+     */
+    PathResult find_path(const GridPosition& start, const GridPosition& end);
+
+    /**
+     * @brief Get const reference to the find_path() result cache.
+     * @return Const reference to PathCache.
+     */
+    const PathCache& get_path_cache() const;
+
+    /**
+     * @brief Find the cheapest route under current pathway costs.
+     *
+     * Flat A* weighted by the edge cost plane (pathway type, congestion
+     * and decay per EdgeCost.h), so congested roads are avoided when a
+     * parallel route is cheaper. Same preconditions as find_path().
+     *
+     * @param start Starting pathway tile.
+     * @param end   Ending pathway tile.
+     * @return PathResult with found flag, path, and total cost.
+     */
+    PathResult find_weighted_path(const GridPosition& start, const GridPosition& end);
+
+    /**
+     * @brief Get const reference to the per-tile edge cost plane.
+     * @return Const reference to EdgeCostPlane.
+     */
+    const EdgeCostPlane& get_edge_cost_plane() const;
+
+    // =========================================================================
+    // Trip Assignment
+    // =========================================================================
+
+    /// Max distance from a zone centroid to the pathway tile its trips use
+    static constexpr uint8_t TRIP_ACCESS_DISTANCE = 3;
+
+    /**
+     * @brief Set the zones that produce and attract trips.
+     *
+     * Origins are habitation zones, destinations exchange/fabrication
+     * zones; access holds the zone centroid, which is snapped to the
+     * nearest pathway within TRIP_ACCESS_DISTANCE when a round starts.
+     * Zones with no pathway in reach generate no trips. Takes effect from
+     * the next assignment round.
+     *
+     * @param origins      Trip-producing zones.
+     * @param destinations Trip-attracting zones.
+     */
+    void set_trip_zones(const std::vector<TripZone>& origins,
+                        const std::vector<TripZone>& destinations);
+
+    /**
+     * @brief Configure the assignment (iterations, per-tick time budget).
+     */
+    void set_assignment_config(const TrafficAssignmentConfig& config);
+
+    /**
+     * @brief Grow assignment trees on a worker pool (nullptr = tick thread).
+     *
+     * Not owned. Must not be the scheduler that is running this tick.
+     */
+    void set_task_scheduler(sim::TaskScheduler* scheduler);
+
+    /**
+     * @brief Get const reference to the trip assignment stage.
+     * @return Const reference to TrafficAssignment.
+     */
+    const TrafficAssignment& get_traffic_assignment() const;
+
     // =========================================================================
     // Events
     // =========================================================================
@@ -203,6 +296,9 @@ public:
     void activate_grace_period(uint32_t current_tick);
 
 private:
+    /// road_index_ value for entity IDs without a pathway
+    static constexpr uint32_t NO_ROAD_INDEX = UINT32_MAX;
+
     uint32_t map_width_;
     uint32_t map_height_;
     uint32_t next_entity_id_ = 1;
@@ -215,15 +311,36 @@ private:
     NetworkGraph network_graph_;
     TransportProviderImpl provider_impl_;
     FlowPropagation flow_propagation_;
-
-    // Per-entity data
-    std::unordered_map<uint32_t, RoadComponent> roads_;         ///< entity_id -> road
-    std::unordered_map<uint32_t, TrafficComponent> traffic_;    ///< entity_id -> traffic
-    std::unordered_map<uint32_t, uint8_t> road_owners_;         ///< entity_id -> owner
-    std::unordered_map<uint32_t, std::pair<int32_t,int32_t>> road_positions_;  ///< entity_id -> (x,y)
-
-    // Flow accumulator
-    std::unordered_map<uint64_t, uint32_t> flow_accumulator_;   ///< packed_pos -> flow
+    HierarchicalPathfinding route_planner_;
+    EdgeCostPlane edge_costs_;
+    Pathfinding weighted_pathfinder_;
+    PathCache path_cache_;
+    TrafficAssignment traffic_assignment_;
+
+    // Trip zones as set (centroids) and snapped to pathway tiles per round
+    std::vector<TripZone> trip_origins_;
+    std::vector<TripZone> trip_destinations_;
+    std::vector<TripZone> snapped_origins_;
+    std::vector<TripZone> snapped_destinations_;
+    std::vector<uint32_t> node_free_flow_;
+    std::vector<uint32_t> node_capacity_;
+
+    // Packed pathway store (sparse set). Index i of each array describes
+    // one pathway; removal moves the last pathway into the hole, the same
+    // swap-and-pop flow_plane_ applies, so store index == flow slot.
+    // Entity IDs (what PathwayGrid cells hold) stay the stable handle.
+    std::vector<RoadComponent> roads_;
+    std::vector<TrafficComponent> traffic_;
+    std::vector<uint8_t> road_owners_;
+    std::vector<GridPosition> road_positions_;
+    std::vector<NetworkId> road_networks_;      ///< full ID; RoadComponent keeps 16 bits
+    std::vector<uint32_t> road_entities_;       ///< index -> entity_id
+    std::vector<uint32_t> road_index_;          ///< entity_id -> index, or NO_ROAD_INDEX
+
+    FlowPlane flow_plane_;
+
+    // Positions whose network_id changed in the last incremental graph edit
+    std::vector<GridPosition> relabeled_positions_;
 
     // Event buffers
     std::vector<PathwayPlacedEvent> placed_events_;
@@ -235,9 +352,30 @@ private:
 
     /**
      * @brief Phase 1: Rebuild network graph and proximity cache if dirty.
+     *
+     * Pathway placement and removal update the graph incrementally once it
+     * has been built, so the full rebuild only runs for the initial build
+     * or after PathwayGrid::mark_network_dirty().
      */
     void phase1_rebuild_if_dirty();
 
+    /**
+     * @brief Store index of an entity's pathway, or NO_ROAD_INDEX.
+     */
+    uint32_t road_index_of(uint32_t entity_id) const;
+
+    /**
+     * @brief Remove store entry index by moving the last entry into it.
+     */
+    void erase_road(uint32_t index);
+
+    /**
+     * @brief Copy network IDs from the graph to roads in relabeled_positions_.
+     *
+     * Also evicts cached routes tagged with the networks those roads left.
+     */
+    void apply_network_relabels();
+
     /**
      * @brief Phase 2: Clear previous tick flow values.
      */
@@ -245,14 +383,38 @@ private:
 
     /**
      * @brief Phase 3: Propagate flow via diffusion model.
+     *
+     * Seeds the dense flow plane from flow_previous, diffuses it, and
+     * writes flow_current back by slot (slot == store index).
      */
     void phase3_propagate_flow();
 
+    /**
+     * @brief Advance trip assignment by one time slice (part of phase 3).
+     *
+     * Starts a round from the current graph when none is running, and
+     * writes a finished round's volumes to flow_current of its tiles.
+     * Diffusion then spreads that flow until the next round lands.
+     */
+    void advance_traffic_assignment();
+
+    /**
+     * @brief Snap zone centroids to pathway tiles within TRIP_ACCESS_DISTANCE.
+     */
+    void snap_trip_zones(const std::vector<TripZone>& zones, std::vector<TripZone>& out) const;
+
     /**
      * @brief Phase 4: Calculate congestion from flow vs capacity.
+     *
+     * Also refreshes the edge cost plane for roads whose cost changed.
      */
     void phase4_calculate_congestion();
 
+    /**
+     * @brief Recompute the edge cost plane entry for one road.
+     */
+    void refresh_edge_cost(int32_t x, int32_t y, const RoadComponent& road, uint8_t congestion_level);
+
     /**
      * @brief Phase 5: Apply decay (every 100 ticks).
      */
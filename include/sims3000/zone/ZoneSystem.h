@@ -77,6 +77,7 @@ constexpr std::uint8_t MAX_OVERSEERS = 5;
  * - ZoneGrid: spatial index for zone entities
  * - Per-overseer ZoneCounts: aggregate zone statistics
  * - Per-overseer ZoneDemandData: cached demand values
+ * - Per-overseer, per-type spawn candidate sets (Designated tiles)
  */
 /**
  * @struct DesirabilityConfig
@@ -522,6 +523,25 @@ public:
                     ZoneType type, ZoneDensity density,
                     std::uint8_t player_id, std::uint32_t entity_id);
 
+    // =========================================================================
+    // Spawn Candidates
+    // =========================================================================
+
+    /**
+     * @brief Get the Designated tiles of an overseer's zone type.
+     *
+     * Maintained as zones are placed, removed, redesignated and change
+     * state, so callers such as the building spawn loop never scan the
+     * grid. Entries are tile indices (y * grid width + x) in no particular
+     * order; removal moves the last entry into the hole, so the order
+     * changes as tiles develop.
+     *
+     * @param player_id Overseer ID (0-4).
+     * @param type Zone type.
+     * @return Tile indices (empty for invalid arguments).
+     */
+    const std::vector<std::uint32_t>& get_spawn_candidates(std::uint8_t player_id, ZoneType type) const;
+
     // =========================================================================
     // Grid Access (for testing)
     // =========================================================================
@@ -571,6 +591,21 @@ private:
     /// Grid width for indexing into m_zone_info
     std::uint16_t m_grid_width;
 
+    /// m_candidate_slot value for tiles in no candidate set
+    static constexpr std::uint32_t NO_CANDIDATE_SLOT = UINT32_MAX;
+
+    /// Designated tile indices per [overseer][zone type] (packed sparse sets)
+    std::array<std::array<std::vector<std::uint32_t>, ZONE_TYPE_COUNT>, MAX_OVERSEERS> m_spawn_candidates;
+
+    /// Per tile: position in its candidate set, or NO_CANDIDATE_SLOT
+    std::vector<std::uint32_t> m_candidate_slot;
+
+    /// Add the tile to its owner's candidate set (zone info must be current)
+    void add_spawn_candidate(std::size_t index);
+
+    /// Take the tile out of its owner's candidate set, if present
+    void remove_spawn_candidate(std::size_t index);
+
     /// Get zone info at position (nullptr if no zone)
     const ZoneInfo* get_zone_info(std::int32_t x, std::int32_t y) const;
     ZoneInfo* get_zone_info_mut(std::int32_t x, std::int32_t y);
@@ -21,6 +21,7 @@
 #include "sims3000/transport/TransportEnums.h"
 #include "sims3000/transport/RailComponent.h"
 #include "sims3000/transport/TerminalComponent.h"
+#include "sims3000/services/ServiceEvents.h"
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_log.h>
 #include <glm/gtc/type_ptr.hpp>
@@ -128,6 +129,13 @@ Application::Application(const ApplicationConfig& config)
             SDL_Log("Warning: Fluid demo failed to initialize");
         }
 
+        // Worker pool for transport and services; the main thread joins
+        // each batch, so leave one hardware thread for it
+        const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+        m_taskScheduler = std::make_unique<sim::TaskScheduler>(
+            hardwareThreads > 1 ? hardwareThreads - 1 : 0);
+        SDL_Log("Task scheduler: %u worker threads", m_taskScheduler->worker_count());
+
         // Initialize transport demo (Epic 7)
         if (!initTransport()) {
             SDL_Log("Warning: Transport demo failed to initialize");
@@ -600,6 +608,9 @@ void Application::shutdown() {
     // Cleanup demo resources
     cleanupDemo();
 
+    // Join worker threads once no system can submit work
+    m_taskScheduler.reset();
+
     // Destroy systems in reverse order of creation
     m_systems.reset();
     m_registry.reset();
@@ -2567,6 +2578,7 @@ bool Application::initTransport() {
 
     // Create TransportSystem (256x256 to match terrain grid)
     m_transportSystem = std::make_unique<transport::TransportSystem>(256, 256);
+    m_transportSystem->set_task_scheduler(m_taskScheduler.get());
 
     // Create RailSystem (256x256 to match terrain grid)
     m_railSystem = std::make_unique<transport::RailSystem>(256, 256);
@@ -2840,6 +2852,7 @@ bool Application::initServices() {
 
     // Create ServicesSystem
     m_services = std::make_unique<services::ServicesSystem>();
+    m_services->set_task_scheduler(m_taskScheduler.get());
 
     // Initialize with map dimensions (256x256 to match terrain grid)
     m_services->init(256, 256);
@@ -2906,9 +2919,9 @@ void Application::handleServicesInput() {
         // Use entity ID based on position for demo purposes
         uint32_t entityId = static_cast<uint32_t>(cz * 256 + cx);
 
-        // Register building construction with services system
-        m_services->on_building_constructed(entityId, 0);
-        m_services->mark_dirty(stype, 0);
+        // Register the provider; its stamp is added on the next tick
+        m_services->on_service_building_placed(services::ServiceBuildingPlacedEvent(
+            entityId, 0, stype, services::ServiceTier::Post, cx, cz));
 
         SDL_Log("Placed %s service at (%d, %d) entity=%u", typeName, cx, cz, entityId);
     }
@@ -2919,8 +2932,12 @@ void Application::handleServicesInput() {
         int32_t cz = static_cast<int32_t>(std::max(0.0f, m_demoCamera.focus_point.z));
 
         uint32_t entityId = static_cast<uint32_t>(cz * 256 + cx);
-        m_services->on_building_deconstructed(entityId, 0);
-        m_services->mark_all_dirty(0);
+        // Type/tier are looked up from the provider registry
+        services::ServiceBuildingRemovedEvent removed;
+        removed.entity_id = entityId;
+        removed.grid_x = cx;
+        removed.grid_y = cz;
+        m_services->on_service_building_removed(removed);
 
         SDL_Log("Removed service building at (%d, %d) entity=%u", cx, cz, entityId);
     }
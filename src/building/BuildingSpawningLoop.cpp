@@ -23,6 +23,8 @@ BuildingSpawningLoop::BuildingSpawningLoop(
     , m_grid(grid)
     , m_config()
     , m_total_spawned(0)
+    , m_cursors(zone::MAX_OVERSEERS)
+    , m_next_type(zone::MAX_OVERSEERS, 0)
 {
 }
 
@@ -46,105 +48,134 @@ void BuildingSpawningLoop::tick(uint32_t current_tick) {
 
 void BuildingSpawningLoop::scan_for_overseer(uint8_t player_id, uint32_t current_tick) {
     uint32_t spawn_count = 0;
+    const uint32_t grid_width = m_zone_system->get_grid().getWidth();
+
+    // Visits left this scan, per zone type, capped at each set's size now
+    // (not a visited set; swap-removes can bring a candidate round twice).
+    // Types without demand fail can_spawn_building on every tile, so skip
+    // them whole.
+    std::array<uint32_t, zone::ZONE_TYPE_COUNT> remaining = {};
+    uint32_t total_remaining = 0;
+    for (uint8_t t = 0; t < zone::ZONE_TYPE_COUNT; ++t) {
+        const zone::ZoneType type = static_cast<zone::ZoneType>(t);
+        const std::vector<uint32_t>& set = m_zone_system->get_spawn_candidates(player_id, type);
+        if (set.empty() || m_zone_system->get_demand_for_type(type, player_id) <= 0) {
+            continue;
+        }
+        remaining[t] = static_cast<uint32_t>(set.size());
+        total_remaining += remaining[t];
+    }
 
-    // Get the zone grid dimensions
-    const auto& zone_grid = m_zone_system->get_grid();
-    uint16_t grid_width = zone_grid.getWidth();
-    uint16_t grid_height = zone_grid.getHeight();
-
-    // Iterate all zone grid positions looking for designated zones
-    for (int32_t y = 0; y < static_cast<int32_t>(grid_height) && spawn_count < m_config.max_spawns_per_scan; ++y) {
-        for (int32_t x = 0; x < static_cast<int32_t>(grid_width) && spawn_count < m_config.max_spawns_per_scan; ++x) {
-            // Check if there's a zone at this position
-            if (!m_zone_system->is_zoned(x, y)) {
-                continue;
+    // Zone types take turns, one candidate each, starting where the
+    // previous scan left off
+    uint8_t t = m_next_type[player_id];
+    while (total_remaining > 0 && spawn_count < m_config.max_spawns_per_scan) {
+        if (remaining[t] > 0) {
+            const zone::ZoneType type = static_cast<zone::ZoneType>(t);
+            const std::vector<uint32_t>& set = m_zone_system->get_spawn_candidates(player_id, type);
+            --remaining[t];
+            --total_remaining;
+            if (set.empty()) {
+                total_remaining -= remaining[t];
+                remaining[t] = 0;
+            } else {
+                uint32_t& cursor = m_cursors[player_id][t];
+                if (cursor >= set.size()) {
+                    cursor = 0;
+                }
+                const uint32_t index = set[cursor];
+                const int32_t x = static_cast<int32_t>(index % grid_width);
+                const int32_t y = static_cast<int32_t>(index / grid_width);
+                if (try_spawn_at(x, y, player_id, current_tick)) {
+                    ++spawn_count;
+                }
+                // A spawn takes the tile out of the set and moves another
+                // candidate into its slot; only step past tiles still there
+                if (cursor < set.size() && set[cursor] == index) {
+                    ++cursor;
+                }
             }
+        }
+        t = static_cast<uint8_t>((t + 1) % zone::ZONE_TYPE_COUNT);
+    }
+    m_next_type[player_id] = t;
+}
 
-            // Check zone state is Designated
-            zone::ZoneState zone_state;
-            if (!m_zone_system->get_zone_state(x, y, zone_state)) {
-                continue;
-            }
-            if (zone_state != zone::ZoneState::Designated) {
-                continue;
-            }
+bool BuildingSpawningLoop::try_spawn_at(int32_t x, int32_t y, uint8_t player_id, uint32_t current_tick) {
+    // Check spawn preconditions via BuildingSpawnChecker
+    if (!m_checker->can_spawn_building(x, y, player_id)) {
+        return false;
+    }
 
-            // Check spawn preconditions via BuildingSpawnChecker
-            if (!m_checker->can_spawn_building(x, y, player_id)) {
-                continue;
-            }
+    // Get zone type and density for template selection
+    zone::ZoneType zone_type;
+    if (!m_zone_system->get_zone_type(x, y, zone_type)) {
+        return false;
+    }
 
-            // Get zone type and density for template selection
-            zone::ZoneType zone_type;
-            if (!m_zone_system->get_zone_type(x, y, zone_type)) {
-                continue;
-            }
+    zone::ZoneDensity zone_density;
+    if (!m_zone_system->get_zone_density(x, y, zone_density)) {
+        return false;
+    }
 
-            zone::ZoneDensity zone_density;
-            if (!m_zone_system->get_zone_density(x, y, zone_density)) {
+    // Convert zone types to building types
+    ZoneBuildingType building_zone_type = static_cast<ZoneBuildingType>(static_cast<uint8_t>(zone_type));
+    DensityLevel density_level = static_cast<DensityLevel>(static_cast<uint8_t>(zone_density));
+
+    // Get neighbor template IDs from BuildingGrid (4 orthogonal positions)
+    std::vector<uint32_t> neighbor_ids;
+    // Up
+    uint32_t up_id = m_grid->get_building_at(x, y - 1);
+    neighbor_ids.push_back(up_id);
+    // Down
+    uint32_t down_id = m_grid->get_building_at(x, y + 1);
+    neighbor_ids.push_back(down_id);
+    // Left
+    uint32_t left_id = m_grid->get_building_at(x - 1, y);
+    neighbor_ids.push_back(left_id);
+    // Right
+    uint32_t right_id = m_grid->get_building_at(x + 1, y);
+    neighbor_ids.push_back(right_id);
+
+    // For neighbor template IDs, look up the actual template_id from entities
+    std::vector<uint32_t> neighbor_template_ids;
+    for (uint32_t eid : neighbor_ids) {
+        if (eid != INVALID_ENTITY) {
+            const BuildingEntity* entity = m_factory->get_entity(eid);
+            if (entity) {
+                neighbor_template_ids.push_back(entity->building.template_id);
                 continue;
             }
+        }
+        neighbor_template_ids.push_back(0);
+    }
 
-            // Convert zone types to building types
-            ZoneBuildingType building_zone_type = static_cast<ZoneBuildingType>(static_cast<uint8_t>(zone_type));
-            DensityLevel density_level = static_cast<DensityLevel>(static_cast<uint8_t>(zone_density));
-
-            // Get neighbor template IDs from BuildingGrid (4 orthogonal positions)
-            std::vector<uint32_t> neighbor_ids;
-            // Up
-            uint32_t up_id = m_grid->get_building_at(x, y - 1);
-            neighbor_ids.push_back(up_id);
-            // Down
-            uint32_t down_id = m_grid->get_building_at(x, y + 1);
-            neighbor_ids.push_back(down_id);
-            // Left
-            uint32_t left_id = m_grid->get_building_at(x - 1, y);
-            neighbor_ids.push_back(left_id);
-            // Right
-            uint32_t right_id = m_grid->get_building_at(x + 1, y);
-            neighbor_ids.push_back(right_id);
-
-            // For neighbor template IDs, look up the actual template_id from entities
-            std::vector<uint32_t> neighbor_template_ids;
-            for (uint32_t eid : neighbor_ids) {
-                if (eid != INVALID_ENTITY) {
-                    const BuildingEntity* entity = m_factory->get_entity(eid);
-                    if (entity) {
-                        neighbor_template_ids.push_back(entity->building.template_id);
-                        continue;
-                    }
-                }
-                neighbor_template_ids.push_back(0);
-            }
-
-            // Default desirability (50.0f stub value)
-            float desirability = 50.0f;
-
-            // Select a template
-            TemplateSelectionResult selection = select_template(
-                *m_registry,
-                building_zone_type,
-                density_level,
-                desirability,
-                x, y,
-                static_cast<uint64_t>(current_tick),
-                neighbor_template_ids
-            );
-
-            // If no valid template was selected, skip
-            if (selection.template_id == 0) {
-                continue;
-            }
+    // Default desirability (50.0f stub value)
+    float desirability = 50.0f;
+
+    // Select a template
+    TemplateSelectionResult selection = select_template(
+        *m_registry,
+        building_zone_type,
+        density_level,
+        desirability,
+        x, y,
+        static_cast<uint64_t>(current_tick),
+        neighbor_template_ids
+    );
+
+    // If no valid template was selected, skip
+    if (selection.template_id == 0) {
+        return false;
+    }
 
-            // Get the full template
-            const BuildingTemplate& templ = m_registry->get_template(selection.template_id);
+    // Get the full template
+    const BuildingTemplate& templ = m_registry->get_template(selection.template_id);
 
-            // Spawn the building
-            m_factory->spawn_building(templ, selection, x, y, player_id, current_tick);
-            ++spawn_count;
-            ++m_total_spawned;
-        }
-    }
+    // Spawn the building
+    m_factory->spawn_building(templ, selection, x, y, player_id, current_tick);
+    ++m_total_spawned;
+    return true;
 }
 
 void BuildingSpawningLoop::set_config(const SpawningConfig& config) {
@@ -7,6 +7,7 @@
  */
 
 #include <sims3000/contamination/ContaminationDecay.h>
+#include <algorithm>
 
 namespace sims3000 {
 namespace contamination {
@@ -29,28 +30,41 @@ uint8_t calculate_decay_rate(const DecayTileInfo& info) {
 
 void apply_contamination_decay(ContaminationGrid& grid,
                                 const DecayTileInfo* tile_info) {
-    const uint16_t width = grid.get_width();
-    const uint16_t height = grid.get_height();
-
-    for (int32_t y = 0; y < height; ++y) {
-        for (int32_t x = 0; x < width; ++x) {
-            // Skip tiles with no contamination
-            uint8_t level = grid.get_level(x, y);
-            if (level == 0) {
+    const int32_t width = grid.get_width();
+    const int32_t height = grid.get_height();
+    const TileActivityMask& activity = grid.get_activity();
+
+    // Only blocks holding contamination can decay
+    for (uint32_t by = 0; by < activity.blocks_y(); ++by) {
+        const int32_t y0 = static_cast<int32_t>(by << TILE_BLOCK_SHIFT);
+        const int32_t y1 = std::min(y0 + static_cast<int32_t>(TILE_BLOCK_SIZE), height);
+        for (uint32_t bx = 0; bx < activity.blocks_x(); ++bx) {
+            if (!activity.is_block_active(bx, by)) {
                 continue;
             }
+            const int32_t x0 = static_cast<int32_t>(bx << TILE_BLOCK_SHIFT);
+            const int32_t x1 = std::min(x0 + static_cast<int32_t>(TILE_BLOCK_SIZE), width);
+            for (int32_t y = y0; y < y1; ++y) {
+                for (int32_t x = x0; x < x1; ++x) {
+                    // Skip tiles with no contamination
+                    uint8_t level = grid.get_level(x, y);
+                    if (level == 0) {
+                        continue;
+                    }
 
-            uint8_t decay_rate;
-            if (tile_info == nullptr) {
-                // Uniform base decay only
-                decay_rate = BASE_DECAY_RATE;
-            } else {
-                // Calculate decay based on environmental factors
-                const size_t index = static_cast<size_t>(y) * width + static_cast<size_t>(x);
-                decay_rate = calculate_decay_rate(tile_info[index]);
-            }
+                    uint8_t decay_rate;
+                    if (tile_info == nullptr) {
+                        // Uniform base decay only
+                        decay_rate = BASE_DECAY_RATE;
+                    } else {
+                        // Calculate decay based on environmental factors
+                        const size_t index = static_cast<size_t>(y) * width + static_cast<size_t>(x);
+                        decay_rate = calculate_decay_rate(tile_info[index]);
+                    }
 
-            grid.apply_decay(x, y, decay_rate);
+                    grid.apply_decay(x, y, decay_rate);
+                }
+            }
         }
     }
 }
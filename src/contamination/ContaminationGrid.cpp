@@ -7,6 +7,7 @@
  */
 
 #include <sims3000/contamination/ContaminationGrid.h>
+#include <sims3000/core/BytePlane.h>
 #include <algorithm>
 
 namespace sims3000 {
@@ -15,9 +16,12 @@ namespace contamination {
 ContaminationGrid::ContaminationGrid(uint16_t width, uint16_t height)
     : m_width(width)
     , m_height(height)
-    , m_grid(static_cast<size_t>(width) * height)
-    , m_previous_grid(static_cast<size_t>(width) * height)
-    , m_level_cache(static_cast<size_t>(width) * height, 0)
+    , m_levels(static_cast<size_t>(width) * height, 0)
+    , m_types(static_cast<size_t>(width) * height, 0)
+    , m_previous_levels(static_cast<size_t>(width) * height, 0)
+    , m_previous_types(static_cast<size_t>(width) * height, 0)
+    , m_activity(width, height)
+    , m_previous_activity(width, height)
 {
 }
 
@@ -33,22 +37,23 @@ uint8_t ContaminationGrid::get_level(int32_t x, int32_t y) const {
     if (!is_valid(x, y)) {
         return 0;
     }
-    return m_grid[index(x, y)].level;
+    return m_levels[index(x, y)];
 }
 
 uint8_t ContaminationGrid::get_dominant_type(int32_t x, int32_t y) const {
     if (!is_valid(x, y)) {
         return 0;
     }
-    return m_grid[index(x, y)].dominant_type;
+    return m_types[index(x, y)];
 }
 
 void ContaminationGrid::set_level(int32_t x, int32_t y, uint8_t level) {
     if (!is_valid(x, y)) {
         return;
     }
-    m_grid[index(x, y)].level = level;
-    m_level_cache_dirty = true;
+    size_t idx = index(x, y);
+    m_activity.on_tile_changed(x, y, m_levels[idx], level);
+    m_levels[idx] = level;
 }
 
 void ContaminationGrid::add_contamination(int32_t x, int32_t y, uint8_t amount, uint8_t type) {
@@ -56,18 +61,17 @@ void ContaminationGrid::add_contamination(int32_t x, int32_t y, uint8_t amount,
         return;
     }
     size_t idx = index(x, y);
-    ContaminationCell& cell = m_grid[idx];
 
-    uint16_t sum = static_cast<uint16_t>(cell.level) + static_cast<uint16_t>(amount);
-    cell.level = sum > 255 ? 255 : static_cast<uint8_t>(sum);
+    uint16_t sum = static_cast<uint16_t>(m_levels[idx]) + static_cast<uint16_t>(amount);
+    uint8_t level = sum > 255 ? 255 : static_cast<uint8_t>(sum);
+    m_activity.on_tile_changed(x, y, m_levels[idx], level);
+    m_levels[idx] = level;
 
     // Update dominant type: if the cell was empty or the new contribution
     // is significant, adopt the new type
-    if (cell.dominant_type == 0 || amount > 0) {
-        cell.dominant_type = type;
+    if (m_types[idx] == 0 || amount > 0) {
+        m_types[idx] = type;
     }
-
-    m_level_cache_dirty = true;
 }
 
 void ContaminationGrid::apply_decay(int32_t x, int32_t y, uint8_t amount) {
@@ -75,35 +79,70 @@ void ContaminationGrid::apply_decay(int32_t x, int32_t y, uint8_t amount) {
         return;
     }
     size_t idx = index(x, y);
-    ContaminationCell& cell = m_grid[idx];
 
-    if (cell.level <= amount) {
-        cell.level = 0;
-        cell.dominant_type = 0;
+    if (m_levels[idx] <= amount) {
+        m_activity.on_tile_changed(x, y, m_levels[idx], 0);
+        m_levels[idx] = 0;
+        m_types[idx] = 0;
     } else {
-        cell.level = cell.level - amount;
+        m_levels[idx] = m_levels[idx] - amount;
     }
-
-    m_level_cache_dirty = true;
 }
 
 uint8_t ContaminationGrid::get_level_previous_tick(int32_t x, int32_t y) const {
     if (!is_valid(x, y)) {
         return 0;
     }
-    return m_previous_grid[index(x, y)].level;
+    return m_previous_levels[index(x, y)];
 }
 
 uint8_t ContaminationGrid::get_dominant_type_previous_tick(int32_t x, int32_t y) const {
     if (!is_valid(x, y)) {
         return 0;
     }
-    return m_previous_grid[index(x, y)].dominant_type;
+    return m_previous_types[index(x, y)];
+}
+
+const uint8_t* ContaminationGrid::get_previous_level_data() const {
+    return m_previous_levels.data();
+}
+
+const uint8_t* ContaminationGrid::get_previous_type_data() const {
+    return m_previous_types.data();
+}
+
+void ContaminationGrid::add_contamination_span(int32_t x, int32_t y, uint32_t count,
+                                               const uint8_t* amounts, const uint8_t* types) {
+    // Saturating add; a non-zero amount always adopts the contributing
+    // type (see add_contamination)
+    const size_t start = index(x, y);
+    uint8_t* levels = m_levels.data() + start;
+    uint8_t* cell_types = m_types.data() + start;
+    for (uint32_t i = 0; i < count; ++i) {
+        const uint8_t amount = amounts[i];
+        if (amount == 0) {
+            continue;
+        }
+        const uint16_t sum = static_cast<uint16_t>(levels[i]) + amount;
+        const uint8_t level = sum > 255 ? 255 : static_cast<uint8_t>(sum);
+        m_activity.on_tile_changed(x + static_cast<int32_t>(i), y, levels[i], level);
+        levels[i] = level;
+        cell_types[i] = types[i];
+    }
+}
+
+const TileActivityMask& ContaminationGrid::get_activity() const {
+    return m_activity;
+}
+
+const TileActivityMask& ContaminationGrid::get_previous_activity() const {
+    return m_previous_activity;
 }
 
 void ContaminationGrid::swap_buffers() {
-    std::swap(m_grid, m_previous_grid);
-    m_level_cache_dirty = true;
+    std::swap(m_levels, m_previous_levels);
+    std::swap(m_types, m_previous_types);
+    m_activity.swap(m_previous_activity);
 }
 
 uint32_t ContaminationGrid::get_total_contamination() const {
@@ -111,42 +150,29 @@ uint32_t ContaminationGrid::get_total_contamination() const {
 }
 
 uint32_t ContaminationGrid::get_toxic_tiles(uint8_t threshold) const {
-    uint32_t count = 0;
-    for (size_t i = 0; i < m_grid.size(); ++i) {
-        if (m_grid[i].level >= threshold) {
-            ++count;
-        }
-    }
-    return count;
+    return byte_plane_count_at_least(m_levels.data(), m_levels.size(), threshold);
 }
 
 void ContaminationGrid::update_stats() {
-    m_total_contamination = 0;
-    m_toxic_tiles = 0;
-    for (size_t i = 0; i < m_grid.size(); ++i) {
-        m_total_contamination += m_grid[i].level;
-        if (m_grid[i].level >= 128) {
-            ++m_toxic_tiles;
-        }
-    }
+    m_total_contamination = byte_plane_sum(m_levels.data(), m_levels.size());
+    m_toxic_tiles = byte_plane_count_at_least(m_levels.data(), m_levels.size(), 128);
 }
 
 const uint8_t* ContaminationGrid::get_level_data() const {
-    if (m_level_cache_dirty) {
-        for (size_t i = 0; i < m_grid.size(); ++i) {
-            m_level_cache[i] = m_grid[i].level;
-        }
-        m_level_cache_dirty = false;
-    }
-    return m_level_cache.data();
+    return m_levels.data();
+}
+
+const uint8_t* ContaminationGrid::get_type_data() const {
+    return m_types.data();
 }
 
 void ContaminationGrid::clear() {
-    ContaminationCell empty;
-    std::fill(m_grid.begin(), m_grid.end(), empty);
-    std::fill(m_previous_grid.begin(), m_previous_grid.end(), empty);
-    std::fill(m_level_cache.begin(), m_level_cache.end(), static_cast<uint8_t>(0));
-    m_level_cache_dirty = false;
+    std::fill(m_levels.begin(), m_levels.end(), static_cast<uint8_t>(0));
+    std::fill(m_types.begin(), m_types.end(), static_cast<uint8_t>(0));
+    std::fill(m_previous_levels.begin(), m_previous_levels.end(), static_cast<uint8_t>(0));
+    std::fill(m_previous_types.begin(), m_previous_types.end(), static_cast<uint8_t>(0));
+    m_activity.clear();
+    m_previous_activity.clear();
     m_total_contamination = 0;
     m_toxic_tiles = 0;
 }
@@ -2,118 +2,341 @@
  * @file ContaminationSpread.cpp
  * @brief Implementation of contamination spread algorithm.
  *
+ * The spread is computed as a gather over padded planes rather than a
+ * scatter from each source:
+ * 1. The previous tick is split into a level plane (tiles below the
+ *    threshold zeroed, so they contribute nothing) and a type plane, each
+ *    with a one-tile zero border so edge tiles need no bounds checks.
+ * 2. Each target tile sums level/8 from its 4 cardinal neighbours and
+ *    level/16 from its 4 diagonals with saturating byte adds. Rows are
+ *    processed 32 (AVX2) or 16 (SSE2) tiles at a time, with a scalar
+ *    tail and a scalar fallback on other targets.
+ * 3. The deltas are added to the current buffer one row run at a time.
+ *
+ * Only 16x16 blocks that held non-zero levels last tick (per the grid's
+ * TileActivityMask) are copied, and only those blocks plus a one-block
+ * halo are gathered, so clean regions of the map cost a flag test.
+ *
+ * The scatter version let the last spreading source (in row-major order)
+ * set a target's type. Every source at or above the threshold reaches all
+ * 8 neighbours, so the last writer is the active neighbour latest in
+ * row-major order; the gather selects it with a fixed blend order.
+ *
+ * The largest possible delta is 4 * (255/8) + 4 * (255/16) = 184, so the
+ * saturating adds never clamp and results match the scatter exactly.
+ *
  * @see ContaminationSpread.h for algorithm documentation.
  * @see E10-087
  */
 
 #include <sims3000/contamination/ContaminationSpread.h>
+#include <algorithm>
 #include <vector>
+#include <cstddef>
+#include <cstring>
 #include <cstdint>
 
+// SIMS3000_NO_SIMD forces the scalar path (for testing and odd targets)
+#if defined(SIMS3000_NO_SIMD)
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#define SIMS3000_SPREAD_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SIMS3000_SPREAD_SSE2 1
+#endif
+
 namespace sims3000 {
 namespace contamination {
 
 namespace {
 
 /**
- * @brief Cardinal direction offsets (N, S, E, W).
+ * @brief Padded level/type planes and delta output, reused across calls.
+ *
+ * The padded planes persist between calls; only blocks that are active
+ * now or were copied last call are rewritten, so their cost follows the
+ * active area rather than the map size.
  */
-constexpr int32_t CARDINAL_OFFSETS[4][2] = {
-    {0, -1},  // North
-    {0, 1},   // South
-    {1, 0},   // East
-    {-1, 0}   // West
+struct SpreadScratch {
+    int32_t width = -1;            ///< Grid width the planes are sized for
+    int32_t height = -1;           ///< Grid height the planes are sized for
+    std::vector<uint8_t> levels;   ///< (w+2) x (h+2), below-threshold tiles zeroed
+    std::vector<uint8_t> types;    ///< (w+2) x (h+2) dominant types
+    std::vector<uint8_t> filled;   ///< Per block: levels may hold non-zero data
+    std::vector<uint8_t> halo;     ///< Per block: active or next to an active block
+    std::vector<uint8_t> amounts;  ///< One row of spread deltas
+    std::vector<uint8_t> delta_types; ///< One row of contributing types
 };
 
 /**
- * @brief Diagonal direction offsets (NE, NW, SE, SW).
+ * @brief Pointers to the three padded rows around a target row.
+ *
+ * Each pointer addresses padded column x + 1, i.e. the tile directly
+ * above / at / below target column x.
  */
-constexpr int32_t DIAGONAL_OFFSETS[4][2] = {
-    {1, -1},  // Northeast
-    {-1, -1}, // Northwest
-    {1, 1},   // Southeast
-    {-1, 1}   // Southwest
+struct SpreadRows {
+    const uint8_t* up_level;
+    const uint8_t* mid_level;
+    const uint8_t* down_level;
+    const uint8_t* up_type;
+    const uint8_t* mid_type;
+    const uint8_t* down_type;
+    uint8_t* out_amount;
+    uint8_t* out_type;
 };
 
+inline uint8_t add_sat(uint8_t a, uint8_t b) {
+    const uint16_t sum = static_cast<uint16_t>(a) + b;
+    return sum > 255 ? 255 : static_cast<uint8_t>(sum);
+}
+
 /**
- * @brief Structure to hold spread delta for a single cell.
+ * @brief Scalar spread for target columns [x_begin, x_end) of one row.
  */
-struct SpreadDelta {
-    uint8_t amount = 0;
-    uint8_t type = 0;
-};
+void spread_row_scalar(const SpreadRows& r, int32_t x_begin, int32_t x_end) {
+    for (int32_t x = x_begin; x < x_end; ++x) {
+        // Cardinals (N, S, W, E) then diagonals (NW, NE, SW, SE)
+        uint8_t amount = 0;
+        amount = add_sat(amount, r.up_level[x] / 8);
+        amount = add_sat(amount, r.down_level[x] / 8);
+        amount = add_sat(amount, r.mid_level[x - 1] / 8);
+        amount = add_sat(amount, r.mid_level[x + 1] / 8);
+        amount = add_sat(amount, r.up_level[x - 1] / 16);
+        amount = add_sat(amount, r.up_level[x + 1] / 16);
+        amount = add_sat(amount, r.down_level[x - 1] / 16);
+        amount = add_sat(amount, r.down_level[x + 1] / 16);
 
-} // anonymous namespace
+        // Type of the active neighbour last in row-major order
+        uint8_t type = 0;
+        if (r.up_level[x - 1])   type = r.up_type[x - 1];
+        if (r.up_level[x])       type = r.up_type[x];
+        if (r.up_level[x + 1])   type = r.up_type[x + 1];
+        if (r.mid_level[x - 1])  type = r.mid_type[x - 1];
+        if (r.mid_level[x + 1])  type = r.mid_type[x + 1];
+        if (r.down_level[x - 1]) type = r.down_type[x - 1];
+        if (r.down_level[x])     type = r.down_type[x];
+        if (r.down_level[x + 1]) type = r.down_type[x + 1];
 
-void apply_contamination_spread(ContaminationGrid& grid) {
-    const uint16_t width = grid.get_width();
-    const uint16_t height = grid.get_height();
-    const size_t grid_size = static_cast<size_t>(width) * height;
+        r.out_amount[x] = amount;
+        r.out_type[x] = type;
+    }
+}
 
-    // Delta buffer to accumulate spread amounts
-    std::vector<SpreadDelta> deltas(grid_size);
+#if defined(SIMS3000_SPREAD_AVX2)
 
-    // Phase 1: Calculate all spread amounts and accumulate in delta buffer
-    for (int32_t y = 0; y < height; ++y) {
-        for (int32_t x = 0; x < width; ++x) {
-            // Read from previous tick buffer
-            const uint8_t level = grid.get_level_previous_tick(x, y);
+constexpr int32_t SPREAD_LANES = 32;
 
-            // Skip if below threshold
-            if (level < CONTAM_SPREAD_THRESHOLD) {
-                continue;
-            }
+inline __m256i load(const uint8_t* p) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
 
-            const uint8_t dominant_type = grid.get_dominant_type_previous_tick(x, y);
+/// Per-byte v >> shift (there is no byte shift; shift words and mask).
+inline __m256i shr_bytes(__m256i v, int shift, __m256i mask) {
+    return _mm256_and_si256(_mm256_srli_epi16(v, shift), mask);
+}
 
-            // Calculate spread amounts
-            const uint8_t cardinal_spread = level / 8;
-            const uint8_t diagonal_spread = level / 16;
+/// type = level != 0 ? neighbour_type : type
+inline __m256i select_active(__m256i type, const uint8_t* level, const uint8_t* ntype) {
+    const __m256i inactive = _mm256_cmpeq_epi8(load(level), _mm256_setzero_si256());
+    return _mm256_blendv_epi8(load(ntype), type, inactive);
+}
 
-            // Spread to cardinal neighbors
-            for (int i = 0; i < 4; ++i) {
-                const int32_t nx = x + CARDINAL_OFFSETS[i][0];
-                const int32_t ny = y + CARDINAL_OFFSETS[i][1];
+/// Vector spread over whole vectors of a row; returns the first column left for the scalar tail.
+int32_t spread_row_simd(const SpreadRows& r, int32_t width) {
+    const __m256i mask8 = _mm256_set1_epi8(0x1F);
+    const __m256i mask16 = _mm256_set1_epi8(0x0F);
+    int32_t x = 0;
+    for (; x + SPREAD_LANES <= width; x += SPREAD_LANES) {
+        __m256i amount = shr_bytes(load(r.up_level + x), 3, mask8);
+        amount = _mm256_adds_epu8(amount, shr_bytes(load(r.down_level + x), 3, mask8));
+        amount = _mm256_adds_epu8(amount, shr_bytes(load(r.mid_level + x - 1), 3, mask8));
+        amount = _mm256_adds_epu8(amount, shr_bytes(load(r.mid_level + x + 1), 3, mask8));
+        amount = _mm256_adds_epu8(amount, shr_bytes(load(r.up_level + x - 1), 4, mask16));
+        amount = _mm256_adds_epu8(amount, shr_bytes(load(r.up_level + x + 1), 4, mask16));
+        amount = _mm256_adds_epu8(amount, shr_bytes(load(r.down_level + x - 1), 4, mask16));
+        amount = _mm256_adds_epu8(amount, shr_bytes(load(r.down_level + x + 1), 4, mask16));
 
-                if (grid.is_valid(nx, ny) && cardinal_spread > 0) {
-                    const size_t idx = static_cast<size_t>(ny) * width + static_cast<size_t>(nx);
+        __m256i type = _mm256_setzero_si256();
+        type = select_active(type, r.up_level + x - 1, r.up_type + x - 1);
+        type = select_active(type, r.up_level + x, r.up_type + x);
+        type = select_active(type, r.up_level + x + 1, r.up_type + x + 1);
+        type = select_active(type, r.mid_level + x - 1, r.mid_type + x - 1);
+        type = select_active(type, r.mid_level + x + 1, r.mid_type + x + 1);
+        type = select_active(type, r.down_level + x - 1, r.down_type + x - 1);
+        type = select_active(type, r.down_level + x, r.down_type + x);
+        type = select_active(type, r.down_level + x + 1, r.down_type + x + 1);
 
-                    // Accumulate spread amount (saturate at 255)
-                    const uint16_t new_amount = static_cast<uint16_t>(deltas[idx].amount) + cardinal_spread;
-                    deltas[idx].amount = (new_amount > 255) ? 255 : static_cast<uint8_t>(new_amount);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(r.out_amount + x), amount);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(r.out_type + x), type);
+    }
+    return x;
+}
 
-                    // Use the dominant type from the spreading cell
-                    // (In case of multiple sources, the last one wins - simple resolution)
-                    deltas[idx].type = dominant_type;
-                }
-            }
+#elif defined(SIMS3000_SPREAD_SSE2)
 
-            // Spread to diagonal neighbors
-            for (int i = 0; i < 4; ++i) {
-                const int32_t nx = x + DIAGONAL_OFFSETS[i][0];
-                const int32_t ny = y + DIAGONAL_OFFSETS[i][1];
+constexpr int32_t SPREAD_LANES = 16;
 
-                if (grid.is_valid(nx, ny) && diagonal_spread > 0) {
-                    const size_t idx = static_cast<size_t>(ny) * width + static_cast<size_t>(nx);
+inline __m128i load(const uint8_t* p) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
 
-                    // Accumulate spread amount (saturate at 255)
-                    const uint16_t new_amount = static_cast<uint16_t>(deltas[idx].amount) + diagonal_spread;
-                    deltas[idx].amount = (new_amount > 255) ? 255 : static_cast<uint8_t>(new_amount);
+/// Per-byte v >> shift (there is no byte shift; shift words and mask).
+inline __m128i shr_bytes(__m128i v, int shift, __m128i mask) {
+    return _mm_and_si128(_mm_srli_epi16(v, shift), mask);
+}
 
-                    deltas[idx].type = dominant_type;
+/// type = level != 0 ? neighbour_type : type
+inline __m128i select_active(__m128i type, const uint8_t* level, const uint8_t* ntype) {
+    const __m128i inactive = _mm_cmpeq_epi8(load(level), _mm_setzero_si128());
+    return _mm_or_si128(_mm_and_si128(inactive, type), _mm_andnot_si128(inactive, load(ntype)));
+}
+
+/// Vector spread over whole vectors of a row; returns the first column left for the scalar tail.
+int32_t spread_row_simd(const SpreadRows& r, int32_t width) {
+    const __m128i mask8 = _mm_set1_epi8(0x1F);
+    const __m128i mask16 = _mm_set1_epi8(0x0F);
+    int32_t x = 0;
+    for (; x + SPREAD_LANES <= width; x += SPREAD_LANES) {
+        __m128i amount = shr_bytes(load(r.up_level + x), 3, mask8);
+        amount = _mm_adds_epu8(amount, shr_bytes(load(r.down_level + x), 3, mask8));
+        amount = _mm_adds_epu8(amount, shr_bytes(load(r.mid_level + x - 1), 3, mask8));
+        amount = _mm_adds_epu8(amount, shr_bytes(load(r.mid_level + x + 1), 3, mask8));
+        amount = _mm_adds_epu8(amount, shr_bytes(load(r.up_level + x - 1), 4, mask16));
+        amount = _mm_adds_epu8(amount, shr_bytes(load(r.up_level + x + 1), 4, mask16));
+        amount = _mm_adds_epu8(amount, shr_bytes(load(r.down_level + x - 1), 4, mask16));
+        amount = _mm_adds_epu8(amount, shr_bytes(load(r.down_level + x + 1), 4, mask16));
+
+        __m128i type = _mm_setzero_si128();
+        type = select_active(type, r.up_level + x - 1, r.up_type + x - 1);
+        type = select_active(type, r.up_level + x, r.up_type + x);
+        type = select_active(type, r.up_level + x + 1, r.up_type + x + 1);
+        type = select_active(type, r.mid_level + x - 1, r.mid_type + x - 1);
+        type = select_active(type, r.mid_level + x + 1, r.mid_type + x + 1);
+        type = select_active(type, r.down_level + x - 1, r.down_type + x - 1);
+        type = select_active(type, r.down_level + x, r.down_type + x);
+        type = select_active(type, r.down_level + x + 1, r.down_type + x + 1);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(r.out_amount + x), amount);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(r.out_type + x), type);
+    }
+    return x;
+}
+
+#else
+
+/// No vector unit: everything goes through the scalar tail.
+int32_t spread_row_simd(const SpreadRows& /*r*/, int32_t /*width*/) {
+    return 0;
+}
+
+#endif
+
+} // anonymous namespace
+
+void apply_contamination_spread(ContaminationGrid& grid) {
+    const int32_t width = grid.get_width();
+    const int32_t height = grid.get_height();
+    if (width == 0 || height == 0) {
+        return;
+    }
+    const size_t padded_width = static_cast<size_t>(width) + 2;
+    const size_t padded_size = padded_width * (static_cast<size_t>(height) + 2);
+    const TileActivityMask& activity = grid.get_previous_activity();
+    const uint32_t blocks_x = activity.blocks_x();
+    const uint32_t blocks_y = activity.blocks_y();
+
+    // Scratch planes are kept per thread to avoid a full-grid allocation each tick
+    thread_local SpreadScratch scratch;
+    if (scratch.width != width || scratch.height != height) {
+        scratch.width = width;
+        scratch.height = height;
+        scratch.levels.assign(padded_size, 0);
+        scratch.types.assign(padded_size, 0);
+        scratch.filled.assign(static_cast<size_t>(blocks_x) * blocks_y, 0);
+        scratch.amounts.resize(static_cast<size_t>(width));
+        scratch.delta_types.resize(static_cast<size_t>(width));
+    }
+
+    // Phase 1: copy active blocks of the previous tick into the padded
+    // planes (zeroing levels too low to spread) and clear blocks copied
+    // last call that have since gone inactive
+    const uint8_t* previous_levels = grid.get_previous_level_data();
+    const uint8_t* previous_types = grid.get_previous_type_data();
+    for (uint32_t by = 0; by < blocks_y; ++by) {
+        const int32_t y0 = static_cast<int32_t>(by << TILE_BLOCK_SHIFT);
+        const int32_t y1 = std::min(y0 + static_cast<int32_t>(TILE_BLOCK_SIZE), height);
+        for (uint32_t bx = 0; bx < blocks_x; ++bx) {
+            uint8_t& filled = scratch.filled[static_cast<size_t>(by) * blocks_x + bx];
+            const bool active = activity.is_block_active(bx, by);
+            if (!active && !filled) {
+                continue;
+            }
+            const int32_t x0 = static_cast<int32_t>(bx << TILE_BLOCK_SHIFT);
+            const size_t run = static_cast<size_t>(
+                std::min(x0 + static_cast<int32_t>(TILE_BLOCK_SIZE), width) - x0);
+            for (int32_t y = y0; y < y1; ++y) {
+                uint8_t* level_row = scratch.levels.data() + (static_cast<size_t>(y) + 1) * padded_width + 1 + x0;
+                if (!active) {
+                    std::memset(level_row, 0, run);
+                    continue;
                 }
+                const size_t row = static_cast<size_t>(y) * width + x0;
+                const uint8_t* src_levels = previous_levels + row;
+                for (size_t x = 0; x < run; ++x) {
+                    const uint8_t level = src_levels[x];
+                    level_row[x] = (level >= CONTAM_SPREAD_THRESHOLD) ? level : 0;
+                }
+                uint8_t* type_row = scratch.types.data() + (static_cast<size_t>(y) + 1) * padded_width + 1 + x0;
+                std::memcpy(type_row, previous_types + row, run);
             }
+            filled = active ? 1 : 0;
         }
     }
 
-    // Phase 2: Apply all deltas to the current buffer
-    for (int32_t y = 0; y < height; ++y) {
-        for (int32_t x = 0; x < width; ++x) {
-            const size_t idx = static_cast<size_t>(y) * width + static_cast<size_t>(x);
-            const SpreadDelta& delta = deltas[idx];
+    // Phase 2: gather spread amounts and types over runs of blocks that
+    // are active or border an active block, and add them to the current
+    // buffer row by row
+    activity.build_halo(scratch.halo);
+    for (uint32_t by = 0; by < blocks_y; ++by) {
+        const int32_t y0 = static_cast<int32_t>(by << TILE_BLOCK_SHIFT);
+        const int32_t y1 = std::min(y0 + static_cast<int32_t>(TILE_BLOCK_SIZE), height);
+        const uint8_t* halo_row = scratch.halo.data() + static_cast<size_t>(by) * blocks_x;
+        uint32_t bx = 0;
+        while (bx < blocks_x) {
+            if (!halo_row[bx]) {
+                ++bx;
+                continue;
+            }
+            const uint32_t run_begin = bx;
+            while (bx < blocks_x && halo_row[bx]) {
+                ++bx;
+            }
+            const int32_t x0 = static_cast<int32_t>(run_begin << TILE_BLOCK_SHIFT);
+            const int32_t x1 = std::min(static_cast<int32_t>(bx << TILE_BLOCK_SHIFT), width);
+            const int32_t run = x1 - x0;
+
+            for (int32_t y = y0; y < y1; ++y) {
+                const size_t up = static_cast<size_t>(y) * padded_width + 1 + x0;
+                const size_t mid = up + padded_width;
+                const size_t down = mid + padded_width;
+
+                SpreadRows rows{
+                    scratch.levels.data() + up,
+                    scratch.levels.data() + mid,
+                    scratch.levels.data() + down,
+                    scratch.types.data() + up,
+                    scratch.types.data() + mid,
+                    scratch.types.data() + down,
+                    scratch.amounts.data(),
+                    scratch.delta_types.data()
+                };
+                const int32_t done = spread_row_simd(rows, run);
+                spread_row_scalar(rows, done, run);
 
-            if (delta.amount > 0) {
-                grid.add_contamination(x, y, delta.amount, delta.type);
+                // Phase 3: apply this row's deltas to the current buffer
+                grid.add_contamination_span(x0, y, static_cast<uint32_t>(run),
+                                            scratch.amounts.data(), scratch.delta_types.data());
             }
         }
     }
@@ -8,11 +8,33 @@
 #include <sims3000/contamination/ContaminationStats.h>
 #include <sims3000/contamination/ContaminationGrid.h>
 #include <sims3000/contamination/ContaminationType.h>
-#include <algorithm>
+#include <sims3000/core/BytePlane.h>
 
 namespace sims3000 {
 namespace contamination {
 
+namespace {
+
+size_t grid_cell_count(const ContaminationGrid& grid) {
+    return static_cast<size_t>(grid.get_width()) * grid.get_height();
+}
+
+/// Count contaminated tiles whose dominant type is `type`, scanning the
+/// level and type planes directly.
+uint32_t count_tiles_of_type(const ContaminationGrid& grid, ContaminationType type) {
+    const uint8_t* levels = grid.get_level_data();
+    const uint8_t* types = grid.get_type_data();
+    const uint8_t wanted = static_cast<uint8_t>(type);
+    const size_t count = grid_cell_count(grid);
+    uint32_t matches = 0;
+    for (size_t i = 0; i < count; ++i) {
+        matches += static_cast<uint32_t>(levels[i] != 0 && types[i] == wanted);
+    }
+    return matches;
+}
+
+} // anonymous namespace
+
 float get_contamination_stat(const ContaminationGrid& grid, uint16_t stat_id) {
     switch (stat_id) {
         case STAT_TOTAL_CONTAMINATION: {
@@ -33,65 +55,23 @@ float get_contamination_stat(const ContaminationGrid& grid, uint16_t stat_id) {
         }
 
         case STAT_MAX_CONTAMINATION: {
-            uint8_t max_level = 0;
-            for (int32_t y = 0; y < grid.get_height(); ++y) {
-                for (int32_t x = 0; x < grid.get_width(); ++x) {
-                    max_level = std::max(max_level, grid.get_level(x, y));
-                }
-            }
-            return static_cast<float>(max_level);
+            return static_cast<float>(byte_plane_max(grid.get_level_data(), grid_cell_count(grid)));
         }
 
         case STAT_INDUSTRIAL_TOTAL: {
-            uint32_t count = 0;
-            for (int32_t y = 0; y < grid.get_height(); ++y) {
-                for (int32_t x = 0; x < grid.get_width(); ++x) {
-                    if (grid.get_level(x, y) > 0 &&
-                        grid.get_dominant_type(x, y) == static_cast<uint8_t>(ContaminationType::Industrial)) {
-                        ++count;
-                    }
-                }
-            }
-            return static_cast<float>(count);
+            return static_cast<float>(count_tiles_of_type(grid, ContaminationType::Industrial));
         }
 
         case STAT_TRAFFIC_TOTAL: {
-            uint32_t count = 0;
-            for (int32_t y = 0; y < grid.get_height(); ++y) {
-                for (int32_t x = 0; x < grid.get_width(); ++x) {
-                    if (grid.get_level(x, y) > 0 &&
-                        grid.get_dominant_type(x, y) == static_cast<uint8_t>(ContaminationType::Traffic)) {
-                        ++count;
-                    }
-                }
-            }
-            return static_cast<float>(count);
+            return static_cast<float>(count_tiles_of_type(grid, ContaminationType::Traffic));
         }
 
         case STAT_ENERGY_TOTAL: {
-            uint32_t count = 0;
-            for (int32_t y = 0; y < grid.get_height(); ++y) {
-                for (int32_t x = 0; x < grid.get_width(); ++x) {
-                    if (grid.get_level(x, y) > 0 &&
-                        grid.get_dominant_type(x, y) == static_cast<uint8_t>(ContaminationType::Energy)) {
-                        ++count;
-                    }
-                }
-            }
-            return static_cast<float>(count);
+            return static_cast<float>(count_tiles_of_type(grid, ContaminationType::Energy));
         }
 
         case STAT_TERRAIN_TOTAL: {
-            uint32_t count = 0;
-            for (int32_t y = 0; y < grid.get_height(); ++y) {
-                for (int32_t x = 0; x < grid.get_width(); ++x) {
-                    if (grid.get_level(x, y) > 0 &&
-                        grid.get_dominant_type(x, y) == static_cast<uint8_t>(ContaminationType::Terrain)) {
-                        ++count;
-                    }
-                }
-            }
-            return static_cast<float>(count);
+            return static_cast<float>(count_tiles_of_type(grid, ContaminationType::Terrain));
         }
 
         default:
@@ -7,8 +7,8 @@
  */
 
 #include <sims3000/disorder/DisorderGrid.h>
+#include <sims3000/core/BytePlane.h>
 #include <algorithm>
-#include <numeric>
 
 namespace sims3000 {
 namespace disorder {
@@ -18,6 +18,8 @@ DisorderGrid::DisorderGrid(uint16_t width, uint16_t height)
     , m_height(height)
     , m_grid(static_cast<size_t>(width) * height, 0)
     , m_previous_grid(static_cast<size_t>(width) * height, 0)
+    , m_activity(width, height)
+    , m_previous_activity(width, height)
 {
 }
 
@@ -40,7 +42,9 @@ void DisorderGrid::set_level(int32_t x, int32_t y, uint8_t level) {
     if (!is_valid(x, y)) {
         return;
     }
-    m_grid[index(x, y)] = level;
+    size_t idx = index(x, y);
+    m_activity.on_tile_changed(x, y, m_grid[idx], level);
+    m_grid[idx] = level;
 }
 
 void DisorderGrid::add_disorder(int32_t x, int32_t y, uint8_t amount) {
@@ -49,7 +53,9 @@ void DisorderGrid::add_disorder(int32_t x, int32_t y, uint8_t amount) {
     }
     size_t idx = index(x, y);
     uint16_t sum = static_cast<uint16_t>(m_grid[idx]) + static_cast<uint16_t>(amount);
-    m_grid[idx] = sum > 255 ? 255 : static_cast<uint8_t>(sum);
+    uint8_t level = sum > 255 ? 255 : static_cast<uint8_t>(sum);
+    m_activity.on_tile_changed(x, y, m_grid[idx], level);
+    m_grid[idx] = level;
 }
 
 void DisorderGrid::apply_suppression(int32_t x, int32_t y, uint8_t amount) {
@@ -58,6 +64,7 @@ void DisorderGrid::apply_suppression(int32_t x, int32_t y, uint8_t amount) {
     }
     size_t idx = index(x, y);
     if (m_grid[idx] <= amount) {
+        m_activity.on_tile_changed(x, y, m_grid[idx], 0);
         m_grid[idx] = 0;
     } else {
         m_grid[idx] = m_grid[idx] - amount;
@@ -73,6 +80,7 @@ uint8_t DisorderGrid::get_level_previous_tick(int32_t x, int32_t y) const {
 
 void DisorderGrid::swap_buffers() {
     std::swap(m_grid, m_previous_grid);
+    m_activity.swap(m_previous_activity);
 }
 
 uint32_t DisorderGrid::get_total_disorder() const {
@@ -80,38 +88,36 @@ uint32_t DisorderGrid::get_total_disorder() const {
 }
 
 uint32_t DisorderGrid::get_high_disorder_tiles(uint8_t threshold) const {
-    // Note: cached value uses default threshold from last update_stats() call.
-    // For non-default thresholds, caller should iterate raw data directly.
-    // This returns the cached value regardless of the threshold parameter,
-    // which is consistent with the spec that stats are "cached, updated on demand".
-    // However, for correctness we recount if needed.
-    uint32_t count = 0;
-    for (size_t i = 0; i < m_grid.size(); ++i) {
-        if (m_grid[i] >= threshold) {
-            ++count;
-        }
-    }
-    return count;
+    // Recounted from the plane so non-default thresholds are exact
+    return byte_plane_count_at_least(m_grid.data(), m_grid.size(), threshold);
 }
 
 void DisorderGrid::update_stats() {
-    m_total_disorder = 0;
-    m_high_disorder_tiles = 0;
-    for (size_t i = 0; i < m_grid.size(); ++i) {
-        m_total_disorder += m_grid[i];
-        if (m_grid[i] >= 128) {
-            ++m_high_disorder_tiles;
-        }
-    }
+    m_total_disorder = byte_plane_sum(m_grid.data(), m_grid.size());
+    m_high_disorder_tiles = byte_plane_count_at_least(m_grid.data(), m_grid.size(), 128);
 }
 
 const uint8_t* DisorderGrid::get_raw_data() const {
     return m_grid.data();
 }
 
+const uint8_t* DisorderGrid::get_previous_raw_data() const {
+    return m_previous_grid.data();
+}
+
+const TileActivityMask& DisorderGrid::get_activity() const {
+    return m_activity;
+}
+
+const TileActivityMask& DisorderGrid::get_previous_activity() const {
+    return m_previous_activity;
+}
+
 void DisorderGrid::clear() {
     std::fill(m_grid.begin(), m_grid.end(), static_cast<uint8_t>(0));
     std::fill(m_previous_grid.begin(), m_previous_grid.end(), static_cast<uint8_t>(0));
+    m_activity.clear();
+    m_previous_activity.clear();
     m_total_disorder = 0;
     m_high_disorder_tiles = 0;
 }
@@ -13,80 +13,127 @@
 namespace sims3000 {
 namespace disorder {
 
+namespace {
+
+/**
+ * @brief Delta buffer and halo flags reused across calls.
+ *
+ * The delta buffer is kept all-zero between calls: entries are only
+ * written inside halo blocks, and step 3 resets them as it applies.
+ */
+struct DisorderSpreadScratch {
+    std::vector<int16_t> delta;
+    std::vector<uint8_t> halo;
+};
+
+} // anonymous namespace
+
 void apply_disorder_spread(DisorderGrid& grid, const std::vector<bool>* water_mask) {
     const uint16_t width = grid.get_width();
     const uint16_t height = grid.get_height();
     const size_t total_cells = static_cast<size_t>(width) * height;
+    const TileActivityMask& activity = grid.get_activity();
+    if (activity.active_block_count() == 0) {
+        return;
+    }
 
     // Step 1: Create delta buffer (signed to allow negative deltas for source cells)
-    std::vector<int16_t> delta(total_cells, 0);
+    thread_local DisorderSpreadScratch scratch;
+    if (scratch.delta.size() != total_cells) {
+        scratch.delta.assign(total_cells, 0);
+    }
+    std::vector<int16_t>& delta = scratch.delta;
+
+    // Sources only live in active blocks; their deltas stay within a
+    // one-block halo, which is captured before any level changes
+    activity.build_halo(scratch.halo);
 
     // 4-neighbor offsets: right, left, down, up
     const int32_t dx[] = { 1, -1, 0, 0 };
     const int32_t dy[] = { 0, 0, 1, -1 };
 
     // Step 2: Calculate deltas
-    for (int32_t y = 0; y < static_cast<int32_t>(height); ++y) {
-        for (int32_t x = 0; x < static_cast<int32_t>(width); ++x) {
-            uint8_t level = grid.get_level(x, y);
-            if (level <= SPREAD_THRESHOLD) {
+    for (uint32_t by = 0; by < activity.blocks_y(); ++by) {
+        const int32_t y0 = static_cast<int32_t>(by << TILE_BLOCK_SHIFT);
+        const int32_t y1 = std::min(y0 + static_cast<int32_t>(TILE_BLOCK_SIZE), static_cast<int32_t>(height));
+        for (uint32_t bx = 0; bx < activity.blocks_x(); ++bx) {
+            if (!activity.is_block_active(bx, by)) {
                 continue;
             }
+            const int32_t x0 = static_cast<int32_t>(bx << TILE_BLOCK_SHIFT);
+            const int32_t x1 = std::min(x0 + static_cast<int32_t>(TILE_BLOCK_SIZE), static_cast<int32_t>(width));
+            for (int32_t y = y0; y < y1; ++y) {
+                for (int32_t x = x0; x < x1; ++x) {
+                    uint8_t level = grid.get_level(x, y);
+                    if (level <= SPREAD_THRESHOLD) {
+                        continue;
+                    }
 
-            uint8_t spread = static_cast<uint8_t>((level - SPREAD_THRESHOLD) / 8);
-            if (spread == 0) {
-                continue;
-            }
+                    uint8_t spread = static_cast<uint8_t>((level - SPREAD_THRESHOLD) / 8);
+                    if (spread == 0) {
+                        continue;
+                    }
 
-            size_t src_idx = static_cast<size_t>(y) * width + static_cast<size_t>(x);
-            int num_valid_neighbors = 0;
+                    size_t src_idx = static_cast<size_t>(y) * width + static_cast<size_t>(x);
+                    int num_valid_neighbors = 0;
 
-            for (int d = 0; d < 4; ++d) {
-                int32_t nx = x + dx[d];
-                int32_t ny = y + dy[d];
+                    for (int d = 0; d < 4; ++d) {
+                        int32_t nx = x + dx[d];
+                        int32_t ny = y + dy[d];
 
-                if (!grid.is_valid(nx, ny)) {
-                    continue;
-                }
+                        if (!grid.is_valid(nx, ny)) {
+                            continue;
+                        }
 
-                // Check water mask
-                if (water_mask != nullptr) {
-                    size_t neighbor_idx = static_cast<size_t>(ny) * width + static_cast<size_t>(nx);
-                    if ((*water_mask)[neighbor_idx]) {
-                        continue;
+                        // Check water mask
+                        size_t neighbor_idx = static_cast<size_t>(ny) * width + static_cast<size_t>(nx);
+                        if (water_mask != nullptr && (*water_mask)[neighbor_idx]) {
+                            continue;
+                        }
+
+                        delta[neighbor_idx] += static_cast<int16_t>(spread);
+                        ++num_valid_neighbors;
                     }
-                }
 
-                size_t neighbor_idx = static_cast<size_t>(ny) * width + static_cast<size_t>(nx);
-                delta[neighbor_idx] += static_cast<int16_t>(spread);
-                ++num_valid_neighbors;
+                    // Source loses spread * num_valid_neighbors
+                    delta[src_idx] -= static_cast<int16_t>(spread) * static_cast<int16_t>(num_valid_neighbors);
+                }
             }
-
-            // Source loses spread * num_valid_neighbors
-            delta[src_idx] -= static_cast<int16_t>(spread) * static_cast<int16_t>(num_valid_neighbors);
         }
     }
 
-    // Step 3: Apply deltas with clamping to [0, 255]
-    for (int32_t y = 0; y < static_cast<int32_t>(height); ++y) {
-        for (int32_t x = 0; x < static_cast<int32_t>(width); ++x) {
-            size_t idx = static_cast<size_t>(y) * width + static_cast<size_t>(x);
-            int16_t d = delta[idx];
-            if (d == 0) {
+    // Step 3: Apply deltas with clamping to [0, 255], resetting the buffer
+    for (uint32_t by = 0; by < activity.blocks_y(); ++by) {
+        const int32_t y0 = static_cast<int32_t>(by << TILE_BLOCK_SHIFT);
+        const int32_t y1 = std::min(y0 + static_cast<int32_t>(TILE_BLOCK_SIZE), static_cast<int32_t>(height));
+        for (uint32_t bx = 0; bx < activity.blocks_x(); ++bx) {
+            if (!scratch.halo[static_cast<size_t>(by) * activity.blocks_x() + bx]) {
                 continue;
             }
+            const int32_t x0 = static_cast<int32_t>(bx << TILE_BLOCK_SHIFT);
+            const int32_t x1 = std::min(x0 + static_cast<int32_t>(TILE_BLOCK_SIZE), static_cast<int32_t>(width));
+            for (int32_t y = y0; y < y1; ++y) {
+                for (int32_t x = x0; x < x1; ++x) {
+                    size_t idx = static_cast<size_t>(y) * width + static_cast<size_t>(x);
+                    int16_t d = delta[idx];
+                    if (d == 0) {
+                        continue;
+                    }
+                    delta[idx] = 0;
 
-            int16_t current = static_cast<int16_t>(grid.get_level(x, y));
-            int16_t new_level = current + d;
+                    int16_t current = static_cast<int16_t>(grid.get_level(x, y));
+                    int16_t new_level = current + d;
 
-            // Clamp to [0, 255]
-            if (new_level < 0) {
-                new_level = 0;
-            } else if (new_level > 255) {
-                new_level = 255;
-            }
+                    // Clamp to [0, 255]
+                    if (new_level < 0) {
+                        new_level = 0;
+                    } else if (new_level > 255) {
+                        new_level = 255;
+                    }
 
-            grid.set_level(x, y, static_cast<uint8_t>(new_level));
+                    grid.set_level(x, y, static_cast<uint8_t>(new_level));
+                }
+            }
         }
     }
 }
@@ -24,12 +24,12 @@
 #include <sims3000/energy/EnergySystem.h>
 #include <sims3000/energy/EnergyComponent.h>
 #include <sims3000/energy/EnergyConduitComponent.h>
+#include <sims3000/energy/EnergyNetworkTraits.h>
 #include <sims3000/energy/NexusTypeConfig.h>
 #include <sims3000/terrain/ITerrainQueryable.h>
 #include <algorithm>
+#include <cassert>
 #include <cmath>
-#include <queue>
-#include <unordered_set>
 
 namespace sims3000 {
 namespace energy {
@@ -44,16 +44,32 @@ EnergySystem::EnergySystem(uint32_t map_width, uint32_t map_height,
     , m_coverage_grid(map_width, map_height)
     , m_pools{}
     , m_coverage_dirty{}
+    , m_coverage_rebuild{}
+    , m_generated_total{}
+    , m_consumed_total{}
+    , m_generation_stale{}
+    , m_consumption_stale{}
     , m_nexus_ids{}
     , m_consumer_ids{}
     , m_terrain(terrain)
     , m_map_width(map_width)
     , m_map_height(map_height)
 {
+    const size_t tile_count = static_cast<size_t>(map_width) * map_height;
+
     // Initialize per-player pools with owner IDs
     for (uint8_t i = 0; i < MAX_PLAYERS; ++i) {
         m_pools[i].owner = i;
         m_coverage_dirty[i] = false;
+        m_coverage_rebuild[i] = false;
+        m_coverage_refs[i].assign(tile_count, 0);
+        m_source_kind[i].assign(tile_count, SOURCE_NONE);
+        m_source_radius[i].assign(tile_count, 0);
+        m_consumer_demand[i].assign(tile_count, 0);
+        m_consumer_positions[i].resize(map_width, map_height);
+        m_conduit_positions[i].resize(map_width, map_height);
+        m_nexus_positions[i].resize(map_width, map_height);
+        m_network_sets[i].resize(map_width, map_height);
     }
 }
 
@@ -96,10 +112,12 @@ void EnergySystem::tick(float /*delta_time*/) {
         update_all_nexus_outputs(i);
     }
 
-    // 2. Coverage BFS recomputation for dirty players (Ticket 5-015)
+    // 2. Coverage update for dirty players (Ticket 5-015)
+    //    Conduit-only changes are applied incrementally; anything else
+    //    falls back to a full BFS rebuild.
     for (uint8_t i = 0; i < MAX_PLAYERS; ++i) {
         if (m_coverage_dirty[i]) {
-            recalculate_coverage(i);
+            update_coverage_incremental(i);
         }
     }
 
@@ -147,6 +165,10 @@ int EnergySystem::get_priority() const {
 
 void EnergySystem::set_registry(entt::registry* registry) {
     m_registry = registry;
+    for (uint8_t i = 0; i < MAX_PLAYERS; ++i) {
+        m_generation_stale[i] = true;
+        m_consumption_stale[i] = true;
+    }
 }
 
 // =============================================================================
@@ -251,6 +273,7 @@ void EnergySystem::update_all_nexus_outputs(uint8_t owner) {
     if (owner >= MAX_PLAYERS || !m_registry) {
         return;
     }
+    uint32_t total = 0;
     for (uint32_t eid : m_nexus_ids[owner]) {
         auto entity = static_cast<entt::entity>(eid);
         if (!m_registry->valid(entity)) {
@@ -261,24 +284,23 @@ void EnergySystem::update_all_nexus_outputs(uint8_t owner) {
             update_nexus_output(*comp);
 
             // Ticket 5-024: Apply terrain efficiency bonus if nexus has a position
-            if (comp->current_output > 0) {
+            const TrackedEntity* tracked = find_tracked(m_tracked_nexuses, eid);
+            if (comp->current_output > 0 && tracked && tracked->tile != NO_TILE) {
                 NexusType ntype = static_cast<NexusType>(comp->nexus_type);
-                // Look up nexus position for terrain bonus query
-                for (const auto& pos_pair : m_nexus_positions[owner]) {
-                    if (pos_pair.second == eid) {
-                        uint32_t nx = unpack_x(pos_pair.first);
-                        uint32_t ny = unpack_y(pos_pair.first);
-                        float bonus = get_terrain_efficiency_bonus(ntype, nx, ny);
-                        if (bonus != 1.0f) {
-                            comp->current_output = static_cast<uint32_t>(
-                                static_cast<float>(comp->current_output) * bonus);
-                        }
-                        break;
-                    }
+                float bonus = get_terrain_efficiency_bonus(ntype, tracked->tile % m_map_width,
+                                                           tracked->tile / m_map_width);
+                if (bonus != 1.0f) {
+                    comp->current_output = static_cast<uint32_t>(
+                        static_cast<float>(comp->current_output) * bonus);
                 }
             }
+            total += comp->current_output;
         }
     }
+
+    // Every nexus was just visited, so this is the exact generation total
+    m_generated_total[owner] = total;
+    m_generation_stale[owner] = false;
 }
 
 uint32_t EnergySystem::get_total_generation(uint8_t owner) const {
@@ -500,7 +522,14 @@ void EnergySystem::register_nexus(uint32_t entity_id, uint8_t owner) {
         return;
     }
     m_nexus_ids[owner].push_back(entity_id);
-    m_coverage_dirty[owner] = true;
+    TrackedEntity& tracked = tracked_slot(m_tracked_nexuses, entity_id);
+    if (tracked.entity_id != entity_id || tracked.owner != owner) {
+        tracked = TrackedEntity{};
+        tracked.entity_id = entity_id;
+        tracked.owner = owner;
+    }
+    m_generation_stale[owner] = true;
+    request_coverage_rebuild(owner);
 }
 
 void EnergySystem::unregister_nexus(uint32_t entity_id, uint8_t owner) {
@@ -511,7 +540,12 @@ void EnergySystem::unregister_nexus(uint32_t entity_id, uint8_t owner) {
     auto it = std::find(ids.begin(), ids.end(), entity_id);
     if (it != ids.end()) {
         ids.erase(it);
-        m_coverage_dirty[owner] = true;
+        const TrackedEntity* tracked = find_tracked(m_tracked_nexuses, entity_id);
+        if (tracked && tracked->owner == owner) {
+            tracked_slot(m_tracked_nexuses, entity_id) = TrackedEntity{};
+        }
+        m_generation_stale[owner] = true;
+        request_coverage_rebuild(owner);
     }
 }
 
@@ -543,11 +577,51 @@ void EnergySystem::unregister_consumer(uint32_t entity_id, uint8_t owner) {
 
 void EnergySystem::register_consumer_position(uint32_t entity_id, uint8_t owner,
                                               uint32_t x, uint32_t y) {
-    if (owner >= MAX_PLAYERS) {
+    if (owner >= MAX_PLAYERS || x >= m_map_width || y >= m_map_height) {
         return;
     }
-    uint64_t key = pack_position(x, y);
-    m_consumer_positions[owner][key] = entity_id;
+    uint32_t tile = y * m_map_width + x;
+
+    // A consumer already at this tile is replaced
+    uint32_t previous = m_consumer_positions[owner].get(x, y);
+    if (previous != TilePositionIndex::INVALID_ID) {
+        unfile_ration_entry(owner, previous);
+        const TrackedEntity* tracked = find_tracked(m_tracked_consumers, previous);
+        if (tracked && tracked->owner == owner && tracked->tile == tile) {
+            tracked_slot(m_tracked_consumers, previous) = TrackedEntity{};
+        }
+    }
+    m_consumer_positions[owner].set(x, y, entity_id);
+
+    // An entity registered again keeps a single rationing entry
+    if (const TrackedEntity* existing = find_tracked(m_tracked_consumers, entity_id)) {
+        unfile_ration_entry(existing->owner, entity_id);
+    }
+
+    TrackedEntity& tracked = tracked_slot(m_tracked_consumers, entity_id);
+    tracked = TrackedEntity{};
+    tracked.entity_id = entity_id;
+    tracked.tile = tile;
+    tracked.owner = owner;
+
+    // Swap the tile's recorded demand in the running total
+    uint32_t demand = read_consumer_demand(entity_id);
+    if (m_coverage_grid.is_in_coverage(x, y, owner + 1)) {
+        m_consumed_total[owner] += demand - m_consumer_demand[owner][tile];
+    }
+    m_consumer_demand[owner][tile] = demand;
+
+    uint8_t priority = ENERGY_PRIORITY_DEFAULT;
+    if (m_registry) {
+        auto entity = static_cast<entt::entity>(entity_id);
+        if (m_registry->valid(entity)) {
+            const auto* ec = m_registry->try_get<EnergyComponent>(entity);
+            if (ec) {
+                priority = ec->priority;
+            }
+        }
+    }
+    file_ration_entry(owner, entity_id, tile, priority);
 }
 
 void EnergySystem::unregister_consumer_position(uint32_t /*entity_id*/, uint8_t owner,
@@ -555,15 +629,64 @@ void EnergySystem::unregister_consumer_position(uint32_t /*entity_id*/, uint8_t
     if (owner >= MAX_PLAYERS) {
         return;
     }
-    uint64_t key = pack_position(x, y);
-    m_consumer_positions[owner].erase(key);
+    uint32_t current = m_consumer_positions[owner].get(x, y);
+    if (current == TilePositionIndex::INVALID_ID) {
+        return;
+    }
+    uint32_t tile = y * m_map_width + x;
+    unfile_ration_entry(owner, current);
+    m_consumer_positions[owner].erase(x, y);
+
+    const TrackedEntity* tracked = find_tracked(m_tracked_consumers, current);
+    if (tracked && tracked->owner == owner && tracked->tile == tile) {
+        tracked_slot(m_tracked_consumers, current) = TrackedEntity{};
+    }
+
+    if (m_coverage_grid.is_in_coverage(x, y, owner + 1)) {
+        m_consumed_total[owner] -= m_consumer_demand[owner][tile];
+    }
+    m_consumer_demand[owner][tile] = 0;
+}
+
+void EnergySystem::on_consumer_demand_changed(uint32_t entity_id, uint8_t owner,
+                                              uint32_t x, uint32_t y) {
+    if (owner >= MAX_PLAYERS || x >= m_map_width || y >= m_map_height ||
+        m_consumer_positions[owner].get(x, y) != entity_id || !m_registry) {
+        return;
+    }
+    auto entity = static_cast<entt::entity>(entity_id);
+    if (!m_registry->valid(entity)) {
+        return;
+    }
+    const auto* ec = m_registry->try_get<EnergyComponent>(entity);
+    if (!ec) {
+        return;
+    }
+
+    uint32_t tile = y * m_map_width + x;
+    uint32_t& recorded = m_consumer_demand[owner][tile];
+    if (m_coverage_grid.is_in_coverage(x, y, owner + 1)) {
+        m_consumed_total[owner] += ec->energy_required - recorded;
+    }
+    recorded = ec->energy_required;
+
+    RationEntry* entry = find_ration_entry(owner, entity_id);
+    if (!entry) {
+        return;
+    }
+    if (entry->priority != ec->priority) {
+        unfile_ration_entry(owner, entity_id);
+        file_ration_entry(owner, entity_id, tile, ec->priority);
+    } else {
+        update_ration_entry(owner, *entry, ec->energy_required, entry->covered);
+    }
 }
 
 uint32_t EnergySystem::get_consumer_position_count(uint8_t owner) const {
     if (owner >= MAX_PLAYERS) {
         return 0;
     }
-    return static_cast<uint32_t>(m_consumer_positions[owner].size());
+    return m_consumer_positions[owner].size();
 }
 
 uint32_t EnergySystem::aggregate_consumption(uint8_t owner) const {
@@ -573,28 +696,9 @@ uint32_t EnergySystem::aggregate_consumption(uint8_t owner) const {
     // Coverage grid uses overseer_id (1-based): overseer_id = player_id + 1
     uint8_t overseer_id = owner + 1;
 
-    uint32_t total = 0;
-    for (const auto& pair : m_consumer_positions[owner]) {
-        uint32_t x = unpack_x(pair.first);
-        uint32_t y = unpack_y(pair.first);
-
-        // Only count consumers that are in coverage
-        if (!m_coverage_grid.is_in_coverage(x, y, overseer_id)) {
-            continue;
-        }
-
-        uint32_t entity_id = pair.second;
-        auto entity = static_cast<entt::entity>(entity_id);
-        if (!m_registry->valid(entity)) {
-            continue;
-        }
-        const auto* ec = m_registry->try_get<EnergyComponent>(entity);
-        if (!ec) {
-            continue;
-        }
-        total += ec->energy_required;
-    }
-    return total;
+    return EnergyNetwork::aggregate_consumption(*m_registry, m_coverage_grid,
+                                                m_consumer_positions[owner],
+                                                overseer_id).total;
 }
 
 // =============================================================================
@@ -621,15 +725,136 @@ void EnergySystem::calculate_pool(uint8_t owner) {
     if (owner >= MAX_PLAYERS) {
         return;
     }
+    if (m_generation_stale[owner]) {
+        rebuild_generation_total(owner);
+    }
+    if (m_consumption_stale[owner]) {
+        rebuild_consumption_total(owner);
+    }
+#ifdef SIMS3000_DEBUG
+    assert(verify_pool_totals(owner) && "energy pool running totals out of sync");
+#endif
+
     PerPlayerEnergyPool& pool = m_pools[owner];
-    pool.total_generated = get_total_generation(owner);
-    pool.total_consumed = aggregate_consumption(owner);
+    pool.total_generated = m_generated_total[owner];
+    pool.total_consumed = m_consumed_total[owner];
     pool.surplus = static_cast<int32_t>(pool.total_generated)
                  - static_cast<int32_t>(pool.total_consumed);
     pool.nexus_count = get_nexus_count(owner);
     pool.consumer_count = get_consumer_count(owner);
 }
 
+bool EnergySystem::verify_pool_totals(uint8_t owner) const {
+    if (owner >= MAX_PLAYERS) {
+        return true;
+    }
+    if (!m_generation_stale[owner] &&
+        m_generated_total[owner] != get_total_generation(owner)) {
+        return false;
+    }
+    if (!m_consumption_stale[owner] &&
+        m_consumed_total[owner] != aggregate_consumption(owner)) {
+        return false;
+    }
+    return true;
+}
+
+void EnergySystem::set_coverage_owner(uint32_t x, uint32_t y, uint8_t owner_id) {
+    uint8_t previous = m_coverage_grid.get_coverage_owner(x, y);
+    if (previous == owner_id) {
+        return;
+    }
+    m_coverage_grid.set(x, y, owner_id);
+
+    // Demand of a consumer on this tile moves between the owners' totals
+    size_t idx = static_cast<size_t>(y) * m_map_width + x;
+    if (previous != 0 && previous <= MAX_PLAYERS) {
+        m_consumed_total[previous - 1] -= m_consumer_demand[previous - 1][idx];
+    }
+    if (owner_id != 0 && owner_id <= MAX_PLAYERS) {
+        m_consumed_total[owner_id - 1] += m_consumer_demand[owner_id - 1][idx];
+    }
+
+    // ...and between the owners' rationing bucket sums
+    for (uint8_t overseer_id : { previous, owner_id }) {
+        if (overseer_id == 0 || overseer_id > MAX_PLAYERS) {
+            continue;
+        }
+        uint8_t owner = overseer_id - 1;
+        uint32_t consumer = m_consumer_positions[owner].get(x, y);
+        if (consumer == TilePositionIndex::INVALID_ID) {
+            continue;
+        }
+        RationEntry* entry = find_ration_entry(owner, consumer);
+        if (entry) {
+            update_ration_entry(owner, *entry, entry->demand, overseer_id == owner_id);
+        }
+    }
+}
+
+uint32_t EnergySystem::read_consumer_demand(uint32_t entity_id) const {
+    if (!m_registry) {
+        return 0;
+    }
+    auto entity = static_cast<entt::entity>(entity_id);
+    if (!m_registry->valid(entity)) {
+        return 0;
+    }
+    const auto* ec = m_registry->try_get<EnergyComponent>(entity);
+    return ec ? ec->energy_required : 0;
+}
+
+void EnergySystem::rebuild_consumption_total(uint8_t owner) {
+    uint8_t overseer_id = owner + 1;
+    uint32_t total = 0;
+    std::vector<uint32_t>& demand = m_consumer_demand[owner];
+    m_consumer_positions[owner].for_each([&](uint32_t x, uint32_t y, uint32_t entity_id) {
+        size_t idx = static_cast<size_t>(y) * m_map_width + x;
+        demand[idx] = read_consumer_demand(entity_id);
+        if (m_coverage_grid.is_in_coverage(x, y, overseer_id)) {
+            total += demand[idx];
+        }
+    });
+    m_consumed_total[owner] = total;
+    m_consumption_stale[owner] = false;
+    rebuild_ration_buckets(owner);
+}
+
+void EnergySystem::rebuild_generation_total(uint8_t owner) {
+    uint32_t total = 0;
+    for (uint32_t eid : m_nexus_ids[owner]) {
+        uint32_t output = 0;
+        if (m_registry) {
+            auto entity = static_cast<entt::entity>(eid);
+            if (m_registry->valid(entity)) {
+                const auto* comp = m_registry->try_get<EnergyProducerComponent>(entity);
+                output = comp ? comp->current_output : 0;
+            }
+        }
+        total += output;
+    }
+    m_generated_total[owner] = total;
+    m_generation_stale[owner] = false;
+}
+
+EnergySystem::TrackedEntity& EnergySystem::tracked_slot(std::vector<TrackedEntity>& tracked,
+                                                        uint32_t entity_id) {
+    size_t index = static_cast<size_t>(entt::to_entity(static_cast<entt::entity>(entity_id)));
+    if (index >= tracked.size()) {
+        tracked.resize(index + 1);
+    }
+    return tracked[index];
+}
+
+const EnergySystem::TrackedEntity* EnergySystem::find_tracked(
+        const std::vector<TrackedEntity>& tracked, uint32_t entity_id) {
+    size_t index = static_cast<size_t>(entt::to_entity(static_cast<entt::entity>(entity_id)));
+    if (index >= tracked.size() || tracked[index].entity_id != entity_id) {
+        return nullptr;
+    }
+    return &tracked[index];
+}
+
 // =============================================================================
 // Pool queries
 // =============================================================================
@@ -737,18 +962,14 @@ void EnergySystem::distribute_energy(uint8_t owner) {
         return;
     }
 
-    for (const auto& pair : m_consumer_positions[owner]) {
-        uint32_t x = unpack_x(pair.first);
-        uint32_t y = unpack_y(pair.first);
-        uint32_t entity_id = pair.second;
-
+    m_consumer_positions[owner].for_each([&](uint32_t x, uint32_t y, uint32_t entity_id) {
         auto entity = static_cast<entt::entity>(entity_id);
         if (!m_registry->valid(entity)) {
-            continue;
+            return;
         }
         auto* ec = m_registry->try_get<EnergyComponent>(entity);
         if (!ec) {
-            continue;
+            return;
         }
 
         // Check if consumer is in coverage
@@ -756,12 +977,16 @@ void EnergySystem::distribute_energy(uint8_t owner) {
             // Outside coverage: always unpowered
             ec->is_powered = false;
             ec->energy_received = 0;
-            continue;
+            return;
         }
 
         // Healthy/Marginal: all consumers in coverage get powered
         ec->is_powered = true;
         ec->energy_received = ec->energy_required;
+    });
+
+    for (RationBucket& bucket : m_ration_buckets[owner]) {
+        bucket.state = RationState::Powered;
     }
 }
 
@@ -807,7 +1032,7 @@ void EnergySystem::mark_coverage_dirty(uint8_t owner) {
     if (owner >= MAX_PLAYERS) {
         return;
     }
-    m_coverage_dirty[owner] = true;
+    request_coverage_rebuild(owner);
 }
 
 bool EnergySystem::is_coverage_dirty(uint8_t owner) const {
@@ -825,28 +1050,40 @@ void EnergySystem::on_conduit_placed(const ConduitPlacedEvent& event) {
     if (event.owner_id >= MAX_PLAYERS) {
         return;
     }
-    m_coverage_dirty[event.owner_id] = true;
+    if (event.grid_x < 0 || event.grid_y < 0) {
+        request_coverage_rebuild(event.owner_id);
+        return;
+    }
+    queue_conduit_change(event.owner_id,
+                         static_cast<uint32_t>(event.grid_x),
+                         static_cast<uint32_t>(event.grid_y));
 }
 
 void EnergySystem::on_conduit_removed(const ConduitRemovedEvent& event) {
     if (event.owner_id >= MAX_PLAYERS) {
         return;
     }
-    m_coverage_dirty[event.owner_id] = true;
+    if (event.grid_x < 0 || event.grid_y < 0) {
+        request_coverage_rebuild(event.owner_id);
+        return;
+    }
+    queue_conduit_change(event.owner_id,
+                         static_cast<uint32_t>(event.grid_x),
+                         static_cast<uint32_t>(event.grid_y));
 }
 
 void EnergySystem::on_nexus_placed(const NexusPlacedEvent& event) {
     if (event.owner_id >= MAX_PLAYERS) {
         return;
     }
-    m_coverage_dirty[event.owner_id] = true;
+    request_coverage_rebuild(event.owner_id);
 }
 
 void EnergySystem::on_nexus_removed(const NexusRemovedEvent& event) {
     if (event.owner_id >= MAX_PLAYERS) {
         return;
     }
-    m_coverage_dirty[event.owner_id] = true;
+    request_coverage_rebuild(event.owner_id);
 }
 
 void EnergySystem::on_nexus_aged(const NexusAgedEvent& /*event*/) {
@@ -878,6 +1115,10 @@ const CoverageGrid& EnergySystem::get_coverage_grid() const {
 }
 
 CoverageGrid& EnergySystem::get_coverage_grid_mut() {
+    // Direct writes bypass set_coverage_owner()
+    for (uint8_t i = 0; i < MAX_PLAYERS; ++i) {
+        m_consumption_stale[i] = true;
+    }
     return m_coverage_grid;
 }
 
@@ -916,9 +1157,9 @@ void EnergySystem::register_conduit_position(uint32_t entity_id, uint8_t owner,
     if (owner >= MAX_PLAYERS) {
         return;
     }
-    uint64_t key = pack_position(x, y);
-    m_conduit_positions[owner][key] = entity_id;
-    m_coverage_dirty[owner] = true;
+    m_conduit_positions[owner].set(x, y, entity_id);
+    m_network_sets[owner].insert(x, y);
+    queue_conduit_change(owner, x, y);
 }
 
 void EnergySystem::unregister_conduit_position(uint32_t /*entity_id*/, uint8_t owner,
@@ -926,9 +1167,11 @@ void EnergySystem::unregister_conduit_position(uint32_t /*entity_id*/, uint8_t o
     if (owner >= MAX_PLAYERS) {
         return;
     }
-    uint64_t key = pack_position(x, y);
-    m_conduit_positions[owner].erase(key);
-    m_coverage_dirty[owner] = true;
+    m_conduit_positions[owner].erase(x, y);
+    if (!m_nexus_positions[owner].contains(x, y)) {
+        m_network_sets[owner].erase(x, y);
+    }
+    queue_conduit_change(owner, x, y);
 }
 
 void EnergySystem::register_nexus_position(uint32_t entity_id, uint8_t owner,
@@ -936,9 +1179,22 @@ void EnergySystem::register_nexus_position(uint32_t entity_id, uint8_t owner,
     if (owner >= MAX_PLAYERS) {
         return;
     }
-    uint64_t key = pack_position(x, y);
-    m_nexus_positions[owner][key] = entity_id;
-    m_coverage_dirty[owner] = true;
+    m_nexus_positions[owner].set(x, y, entity_id);
+
+    // Remembered for the terrain bonus lookup in update_all_nexus_outputs()
+    if (x < m_map_width && y < m_map_height) {
+        TrackedEntity& tracked = tracked_slot(m_tracked_nexuses, entity_id);
+        if (tracked.entity_id != entity_id || tracked.owner != owner) {
+            tracked = TrackedEntity{};
+            tracked.entity_id = entity_id;
+            tracked.owner = owner;
+        }
+        tracked.tile = y * m_map_width + x;
+    }
+
+    m_network_sets[owner].insert(x, y);
+    m_network_sets[owner].set_source(x, y, true);
+    request_coverage_rebuild(owner);
 }
 
 void EnergySystem::unregister_nexus_position(uint32_t /*entity_id*/, uint8_t owner,
@@ -946,23 +1202,48 @@ void EnergySystem::unregister_nexus_position(uint32_t /*entity_id*/, uint8_t own
     if (owner >= MAX_PLAYERS) {
         return;
     }
-    uint64_t key = pack_position(x, y);
-    m_nexus_positions[owner].erase(key);
-    m_coverage_dirty[owner] = true;
+    uint32_t current = m_nexus_positions[owner].get(x, y);
+    if (current != TilePositionIndex::INVALID_ID) {
+        const TrackedEntity* tracked = find_tracked(m_tracked_nexuses, current);
+        if (tracked && tracked->owner == owner && tracked->tile == y * m_map_width + x) {
+            tracked_slot(m_tracked_nexuses, current).tile = NO_TILE;
+        }
+    }
+    m_nexus_positions[owner].erase(x, y);
+    if (m_conduit_positions[owner].contains(x, y)) {
+        m_network_sets[owner].set_source(x, y, false);
+    } else {
+        m_network_sets[owner].erase(x, y);
+    }
+    request_coverage_rebuild(owner);
+}
+
+bool EnergySystem::is_connected_to_nexus(uint32_t x, uint32_t y, uint8_t owner) const {
+    if (owner >= MAX_PLAYERS) {
+        return false;
+    }
+    return m_network_sets[owner].has_source(x, y);
+}
+
+uint32_t EnergySystem::get_network_component_count(uint8_t owner) const {
+    if (owner >= MAX_PLAYERS) {
+        return 0;
+    }
+    return m_network_sets[owner].component_count();
 }
 
 uint32_t EnergySystem::get_conduit_position_count(uint8_t owner) const {
     if (owner >= MAX_PLAYERS) {
         return 0;
     }
-    return static_cast<uint32_t>(m_conduit_positions[owner].size());
+    return m_conduit_positions[owner].size();
 }
 
 uint32_t EnergySystem::get_nexus_position_count(uint8_t owner) const {
     if (owner >= MAX_PLAYERS) {
         return 0;
     }
-    return static_cast<uint32_t>(m_nexus_positions[owner].size());
+    return m_nexus_positions[owner].size();
 }
 
 // =============================================================================
@@ -970,15 +1251,15 @@ uint32_t EnergySystem::get_nexus_position_count(uint8_t owner) const {
 // =============================================================================
 
 uint64_t EnergySystem::pack_position(uint32_t x, uint32_t y) {
-    return (static_cast<uint64_t>(x) << 32) | static_cast<uint64_t>(y);
+    return EnergyNetwork::pack(x, y);
 }
 
 uint32_t EnergySystem::unpack_x(uint64_t packed) {
-    return static_cast<uint32_t>(packed >> 32);
+    return EnergyNetwork::unpack_x(packed);
 }
 
 uint32_t EnergySystem::unpack_y(uint64_t packed) {
-    return static_cast<uint32_t>(packed & 0xFFFFFFFF);
+    return EnergyNetwork::unpack_y(packed);
 }
 
 // =============================================================================
@@ -987,24 +1268,10 @@ uint32_t EnergySystem::unpack_y(uint64_t packed) {
 
 void EnergySystem::mark_coverage_radius(uint32_t cx, uint32_t cy, uint8_t radius,
                                         uint8_t owner_id) {
-    // Calculate clamped bounds for the square coverage area.
-    // Use int64_t to safely handle underflow when cx < radius.
-    int64_t min_x = static_cast<int64_t>(cx) - static_cast<int64_t>(radius);
-    int64_t min_y = static_cast<int64_t>(cy) - static_cast<int64_t>(radius);
-    int64_t max_x = static_cast<int64_t>(cx) + static_cast<int64_t>(radius);
-    int64_t max_y = static_cast<int64_t>(cy) + static_cast<int64_t>(radius);
-
-    // Clamp to grid bounds
-    if (min_x < 0) min_x = 0;
-    if (min_y < 0) min_y = 0;
-    if (max_x >= static_cast<int64_t>(m_map_width)) max_x = static_cast<int64_t>(m_map_width) - 1;
-    if (max_y >= static_cast<int64_t>(m_map_height)) max_y = static_cast<int64_t>(m_map_height) - 1;
-
-    // Mark all cells in the clamped square
-    for (int64_t y = min_y; y <= max_y; ++y) {
-        for (int64_t x = min_x; x <= max_x; ++x) {
-            m_coverage_grid.set(static_cast<uint32_t>(x), static_cast<uint32_t>(y), owner_id);
-        }
+    EnergyNetwork::mark_coverage_radius(m_coverage_grid, cx, cy, radius, owner_id,
+                                        m_map_width, m_map_height);
+    for (uint8_t i = 0; i < MAX_PLAYERS; ++i) {
+        m_consumption_stale[i] = true;
     }
 }
 
@@ -1013,35 +1280,20 @@ void EnergySystem::recalculate_coverage(uint8_t owner) {
         return;
     }
 
-    // The coverage owner_id is owner+1 (0 means uncovered in the grid)
-    uint8_t owner_id = owner + 1;
-
     // Step 0: Reset all conduits' is_connected to false for this owner (Ticket 5-028)
-    if (m_registry) {
-        for (const auto& pair : m_conduit_positions[owner]) {
-            uint32_t entity_id = pair.second;
-            auto entity = static_cast<entt::entity>(entity_id);
-            if (m_registry->valid(entity)) {
-                auto* conduit = m_registry->try_get<EnergyConduitComponent>(entity);
-                if (conduit) {
-                    conduit->is_connected = false;
-                }
-            }
-        }
-    }
+    EnergyNetwork::reset_connections(m_registry, m_conduit_positions[owner]);
 
-    // Step 1: Clear all existing coverage for this owner
-    m_coverage_grid.clear_all_for_owner(owner_id);
+    // Step 1: Clear all existing coverage, refcounts, and sources for this owner
+    reset_coverage_state(owner);
 
-    // Step 2: Seed BFS from nexus positions
-    std::queue<uint64_t> frontier;
-    std::unordered_set<uint64_t> visited;
+    // Step 2: Seed BFS from nexus positions.
+    // m_source_kind doubles as the visited set: a tile is visited once it
+    // has become a connected source.
+    std::vector<uint64_t>& frontier = m_scratch_tiles;
+    frontier.clear();
 
-    for (const auto& pair : m_nexus_positions[owner]) {
-        uint64_t packed_pos = pair.first;
-        uint32_t entity_id = pair.second;
-        uint32_t nx = unpack_x(packed_pos);
-        uint32_t ny = unpack_y(packed_pos);
+    m_nexus_positions[owner].for_each([&](uint32_t nx, uint32_t ny, uint32_t entity_id) {
+        size_t idx = static_cast<size_t>(ny) * m_map_width + nx;
 
         // Determine nexus coverage radius from NexusTypeConfig
         uint8_t radius = 8; // default fallback (Carbon radius)
@@ -1057,86 +1309,298 @@ void EnergySystem::recalculate_coverage(uint8_t owner) {
             }
         }
 
-        // Mark coverage area around the nexus
-        mark_coverage_radius(nx, ny, radius, owner_id);
+        // Mark coverage area around the nexus and add it to the frontier
+        m_source_kind[owner][idx] = SOURCE_NEXUS;
+        m_source_radius[owner][idx] = radius;
+        stamp_coverage(owner, nx, ny, radius);
+        frontier.push_back(pack_position(nx, ny));
+    });
 
-        // Add nexus position to BFS frontier
-        if (visited.find(packed_pos) == visited.end()) {
-            visited.insert(packed_pos);
-            frontier.push(packed_pos);
+    // Step 3: BFS through conduit network.
+    // Ownership boundary check (Ticket 5-016): can_extend_coverage_to()
+    // currently always returns true, but provides the integration point
+    // for when territory boundaries are implemented.
+    flood_conduits(owner, frontier);
+
+    // Full rebuild supersedes any queued incremental changes
+    m_pending_conduit_tiles[owner].clear();
+    m_coverage_rebuild[owner] = false;
+
+    // Clear dirty flag after recalculation
+    m_coverage_dirty[owner] = false;
+}
+
+// =============================================================================
+// Incremental coverage
+// =============================================================================
+
+void EnergySystem::update_coverage_incremental(uint8_t owner) {
+    if (owner >= MAX_PLAYERS) {
+        return;
+    }
+    if (m_coverage_rebuild[owner]) {
+        recalculate_coverage(owner);
+        return;
+    }
+
+    // Apply queued tiles in order. Each tile is re-examined against the
+    // current conduit map, so duplicate or cancelled changes are no-ops.
+    for (uint64_t packed : m_pending_conduit_tiles[owner]) {
+        uint32_t x = unpack_x(packed);
+        uint32_t y = unpack_y(packed);
+        size_t idx = static_cast<size_t>(y) * m_map_width + x;
+        uint8_t kind = m_source_kind[owner][idx];
+
+        uint32_t conduit_id = m_conduit_positions[owner].get(x, y);
+        bool present = (conduit_id != TilePositionIndex::INVALID_ID);
+
+        if (present && kind == SOURCE_NONE) {
+            apply_conduit_added(owner, x, y, conduit_id);
+        } else if (!present && kind == SOURCE_CONDUIT) {
+            apply_conduit_removed(owner, x, y);
+        } else if (present && kind == SOURCE_CONDUIT && m_registry) {
+            // Conduit replaced in place: carry the connected state over.
+            auto entity = static_cast<entt::entity>(conduit_id);
+            if (m_registry->valid(entity)) {
+                auto* conduit = m_registry->try_get<EnergyConduitComponent>(entity);
+                if (conduit) {
+                    conduit->is_connected = true;
+                }
+            }
         }
     }
+    m_pending_conduit_tiles[owner].clear();
 
-    // Step 3: BFS through conduit network
-    // 4-directional neighbor offsets: right, left, down, up
-    static const int32_t dx[] = { 1, -1, 0, 0 };
-    static const int32_t dy[] = { 0, 0, 1, -1 };
+    m_coverage_dirty[owner] = false;
+}
+
+uint32_t EnergySystem::get_coverage_ref_count(uint32_t x, uint32_t y, uint8_t owner) const {
+    if (owner >= MAX_PLAYERS || x >= m_map_width || y >= m_map_height) {
+        return 0;
+    }
+    return m_coverage_refs[owner][static_cast<size_t>(y) * m_map_width + x];
+}
+
+void EnergySystem::queue_conduit_change(uint8_t owner, uint32_t x, uint32_t y) {
+    m_coverage_dirty[owner] = true;
+    if (m_coverage_rebuild[owner]) {
+        return;
+    }
+    if (x >= m_map_width || y >= m_map_height) {
+        request_coverage_rebuild(owner);
+        return;
+    }
 
-    while (!frontier.empty()) {
-        uint64_t current = frontier.front();
-        frontier.pop();
+    // place_conduit() both registers the position and emits the event;
+    // collapse the back-to-back duplicate.
+    uint64_t key = pack_position(x, y);
+    auto& pending = m_pending_conduit_tiles[owner];
+    if (pending.empty() || pending.back() != key) {
+        pending.push_back(key);
+    }
+}
 
-        uint32_t cx = unpack_x(current);
-        uint32_t cy = unpack_y(current);
+void EnergySystem::request_coverage_rebuild(uint8_t owner) {
+    m_coverage_dirty[owner] = true;
+    m_coverage_rebuild[owner] = true;
+    m_pending_conduit_tiles[owner].clear();
+}
 
-        // Check 4-directional neighbors
-        for (int i = 0; i < 4; ++i) {
-            int64_t neighbor_x = static_cast<int64_t>(cx) + dx[i];
-            int64_t neighbor_y = static_cast<int64_t>(cy) + dy[i];
+void EnergySystem::stamp_coverage(uint8_t owner, uint32_t cx, uint32_t cy, uint8_t radius) {
+    uint32_t min_x = (cx > radius) ? cx - radius : 0;
+    uint32_t min_y = (cy > radius) ? cy - radius : 0;
+    uint32_t max_x = std::min<uint32_t>(cx + radius, m_map_width - 1);
+    uint32_t max_y = std::min<uint32_t>(cy + radius, m_map_height - 1);
+    uint8_t owner_id = owner + 1;
 
-            // Bounds check
-            if (neighbor_x < 0 || neighbor_x >= static_cast<int64_t>(m_map_width) ||
-                neighbor_y < 0 || neighbor_y >= static_cast<int64_t>(m_map_height)) {
-                continue;
+    std::vector<uint16_t>& refs = m_coverage_refs[owner];
+    for (uint32_t y = min_y; y <= max_y; ++y) {
+        size_t row = static_cast<size_t>(y) * m_map_width;
+        for (uint32_t x = min_x; x <= max_x; ++x) {
+            if (refs[row + x]++ == 0) {
+                set_coverage_owner(x, y, owner_id);
             }
+        }
+    }
+}
 
-            uint32_t nbx = static_cast<uint32_t>(neighbor_x);
-            uint32_t nby = static_cast<uint32_t>(neighbor_y);
-            uint64_t neighbor_key = pack_position(nbx, nby);
+void EnergySystem::unstamp_coverage(uint8_t owner, uint32_t cx, uint32_t cy, uint8_t radius) {
+    uint32_t min_x = (cx > radius) ? cx - radius : 0;
+    uint32_t min_y = (cy > radius) ? cy - radius : 0;
+    uint32_t max_x = std::min<uint32_t>(cx + radius, m_map_width - 1);
+    uint32_t max_y = std::min<uint32_t>(cy + radius, m_map_height - 1);
+    uint8_t owner_id = owner + 1;
 
-            // Skip if already visited
-            if (visited.find(neighbor_key) != visited.end()) {
+    std::vector<uint16_t>& refs = m_coverage_refs[owner];
+    for (uint32_t y = min_y; y <= max_y; ++y) {
+        size_t row = static_cast<size_t>(y) * m_map_width;
+        for (uint32_t x = min_x; x <= max_x; ++x) {
+            size_t idx = row + x;
+            if (refs[idx] == 0 || --refs[idx] != 0) {
                 continue;
             }
-
-            // Ownership boundary check (Ticket 5-016): verify coverage
-            // can extend to this tile for the given owner. Currently always
-            // returns true, but provides the integration point for when
-            // territory boundaries are implemented.
-            if (!can_extend_coverage_to(nbx, nby, owner)) {
+            if (m_coverage_grid.get_coverage_owner(x, y) != owner_id) {
                 continue;
             }
+            // Hand the tile to another player still covering it, if any
+            uint8_t fallback = 0;
+            for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+                if (p != owner && m_coverage_refs[p][idx] > 0) {
+                    fallback = p + 1;
+                    break;
+                }
+            }
+            set_coverage_owner(x, y, fallback);
+        }
+    }
+}
+
+void EnergySystem::reset_coverage_state(uint8_t owner) {
+    uint8_t owner_id = owner + 1;
+    std::fill(m_coverage_refs[owner].begin(), m_coverage_refs[owner].end(), 0);
+    std::fill(m_source_kind[owner].begin(), m_source_kind[owner].end(), SOURCE_NONE);
+    std::fill(m_source_radius[owner].begin(), m_source_radius[owner].end(), 0);
 
-            // Check if there's a conduit at this position for this owner
-            auto conduit_it = m_conduit_positions[owner].find(neighbor_key);
-            if (conduit_it == m_conduit_positions[owner].end()) {
+    for (uint32_t y = 0; y < m_map_height; ++y) {
+        for (uint32_t x = 0; x < m_map_width; ++x) {
+            if (m_coverage_grid.get_coverage_owner(x, y) != owner_id) {
                 continue;
             }
+            size_t idx = static_cast<size_t>(y) * m_map_width + x;
+            uint8_t fallback = 0;
+            for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+                if (p != owner && m_coverage_refs[p][idx] > 0) {
+                    fallback = p + 1;
+                    break;
+                }
+            }
+            set_coverage_owner(x, y, fallback);
+        }
+    }
+}
 
-            // Found a conduit - mark it visited and add to frontier
-            visited.insert(neighbor_key);
-            frontier.push(neighbor_key);
-
-            // Determine conduit coverage radius and mark as connected (Ticket 5-028)
-            uint8_t conduit_radius = 3; // default from EnergyConduitComponent
-            if (m_registry) {
-                auto entity = static_cast<entt::entity>(conduit_it->second);
-                if (m_registry->valid(entity)) {
-                    auto* conduit = m_registry->try_get<EnergyConduitComponent>(entity);
-                    if (conduit) {
-                        conduit_radius = conduit->coverage_radius;
-                        conduit->is_connected = true; // Ticket 5-028: reachable from nexus
-                    }
+void EnergySystem::connect_conduit(uint8_t owner, uint32_t x, uint32_t y, uint32_t entity_id) {
+    // Determine conduit coverage radius and mark as connected (Ticket 5-028)
+    uint8_t conduit_radius = EnergyNetwork::connect(m_registry, entity_id);
+
+    size_t idx = static_cast<size_t>(y) * m_map_width + x;
+    m_source_kind[owner][idx] = SOURCE_CONDUIT;
+    m_source_radius[owner][idx] = conduit_radius;
+    stamp_coverage(owner, x, y, conduit_radius);
+}
+
+void EnergySystem::disconnect_conduit(uint8_t owner, uint32_t x, uint32_t y) {
+    size_t idx = static_cast<size_t>(y) * m_map_width + x;
+    unstamp_coverage(owner, x, y, m_source_radius[owner][idx]);
+    m_source_kind[owner][idx] = SOURCE_NONE;
+    m_source_radius[owner][idx] = 0;
+
+    if (m_registry) {
+        uint32_t conduit_id = m_conduit_positions[owner].get(x, y);
+        if (conduit_id != TilePositionIndex::INVALID_ID) {
+            auto entity = static_cast<entt::entity>(conduit_id);
+            if (m_registry->valid(entity)) {
+                auto* conduit = m_registry->try_get<EnergyConduitComponent>(entity);
+                if (conduit) {
+                    conduit->is_connected = false;
                 }
             }
+        }
+    }
+}
+
+void EnergySystem::flood_conduits(uint8_t owner, std::vector<uint64_t>& frontier) {
+    // m_source_kind doubles as the visited set
+    std::vector<uint8_t>& source_kind = m_source_kind[owner];
+    EnergyNetwork::flood(
+        frontier, m_conduit_positions[owner], m_map_width, m_map_height,
+        [this, owner](uint32_t nx, uint32_t ny) {
+            return can_extend_coverage_to(nx, ny, owner);
+        },
+        [this, &source_kind](uint32_t nx, uint32_t ny) {
+            return source_kind[static_cast<size_t>(ny) * m_map_width + nx] != SOURCE_NONE;
+        },
+        [this, owner](uint32_t nx, uint32_t ny, uint32_t conduit_id) {
+            // Found a conduit - connect it (Ticket 5-028) and mark its coverage area
+            connect_conduit(owner, nx, ny, conduit_id);
+        });
+}
+
+void EnergySystem::apply_conduit_added(uint8_t owner, uint32_t x, uint32_t y,
+                                       uint32_t entity_id) {
+    static const int32_t dx[] = { 1, -1, 0, 0 };
+    static const int32_t dy[] = { 0, 0, 1, -1 };
 
-            // Mark coverage area around the conduit
-            mark_coverage_radius(nbx, nby, conduit_radius, owner_id);
+    if (!can_extend_coverage_to(x, y, owner)) {
+        return;
+    }
+
+    // Conduits in a network without a nexus stay disconnected; the
+    // component flag answers this without searching.
+    if (!m_network_sets[owner].has_source(x, y)) {
+        return;
+    }
+
+    // Only a conduit touching a connected source can join the network
+    bool touches_network = false;
+    for (int i = 0; i < 4 && !touches_network; ++i) {
+        int64_t nx = static_cast<int64_t>(x) + dx[i];
+        int64_t ny = static_cast<int64_t>(y) + dy[i];
+        if (nx < 0 || nx >= static_cast<int64_t>(m_map_width) ||
+            ny < 0 || ny >= static_cast<int64_t>(m_map_height)) {
+            continue;
         }
+        size_t nidx = static_cast<size_t>(ny) * m_map_width + static_cast<size_t>(nx);
+        touches_network = (m_source_kind[owner][nidx] != SOURCE_NONE);
+    }
+    if (!touches_network) {
+        return;
     }
 
-    // Clear dirty flag after recalculation
-    m_coverage_dirty[owner] = false;
+    // Flood outward through conduits that were previously unreachable
+    std::vector<uint64_t>& frontier = m_scratch_tiles;
+    frontier.clear();
+    connect_conduit(owner, x, y, entity_id);
+    frontier.push_back(pack_position(x, y));
+    flood_conduits(owner, frontier);
+}
+
+void EnergySystem::apply_conduit_removed(uint8_t owner, uint32_t x, uint32_t y) {
+    static const int32_t dx[] = { 1, -1, 0, 0 };
+    static const int32_t dy[] = { 0, 0, 1, -1 };
+
+    disconnect_conduit(owner, x, y);
+
+    // The union-find has already split the old component. Each
+    // neighbouring piece that still contains a nexus keeps its
+    // coverage; any piece without one is walked and disconnected.
+    TileDisjointSet& sets = m_network_sets[owner];
+    for (int n = 0; n < 4; ++n) {
+        int64_t sx = static_cast<int64_t>(x) + dx[n];
+        int64_t sy = static_cast<int64_t>(y) + dy[n];
+        if (sx < 0 || sx >= static_cast<int64_t>(m_map_width) ||
+            sy < 0 || sy >= static_cast<int64_t>(m_map_height)) {
+            continue;
+        }
+        uint32_t nbx = static_cast<uint32_t>(sx);
+        uint32_t nby = static_cast<uint32_t>(sy);
+        size_t sidx = static_cast<size_t>(nby) * m_map_width + nbx;
+        if (m_source_kind[owner][sidx] != SOURCE_CONDUIT || sets.has_source(nbx, nby)) {
+            continue;
+        }
+
+        std::vector<uint64_t>& piece = m_scratch_piece;
+        piece.clear();
+        sets.for_each_in_component(nbx, nby, [&](uint32_t px, uint32_t py) {
+            size_t pidx = static_cast<size_t>(py) * m_map_width + px;
+            if (m_source_kind[owner][pidx] == SOURCE_CONDUIT) {
+                piece.push_back(pack_position(px, py));
+            }
+        });
+        for (uint64_t packed : piece) {
+            disconnect_conduit(owner, unpack_x(packed), unpack_y(packed));
+        }
+    }
 }
 
 // =============================================================================
@@ -1171,17 +1635,11 @@ std::vector<std::pair<uint32_t, uint32_t>> EnergySystem::preview_conduit_coverag
             continue;
         }
 
-        uint64_t neighbor_key = pack_position(static_cast<uint32_t>(nx),
-                                               static_cast<uint32_t>(ny));
-
-        // Check conduit positions
-        if (m_conduit_positions[owner].find(neighbor_key) != m_conduit_positions[owner].end()) {
-            connected = true;
-            break;
-        }
+        uint32_t nbx = static_cast<uint32_t>(nx);
+        uint32_t nby = static_cast<uint32_t>(ny);
 
-        // Check nexus positions
-        if (m_nexus_positions[owner].find(neighbor_key) != m_nexus_positions[owner].end()) {
+        // Any conduit or nexus tile is a member of the network sets
+        if (m_network_sets[owner].contains(nbx, nby)) {
             connected = true;
             break;
         }
@@ -1191,33 +1649,10 @@ std::vector<std::pair<uint32_t, uint32_t>> EnergySystem::preview_conduit_coverag
         return delta;
     }
 
-    // Calculate coverage delta with default conduit coverage_radius = 3
-    const uint8_t coverage_radius = 3;
-    uint8_t overseer_id = owner + 1;
-
-    // Compute clamped bounds
-    int64_t min_x = static_cast<int64_t>(x) - static_cast<int64_t>(coverage_radius);
-    int64_t min_y = static_cast<int64_t>(y) - static_cast<int64_t>(coverage_radius);
-    int64_t max_x = static_cast<int64_t>(x) + static_cast<int64_t>(coverage_radius);
-    int64_t max_y = static_cast<int64_t>(y) + static_cast<int64_t>(coverage_radius);
-
-    if (min_x < 0) min_x = 0;
-    if (min_y < 0) min_y = 0;
-    if (max_x >= static_cast<int64_t>(m_map_width)) max_x = static_cast<int64_t>(m_map_width) - 1;
-    if (max_y >= static_cast<int64_t>(m_map_height)) max_y = static_cast<int64_t>(m_map_height) - 1;
-
-    // Collect tiles that would gain coverage
-    for (int64_t ty = min_y; ty <= max_y; ++ty) {
-        for (int64_t tx = min_x; tx <= max_x; ++tx) {
-            uint32_t tile_x = static_cast<uint32_t>(tx);
-            uint32_t tile_y = static_cast<uint32_t>(ty);
-            if (m_coverage_grid.get_coverage_owner(tile_x, tile_y) != overseer_id) {
-                delta.emplace_back(tile_x, tile_y);
-            }
-        }
-    }
-
-    return delta;
+    // Calculate coverage delta with default conduit coverage_radius
+    return EnergyNetwork::preview_delta(m_coverage_grid, x, y,
+                                        EnergyNetworkTraits::DEFAULT_CONDUIT_RADIUS,
+                                        owner + 1, m_map_width, m_map_height);
 }
 
 // =============================================================================
@@ -1232,18 +1667,8 @@ void EnergySystem::update_conduit_active_states(uint8_t owner) {
     const PerPlayerEnergyPool& pool = m_pools[owner];
     bool has_generation = (pool.total_generated > 0);
 
-    for (const auto& pair : m_conduit_positions[owner]) {
-        uint32_t entity_id = pair.second;
-        auto entity = static_cast<entt::entity>(entity_id);
-        if (!m_registry->valid(entity)) {
-            continue;
-        }
-        auto* conduit = m_registry->try_get<EnergyConduitComponent>(entity);
-        if (!conduit) {
-            continue;
-        }
-        conduit->is_active = (conduit->is_connected && has_generation);
-    }
+    EnergyNetwork::update_active_states(m_registry, m_conduit_positions[owner],
+                                        has_generation);
 }
 
 // =============================================================================
@@ -1285,24 +1710,20 @@ std::vector<ContaminationSourceData> EnergySystem::get_contamination_sources(uin
     }
 
     // Iterate all nexus positions for this owner
-    for (const auto& pos_pair : m_nexus_positions[owner]) {
-        uint32_t entity_id = pos_pair.second;
-        uint32_t nx = unpack_x(pos_pair.first);
-        uint32_t ny = unpack_y(pos_pair.first);
-
+    m_nexus_positions[owner].for_each([&](uint32_t nx, uint32_t ny, uint32_t entity_id) {
         auto entity = static_cast<entt::entity>(entity_id);
         if (!m_registry->valid(entity)) {
-            continue;
+            return;
         }
 
         const auto* comp = m_registry->try_get<EnergyProducerComponent>(entity);
         if (!comp) {
-            continue;
+            return;
         }
 
         // Only include nexuses that are online with actual output and contamination
         if (!comp->is_online || comp->current_output == 0 || comp->contamination_output == 0) {
-            continue;
+            return;
         }
 
         // Determine contamination radius from NexusTypeConfig coverage_radius
@@ -1321,7 +1742,7 @@ std::vector<ContaminationSourceData> EnergySystem::get_contamination_sources(uin
         source.y = ny;
         source.radius = radius;
         result.push_back(source);
-    }
+    });
 
     return result;
 }
@@ -1334,29 +1755,131 @@ std::vector<ContaminationSourceData> EnergySystem::get_contamination_sources(uin
 // Priority-based rationing (Ticket 5-019)
 // =============================================================================
 
-void EnergySystem::apply_rationing(uint8_t owner) {
-    if (owner >= MAX_PLAYERS || !m_registry) {
+namespace {
+
+bool ration_order(uint8_t a_priority, uint32_t a_id, uint8_t b_priority, uint32_t b_id) {
+    if (a_priority != b_priority) {
+        return a_priority < b_priority;
+    }
+    return a_id < b_id;
+}
+
+} // anonymous namespace
+
+void EnergySystem::file_ration_entry(uint8_t owner, uint32_t entity_id, uint32_t tile,
+                                     uint8_t priority) {
+    uint8_t bucket_index = (priority < RATION_OVERFLOW_BUCKET) ? priority : RATION_OVERFLOW_BUCKET;
+    RationBucket& bucket = m_ration_buckets[owner][bucket_index];
+
+    RationEntry entry{};
+    entry.entity_id = entity_id;
+    entry.tile = tile;
+    entry.demand = m_consumer_demand[owner][tile];
+    entry.priority = priority;
+    entry.covered = m_coverage_grid.is_in_coverage(tile % m_map_width, tile / m_map_width,
+                                                   owner + 1);
+
+    // Appended; the bucket is sorted lazily when rationing walks it
+    if (!bucket.entries.empty()) {
+        const RationEntry& last = bucket.entries.back();
+        if (ration_order(priority, entity_id, last.priority, last.entity_id)) {
+            bucket.sorted = false;
+        }
+    }
+    TrackedEntity& tracked = tracked_slot(m_tracked_consumers, entity_id);
+    tracked.ration_bucket = bucket_index;
+    tracked.ration_index = static_cast<uint32_t>(bucket.entries.size());
+    bucket.entries.push_back(entry);
+
+    if (entry.covered) {
+        bucket.demand += entry.demand;
+        bucket.min_demand = std::min(bucket.min_demand, entry.demand);
+    }
+    bucket.state = RationState::Stale;
+}
+
+void EnergySystem::unfile_ration_entry(uint8_t owner, uint32_t entity_id) {
+    if (!find_ration_entry(owner, entity_id)) {
         return;
     }
+    const TrackedEntity* tracked = find_tracked(m_tracked_consumers, entity_id);
+    RationBucket& bucket = m_ration_buckets[owner][tracked->ration_bucket];
+    uint32_t index = tracked->ration_index;
 
-    uint8_t overseer_id = owner + 1;
+    const RationEntry& entry = bucket.entries[index];
+    if (entry.covered) {
+        bucket.demand -= entry.demand;
+    }
 
-    // Struct to hold consumer info for sorting
-    struct ConsumerInfo {
-        uint32_t entity_id;
-        uint8_t priority;
-        uint32_t energy_required;
-    };
+    // Swap-and-pop; the moved entry's slot is re-pointed
+    if (index + 1 != bucket.entries.size()) {
+        bucket.entries[index] = bucket.entries.back();
+        tracked_slot(m_tracked_consumers, bucket.entries[index].entity_id).ration_index = index;
+        bucket.sorted = false;
+    }
+    bucket.entries.pop_back();
+    bucket.state = RationState::Stale;
+}
 
-    std::vector<ConsumerInfo> in_coverage;
+EnergySystem::RationEntry* EnergySystem::find_ration_entry(uint8_t owner, uint32_t entity_id) {
+    const TrackedEntity* tracked = find_tracked(m_tracked_consumers, entity_id);
+    if (!tracked || tracked->owner != owner) {
+        return nullptr;
+    }
+    std::vector<RationEntry>& entries = m_ration_buckets[owner][tracked->ration_bucket].entries;
+    if (tracked->ration_index >= entries.size() ||
+        entries[tracked->ration_index].entity_id != entity_id) {
+        return nullptr;
+    }
+    return &entries[tracked->ration_index];
+}
 
-    // Collect all consumers in coverage for this owner
-    for (const auto& pair : m_consumer_positions[owner]) {
-        uint32_t x = unpack_x(pair.first);
-        uint32_t y = unpack_y(pair.first);
-        uint32_t entity_id = pair.second;
+void EnergySystem::update_ration_entry(uint8_t owner, RationEntry& entry, uint32_t demand,
+                                       bool covered) {
+    if (entry.demand == demand && entry.covered == covered) {
+        return;
+    }
+    uint8_t bucket_index = (entry.priority < RATION_OVERFLOW_BUCKET)
+        ? entry.priority : RATION_OVERFLOW_BUCKET;
+    RationBucket& bucket = m_ration_buckets[owner][bucket_index];
+    if (entry.covered) {
+        bucket.demand -= entry.demand;
+    }
+    entry.demand = demand;
+    entry.covered = covered;
+    if (covered) {
+        bucket.demand += demand;
+        bucket.min_demand = std::min(bucket.min_demand, demand);
+    }
+    bucket.state = RationState::Stale;
+}
 
-        auto entity = static_cast<entt::entity>(entity_id);
+void EnergySystem::rebuild_ration_buckets(uint8_t owner) {
+    uint8_t overseer_id = owner + 1;
+    for (RationBucket& bucket : m_ration_buckets[owner]) {
+        bucket.demand = 0;
+        bucket.min_demand = UINT32_MAX;
+        for (RationEntry& entry : bucket.entries) {
+            entry.demand = m_consumer_demand[owner][entry.tile];
+            entry.covered = m_coverage_grid.is_in_coverage(entry.tile % m_map_width,
+                                                           entry.tile / m_map_width,
+                                                           overseer_id);
+            if (entry.covered) {
+                bucket.demand += entry.demand;
+                bucket.min_demand = std::min(bucket.min_demand, entry.demand);
+            }
+        }
+        bucket.state = RationState::Stale;
+    }
+}
+
+void EnergySystem::set_ration_state(uint8_t owner, uint8_t bucket_index, RationState state) {
+    RationBucket& bucket = m_ration_buckets[owner][bucket_index];
+    if (bucket.state == state) {
+        return;
+    }
+    for (const RationEntry& entry : bucket.entries) {
+        auto entity = static_cast<entt::entity>(entry.entity_id);
         if (!m_registry->valid(entity)) {
             continue;
         }
@@ -1364,49 +1887,100 @@ void EnergySystem::apply_rationing(uint8_t owner) {
         if (!ec) {
             continue;
         }
-
-        // Check coverage
-        if (!m_coverage_grid.is_in_coverage(x, y, overseer_id)) {
-            // Outside coverage: always unpowered
-            ec->is_powered = false;
-            ec->energy_received = 0;
-            continue;
+        // Consumers outside coverage are always unpowered
+        bool powered = (state == RationState::Powered) && entry.covered;
+        ec->is_powered = powered;
+        ec->energy_received = powered ? ec->energy_required : 0;
+    }
+    bucket.state = state;
+}
+
+uint64_t EnergySystem::allocate_ration_bucket(uint8_t owner, uint8_t bucket_index,
+                                              uint64_t available) {
+    RationBucket& bucket = m_ration_buckets[owner][bucket_index];
+    if (!bucket.sorted) {
+        std::sort(bucket.entries.begin(), bucket.entries.end(),
+                  [](const RationEntry& a, const RationEntry& b) {
+                      return ration_order(a.priority, a.entity_id, b.priority, b.entity_id);
+                  });
+        for (uint32_t i = 0; i < bucket.entries.size(); ++i) {
+            tracked_slot(m_tracked_consumers, bucket.entries[i].entity_id).ration_index = i;
         }
-
-        ConsumerInfo info;
-        info.entity_id = entity_id;
-        info.priority = ec->priority;
-        info.energy_required = ec->energy_required;
-        in_coverage.push_back(info);
+        bucket.sorted = true;
     }
 
-    // Sort by priority ascending (1=Critical first), then entity_id ascending for determinism
-    std::sort(in_coverage.begin(), in_coverage.end(),
-              [](const ConsumerInfo& a, const ConsumerInfo& b) {
-                  if (a.priority != b.priority) {
-                      return a.priority < b.priority;
-                  }
-                  return a.entity_id < b.entity_id;
-              });
-
-    // Available energy = pool.total_generated
-    uint32_t available = m_pools[owner].total_generated;
-
-    // Iterate sorted list and allocate energy
-    for (const auto& info : in_coverage) {
-        auto entity = static_cast<entt::entity>(info.entity_id);
+    // Greedy: a consumer that does not fit is skipped and allocation continues
+    uint32_t min_demand = UINT32_MAX;
+    bool any_powered = false;
+    bool any_unpowered = false;
+    for (const RationEntry& entry : bucket.entries) {
+        auto entity = static_cast<entt::entity>(entry.entity_id);
+        if (!m_registry->valid(entity)) {
+            continue;
+        }
         auto* ec = m_registry->try_get<EnergyComponent>(entity);
         if (!ec) {
             continue;
         }
+        bool powered = false;
+        if (entry.covered) {
+            min_demand = std::min(min_demand, entry.demand);
+            if (available >= entry.demand) {
+                available -= entry.demand;
+                powered = true;
+            }
+            any_powered |= powered;
+            any_unpowered |= !powered;
+        }
+        ec->is_powered = powered;
+        ec->energy_received = powered ? ec->energy_required : 0;
+    }
+    bucket.min_demand = min_demand;
+
+    // Record a uniform outcome so the next pass can skip the bucket
+    if (!any_unpowered) {
+        bucket.state = RationState::Powered;
+    } else if (!any_powered) {
+        bucket.state = RationState::Unpowered;
+    } else {
+        bucket.state = RationState::Stale;
+    }
+    return available;
+}
 
-        if (available >= info.energy_required) {
-            ec->is_powered = true;
-            ec->energy_received = info.energy_required;
-            available -= info.energy_required;
+void EnergySystem::apply_rationing(uint8_t owner) {
+    if (owner >= MAX_PLAYERS || !m_registry) {
+        return;
+    }
+    if (m_consumption_stale[owner]) {
+        rebuild_consumption_total(owner);
+    }
+
+    // Available energy = pool.total_generated
+    uint64_t available = m_pools[owner].total_generated;
+
+    // Running demand by bucket; every bucket before the first one that
+    // does not fit whole is powered outright.
+    uint64_t prefix[RATION_BUCKET_COUNT];
+    uint64_t running = 0;
+    for (uint8_t b = 0; b < RATION_BUCKET_COUNT; ++b) {
+        running += m_ration_buckets[owner][b].demand;
+        prefix[b] = running;
+    }
+    uint8_t cut = static_cast<uint8_t>(
+        std::upper_bound(prefix, prefix + RATION_BUCKET_COUNT, available) - prefix);
+    for (uint8_t b = 0; b < cut; ++b) {
+        set_ration_state(owner, b, RationState::Powered);
+    }
+    uint64_t remaining = available - (cut > 0 ? prefix[cut - 1] : 0);
+
+    // From the cut, keep allocating greedily. A bucket whose smallest
+    // demand exceeds the remainder is unpowered wholesale.
+    for (uint8_t b = cut; b < RATION_BUCKET_COUNT; ++b) {
+        if (remaining < m_ration_buckets[owner][b].min_demand) {
+            set_ration_state(owner, b, RationState::Unpowered);
         } else {
-            ec->is_powered = false;
-            ec->energy_received = 0;
+            remaining = allocate_ration_bucket(owner, b, remaining);
         }
     }
 }
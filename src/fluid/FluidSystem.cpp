@@ -22,6 +22,7 @@
 #include <sims3000/fluid/FluidExtractorConfig.h>
 #include <sims3000/fluid/FluidReservoirConfig.h>
 #include <sims3000/fluid/FluidCoverageBFS.h>
+#include <sims3000/fluid/FluidNetworkTraits.h>
 #include <sims3000/terrain/ITerrainQueryable.h>
 #include <sims3000/energy/EnergyComponent.h>
 #include <algorithm>
@@ -46,6 +47,7 @@ FluidSystem::FluidSystem(uint32_t map_width, uint32_t map_height,
     , m_coverage_grid(map_width, map_height)
     , m_pools{}
     , m_coverage_dirty{}
+    , m_network_dirty{}
     , m_map_width(map_width)
     , m_map_height(map_height)
 {
@@ -53,6 +55,12 @@ FluidSystem::FluidSystem(uint32_t map_width, uint32_t map_height,
     for (uint8_t i = 0; i < MAX_PLAYERS; ++i) {
         m_pools[i].clear();
         m_coverage_dirty[i] = false;
+        m_network_dirty[i] = false;
+        m_extractor_positions[i].resize(map_width, map_height);
+        m_reservoir_positions[i].resize(map_width, map_height);
+        m_conduit_positions[i].resize(map_width, map_height);
+        m_consumer_positions[i].resize(map_width, map_height);
+        m_network_sets[i].resize(map_width, map_height);
     }
 }
 
@@ -101,6 +109,7 @@ void FluidSystem::tick(float /*delta_time*/) {
             recalculate_coverage(ctx);
             m_coverage_dirty[i] = false;
         }
+        m_network_dirty[i] = false;
     }
 
     // Phase 5: aggregate_consumption() (Ticket 6-016)
@@ -298,8 +307,9 @@ void FluidSystem::register_extractor_position(uint32_t entity_id, uint8_t owner,
         return;
     }
     uint64_t key = pack_position(x, y);
-    m_extractor_positions[owner][key] = entity_id;
+    m_extractor_positions[owner].set(x, y, entity_id);
     m_extractor_reverse[owner][entity_id] = key;
+    sync_network_tile(owner, x, y);
     m_coverage_dirty[owner] = true;
 }
 
@@ -309,8 +319,9 @@ void FluidSystem::register_reservoir_position(uint32_t entity_id, uint8_t owner,
         return;
     }
     uint64_t key = pack_position(x, y);
-    m_reservoir_positions[owner][key] = entity_id;
+    m_reservoir_positions[owner].set(x, y, entity_id);
     m_reservoir_reverse[owner][entity_id] = key;
+    sync_network_tile(owner, x, y);
     m_coverage_dirty[owner] = true;
 }
 
@@ -320,7 +331,7 @@ void FluidSystem::register_consumer_position(uint32_t entity_id, uint8_t owner,
         return;
     }
     uint64_t key = pack_position(x, y);
-    m_consumer_positions[owner][key] = entity_id;
+    m_consumer_positions[owner].set(x, y, entity_id);
     m_consumer_reverse[owner][entity_id] = key;
 }
 
@@ -480,9 +491,16 @@ uint32_t FluidSystem::place_conduit(uint32_t x, uint32_t y, uint8_t owner) {
 
     // Register conduit position
     uint64_t key = pack_position(x, y);
-    m_conduit_positions[owner][key] = entity_id;
+    m_conduit_positions[owner].set(x, y, entity_id);
     m_conduit_reverse[owner][entity_id] = key;
-    m_coverage_dirty[owner] = true;
+    sync_network_tile(owner, x, y);
+
+    // A conduit joining a network without a source cannot change coverage
+    if (m_network_sets[owner].has_source(x, y)) {
+        m_coverage_dirty[owner] = true;
+    } else {
+        m_network_dirty[owner] = true;
+    }
 
     // Cost deduction stub: not yet deducted, needs ICreditProvider
 
@@ -515,11 +533,17 @@ bool FluidSystem::remove_conduit(uint32_t entity_id, uint8_t owner,
         return false;
     }
 
-    // Unregister conduit position
-    uint64_t key = pack_position(x, y);
-    m_conduit_positions[owner].erase(key);
+    // Unregister conduit position. Removing a conduit from a network
+    // without a source cannot change coverage.
+    bool was_fed = m_network_sets[owner].has_source(x, y);
+    m_conduit_positions[owner].erase(x, y);
     m_conduit_reverse[owner].erase(entity_id);
-    m_coverage_dirty[owner] = true;
+    sync_network_tile(owner, x, y);
+    if (was_fed) {
+        m_coverage_dirty[owner] = true;
+    } else {
+        m_network_dirty[owner] = true;
+    }
 
     // Emit FluidConduitRemovedEvent
     m_conduit_removed_events.emplace_back(entity_id, owner, x, y);
@@ -563,23 +587,11 @@ std::vector<std::pair<uint32_t, uint32_t>> FluidSystem::preview_conduit_coverage
             continue;
         }
 
-        uint64_t neighbor_key = pack_position(static_cast<uint32_t>(nx),
-                                               static_cast<uint32_t>(ny));
-
-        // Check conduit positions
-        if (m_conduit_positions[owner].find(neighbor_key) != m_conduit_positions[owner].end()) {
-            connected = true;
-            break;
-        }
+        uint32_t nbx = static_cast<uint32_t>(nx);
+        uint32_t nby = static_cast<uint32_t>(ny);
 
-        // Check extractor positions
-        if (m_extractor_positions[owner].find(neighbor_key) != m_extractor_positions[owner].end()) {
-            connected = true;
-            break;
-        }
-
-        // Check reservoir positions
-        if (m_reservoir_positions[owner].find(neighbor_key) != m_reservoir_positions[owner].end()) {
+        // Any conduit, extractor or reservoir tile is a member of the network sets
+        if (m_network_sets[owner].contains(nbx, nby)) {
             connected = true;
             break;
         }
@@ -591,31 +603,8 @@ std::vector<std::pair<uint32_t, uint32_t>> FluidSystem::preview_conduit_coverage
 
     // Calculate coverage delta with default conduit coverage_radius = 3
     const uint8_t coverage_radius = 3;
-    uint8_t overseer_id = owner + 1;
-
-    // Compute clamped bounds
-    int64_t min_x = static_cast<int64_t>(x) - static_cast<int64_t>(coverage_radius);
-    int64_t min_y = static_cast<int64_t>(y) - static_cast<int64_t>(coverage_radius);
-    int64_t max_x = static_cast<int64_t>(x) + static_cast<int64_t>(coverage_radius);
-    int64_t max_y = static_cast<int64_t>(y) + static_cast<int64_t>(coverage_radius);
-
-    if (min_x < 0) min_x = 0;
-    if (min_y < 0) min_y = 0;
-    if (max_x >= static_cast<int64_t>(m_map_width)) max_x = static_cast<int64_t>(m_map_width) - 1;
-    if (max_y >= static_cast<int64_t>(m_map_height)) max_y = static_cast<int64_t>(m_map_height) - 1;
-
-    // Collect tiles that would gain coverage
-    for (int64_t ty = min_y; ty <= max_y; ++ty) {
-        for (int64_t tx = min_x; tx <= max_x; ++tx) {
-            uint32_t tile_x = static_cast<uint32_t>(tx);
-            uint32_t tile_y = static_cast<uint32_t>(ty);
-            if (m_coverage_grid.get_coverage_owner(tile_x, tile_y) != overseer_id) {
-                delta.emplace_back(tile_x, tile_y);
-            }
-        }
-    }
-
-    return delta;
+    return FluidNetwork::preview_delta(m_coverage_grid, x, y, coverage_radius,
+                                       owner + 1, m_map_width, m_map_height);
 }
 
 // =============================================================================
@@ -638,7 +627,28 @@ bool FluidSystem::is_coverage_dirty(uint8_t owner) const {
     if (owner >= MAX_PLAYERS) {
         return false;
     }
-    return m_coverage_dirty[owner];
+    return m_coverage_dirty[owner] || m_network_dirty[owner];
+}
+
+bool FluidSystem::is_network_dirty(uint8_t owner) const {
+    if (owner >= MAX_PLAYERS) {
+        return false;
+    }
+    return m_network_dirty[owner];
+}
+
+bool FluidSystem::is_connected_to_source(uint32_t x, uint32_t y, uint8_t owner) const {
+    if (owner >= MAX_PLAYERS) {
+        return false;
+    }
+    return m_network_sets[owner].has_source(x, y);
+}
+
+uint32_t FluidSystem::get_network_component_count(uint8_t owner) const {
+    if (owner >= MAX_PLAYERS) {
+        return 0;
+    }
+    return m_network_sets[owner].component_count();
 }
 
 // =============================================================================
@@ -689,7 +699,7 @@ uint32_t FluidSystem::get_conduit_position_count(uint8_t owner) const {
     if (owner >= MAX_PLAYERS) {
         return 0;
     }
-    return static_cast<uint32_t>(m_conduit_positions[owner].size());
+    return m_conduit_positions[owner].size();
 }
 
 // =============================================================================
@@ -837,8 +847,7 @@ void FluidSystem::on_building_deconstructed(uint32_t entity_id, uint8_t owner,
         auto it = std::find(ids.begin(), ids.end(), entity_id);
         if (it != ids.end()) {
             unregister_consumer(entity_id, owner);
-            uint64_t key = pack_position(x, y);
-            m_consumer_positions[owner].erase(key);
+            m_consumer_positions[owner].erase(x, y);
             // Note: unregister_consumer already erases from m_consumer_reverse
         }
     }
@@ -849,8 +858,8 @@ void FluidSystem::on_building_deconstructed(uint32_t entity_id, uint8_t owner,
         auto it = std::find(ids.begin(), ids.end(), entity_id);
         if (it != ids.end()) {
             unregister_extractor(entity_id, owner);
-            uint64_t key = pack_position(x, y);
-            m_extractor_positions[owner].erase(key);
+            m_extractor_positions[owner].erase(x, y);
+            sync_network_tile(owner, x, y);
             // Note: unregister_extractor already erases from m_extractor_reverse
             m_coverage_dirty[owner] = true;
         }
@@ -862,8 +871,8 @@ void FluidSystem::on_building_deconstructed(uint32_t entity_id, uint8_t owner,
         auto it = std::find(ids.begin(), ids.end(), entity_id);
         if (it != ids.end()) {
             unregister_reservoir(entity_id, owner);
-            uint64_t key = pack_position(x, y);
-            m_reservoir_positions[owner].erase(key);
+            m_reservoir_positions[owner].erase(x, y);
+            sync_network_tile(owner, x, y);
             // Note: unregister_reservoir already erases from m_reservoir_reverse
             m_coverage_dirty[owner] = true;
         }
@@ -887,15 +896,29 @@ uint32_t FluidSystem::get_map_height() const {
 // =============================================================================
 
 uint64_t FluidSystem::pack_position(uint32_t x, uint32_t y) {
-    return (static_cast<uint64_t>(x) << 32) | static_cast<uint64_t>(y);
+    return FluidNetwork::pack(x, y);
 }
 
 uint32_t FluidSystem::unpack_x(uint64_t packed) {
-    return static_cast<uint32_t>(packed >> 32);
+    return FluidNetwork::unpack_x(packed);
 }
 
 uint32_t FluidSystem::unpack_y(uint64_t packed) {
-    return static_cast<uint32_t>(packed & 0xFFFFFFFF);
+    return FluidNetwork::unpack_y(packed);
+}
+
+void FluidSystem::sync_network_tile(uint8_t owner, uint32_t x, uint32_t y) {
+    bool is_source = m_extractor_positions[owner].contains(x, y) ||
+                     m_reservoir_positions[owner].contains(x, y);
+    bool is_member = is_source || m_conduit_positions[owner].contains(x, y);
+
+    TileDisjointSet& sets = m_network_sets[owner];
+    if (!is_member) {
+        sets.erase(x, y);
+        return;
+    }
+    sets.insert(x, y);
+    sets.set_source(x, y, is_source);
 }
 
 // =============================================================================
@@ -1296,18 +1319,8 @@ void FluidSystem::update_conduit_active_states(uint8_t owner) {
     const PerPlayerFluidPool& pool = m_pools[owner];
     bool has_generation = (pool.total_generated > 0);
 
-    for (const auto& pair : m_conduit_positions[owner]) {
-        uint32_t entity_id = pair.second;
-        auto entity = static_cast<entt::entity>(entity_id);
-        if (!m_registry->valid(entity)) {
-            continue;
-        }
-        auto* conduit = m_registry->try_get<FluidConduitComponent>(entity);
-        if (!conduit) {
-            continue;
-        }
-        conduit->is_active = (conduit->is_connected && has_generation);
-    }
+    FluidNetwork::update_active_states(m_registry, m_conduit_positions[owner],
+                                       has_generation);
 }
 
 // =============================================================================
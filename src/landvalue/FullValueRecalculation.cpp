@@ -2,6 +2,11 @@
  * @file FullValueRecalculation.cpp
  * @brief Implementation of full land value recalculation.
  *
+ * The fused kernel sums one row chunk at a time: five table lookups per
+ * tile into an int16_t buffer (the largest sum, 128 + 55 + 20, and the
+ * smallest, 128 - 30 - 40 - 50, both fit), then saturating 16-to-8 bit
+ * packs do the [0, 255] clamp and narrowing many tiles at a time.
+ *
  * @see FullValueRecalculation.h for documentation.
  * @see E10-105
  */
@@ -13,9 +18,82 @@
 #include <sims3000/landvalue/ContaminationPenalty.h>
 #include <algorithm>
 
+// SIMS3000_NO_SIMD forces the scalar path (for testing and odd targets)
+#if defined(SIMS3000_NO_SIMD)
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#define SIMS3000_LANDVALUE_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SIMS3000_LANDVALUE_SSE2 1
+#endif
+
 namespace sims3000 {
 namespace landvalue {
 
+namespace {
+
+/// Tiles summed per pass; the int16_t buffer stays in L1
+constexpr uint32_t KERNEL_CHUNK = 256;
+
+LandValueTables build_tables() {
+    LandValueTables tables;
+    const uint8_t no_water = 255;  // beyond every water bonus
+    const uint8_t plain = 0;       // terrain type with no bonus
+    for (int i = 0; i < 256; ++i) {
+        const uint8_t v = static_cast<uint8_t>(i);
+        tables.terrain[i] = calculate_terrain_bonus(v, no_water);
+        tables.water[i] = calculate_terrain_bonus(plain, v);
+        tables.road[i] = calculate_road_bonus(v);
+        tables.disorder[i] = static_cast<int16_t>(-calculate_disorder_penalty(v));
+        tables.contamination[i] = static_cast<int16_t>(-calculate_contamination_penalty(v));
+    }
+    return tables;
+}
+
+#if defined(SIMS3000_LANDVALUE_AVX2)
+
+/// Clamp-and-narrow whole vectors; returns the first index left for the scalar tail.
+uint32_t narrow_simd(const int16_t* sums, uint8_t* out, uint32_t count) {
+    uint32_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(sums + i));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(sums + i + 16));
+        // packus interleaves 128-bit lanes; restore tile order
+        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), packed);
+    }
+    return i;
+}
+
+#elif defined(SIMS3000_LANDVALUE_SSE2)
+
+/// Clamp-and-narrow whole vectors; returns the first index left for the scalar tail.
+uint32_t narrow_simd(const int16_t* sums, uint8_t* out, uint32_t count) {
+    uint32_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sums + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sums + i + 8));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(a, b));
+    }
+    return i;
+}
+
+#else
+
+uint32_t narrow_simd(const int16_t* /*sums*/, uint8_t* /*out*/, uint32_t /*count*/) {
+    return 0;
+}
+
+#endif
+
+} // anonymous namespace
+
+const LandValueTables& get_land_value_tables() {
+    static const LandValueTables tables = build_tables();
+    return tables;
+}
+
 uint8_t calculate_tile_value(const LandValueTileInput& input) {
     // Start with base value
     int32_t value = static_cast<int32_t>(BASE_LAND_VALUE);
@@ -70,5 +148,58 @@ void recalculate_all_values(LandValueGrid& grid,
     }
 }
 
+void recalculate_all_values(LandValueGrid& grid, const LandValueInputPlanes& planes) {
+    recalculate_values_in_rect(grid, planes, 0, 0, grid.get_width(), grid.get_height());
+}
+
+void recalculate_values_in_rect(LandValueGrid& grid, const LandValueInputPlanes& planes,
+                                uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+    if (planes.terrain_types == nullptr || planes.water_distances == nullptr ||
+        planes.road_distances == nullptr || planes.disorder_levels == nullptr ||
+        planes.contam_levels == nullptr) {
+        return;
+    }
+
+    const LandValueTables& tables = get_land_value_tables();
+    const uint32_t grid_width = grid.get_width();
+    const uint32_t grid_height = grid.get_height();
+    if (x >= grid_width || y >= grid_height) {
+        return;
+    }
+    const uint32_t x_end = x + std::min(width, grid_width - x);
+    const uint32_t y_end = y + std::min(height, grid_height - y);
+    const size_t stride = planes.terrain_stride;
+
+    int16_t sums[KERNEL_CHUNK];
+    uint8_t values[KERNEL_CHUNK];
+
+    for (uint32_t row = y; row < y_end; ++row) {
+        for (uint32_t x0 = x; x0 < x_end; x0 += KERNEL_CHUNK) {
+            const uint32_t count = std::min(KERNEL_CHUNK, x_end - x0);
+            const size_t first = static_cast<size_t>(row) * grid_width + x0;
+
+            const uint8_t* terrain = planes.terrain_types + first * stride;
+            const uint8_t* water = planes.water_distances + first;
+            const uint8_t* road = planes.road_distances + first;
+            const uint8_t* disorder = planes.disorder_levels + first;
+            const uint8_t* contam = planes.contam_levels + first;
+            for (uint32_t i = 0; i < count; ++i) {
+                sums[i] = static_cast<int16_t>(BASE_LAND_VALUE
+                    + tables.terrain[terrain[i * stride]]
+                    + tables.water[water[i]]
+                    + tables.road[road[i]]
+                    + tables.disorder[disorder[i]]
+                    + tables.contamination[contam[i]]);
+            }
+
+            uint32_t i = narrow_simd(sums, values, count);
+            for (; i < count; ++i) {
+                values[i] = static_cast<uint8_t>(std::max<int16_t>(0, std::min<int16_t>(255, sums[i])));
+            }
+            grid.set_values(static_cast<int32_t>(x0), static_cast<int32_t>(row), values, count);
+        }
+    }
+}
+
 } // namespace landvalue
 } // namespace sims3000
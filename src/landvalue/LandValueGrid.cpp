@@ -8,6 +8,7 @@
 
 #include <sims3000/landvalue/LandValueGrid.h>
 #include <algorithm>
+#include <cstddef>
 
 namespace sims3000 {
 namespace landvalue {
@@ -51,6 +52,18 @@ void LandValueGrid::set_value(int32_t x, int32_t y, uint8_t value) {
     m_value_cache_dirty = true;
 }
 
+void LandValueGrid::set_values(int32_t x, int32_t y, const uint8_t* values, uint32_t count) {
+    if (!is_valid(x, y) || static_cast<uint32_t>(x) + count > m_width) {
+        return;
+    }
+    const size_t start = index(x, y);
+    for (uint32_t i = 0; i < count; ++i) {
+        m_grid[start + i].total_value = values[i];
+    }
+    // Keep the overlay buffer in step rather than forcing a full re-extract
+    std::copy(values, values + count, m_value_cache.begin() + static_cast<std::ptrdiff_t>(start));
+}
+
 void LandValueGrid::subtract_value(int32_t x, int32_t y, uint8_t amount) {
     if (!is_valid(x, y)) {
         return;
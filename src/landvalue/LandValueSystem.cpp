@@ -7,16 +7,30 @@
  */
 
 #include <sims3000/landvalue/LandValueSystem.h>
+#include <sims3000/core/TileActivityMask.h>
+#include <sims3000/terrain/TerrainGrid.h>
+#include <sims3000/terrain/WaterDistanceField.h>
+#include <sims3000/transport/ProximityCache.h>
+#include <sims3000/disorder/DisorderGrid.h>
+#include <sims3000/contamination/ContaminationGrid.h>
+#include <algorithm>
 
 namespace sims3000 {
 namespace landvalue {
 
 LandValueSystem::LandValueSystem(uint16_t grid_width, uint16_t grid_height)
     : m_grid(grid_width, grid_height)
+    , m_blocks_x((static_cast<uint32_t>(grid_width) + TILE_BLOCK_SIZE - 1) >> TILE_BLOCK_SHIFT)
+    , m_blocks_y((static_cast<uint32_t>(grid_height) + TILE_BLOCK_SIZE - 1) >> TILE_BLOCK_SHIFT)
+    , m_dirty_blocks(static_cast<size_t>(m_blocks_x) * m_blocks_y, 1)
+    , m_penalty_blocks(static_cast<size_t>(m_blocks_x) * m_blocks_y, 0)
 {
 }
 
 void LandValueSystem::tick(const ISimulationTime& /*time*/) {
+    if (recalculate()) {
+        return;
+    }
     m_grid.reset_values();
     apply_terrain_bonus();
     apply_road_bonus();
@@ -24,6 +38,51 @@ void LandValueSystem::tick(const ISimulationTime& /*time*/) {
     apply_contamination_penalty();
 }
 
+void LandValueSystem::set_sources(const LandValueSources& sources) {
+    m_sources = sources;
+    mark_all_dirty();
+}
+
+void LandValueSystem::on_terrain_modified(const terrain::TerrainModifiedEvent& event) {
+    if (event.modification_type == terrain::ModificationType::Generated ||
+        event.modification_type == terrain::ModificationType::SeaLevelChanged) {
+        mark_all_dirty();
+        return;
+    }
+    const terrain::GridRect& area = event.affected_area;
+    mark_dirty(area.x - FACTOR_REACH, area.y - FACTOR_REACH,
+               area.width + 2 * FACTOR_REACH, area.height + 2 * FACTOR_REACH);
+}
+
+void LandValueSystem::on_pathway_changed(int32_t x, int32_t y) {
+    mark_dirty(x - FACTOR_REACH, y - FACTOR_REACH, 2 * FACTOR_REACH + 1, 2 * FACTOR_REACH + 1);
+}
+
+void LandValueSystem::mark_dirty(int32_t x, int32_t y, int32_t width, int32_t height) {
+    const int32_t x0 = std::max(x, 0);
+    const int32_t y0 = std::max(y, 0);
+    const int32_t x1 = std::min(x + width, static_cast<int32_t>(m_grid.get_width()));
+    const int32_t y1 = std::min(y + height, static_cast<int32_t>(m_grid.get_height()));
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+    for (uint32_t by = static_cast<uint32_t>(y0) >> TILE_BLOCK_SHIFT;
+         by <= static_cast<uint32_t>(y1 - 1) >> TILE_BLOCK_SHIFT; ++by) {
+        for (uint32_t bx = static_cast<uint32_t>(x0) >> TILE_BLOCK_SHIFT;
+             bx <= static_cast<uint32_t>(x1 - 1) >> TILE_BLOCK_SHIFT; ++bx) {
+            m_dirty_blocks[static_cast<size_t>(by) * m_blocks_x + bx] = 1;
+        }
+    }
+}
+
+void LandValueSystem::mark_all_dirty() {
+    std::fill(m_dirty_blocks.begin(), m_dirty_blocks.end(), static_cast<uint8_t>(1));
+}
+
+uint32_t LandValueSystem::get_last_recomputed_blocks() const {
+    return m_last_recomputed_blocks;
+}
+
 const LandValueGrid& LandValueSystem::get_grid() const {
     return m_grid;
 }
@@ -36,8 +95,83 @@ float LandValueSystem::get_land_value(uint32_t x, uint32_t y) const {
     return static_cast<float>(m_grid.get_value(static_cast<int32_t>(x), static_cast<int32_t>(y)));
 }
 
-void LandValueSystem::recalculate() {
-    // Stub: will be implemented by E10-105
+bool LandValueSystem::gather_planes(LandValueInputPlanes& planes) const {
+    const LandValueSources& src = m_sources;
+    if (src.terrain == nullptr || src.water == nullptr || src.roads == nullptr ||
+        src.disorder == nullptr || src.contamination == nullptr) {
+        return false;
+    }
+
+    const uint32_t width = m_grid.get_width();
+    const uint32_t height = m_grid.get_height();
+    if (src.terrain->width != width || src.terrain->height != height ||
+        src.terrain->tiles.size() != static_cast<size_t>(width) * height ||
+        src.water->width != width || src.water->height != height ||
+        src.roads->width() != width || src.roads->height() != height ||
+        src.disorder->get_width() != width || src.disorder->get_height() != height ||
+        src.contamination->get_width() != width || src.contamination->get_height() != height) {
+        return false;
+    }
+
+    // Buffer pointers are fetched every tick: disorder and contamination
+    // swap their previous/current planes between ticks.
+    planes.terrain_types = &src.terrain->tiles[0].terrain_type;
+    planes.terrain_stride = sizeof(terrain::TerrainComponent);
+    planes.water_distances = src.water->distances.data();
+    planes.road_distances = src.roads->get_distance_data();
+    planes.disorder_levels = src.disorder->get_previous_raw_data();
+    planes.contam_levels = src.contamination->get_previous_level_data();
+    return true;
+}
+
+bool LandValueSystem::recalculate() {
+    LandValueInputPlanes planes;
+    if (!gather_planes(planes)) {
+        return false;
+    }
+
+    // Penalty inputs change without notification; recompute blocks where
+    // either is non-zero now or was at the last recompute (gone to zero).
+    const TileActivityMask& disorder = m_sources.disorder->get_previous_activity();
+    const TileActivityMask& contam = m_sources.contamination->get_previous_activity();
+    for (uint32_t by = 0; by < m_blocks_y; ++by) {
+        for (uint32_t bx = 0; bx < m_blocks_x; ++bx) {
+            const size_t block = static_cast<size_t>(by) * m_blocks_x + bx;
+            const uint8_t active = (disorder.is_block_active(bx, by) ||
+                                    contam.is_block_active(bx, by)) ? 1 : 0;
+            m_dirty_blocks[block] |= active | m_penalty_blocks[block];
+            m_penalty_blocks[block] = active;
+        }
+    }
+
+    // Reconciliation sweep
+    for (uint32_t i = 0; i < RECONCILE_BLOCK_ROWS_PER_TICK && i < m_blocks_y; ++i) {
+        std::fill_n(m_dirty_blocks.begin() + static_cast<std::ptrdiff_t>(m_reconcile_row) * m_blocks_x,
+                    m_blocks_x, static_cast<uint8_t>(1));
+        m_reconcile_row = (m_reconcile_row + 1) % m_blocks_y;
+    }
+
+    // Recompute runs of dirty blocks one block row at a time
+    m_last_recomputed_blocks = 0;
+    for (uint32_t by = 0; by < m_blocks_y; ++by) {
+        uint8_t* row = &m_dirty_blocks[static_cast<size_t>(by) * m_blocks_x];
+        uint32_t bx = 0;
+        while (bx < m_blocks_x) {
+            if (row[bx] == 0) {
+                ++bx;
+                continue;
+            }
+            const uint32_t run_start = bx;
+            while (bx < m_blocks_x && row[bx] != 0) {
+                row[bx++] = 0;
+            }
+            recalculate_values_in_rect(m_grid, planes,
+                                       run_start << TILE_BLOCK_SHIFT, by << TILE_BLOCK_SHIFT,
+                                       (bx - run_start) << TILE_BLOCK_SHIFT, TILE_BLOCK_SIZE);
+            m_last_recomputed_blocks += bx - run_start;
+        }
+    }
+    return true;
 }
 
 void LandValueSystem::apply_terrain_bonus() {
@@ -13,9 +13,206 @@
 #include <cmath>
 #include <cstdlib>
 
+// SIMS3000_NO_SIMD forces the scalar path (for testing and odd targets)
+#if defined(SIMS3000_NO_SIMD)
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#define SIMS3000_COVERAGE_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SIMS3000_COVERAGE_SSE2 1
+#endif
+
 namespace sims3000 {
 namespace services {
 
+namespace {
+
+/// Buildings sharing a stamp
+struct StampGroup {
+    int32_t radius;
+    uint8_t effectiveness;
+    CoverageStamp stamp;
+    std::vector<uint32_t> members;  ///< Indices into the buildings vector
+};
+
+#if defined(SIMS3000_COVERAGE_AVX2)
+
+/// dst = max(dst, src) over whole vectors; returns the first index left for the scalar tail.
+uint32_t max_row_simd(uint8_t* dst, const uint8_t* src, uint32_t count) {
+    uint32_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_max_epu8(a, b));
+    }
+    return i;
+}
+
+/// row = min(row, prev + 1) over whole vectors; returns the first index left for the scalar tail.
+uint32_t relax_row_simd(uint8_t* row, const uint8_t* prev, uint32_t count) {
+    const __m256i one = _mm256_set1_epi8(1);
+    uint32_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + i));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(prev + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(row + i),
+                            _mm256_min_epu8(a, _mm256_adds_epu8(b, one)));
+    }
+    return i;
+}
+
+#elif defined(SIMS3000_COVERAGE_SSE2)
+
+/// dst = max(dst, src) over whole vectors; returns the first index left for the scalar tail.
+uint32_t max_row_simd(uint8_t* dst, const uint8_t* src, uint32_t count) {
+    uint32_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_max_epu8(a, b));
+    }
+    return i;
+}
+
+/// row = min(row, prev + 1) over whole vectors; returns the first index left for the scalar tail.
+uint32_t relax_row_simd(uint8_t* row, const uint8_t* prev, uint32_t count) {
+    const __m128i one = _mm_set1_epi8(1);
+    uint32_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(prev + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(row + i),
+                         _mm_min_epu8(a, _mm_adds_epu8(b, one)));
+    }
+    return i;
+}
+
+#else
+
+uint32_t max_row_simd(uint8_t* /*dst*/, const uint8_t* /*src*/, uint32_t /*count*/) {
+    return 0;
+}
+
+uint32_t relax_row_simd(uint8_t* /*row*/, const uint8_t* /*prev*/, uint32_t /*count*/) {
+    return 0;
+}
+
+#endif
+
+void max_row(uint8_t* dst, const uint8_t* src, uint32_t count) {
+    for (uint32_t i = max_row_simd(dst, src, count); i < count; ++i) {
+        if (src[i] > dst[i]) {
+            dst[i] = src[i];
+        }
+    }
+}
+
+void relax_row(uint8_t* row, const uint8_t* prev, uint32_t count) {
+    for (uint32_t i = relax_row_simd(row, prev, count); i < count; ++i) {
+        const uint8_t via = prev[i] == 255 ? prev[i] : static_cast<uint8_t>(prev[i] + 1);
+        if (via < row[i]) {
+            row[i] = via;
+        }
+    }
+}
+
+/// Max one stamp into the grid, clipped to the map and to the diamond.
+void blit_stamp(uint8_t* cells, int32_t map_w, int32_t map_h,
+                const CoverageStamp& stamp, int32_t cx, int32_t cy) {
+    const int32_t r = stamp.radius;
+    const int32_t size = 2 * r + 1;
+    const int32_t y0 = std::max(cy - r + 1, 0);
+    const int32_t y1 = std::min(cy + r - 1, map_h - 1);
+    for (int32_t ty = y0; ty <= y1; ++ty) {
+        // Tiles at distance >= r are zero; span of this row inside the diamond
+        const int32_t half = r - 1 - std::abs(ty - cy);
+        const int32_t x0 = std::max(cx - half, 0);
+        const int32_t x1 = std::min(cx + half, map_w - 1);
+        if (x0 > x1) {
+            continue;
+        }
+        const uint8_t* src = stamp.mask.data()
+            + static_cast<size_t>(ty - cy + r) * size + (x0 - cx + r);
+        uint8_t* dst = cells + static_cast<size_t>(ty) * map_w + x0;
+        max_row(dst, src, static_cast<uint32_t>(x1 - x0 + 1));
+    }
+}
+
+/**
+ * Max a whole group into the grid through a manhattan distance transform.
+ * The falloff profile is non-increasing in distance, so the best value at
+ * a tile comes from its nearest group member. Distances are capped at the
+ * radius, whose profile value is 0.
+ */
+void apply_distance_transform(uint8_t* cells, int32_t map_w, int32_t map_h,
+                              const StampGroup& group,
+                              const std::vector<int32_t>& seeds,
+                              std::vector<uint8_t>& dist) {
+    const uint8_t far = static_cast<uint8_t>(group.radius);
+    const size_t area = static_cast<size_t>(map_w) * map_h;
+    dist.assign(area, far);
+    for (int32_t index : seeds) {
+        dist[static_cast<size_t>(index)] = 0;
+    }
+
+    // L1 distance is separable: rows first, then columns
+    for (int32_t y = 0; y < map_h; ++y) {
+        uint8_t* row = dist.data() + static_cast<size_t>(y) * map_w;
+        for (int32_t x = 1; x < map_w; ++x) {
+            if (row[x - 1] < far && row[x - 1] + 1 < row[x]) {
+                row[x] = static_cast<uint8_t>(row[x - 1] + 1);
+            }
+        }
+        for (int32_t x = map_w - 2; x >= 0; --x) {
+            if (row[x + 1] < far && row[x + 1] + 1 < row[x]) {
+                row[x] = static_cast<uint8_t>(row[x + 1] + 1);
+            }
+        }
+    }
+    const uint32_t width = static_cast<uint32_t>(map_w);
+    for (int32_t y = 1; y < map_h; ++y) {
+        relax_row(dist.data() + static_cast<size_t>(y) * map_w,
+                  dist.data() + static_cast<size_t>(y - 1) * map_w, width);
+    }
+    for (int32_t y = map_h - 2; y >= 0; --y) {
+        relax_row(dist.data() + static_cast<size_t>(y) * map_w,
+                  dist.data() + static_cast<size_t>(y + 1) * map_w, width);
+    }
+
+    const uint8_t* profile = group.stamp.profile.data();
+    for (size_t i = 0; i < area; ++i) {
+        const uint8_t d = std::min(dist[i], far);
+        if (profile[d] > cells[i]) {
+            cells[i] = profile[d];
+        }
+    }
+}
+
+/// Radius a building currently covers, or 0 if it contributes nothing
+int coverage_radius(const ServiceBuildingData& building) {
+    if (!building.is_active || !isValidServiceTier(building.tier)) {
+        return 0;
+    }
+    ServiceTier tier = static_cast<ServiceTier>(building.tier);
+    return static_cast<int>(get_service_config(building.type, tier).base_radius);
+}
+
+/// Stamp for (radius, effectiveness), built on first use
+const CoverageStamp& find_or_build_stamp(std::vector<StampGroup>& cache,
+                                         int32_t radius, uint8_t effectiveness) {
+    for (const StampGroup& g : cache) {
+        if (g.radius == radius && g.effectiveness == effectiveness) {
+            return g.stamp;
+        }
+    }
+    cache.push_back(StampGroup{ radius, effectiveness,
+                                build_coverage_stamp(radius, effectiveness), {} });
+    return cache.back().stamp;
+}
+
+} // anonymous namespace
+
 float calculate_falloff(float effectiveness, int distance, int radius) {
     if (radius <= 0 || distance >= radius) {
         return 0.0f;
@@ -32,16 +229,53 @@ float calculate_falloff(float effectiveness, int distance, int radius) {
     return effectiveness * falloff;
 }
 
+CoverageStamp build_coverage_stamp(int radius, uint8_t effectiveness) {
+    CoverageStamp stamp;
+    if (radius <= 0) {
+        return stamp;
+    }
+    stamp.radius = radius;
+
+    // Normalize effectiveness from 0-255 to 0.0-1.0
+    const float eff = static_cast<float>(effectiveness) / 255.0f;
+    stamp.profile.resize(static_cast<size_t>(radius) + 1);
+    for (int d = 0; d <= radius; ++d) {
+        const float strength = calculate_falloff(eff, d, radius);
+        stamp.profile[static_cast<size_t>(d)] = static_cast<uint8_t>(
+            std::min(255.0f, strength * 255.0f + 0.5f)  // Round to nearest
+        );
+    }
+
+    const int size = 2 * radius + 1;
+    stamp.mask.assign(static_cast<size_t>(size) * size, 0);
+    for (int dy = -radius; dy <= radius; ++dy) {
+        for (int dx = -radius; dx <= radius; ++dx) {
+            const int distance = std::abs(dx) + std::abs(dy);
+            if (distance <= radius) {
+                stamp.mask[static_cast<size_t>(dy + radius) * size + (dx + radius)] =
+                    stamp.profile[static_cast<size_t>(distance)];
+            }
+        }
+    }
+    return stamp;
+}
+
 void calculate_radius_coverage(ServiceCoverageGrid& grid,
-                                const std::vector<ServiceBuildingData>& buildings) {
+                                const std::vector<ServiceBuildingData>& buildings,
+                                CoverageMethod method) {
     // Step 1: Clear the grid
     grid.clear();
 
     const int32_t map_w = static_cast<int32_t>(grid.get_width());
     const int32_t map_h = static_cast<int32_t>(grid.get_height());
+    if (map_w <= 0 || map_h <= 0) {
+        return;
+    }
 
-    // Step 2: For each active building, calculate coverage
-    for (const auto& building : buildings) {
+    // Step 2: Group active buildings by stamp
+    std::vector<StampGroup> groups;
+    for (uint32_t i = 0; i < static_cast<uint32_t>(buildings.size()); ++i) {
+        const ServiceBuildingData& building = buildings[i];
         // Skip inactive buildings
         if (!building.is_active) {
             continue;
@@ -59,48 +293,141 @@ void calculate_radius_coverage(ServiceCoverageGrid& grid,
             continue;
         }
 
-        // Normalize effectiveness from 0-255 to 0.0-1.0
-        float effectiveness = static_cast<float>(building.effectiveness) / 255.0f;
-
         // TODO: Skip tiles not owned by building owner (use owner_id check).
         // For now, treat all tiles as owned since no zone ownership grid exists yet.
 
-        // Iterate tiles within bounding box [-radius, +radius] around building
-        int32_t min_x = building.x - radius;
-        int32_t max_x = building.x + radius;
-        int32_t min_y = building.y - radius;
-        int32_t max_y = building.y + radius;
-
-        // Clamp to map bounds (no wraparound)
-        if (min_x < 0) min_x = 0;
-        if (min_y < 0) min_y = 0;
-        if (max_x >= map_w) max_x = map_w - 1;
-        if (max_y >= map_h) max_y = map_h - 1;
-
-        for (int32_t ty = min_y; ty <= max_y; ++ty) {
-            for (int32_t tx = min_x; tx <= max_x; ++tx) {
-                // Step 3: Calculate manhattan distance
-                int distance = std::abs(tx - building.x) + std::abs(ty - building.y);
-
-                // Skip tiles beyond radius
-                if (distance > radius) {
-                    continue;
-                }
+        StampGroup* group = nullptr;
+        for (StampGroup& g : groups) {
+            if (g.radius == radius && g.effectiveness == building.effectiveness) {
+                group = &g;
+                break;
+            }
+        }
+        if (group == nullptr) {
+            groups.push_back(StampGroup{ radius, building.effectiveness, {}, {} });
+            group = &groups.back();
+        }
+        group->members.push_back(i);
+    }
 
-                // Step 4: Apply linear falloff
-                float strength = calculate_falloff(effectiveness, distance, radius);
+    // Steps 3-6: Max each group's stamps into the grid
+    uint8_t* cells = grid.get_raw_data();
+    const uint64_t map_area = static_cast<uint64_t>(map_w) * static_cast<uint64_t>(map_h);
+    std::vector<int32_t> seeds;
+    std::vector<uint8_t> dist;
+    for (StampGroup& group : groups) {
+        group.stamp = build_coverage_stamp(group.radius, group.effectiveness);
 
-                // Step 5: Convert to uint8_t (0-255)
-                uint8_t coverage_value = static_cast<uint8_t>(
-                    std::min(255.0f, strength * 255.0f + 0.5f)  // Round to nearest
-                );
+        // Buildings off the map still reach into it; those always use stamps
+        seeds.clear();
+        for (uint32_t index : group.members) {
+            const ServiceBuildingData& building = buildings[index];
+            if (building.x >= 0 && building.x < map_w && building.y >= 0 && building.y < map_h) {
+                seeds.push_back(building.y * map_w + building.x);
+            }
+        }
 
-                // Step 6: Max-value overlap
-                uint32_t ux = static_cast<uint32_t>(tx);
-                uint32_t uy = static_cast<uint32_t>(ty);
-                uint8_t existing = grid.get_coverage_at(ux, uy);
-                if (coverage_value > existing) {
-                    grid.set_coverage_at(ux, uy, coverage_value);
+        bool use_transform = method == CoverageMethod::DistanceTransform;
+        if (method == CoverageMethod::Auto) {
+            const uint64_t stamp_area = group.stamp.mask.size();
+            use_transform = seeds.size() * stamp_area
+                > DISTANCE_TRANSFORM_COVER_FACTOR * map_area;
+        }
+        if (use_transform && !seeds.empty()) {
+            apply_distance_transform(cells, map_w, map_h, group, seeds, dist);
+        }
+
+        for (uint32_t index : group.members) {
+            const ServiceBuildingData& building = buildings[index];
+            const bool on_map = building.x >= 0 && building.x < map_w
+                && building.y >= 0 && building.y < map_h;
+            if (use_transform && on_map) {
+                continue;
+            }
+            blit_stamp(cells, map_w, map_h, group.stamp, building.x, building.y);
+        }
+    }
+}
+
+void add_building_coverage(ServiceCoverageGrid& grid, const ServiceBuildingData& building) {
+    const int radius = coverage_radius(building);
+    if (radius <= 0) {
+        return;
+    }
+    const int32_t map_w = static_cast<int32_t>(grid.get_width());
+    const int32_t map_h = static_cast<int32_t>(grid.get_height());
+    const CoverageStamp stamp = build_coverage_stamp(radius, building.effectiveness);
+    blit_stamp(grid.get_raw_data(), map_w, map_h, stamp, building.x, building.y);
+}
+
+void remove_building_coverage(ServiceCoverageGrid& grid,
+                              const ServiceBuildingData& removed,
+                              const std::vector<ServiceBuildingData>& providers) {
+    const int32_t r = coverage_radius(removed);
+    if (r <= 0) {
+        return;
+    }
+    const int32_t map_w = static_cast<int32_t>(grid.get_width());
+    const int32_t map_h = static_cast<int32_t>(grid.get_height());
+
+    // Tiles the removed building can have a non-zero value on
+    const int32_t x0 = std::max(removed.x - r + 1, 0);
+    const int32_t x1 = std::min(removed.x + r - 1, map_w - 1);
+    const int32_t y0 = std::max(removed.y - r + 1, 0);
+    const int32_t y1 = std::min(removed.y + r - 1, map_h - 1);
+    if (x0 > x1 || y0 > y1) {
+        return;
+    }
+    const int32_t box_w = x1 - x0 + 1;
+    const int32_t box_h = y1 - y0 + 1;
+
+    // Zero the tiles it was the max for and remember them
+    std::vector<StampGroup> cache;
+    const CoverageStamp& stamp = find_or_build_stamp(cache, r, removed.effectiveness);
+    const int32_t size = 2 * r + 1;
+    uint8_t* cells = grid.get_raw_data();
+    std::vector<uint8_t> affected(static_cast<size_t>(box_w) * box_h, 0);
+    bool any = false;
+    for (int32_t ty = y0; ty <= y1; ++ty) {
+        const uint8_t* src = stamp.mask.data() + static_cast<size_t>(ty - removed.y + r) * size;
+        uint8_t* row = cells + static_cast<size_t>(ty) * map_w;
+        for (int32_t tx = x0; tx <= x1; ++tx) {
+            const uint8_t v = src[tx - removed.x + r];
+            if (v != 0 && v == row[tx]) {
+                row[tx] = 0;
+                affected[static_cast<size_t>(ty - y0) * box_w + (tx - x0)] = 1;
+                any = true;
+            }
+        }
+    }
+    if (!any) {
+        return;
+    }
+
+    // Rebuild those tiles from every provider that reaches the box
+    for (const ServiceBuildingData& other : providers) {
+        const int32_t r2 = coverage_radius(other);
+        if (r2 <= 0) {
+            continue;
+        }
+        const int32_t ox0 = std::max(other.x - r2 + 1, x0);
+        const int32_t ox1 = std::min(other.x + r2 - 1, x1);
+        const int32_t oy0 = std::max(other.y - r2 + 1, y0);
+        const int32_t oy1 = std::min(other.y + r2 - 1, y1);
+        if (ox0 > ox1 || oy0 > oy1) {
+            continue;
+        }
+        const CoverageStamp& other_stamp = find_or_build_stamp(cache, r2, other.effectiveness);
+        const int32_t other_size = 2 * r2 + 1;
+        for (int32_t ty = oy0; ty <= oy1; ++ty) {
+            const uint8_t* src = other_stamp.mask.data()
+                + static_cast<size_t>(ty - other.y + r2) * other_size;
+            const uint8_t* mask = affected.data() + static_cast<size_t>(ty - y0) * box_w;
+            uint8_t* row = cells + static_cast<size_t>(ty) * map_w;
+            for (int32_t tx = ox0; tx <= ox1; ++tx) {
+                const uint8_t v = src[tx - other.x + r2];
+                if (mask[tx - x0] != 0 && v > row[tx]) {
+                    row[tx] = v;
                 }
             }
         }
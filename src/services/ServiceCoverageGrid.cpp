@@ -55,6 +55,14 @@ bool ServiceCoverageGrid::is_valid(uint32_t x, uint32_t y) const {
     return x < m_width && y < m_height;
 }
 
+const uint8_t* ServiceCoverageGrid::get_raw_data() const {
+    return m_data.data();
+}
+
+uint8_t* ServiceCoverageGrid::get_raw_data() {
+    return m_data.data();
+}
+
 uint32_t ServiceCoverageGrid::index(uint32_t x, uint32_t y) const {
     return y * m_width + x;
 }
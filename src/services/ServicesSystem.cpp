@@ -16,6 +16,8 @@
 #include <sims3000/services/ServicesSystem.h>
 #include <sims3000/services/ServiceCoverageGrid.h>
 #include <sims3000/services/CoverageCalculation.h>
+#include <sims3000/services/ServiceEvents.h>
+#include <sims3000/sim/TaskScheduler.h>
 
 namespace sims3000 {
 namespace services {
@@ -83,13 +85,13 @@ bool ServicesSystem::is_dirty(ServiceType type, uint8_t player_id) const {
     if (type_idx >= SERVICE_TYPE_COUNT) {
         return false;
     }
-    return m_dirty[type_idx][player_id];
+    return m_dirty[type_idx][player_id] || !m_pending[type_idx][player_id].empty();
 }
 
 bool ServicesSystem::isCoverageDirty() const {
     for (uint8_t t = 0; t < SERVICE_TYPE_COUNT; ++t) {
         for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
-            if (m_dirty[t][p]) {
+            if (m_dirty[t][p] || !m_pending[t][p].empty()) {
                 return true;
             }
         }
@@ -109,9 +111,15 @@ ServiceCoverageGrid* ServicesSystem::get_coverage_grid(ServiceType type, uint8_t
 }
 
 void ServicesSystem::recalculate_if_dirty() {
+    // Collect grids to update (index = type * MAX_PLAYERS + player)
+    std::vector<uint32_t> work;
     for (uint8_t t = 0; t < SERVICE_TYPE_COUNT; ++t) {
         for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
-            if (!m_dirty[t][p]) {
+            // Re-stamping more than every provider once costs more than a rebuild
+            if (m_pending[t][p].size() > 2 * m_providers[t][p].size()) {
+                m_dirty[t][p] = true;
+            }
+            if (!m_dirty[t][p] && m_pending[t][p].empty()) {
                 continue;
             }
 
@@ -119,24 +127,168 @@ void ServicesSystem::recalculate_if_dirty() {
             if (!m_coverage_grids[t][p]) {
                 m_coverage_grids[t][p] = std::make_unique<ServiceCoverageGrid>(
                     m_map_width, m_map_height);
+                m_dirty[t][p] = true;
             }
+            if (m_dirty[t][p]) {
+                m_pending[t][p].clear();
+                ++m_full_rebuild_count;
+            }
+            work.push_back(static_cast<uint32_t>(t) * MAX_PLAYERS + p);
+        }
+    }
+    if (work.empty()) {
+        return;
+    }
 
-            // Collect building data for this type+player
-            // Note: In the current architecture, entity data comes from outside.
-            // For now, the building data vector is empty since we don't have
-            // ECS access here. The calculate_radius_coverage function will
-            // still clear the grid, which is correct behavior.
-            // Future tickets will wire up ECS component queries to populate
-            // the building data vector before calling calculate_radius_coverage.
-            std::vector<ServiceBuildingData> buildings;
-            // TODO: Populate buildings from ECS component queries for type t, player p
+    // Each grid is written by exactly one task
+    auto recalculate = [this, &work](size_t i) {
+        const uint32_t t = work[i] / MAX_PLAYERS;
+        const uint32_t p = work[i] % MAX_PLAYERS;
+        ServiceCoverageGrid& grid = *m_coverage_grids[t][p];
+        if (m_dirty[t][p]) {
+            calculate_radius_coverage(grid, m_providers[t][p]);
+            return;
+        }
+        for (const ProviderUpdate& update : m_pending[t][p]) {
+            if (update.add) {
+                add_building_coverage(grid, update.data);
+            } else {
+                remove_building_coverage(grid, update.data, m_providers[t][p]);
+            }
+        }
+    };
+    if (m_scheduler != nullptr && work.size() > 1) {
+        m_scheduler->parallel_for(work.size(), recalculate);
+    } else {
+        for (size_t i = 0; i < work.size(); ++i) {
+            recalculate(i);
+        }
+    }
 
-            calculate_radius_coverage(*m_coverage_grids[t][p], buildings);
+    // Mark clean after recalculation
+    for (uint32_t index : work) {
+        m_dirty[index / MAX_PLAYERS][index % MAX_PLAYERS] = false;
+        m_pending[index / MAX_PLAYERS][index % MAX_PLAYERS].clear();
+    }
+}
 
-            // Mark clean after recalculation
-            m_dirty[t][p] = false;
+void ServicesSystem::set_task_scheduler(sim::TaskScheduler* scheduler) {
+    m_scheduler = scheduler;
+}
+
+// =============================================================================
+// Provider Registry
+// =============================================================================
+
+void ServicesSystem::on_service_building_placed(const ServiceBuildingPlacedEvent& event) {
+    if (event.owner_id >= MAX_PLAYERS) {
+        return;
+    }
+    const uint8_t type_idx = static_cast<uint8_t>(event.service_type);
+    if (type_idx >= SERVICE_TYPE_COUNT) {
+        return;
+    }
+    if (m_provider_slots.count(event.entity_id) != 0) {
+        return;
+    }
+
+    ServiceBuildingData data;
+    data.x = event.grid_x;
+    data.y = event.grid_y;
+    data.type = event.service_type;
+    data.tier = static_cast<uint8_t>(event.tier);
+    data.effectiveness = 255;
+    data.is_active = true;
+    data.owner_id = event.owner_id;
+    if (isValidServiceTier(data.tier)) {
+        data.capacity = get_service_config(event.service_type, event.tier).capacity;
+    }
+
+    auto& providers = m_providers[type_idx][event.owner_id];
+    m_provider_slots[event.entity_id] = ProviderSlot{
+        type_idx, event.owner_id, static_cast<uint32_t>(providers.size()) };
+    providers.push_back(data);
+    m_provider_ids[type_idx][event.owner_id].push_back(event.entity_id);
+
+    queue_update(type_idx, event.owner_id, data, true);
+}
+
+void ServicesSystem::on_service_building_removed(const ServiceBuildingRemovedEvent& event) {
+    remove_provider(event.entity_id);
+}
+
+bool ServicesSystem::remove_provider(uint32_t entity_id) {
+    auto it = m_provider_slots.find(entity_id);
+    if (it == m_provider_slots.end()) {
+        return false;
+    }
+    const ProviderSlot slot = it->second;
+    m_provider_slots.erase(it);
+
+    // Swap with last element and pop (order doesn't matter)
+    auto& providers = m_providers[slot.type][slot.owner];
+    auto& ids = m_provider_ids[slot.type][slot.owner];
+    const ServiceBuildingData removed = providers[slot.index];
+    if (slot.index + 1 != providers.size()) {
+        providers[slot.index] = providers.back();
+        ids[slot.index] = ids.back();
+        m_provider_slots[ids[slot.index]].index = slot.index;
+    }
+    providers.pop_back();
+    ids.pop_back();
+
+    queue_update(slot.type, slot.owner, removed, false);
+    return true;
+}
+
+bool ServicesSystem::set_provider_state(uint32_t entity_id, uint8_t effectiveness, bool is_active) {
+    auto it = m_provider_slots.find(entity_id);
+    if (it == m_provider_slots.end()) {
+        return false;
+    }
+    const ProviderSlot slot = it->second;
+    ServiceBuildingData& data = m_providers[slot.type][slot.owner][slot.index];
+    if (data.effectiveness == effectiveness && data.is_active == is_active) {
+        return true;
+    }
+
+    const ServiceBuildingData before = data;
+    data.effectiveness = effectiveness;
+    data.is_active = is_active;
+    queue_update(slot.type, slot.owner, before, false);
+    queue_update(slot.type, slot.owner, data, true);
+    return true;
+}
+
+const std::vector<ServiceBuildingData>& ServicesSystem::get_providers(ServiceType type,
+                                                                       uint8_t player_id) const {
+    static const std::vector<ServiceBuildingData> empty;
+    const uint8_t type_idx = static_cast<uint8_t>(type);
+    if (player_id >= MAX_PLAYERS || type_idx >= SERVICE_TYPE_COUNT) {
+        return empty;
+    }
+    return m_providers[type_idx][player_id];
+}
+
+void ServicesSystem::queue_update(uint8_t type, uint8_t player_id,
+                                  const ServiceBuildingData& data, bool add) {
+    // Without a grid (or with a rebuild already due) the next tick rebuilds anyway
+    if (!m_coverage_grids[type][player_id] || m_dirty[type][player_id]) {
+        m_dirty[type][player_id] = true;
+        return;
+    }
+    m_pending[type][player_id].push_back(ProviderUpdate{ data, add });
+}
+
+void ServicesSystem::clear_providers() {
+    for (uint8_t t = 0; t < SERVICE_TYPE_COUNT; ++t) {
+        for (uint8_t p = 0; p < MAX_PLAYERS; ++p) {
+            m_providers[t][p].clear();
+            m_provider_ids[t][p].clear();
+            m_pending[t][p].clear();
         }
     }
+    m_provider_slots.clear();
 }
 
 // =============================================================================
@@ -151,9 +303,14 @@ void ServicesSystem::on_building_constructed(uint32_t entity_id, uint8_t owner_i
     // Add to per-player tracking vector
     m_service_entities[owner_id].push_back(entity_id);
 
+    // A registered provider's stamp was queued when it was placed
+    auto it = m_provider_slots.find(entity_id);
+    if (it != m_provider_slots.end() && it->second.owner == owner_id) {
+        return;
+    }
+
     // Mark all service types dirty for this player (E9-011)
-    // We mark all types because we don't know the service type from entity_id alone.
-    // Future tickets will pass ServiceType to narrow the dirty marking.
+    // The service type is unknown from entity_id alone.
     mark_all_dirty(owner_id);
 }
 
@@ -173,17 +330,32 @@ void ServicesSystem::on_building_deconstructed(uint32_t entity_id, uint8_t owner
         }
     }
 
+    // A registered provider only touches its own type+player grid
+    auto it = m_provider_slots.find(entity_id);
+    if (it != m_provider_slots.end() && it->second.owner == owner_id) {
+        remove_provider(entity_id);
+        return;
+    }
+
     // Mark all service types dirty for this player (E9-011)
     mark_all_dirty(owner_id);
 }
 
 void ServicesSystem::on_building_power_changed(uint32_t entity_id, uint8_t owner_id) {
-    (void)entity_id;
-
     if (owner_id >= MAX_PLAYERS) {
         return;
     }
 
+    // Re-stamp a registered provider in its own type+player grid
+    auto it = m_provider_slots.find(entity_id);
+    if (it != m_provider_slots.end() && it->second.owner == owner_id) {
+        const ProviderSlot slot = it->second;
+        const ServiceBuildingData& data = m_providers[slot.type][slot.owner][slot.index];
+        queue_update(slot.type, slot.owner, data, false);
+        queue_update(slot.type, slot.owner, data, true);
+        return;
+    }
+
     // Mark all service types dirty for this player (E9-011)
     mark_all_dirty(owner_id);
 }
@@ -204,19 +376,22 @@ void ServicesSystem::init(uint32_t map_width, uint32_t map_height) {
         }
     }
 
-    // Clear any existing entity tracking
+    // Clear any existing entity tracking and provider registrations
     for (auto& entities : m_service_entities) {
         entities.clear();
     }
+    clear_providers();
+    m_full_rebuild_count = 0;
 
     m_initialized = true;
 }
 
 void ServicesSystem::cleanup() {
-    // Clear per-player entity tracking
+    // Clear per-player entity tracking and provider registrations
     for (auto& entities : m_service_entities) {
         entities.clear();
     }
+    clear_providers();
 
     // Release coverage grids and clear dirty flags
     for (uint8_t t = 0; t < SERVICE_TYPE_COUNT; ++t) {
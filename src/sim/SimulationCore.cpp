@@ -19,7 +19,9 @@ void SimulationCore::unregister_system(ISimulatable* system) {
     auto it = std::find(m_systems.begin(), m_systems.end(), system);
     if (it != m_systems.end()) {
         m_systems.erase(it);
-        // No need to re-sort on removal; relative order preserved
+        // No need to re-sort on removal; relative order preserved,
+        // but the stage grouping must drop the system.
+        m_sorted = false;
     }
 }
 
@@ -28,12 +30,9 @@ void SimulationCore::update(float delta_time) {
     const float multiplier = get_speed_multiplier();
     m_accumulator += delta_time * multiplier;
 
-    // Sort systems by priority if needed (lower = earlier)
+    // Sort systems by priority and rebuild stages if needed (lower = earlier)
     if (!m_sorted) {
-        std::stable_sort(m_systems.begin(), m_systems.end(),
-            [](const ISimulatable* a, const ISimulatable* b) {
-                return a->getPriority() < b->getPriority();
-            });
+        rebuild_schedule();
         m_sorted = true;
     }
 
@@ -45,9 +44,7 @@ void SimulationCore::update(float delta_time) {
         // Record tick start event (E10-005)
         m_last_tick_start = TickStartEvent{m_tick, SIMULATION_TICK_DELTA};
 
-        for (auto* system : m_systems) {
-            system->tick(*this);
-        }
+        run_systems();
 
         // Record tick complete event (E10-005)
         m_last_tick_complete = TickCompleteEvent{m_tick, SIMULATION_TICK_DELTA};
@@ -61,6 +58,78 @@ size_t SimulationCore::system_count() const {
     return m_systems.size();
 }
 
+// =========================================================================
+// Parallel scheduling
+// =========================================================================
+
+void SimulationCore::set_worker_count(uint32_t count) {
+    if (count == get_worker_count()) {
+        return;
+    }
+    m_scheduler.reset();
+    if (count > 0) {
+        m_scheduler = std::make_unique<TaskScheduler>(count);
+    }
+}
+
+uint32_t SimulationCore::get_worker_count() const {
+    return m_scheduler ? m_scheduler->worker_count() : 0;
+}
+
+size_t SimulationCore::get_stage_count() const {
+    return m_stages.size();
+}
+
+void SimulationCore::rebuild_schedule() {
+    std::stable_sort(m_systems.begin(), m_systems.end(),
+        [](const ISimulatable* a, const ISimulatable* b) {
+            return a->getPriority() < b->getPriority();
+        });
+
+    // A system lands one stage after the latest earlier system it conflicts
+    // with. Non-conflicting systems commute, so any interleaving of a stage
+    // produces the same result as the serial priority order.
+    std::vector<SystemAccess> access;
+    std::vector<size_t> stage_of;
+    access.reserve(m_systems.size());
+    stage_of.reserve(m_systems.size());
+
+    m_stages.clear();
+    for (size_t i = 0; i < m_systems.size(); ++i) {
+        access.push_back(m_systems[i]->getAccess());
+        size_t stage = 0;
+        for (size_t j = 0; j < i; ++j) {
+            if (access[i].conflicts_with(access[j])) {
+                stage = std::max(stage, stage_of[j] + 1);
+            }
+        }
+        stage_of.push_back(stage);
+        if (stage >= m_stages.size()) {
+            m_stages.resize(stage + 1);
+        }
+        m_stages[stage].push_back(m_systems[i]);
+    }
+}
+
+void SimulationCore::run_systems() {
+    if (!m_scheduler) {
+        for (auto* system : m_systems) {
+            system->tick(*this);
+        }
+        return;
+    }
+
+    for (const auto& stage : m_stages) {
+        if (stage.size() == 1) {
+            stage.front()->tick(*this);
+            continue;
+        }
+        m_scheduler->parallel_for(stage.size(), [this, &stage](size_t i) {
+            stage[i]->tick(*this);
+        });
+    }
+}
+
 SimulationTick SimulationCore::getCurrentTick() const {
     return m_tick;
 }
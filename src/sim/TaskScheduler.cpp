@@ -0,0 +1,160 @@
+/**
+ * @file TaskScheduler.cpp
+ * @brief Implementation of the work-stealing TaskScheduler.
+ *
+ * @see TaskScheduler.h for class documentation.
+ */
+
+#include "sims3000/sim/TaskScheduler.h"
+
+namespace sims3000 {
+namespace sim {
+
+TaskScheduler::TaskScheduler(uint32_t worker_count) {
+    // Queue 0 belongs to the calling thread; queues 1..N to workers.
+    m_queues.reserve(static_cast<size_t>(worker_count) + 1);
+    for (uint32_t i = 0; i <= worker_count; ++i) {
+        m_queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    m_threads.reserve(worker_count);
+    for (uint32_t i = 0; i < worker_count; ++i) {
+        m_threads.emplace_back(&TaskScheduler::worker_loop, this, i + 1);
+    }
+}
+
+TaskScheduler::~TaskScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(m_wake_mutex);
+        m_stopping = true;
+    }
+    m_wake_cv.notify_all();
+    for (auto& thread : m_threads) {
+        thread.join();
+    }
+}
+
+void TaskScheduler::parallel_for(size_t count, const std::function<void(size_t)>& fn) {
+    if (count == 0) {
+        return;
+    }
+
+    // Nothing to gain from the pool: run inline in index order.
+    if (m_threads.empty() || count == 1) {
+        for (size_t i = 0; i < count; ++i) {
+            fn(i);
+        }
+        return;
+    }
+
+    m_batch_fn = &fn;
+    m_first_error = nullptr;
+    m_remaining.store(count, std::memory_order_release);
+
+    // Deal tasks round-robin so every thread starts with local work.
+    const size_t queue_count = m_queues.size();
+    for (size_t i = 0; i < count; ++i) {
+        WorkerQueue& queue = *m_queues[i % queue_count];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(Task{i});
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_wake_mutex);
+        ++m_batch_generation;
+    }
+    m_wake_cv.notify_all();
+
+    // The caller works too, then waits for stragglers.
+    Task task;
+    while (try_pop_own(0, task) || try_steal(0, task)) {
+        run_task(task);
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_wake_mutex);
+        m_done_cv.wait(lock, [this] {
+            return m_remaining.load(std::memory_order_acquire) == 0;
+        });
+    }
+
+    if (m_first_error) {
+        std::exception_ptr error = m_first_error;
+        m_first_error = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+uint32_t TaskScheduler::worker_count() const {
+    return static_cast<uint32_t>(m_threads.size());
+}
+
+uint64_t TaskScheduler::steal_count() const {
+    return m_steals.load(std::memory_order_relaxed);
+}
+
+void TaskScheduler::worker_loop(uint32_t queue_index) {
+    uint64_t seen_generation = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(m_wake_mutex);
+            m_wake_cv.wait(lock, [this, seen_generation] {
+                return m_stopping || m_batch_generation != seen_generation;
+            });
+            if (m_stopping) {
+                return;
+            }
+            seen_generation = m_batch_generation;
+        }
+
+        Task task;
+        while (try_pop_own(queue_index, task) || try_steal(queue_index, task)) {
+            run_task(task);
+        }
+    }
+}
+
+bool TaskScheduler::try_pop_own(uint32_t queue_index, Task& out) {
+    WorkerQueue& queue = *m_queues[queue_index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+        return false;
+    }
+    out = queue.tasks.back();
+    queue.tasks.pop_back();
+    return true;
+}
+
+bool TaskScheduler::try_steal(uint32_t thief_index, Task& out) {
+    const size_t queue_count = m_queues.size();
+    for (size_t offset = 1; offset < queue_count; ++offset) {
+        WorkerQueue& victim = *m_queues[(thief_index + offset) % queue_count];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            out = victim.tasks.front();
+            victim.tasks.pop_front();
+            m_steals.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void TaskScheduler::run_task(const Task& task) {
+    try {
+        (*m_batch_fn)(task.index);
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(m_error_mutex);
+        if (!m_first_error) {
+            m_first_error = std::current_exception();
+        }
+    }
+
+    if (m_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::lock_guard<std::mutex> lock(m_wake_mutex);
+        m_done_cv.notify_all();
+    }
+}
+
+} // namespace sim
+} // namespace sims3000
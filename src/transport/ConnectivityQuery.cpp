@@ -18,8 +18,8 @@ bool ConnectivityQuery::is_connected(const PathwayGrid& grid, const NetworkGraph
     }
 
     // Look up network_ids via NetworkGraph
-    uint16_t id1 = graph.get_network_id(GridPosition{x1, y1});
-    uint16_t id2 = graph.get_network_id(GridPosition{x2, y2});
+    NetworkId id1 = graph.get_network_id(GridPosition{x1, y1});
+    NetworkId id2 = graph.get_network_id(GridPosition{x2, y2});
 
     // Both must have non-zero network_id and they must match
     return id1 != 0 && id1 == id2;
@@ -31,12 +31,12 @@ bool ConnectivityQuery::is_on_network(const PathwayGrid& grid, const NetworkGrap
         return false;
     }
 
-    uint16_t id = graph.get_network_id(GridPosition{x, y});
+    NetworkId id = graph.get_network_id(GridPosition{x, y});
     return id != 0;
 }
 
-uint16_t ConnectivityQuery::get_network_id_at(const PathwayGrid& grid, const NetworkGraph& graph,
-                                               int32_t x, int32_t y) const {
+NetworkId ConnectivityQuery::get_network_id_at(const PathwayGrid& grid, const NetworkGraph& graph,
+                                                int32_t x, int32_t y) const {
     if (!grid.has_pathway(x, y)) {
         return 0;
     }
@@ -5,11 +5,35 @@
  * Single-pass diffusion: for each pathway tile with flow, a fraction
  * (spread_rate) spreads equally to connected pathway neighbors.
  *
+ * The FlowPlane form runs in two passes:
+ * 1. Over the compact pathway slot list: per-neighbour share and total
+ *    spent flow for each tile, written to padded scratch planes.
+ * 2. Over each row's pathway span: out = in - spent + the four neighbour
+ *    shares, masked to pathway tiles. Rows are processed 8 (AVX2) or 4
+ *    (SSE2) tiles at a time, with a scalar tail and a scalar fallback on
+ *    other targets.
+ *
+ * In the map form a source never loses more than it started with
+ * (spread_rate <= 1), so its final flow is start - spent + received in
+ * any order, which is exactly what the gather computes.
+ *
  * @see FlowPropagation.h for class documentation.
  */
 
 #include <sims3000/transport/FlowPropagation.h>
 #include <sims3000/transport/PathwayGrid.h>
+#include <algorithm>
+#include <cstddef>
+
+// SIMS3000_NO_SIMD forces the scalar path (for testing and odd targets)
+#if defined(SIMS3000_NO_SIMD)
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#define SIMS3000_FLOW_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SIMS3000_FLOW_SSE2 1
+#endif
 
 namespace sims3000 {
 namespace transport {
@@ -114,6 +138,296 @@ void FlowPropagation::propagate(
     }
 }
 
+// =============================================================================
+// FlowPlane
+// =============================================================================
+
+FlowPlane::FlowPlane(uint32_t width, uint32_t height)
+    : width_(width)
+    , height_(height)
+    , padded_width_(width + 2)
+{
+    const std::size_t padded = static_cast<std::size_t>(width + 2) * (height + 2);
+    const std::size_t tiles = static_cast<std::size_t>(width) * height;
+    flow_[0].assign(padded, 0);
+    flow_[1].assign(padded, 0);
+    road_.assign(padded, 0);
+    share_.assign(padded, 0);
+    spent_.assign(padded, 0);
+    neighbor_mask_.assign(tiles, 0);
+    slot_of_.assign(tiles, NO_SLOT);
+    row_count_.assign(height, 0);
+    row_min_x_.assign(height, 0);
+    row_max_x_.assign(height, -1);
+}
+
+bool FlowPlane::in_bounds(int32_t x, int32_t y) const {
+    return x >= 0 && y >= 0 &&
+           static_cast<uint32_t>(x) < width_ && static_cast<uint32_t>(y) < height_;
+}
+
+std::size_t FlowPlane::padded_index(int32_t x, int32_t y) const {
+    return (static_cast<std::size_t>(y) + 1) * padded_width_ + static_cast<std::size_t>(x) + 1;
+}
+
+void FlowPlane::add_tile(int32_t x, int32_t y) {
+    if (!in_bounds(x, y) || has_tile(x, y)) {
+        return;
+    }
+
+    const uint32_t tile = static_cast<uint32_t>(y) * width_ + static_cast<uint32_t>(x);
+    const std::size_t padded = padded_index(x, y);
+    slot_of_[tile] = static_cast<uint32_t>(slot_tiles_.size());
+    slot_tiles_.push_back(tile);
+    slot_padded_.push_back(static_cast<uint32_t>(padded));
+    road_[padded] = UINT32_MAX;
+
+    // Neighbours see this tile; in-bounds masks already describe ours
+    if (y > 0)                                   neighbor_mask_[tile - width_] |= FLOW_NEIGHBOR_S;
+    if (static_cast<uint32_t>(y) + 1 < height_)  neighbor_mask_[tile + width_] |= FLOW_NEIGHBOR_N;
+    if (x > 0)                                   neighbor_mask_[tile - 1] |= FLOW_NEIGHBOR_E;
+    if (static_cast<uint32_t>(x) + 1 < width_)   neighbor_mask_[tile + 1] |= FLOW_NEIGHBOR_W;
+
+    if (row_count_[y]++ == 0) {
+        row_min_x_[y] = x;
+        row_max_x_[y] = x;
+    } else {
+        row_min_x_[y] = std::min(row_min_x_[y], x);
+        row_max_x_[y] = std::max(row_max_x_[y], x);
+    }
+}
+
+void FlowPlane::remove_tile(int32_t x, int32_t y) {
+    if (!has_tile(x, y)) {
+        return;
+    }
+
+    const uint32_t tile = static_cast<uint32_t>(y) * width_ + static_cast<uint32_t>(x);
+    const std::size_t padded = padded_index(x, y);
+    const uint32_t slot = slot_of_[tile];
+
+    // Swap-and-pop the slot list
+    const uint32_t last = static_cast<uint32_t>(slot_tiles_.size() - 1);
+    slot_tiles_[slot] = slot_tiles_[last];
+    slot_padded_[slot] = slot_padded_[last];
+    slot_of_[slot_tiles_[slot]] = slot;
+    slot_tiles_.pop_back();
+    slot_padded_.pop_back();
+    slot_of_[tile] = NO_SLOT;
+
+    flow_[0][padded] = 0;
+    flow_[1][padded] = 0;
+    road_[padded] = 0;
+    share_[padded] = 0;
+    spent_[padded] = 0;
+
+    if (y > 0)                                   neighbor_mask_[tile - width_] &= static_cast<uint8_t>(~FLOW_NEIGHBOR_S);
+    if (static_cast<uint32_t>(y) + 1 < height_)  neighbor_mask_[tile + width_] &= static_cast<uint8_t>(~FLOW_NEIGHBOR_N);
+    if (x > 0)                                   neighbor_mask_[tile - 1] &= static_cast<uint8_t>(~FLOW_NEIGHBOR_E);
+    if (static_cast<uint32_t>(x) + 1 < width_)   neighbor_mask_[tile + 1] &= static_cast<uint8_t>(~FLOW_NEIGHBOR_W);
+
+    // Spans only shrink when a row empties; a wider span is just slower
+    if (--row_count_[y] == 0) {
+        row_min_x_[y] = 0;
+        row_max_x_[y] = -1;
+    }
+}
+
+bool FlowPlane::has_tile(int32_t x, int32_t y) const {
+    return get_slot(x, y) != NO_SLOT;
+}
+
+uint32_t FlowPlane::get_slot(int32_t x, int32_t y) const {
+    if (!in_bounds(x, y)) {
+        return NO_SLOT;
+    }
+    return slot_of_[static_cast<uint32_t>(y) * width_ + static_cast<uint32_t>(x)];
+}
+
+uint32_t FlowPlane::tile_count() const {
+    return static_cast<uint32_t>(slot_tiles_.size());
+}
+
+uint32_t FlowPlane::get_slot_tile(uint32_t slot) const {
+    return slot_tiles_[slot];
+}
+
+uint8_t FlowPlane::get_neighbor_mask(int32_t x, int32_t y) const {
+    if (!in_bounds(x, y)) {
+        return 0;
+    }
+    return neighbor_mask_[static_cast<uint32_t>(y) * width_ + static_cast<uint32_t>(x)];
+}
+
+uint32_t FlowPlane::get_flow(int32_t x, int32_t y) const {
+    if (!in_bounds(x, y)) {
+        return 0;
+    }
+    return flow_[front_][padded_index(x, y)];
+}
+
+void FlowPlane::set_flow(int32_t x, int32_t y, uint32_t flow) {
+    if (!has_tile(x, y)) {
+        return;
+    }
+    flow_[front_][padded_index(x, y)] = flow;
+}
+
+uint32_t FlowPlane::get_slot_flow(uint32_t slot) const {
+    return flow_[front_][slot_padded_[slot]];
+}
+
+void FlowPlane::set_slot_flow(uint32_t slot, uint32_t flow) {
+    flow_[front_][slot_padded_[slot]] = flow;
+}
+
+void FlowPlane::clear_flow() {
+    uint32_t* flow = flow_[front_].data();
+    for (uint32_t padded : slot_padded_) {
+        flow[padded] = 0;
+    }
+}
+
+// =============================================================================
+// Dense propagation
+// =============================================================================
+
+namespace {
+
+/// Pathway neighbour count for each 4-bit neighbour mask
+constexpr uint8_t NEIGHBOR_COUNT[16] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+
+/**
+ * @brief Pointers for one row span; all address the same padded column.
+ */
+struct DiffuseRow {
+    const uint32_t* in;
+    const uint32_t* spent;
+    const uint32_t* road;
+    const uint32_t* share_up;
+    const uint32_t* share_mid;
+    const uint32_t* share_down;
+    uint32_t* out;
+};
+
+/**
+ * @brief Scalar diffusion for columns [x_begin, x_end) of a span.
+ */
+void diffuse_row_scalar(const DiffuseRow& r, int32_t x_begin, int32_t x_end) {
+    for (int32_t x = x_begin; x < x_end; ++x) {
+        const uint32_t received = r.share_up[x] + r.share_down[x] +
+                                  r.share_mid[x - 1] + r.share_mid[x + 1];
+        r.out[x] = r.in[x] - r.spent[x] + (received & r.road[x]);
+    }
+}
+
+#if defined(SIMS3000_FLOW_AVX2)
+
+constexpr int32_t FLOW_LANES = 8;
+
+inline __m256i load(const uint32_t* p) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+/// Vector diffusion over whole vectors of a span; returns the first column left for the scalar tail.
+int32_t diffuse_row_simd(const DiffuseRow& r, int32_t length) {
+    int32_t x = 0;
+    for (; x + FLOW_LANES <= length; x += FLOW_LANES) {
+        __m256i received = _mm256_add_epi32(load(r.share_up + x), load(r.share_down + x));
+        received = _mm256_add_epi32(received, load(r.share_mid + x - 1));
+        received = _mm256_add_epi32(received, load(r.share_mid + x + 1));
+        received = _mm256_and_si256(received, load(r.road + x));
+        const __m256i kept = _mm256_sub_epi32(load(r.in + x), load(r.spent + x));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(r.out + x), _mm256_add_epi32(kept, received));
+    }
+    return x;
+}
+
+#elif defined(SIMS3000_FLOW_SSE2)
+
+constexpr int32_t FLOW_LANES = 4;
+
+inline __m128i load(const uint32_t* p) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+/// Vector diffusion over whole vectors of a span; returns the first column left for the scalar tail.
+int32_t diffuse_row_simd(const DiffuseRow& r, int32_t length) {
+    int32_t x = 0;
+    for (; x + FLOW_LANES <= length; x += FLOW_LANES) {
+        __m128i received = _mm_add_epi32(load(r.share_up + x), load(r.share_down + x));
+        received = _mm_add_epi32(received, load(r.share_mid + x - 1));
+        received = _mm_add_epi32(received, load(r.share_mid + x + 1));
+        received = _mm_and_si128(received, load(r.road + x));
+        const __m128i kept = _mm_sub_epi32(load(r.in + x), load(r.spent + x));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(r.out + x), _mm_add_epi32(kept, received));
+    }
+    return x;
+}
+
+#else
+
+int32_t diffuse_row_simd(const DiffuseRow& /*r*/, int32_t /*length*/) {
+    return 0;
+}
+
+#endif
+
+} // namespace
+
+void FlowPropagation::propagate(FlowPlane& plane, const FlowPropagationConfig& config) {
+    const uint32_t count = plane.tile_count();
+    if (count == 0) {
+        return;
+    }
+
+    const uint32_t* in = plane.flow_[plane.front_].data();
+    uint32_t* out = plane.flow_[plane.front_ ^ 1u].data();
+    uint32_t* share = plane.share_.data();
+    uint32_t* spent = plane.spent_.data();
+
+    // Pass 1: what each pathway tile sends to each neighbour
+    for (uint32_t slot = 0; slot < count; ++slot) {
+        const uint32_t padded = plane.slot_padded_[slot];
+        const uint32_t neighbors = NEIGHBOR_COUNT[plane.neighbor_mask_[plane.slot_tiles_[slot]]];
+        const uint32_t flow = in[padded];
+        uint32_t per_neighbor = 0;
+        if (neighbors != 0 && flow != 0) {
+            const uint32_t spread_total = static_cast<uint32_t>(
+                static_cast<float>(flow) * config.spread_rate
+            );
+            per_neighbor = spread_total / neighbors;
+        }
+        share[padded] = per_neighbor;
+        spent[padded] = std::min(per_neighbor * neighbors, flow);
+    }
+
+    // Pass 2: gather over each row's pathway span
+    const std::size_t padded_width = plane.padded_width_;
+    for (uint32_t y = 0; y < plane.height_; ++y) {
+        if (plane.row_count_[y] == 0) {
+            continue;
+        }
+        const int32_t x0 = plane.row_min_x_[y];
+        const int32_t length = plane.row_max_x_[y] - x0 + 1;
+        const std::size_t mid = (static_cast<std::size_t>(y) + 1) * padded_width + 1 + static_cast<std::size_t>(x0);
+
+        DiffuseRow row{
+            in + mid,
+            spent + mid,
+            plane.road_.data() + mid,
+            share + mid - padded_width,
+            share + mid,
+            share + mid + padded_width,
+            out + mid
+        };
+        const int32_t done = diffuse_row_simd(row, length);
+        diffuse_row_scalar(row, done, length);
+    }
+
+    plane.front_ ^= 1u;
+}
+
 // =============================================================================
 // Neighbor lookup
 // =============================================================================
@@ -0,0 +1,469 @@
+/**
+ * @file HierarchicalPathfinding.cpp
+ * @brief Chunked (HPA*) pathfinding implementation
+ *
+ * @see HierarchicalPathfinding.h for class documentation.
+ */
+
+#include <sims3000/transport/HierarchicalPathfinding.h>
+#include <sims3000/transport/PathwayGrid.h>
+#include <algorithm>
+#include <cstdlib>
+
+namespace sims3000 {
+namespace transport {
+
+/// Cost of one step between adjacent tiles (matches Pathfinding base cost)
+static constexpr uint32_t STEP_COST = 10;
+
+static constexpr uint32_t UNREACHED = UINT32_MAX;
+
+// Cardinal directions: N, S, E, W
+static const int32_t DIR_X[] = { 0, 0, 1, -1 };
+static const int32_t DIR_Y[] = { -1, 1, 0, 0 };
+
+static uint32_t manhattan_cost(const GridPosition& a, const GridPosition& b) {
+    return static_cast<uint32_t>(std::abs(a.x - b.x) + std::abs(a.y - b.y)) * STEP_COST;
+}
+
+// =============================================================================
+// Construction and dirty tracking
+// =============================================================================
+
+HierarchicalPathfinding::HierarchicalPathfinding(uint32_t width, uint32_t height) {
+    resize(width, height);
+}
+
+void HierarchicalPathfinding::resize(uint32_t width, uint32_t height) {
+    width_ = width;
+    height_ = height;
+    chunks_x_ = (width + PATH_CHUNK_SIZE - 1) >> PATH_CHUNK_SHIFT;
+    chunks_y_ = (height + PATH_CHUNK_SIZE - 1) >> PATH_CHUNK_SHIFT;
+
+    const size_t tiles = static_cast<size_t>(width) * height;
+    chunks_.assign(static_cast<size_t>(chunks_x_) * chunks_y_, Chunk{});
+    portal_slot_.assign(tiles, NO_PORTAL);
+    dirty_chunks_.clear();
+    for (uint32_t i = 0; i < chunks_.size(); ++i) {
+        dirty_chunks_.push_back(i);
+    }
+
+    // Two extra slots for the query's start and end nodes
+    nodes_.assign(chunks_.size() * MAX_CHUNK_PORTALS + 2, NodeState{});
+    generation_ = 0;
+}
+
+void HierarchicalPathfinding::mark_chunk_dirty(uint32_t cx, uint32_t cy) {
+    const uint32_t index = cy * chunks_x_ + cx;
+    if (!chunks_[index].dirty) {
+        chunks_[index].dirty = true;
+        dirty_chunks_.push_back(index);
+    }
+}
+
+void HierarchicalPathfinding::on_pathway_changed(int32_t x, int32_t y) {
+    if (x < 0 || y < 0 ||
+        static_cast<uint32_t>(x) >= width_ || static_cast<uint32_t>(y) >= height_) {
+        return;
+    }
+    const uint32_t ux = static_cast<uint32_t>(x);
+    const uint32_t uy = static_cast<uint32_t>(y);
+    const uint32_t cx = ux >> PATH_CHUNK_SHIFT;
+    const uint32_t cy = uy >> PATH_CHUNK_SHIFT;
+    const uint32_t lx = ux & (PATH_CHUNK_SIZE - 1);
+    const uint32_t ly = uy & (PATH_CHUNK_SIZE - 1);
+
+    mark_chunk_dirty(cx, cy);
+    if (lx == 0 && cx > 0) {
+        mark_chunk_dirty(cx - 1, cy);
+    }
+    if (lx == PATH_CHUNK_SIZE - 1 && cx + 1 < chunks_x_) {
+        mark_chunk_dirty(cx + 1, cy);
+    }
+    if (ly == 0 && cy > 0) {
+        mark_chunk_dirty(cx, cy - 1);
+    }
+    if (ly == PATH_CHUNK_SIZE - 1 && cy + 1 < chunks_y_) {
+        mark_chunk_dirty(cx, cy + 1);
+    }
+}
+
+void HierarchicalPathfinding::on_pathway_placed(const PathwayPlacedEvent& event) {
+    on_pathway_changed(static_cast<int32_t>(event.x), static_cast<int32_t>(event.y));
+}
+
+void HierarchicalPathfinding::on_pathway_removed(const PathwayRemovedEvent& event) {
+    on_pathway_changed(static_cast<int32_t>(event.x), static_cast<int32_t>(event.y));
+}
+
+void HierarchicalPathfinding::mark_all_dirty() {
+    for (uint32_t cy = 0; cy < chunks_y_; ++cy) {
+        for (uint32_t cx = 0; cx < chunks_x_; ++cx) {
+            mark_chunk_dirty(cx, cy);
+        }
+    }
+}
+
+uint32_t HierarchicalPathfinding::get_dirty_chunk_count() const {
+    return static_cast<uint32_t>(dirty_chunks_.size());
+}
+
+uint32_t HierarchicalPathfinding::get_portal_count() const {
+    uint32_t count = 0;
+    for (const Chunk& chunk : chunks_) {
+        if (!chunk.dirty) {
+            count += static_cast<uint32_t>(chunk.portals.size());
+        }
+    }
+    return count;
+}
+
+// =============================================================================
+// Chunk rebuild
+// =============================================================================
+
+uint32_t HierarchicalPathfinding::chunk_of(const GridPosition& pos) const {
+    return (static_cast<uint32_t>(pos.y) >> PATH_CHUNK_SHIFT) * chunks_x_ +
+           (static_cast<uint32_t>(pos.x) >> PATH_CHUNK_SHIFT);
+}
+
+uint32_t HierarchicalPathfinding::local_of(const GridPosition& pos) {
+    return (static_cast<uint32_t>(pos.y) & (PATH_CHUNK_SIZE - 1)) * PATH_CHUNK_SIZE +
+           (static_cast<uint32_t>(pos.x) & (PATH_CHUNK_SIZE - 1));
+}
+
+uint32_t HierarchicalPathfinding::tile_of(const GridPosition& pos) const {
+    return static_cast<uint32_t>(pos.y) * width_ + static_cast<uint32_t>(pos.x);
+}
+
+void HierarchicalPathfinding::rebuild_dirty_chunks(const PathwayGrid& grid) {
+    if (grid.width() != width_ || grid.height() != height_) {
+        resize(grid.width(), grid.height());
+    }
+    for (uint32_t index : dirty_chunks_) {
+        rebuild_chunk(grid, index % chunks_x_, index / chunks_x_);
+    }
+    dirty_chunks_.clear();
+}
+
+void HierarchicalPathfinding::collect_border_portals(
+    const PathwayGrid& grid, uint32_t chunk_index,
+    int32_t x0, int32_t y0, int32_t step_x, int32_t step_y,
+    uint32_t length, int32_t across_x, int32_t across_y)
+{
+    Chunk& chunk = chunks_[chunk_index];
+    uint32_t run_start = 0;
+    bool in_run = false;
+
+    // One extra iteration closes a run that reaches the end of the side
+    for (uint32_t k = 0; k <= length; ++k) {
+        const int32_t x = x0 + static_cast<int32_t>(k) * step_x;
+        const int32_t y = y0 + static_cast<int32_t>(k) * step_y;
+        const bool open = k < length &&
+                          grid.has_pathway(x, y) &&
+                          grid.has_pathway(x + across_x, y + across_y);
+        if (open && !in_run) {
+            run_start = k;
+            in_run = true;
+        } else if (!open && in_run) {
+            in_run = false;
+            const uint32_t mid = run_start + (k - 1 - run_start) / 2;
+            const GridPosition portal{x0 + static_cast<int32_t>(mid) * step_x,
+                                      y0 + static_cast<int32_t>(mid) * step_y};
+            const uint32_t tile = tile_of(portal);
+            // Corner tiles can be the midpoint of runs on two sides
+            if (portal_slot_[tile] == NO_PORTAL) {
+                portal_slot_[tile] = static_cast<uint8_t>(chunk.portals.size());
+                chunk.portals.push_back(portal);
+            }
+        }
+    }
+}
+
+void HierarchicalPathfinding::rebuild_chunk(const PathwayGrid& grid, uint32_t cx, uint32_t cy) {
+    const uint32_t index = cy * chunks_x_ + cx;
+    Chunk& chunk = chunks_[index];
+
+    for (const GridPosition& portal : chunk.portals) {
+        portal_slot_[tile_of(portal)] = NO_PORTAL;
+    }
+    chunk.portals.clear();
+
+    const int32_t x0 = static_cast<int32_t>(cx * PATH_CHUNK_SIZE);
+    const int32_t y0 = static_cast<int32_t>(cy * PATH_CHUNK_SIZE);
+    const uint32_t w = std::min(PATH_CHUNK_SIZE, width_ - cx * PATH_CHUNK_SIZE);
+    const uint32_t h = std::min(PATH_CHUNK_SIZE, height_ - cy * PATH_CHUNK_SIZE);
+    const int32_t x1 = x0 + static_cast<int32_t>(w) - 1;
+    const int32_t y1 = y0 + static_cast<int32_t>(h) - 1;
+
+    if (cy > 0) {
+        collect_border_portals(grid, index, x0, y0, 1, 0, w, 0, -1);   // north
+    }
+    if (cy + 1 < chunks_y_) {
+        collect_border_portals(grid, index, x0, y1, 1, 0, w, 0, 1);    // south
+    }
+    if (cx > 0) {
+        collect_border_portals(grid, index, x0, y0, 0, 1, h, -1, 0);   // west
+    }
+    if (cx + 1 < chunks_x_) {
+        collect_border_portals(grid, index, x1, y0, 0, 1, h, 1, 0);    // east
+    }
+
+    const size_t n = chunk.portals.size();
+    chunk.costs.assign(n * n, UNREACHED);
+    chunk.toward.resize(n * CHUNK_TILES);
+    for (size_t i = 0; i < n; ++i) {
+        chunk_bfs(grid, chunk.portals[i]);
+        for (size_t j = 0; j < n; ++j) {
+            const uint32_t steps = bfs_dist_[local_of(chunk.portals[j])];
+            chunk.costs[i * n + j] = steps == UNREACHED ? UNREACHED : steps * STEP_COST;
+        }
+        std::copy(bfs_back_, bfs_back_ + CHUNK_TILES, chunk.toward.begin() + static_cast<std::ptrdiff_t>(i * CHUNK_TILES));
+    }
+    chunk.dirty = false;
+}
+
+void HierarchicalPathfinding::chunk_bfs(const PathwayGrid& grid, const GridPosition& source_pos) {
+    const int32_t x0 = static_cast<int32_t>(static_cast<uint32_t>(source_pos.x) & ~(PATH_CHUNK_SIZE - 1));
+    const int32_t y0 = static_cast<int32_t>(static_cast<uint32_t>(source_pos.y) & ~(PATH_CHUNK_SIZE - 1));
+    const int32_t x1 = std::min(x0 + static_cast<int32_t>(PATH_CHUNK_SIZE), static_cast<int32_t>(width_));
+    const int32_t y1 = std::min(y0 + static_cast<int32_t>(PATH_CHUNK_SIZE), static_cast<int32_t>(height_));
+
+    std::fill(bfs_dist_, bfs_dist_ + CHUNK_TILES, UNREACHED);
+
+    const uint16_t source = static_cast<uint16_t>(local_of(source_pos));
+    bfs_dist_[source] = 0;
+    bfs_back_[source] = 0;
+    uint32_t head = 0;
+    uint32_t tail = 0;
+    bfs_queue_[tail++] = source;
+
+    while (head < tail) {
+        const uint16_t local = bfs_queue_[head++];
+        const int32_t x = x0 + static_cast<int32_t>(local % PATH_CHUNK_SIZE);
+        const int32_t y = y0 + static_cast<int32_t>(local / PATH_CHUNK_SIZE);
+        for (int d = 0; d < 4; ++d) {
+            const int32_t nx = x + DIR_X[d];
+            const int32_t ny = y + DIR_Y[d];
+            if (nx < x0 || ny < y0 || nx >= x1 || ny >= y1 || !grid.has_pathway(nx, ny)) {
+                continue;
+            }
+            const uint16_t next = static_cast<uint16_t>((ny - y0) * static_cast<int32_t>(PATH_CHUNK_SIZE) + (nx - x0));
+            if (bfs_dist_[next] != UNREACHED) {
+                continue;
+            }
+            bfs_dist_[next] = bfs_dist_[local] + 1;
+            bfs_back_[next] = static_cast<uint8_t>(d ^ 1);  // N<->S, E<->W
+            bfs_queue_[tail++] = next;
+        }
+    }
+}
+
+// =============================================================================
+// Query
+// =============================================================================
+
+PathResult HierarchicalPathfinding::find_path(
+    const GridPosition& start,
+    const GridPosition& end,
+    const PathwayGrid& grid,
+    const NetworkGraph& graph)
+{
+    PathResult result;
+
+    if (!grid.has_pathway(start.x, start.y) || !grid.has_pathway(end.x, end.y)) {
+        return result;
+    }
+
+    if ((static_cast<uint32_t>(start.x) >> PATH_CHUNK_SHIFT) == (static_cast<uint32_t>(end.x) >> PATH_CHUNK_SHIFT) &&
+        (static_cast<uint32_t>(start.y) >> PATH_CHUNK_SHIFT) == (static_cast<uint32_t>(end.y) >> PATH_CHUNK_SHIFT)) {
+        // Same chunk (including start == end): the portal graph cannot help
+        return flat_.find_path(start, end, grid, graph);
+    }
+
+    NetworkId start_net = graph.get_network_id(start);
+    NetworkId end_net = graph.get_network_id(end);
+    if (start_net == 0 || end_net == 0 || start_net != end_net) {
+        return result;
+    }
+
+    rebuild_dirty_chunks(grid);
+
+    const uint32_t start_chunk = chunk_of(start);
+    const uint32_t end_chunk = chunk_of(end);
+    const uint32_t start_node = static_cast<uint32_t>(chunks_.size()) * MAX_CHUNK_PORTALS;
+    const uint32_t end_node = start_node + 1;
+
+    // In-chunk distances from every tile of the end chunk to the end tile
+    chunk_bfs(grid, end);
+    std::copy(bfs_dist_, bfs_dist_ + CHUNK_TILES, goal_dist_);
+    std::copy(bfs_back_, bfs_back_ + CHUNK_TILES, goal_back_);
+
+    if (++generation_ == 0) {
+        std::fill(nodes_.begin(), nodes_.end(), NodeState{});
+        generation_ = 1;
+    }
+    const uint32_t gen = generation_;
+    heap_.clear();
+
+    auto relax = [&](uint32_t from, uint32_t to, uint32_t g, const GridPosition& to_pos) {
+        NodeState& state = nodes_[to];
+        if (state.closed == gen || (state.seen == gen && g >= state.g_cost)) {
+            return;
+        }
+        state.seen = gen;
+        state.g_cost = g;
+        state.parent = from;
+        heap_push({g + manhattan_cost(to_pos, end), g, to});
+    };
+
+    nodes_[start_node].seen = gen;
+    nodes_[start_node].g_cost = 0;
+    nodes_[start_node].parent = start_node;
+    heap_push({manhattan_cost(start, end), 0, start_node});
+
+    bool found = false;
+    while (!heap_.empty()) {
+        const HeapEntry current = heap_pop();
+        const uint32_t u = current.node;
+        NodeState& u_state = nodes_[u];
+        if (u_state.closed == gen || current.g_cost != u_state.g_cost) {
+            continue;
+        }
+        u_state.closed = gen;
+
+        if (u == end_node) {
+            found = true;
+            break;
+        }
+
+        if (u == start_node) {
+            // Start edges: in-chunk BFS to the start chunk's portals
+            chunk_bfs(grid, start);
+            const Chunk& chunk = chunks_[start_chunk];
+            for (uint32_t j = 0; j < chunk.portals.size(); ++j) {
+                const uint32_t steps = bfs_dist_[local_of(chunk.portals[j])];
+                if (steps != UNREACHED) {
+                    relax(u, start_chunk * MAX_CHUNK_PORTALS + j, steps * STEP_COST,
+                          chunk.portals[j]);
+                }
+            }
+            continue;
+        }
+
+        const uint32_t u_chunk = u / MAX_CHUNK_PORTALS;
+        const uint32_t slot = u % MAX_CHUNK_PORTALS;
+        const Chunk& chunk = chunks_[u_chunk];
+        const GridPosition pos = chunk.portals[slot];
+
+        // Portals of the same chunk via cached in-chunk costs
+        const size_t n = chunk.portals.size();
+        const uint32_t* costs = chunk.costs.data() + slot * n;
+        for (uint32_t j = 0; j < n; ++j) {
+            if (costs[j] != UNREACHED && j != slot) {
+                relax(u, u_chunk * MAX_CHUNK_PORTALS + j, current.g_cost + costs[j],
+                      chunk.portals[j]);
+            }
+        }
+
+        // Crossings into neighbouring chunks (portal tiles are pathway tiles)
+        for (int d = 0; d < 4; ++d) {
+            const GridPosition next{pos.x + DIR_X[d], pos.y + DIR_Y[d]};
+            if (next.x < 0 || next.y < 0 ||
+                static_cast<uint32_t>(next.x) >= width_ || static_cast<uint32_t>(next.y) >= height_) {
+                continue;
+            }
+            const uint32_t next_chunk = chunk_of(next);
+            if (next_chunk == u_chunk) {
+                continue;
+            }
+            const uint8_t next_slot = portal_slot_[tile_of(next)];
+            if (next_slot != NO_PORTAL) {
+                relax(u, next_chunk * MAX_CHUNK_PORTALS + next_slot, current.g_cost + STEP_COST, next);
+            }
+        }
+
+        if (u_chunk == end_chunk) {
+            const uint32_t steps = goal_dist_[local_of(pos)];
+            if (steps != UNREACHED) {
+                relax(u, end_node, current.g_cost + steps * STEP_COST, end);
+            }
+        }
+    }
+    heap_.clear();
+
+    if (!found) {
+        return result;
+    }
+
+    // Abstract route, end to start
+    route_.clear();
+    for (uint32_t node = end_node; ; node = nodes_[node].parent) {
+        route_.push_back(node);
+        if (node == start_node) {
+            break;
+        }
+    }
+
+    result.found = true;
+    result.total_cost = nodes_[end_node].g_cost;
+    result.path.push_back(start);
+    GridPosition from = start;
+    for (size_t i = route_.size() - 1; i > 0; --i) {
+        const uint32_t node = route_[i - 1];
+        if (node == end_node) {
+            refine_segment(from, end, goal_back_, result.path);
+            from = end;
+        } else {
+            const Chunk& chunk = chunks_[node / MAX_CHUNK_PORTALS];
+            const uint32_t slot = node % MAX_CHUNK_PORTALS;
+            refine_segment(from, chunk.portals[slot],
+                           chunk.toward.data() + static_cast<size_t>(slot) * CHUNK_TILES,
+                           result.path);
+            from = chunk.portals[slot];
+        }
+    }
+    return result;
+}
+
+void HierarchicalPathfinding::refine_segment(const GridPosition& from, const GridPosition& to,
+                                             const uint8_t* back,
+                                             std::vector<GridPosition>& path) const {
+    if (chunk_of(from) != chunk_of(to)) {
+        // Border crossing between adjacent portals
+        path.push_back(to);
+        return;
+    }
+
+    // Follow the cached BFS tree rooted at the target
+    GridPosition pos = from;
+    while (pos != to) {
+        const uint8_t d = back[local_of(pos)];
+        pos.x += DIR_X[d];
+        pos.y += DIR_Y[d];
+        path.push_back(pos);
+    }
+}
+
+// =============================================================================
+// Binary heap over heap_
+// =============================================================================
+
+bool HierarchicalPathfinding::heap_after(const HeapEntry& a, const HeapEntry& b) {
+    return a.f_cost > b.f_cost || (a.f_cost == b.f_cost && a.g_cost < b.g_cost);
+}
+
+void HierarchicalPathfinding::heap_push(const HeapEntry& entry) {
+    heap_.push_back(entry);
+    std::push_heap(heap_.begin(), heap_.end(), heap_after);
+}
+
+HierarchicalPathfinding::HeapEntry HierarchicalPathfinding::heap_pop() {
+    std::pop_heap(heap_.begin(), heap_.end(), heap_after);
+    const HeapEntry top = heap_.back();
+    heap_.pop_back();
+    return top;
+}
+
+} // namespace transport
+} // namespace sims3000
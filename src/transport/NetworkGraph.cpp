@@ -7,152 +7,260 @@
 
 #include <sims3000/transport/NetworkGraph.h>
 #include <sims3000/transport/PathwayGrid.h>
-#include <queue>
 #include <algorithm>
 
 namespace sims3000 {
 namespace transport {
 
 void NetworkGraph::clear() {
-    nodes_.clear();
-    position_to_node_.clear();
+    positions_.clear();
+    network_ids_.clear();
+    offsets_.assign(1, 0);
+    neighbors_.clear();
+    pending_edges_.clear();
+    edge_source_ = EdgeSource::None;
+    tile_adjacency_.clear();
+    std::fill(tile_to_node_.begin(), tile_to_node_.end(), INVALID_NODE_INDEX);
     next_network_id_ = 1;
+    network_count_ = 0;
+    network_sizes_.assign(1, 0);
+    free_network_ids_.clear();
 }
 
-uint16_t NetworkGraph::add_node(const GridPosition& pos) {
+void NetworkGraph::reserve_tiles(uint32_t width, uint32_t height) {
+    if (width <= tile_width_ && height <= tile_height_) {
+        return;
+    }
+    const uint32_t new_width = std::max(width, tile_width_);
+    const uint32_t new_height = std::max(height, tile_height_);
+    std::vector<NodeIndex> grown(static_cast<size_t>(new_width) * new_height, INVALID_NODE_INDEX);
+    for (uint32_t y = 0; y < tile_height_; ++y) {
+        std::copy_n(tile_to_node_.begin() + static_cast<size_t>(y) * tile_width_, tile_width_,
+                    grown.begin() + static_cast<size_t>(y) * new_width);
+    }
+    tile_to_node_.swap(grown);
+    tile_width_ = new_width;
+    tile_height_ = new_height;
+}
+
+NodeIndex NetworkGraph::add_node(const GridPosition& pos) {
+    if (pos.x < 0 || pos.y < 0) {
+        return INVALID_NODE_INDEX;
+    }
+    const uint32_t x = static_cast<uint32_t>(pos.x);
+    const uint32_t y = static_cast<uint32_t>(pos.y);
+    if (x >= tile_width_ || y >= tile_height_) {
+        // Grow geometrically so scattered manual inserts stay amortized O(1)
+        reserve_tiles(std::max(x + 1, tile_width_ * 2), std::max(y + 1, tile_height_ * 2));
+    }
+
     // Check if node already exists at this position
-    auto it = position_to_node_.find(pos);
-    if (it != position_to_node_.end()) {
-        return it->second;
+    NodeIndex& slot = tile_to_node_[static_cast<size_t>(y) * tile_width_ + x];
+    if (slot != INVALID_NODE_INDEX) {
+        return slot;
     }
 
-    uint16_t index = static_cast<uint16_t>(nodes_.size());
-    NetworkNode node;
-    node.position = pos;
-    node.network_id = 0;
-    nodes_.push_back(node);
-    position_to_node_[pos] = index;
+    NodeIndex index = static_cast<NodeIndex>(positions_.size());
+    positions_.push_back(pos);
+    network_ids_.push_back(0);
+    slot = index;
+
+    if (edge_source_ == EdgeSource::Tiles) {
+        tile_adjacency_.emplace_back();
+        link_tile(index);
+        link_tile_neighbors(pos);
+    }
     return index;
 }
 
-void NetworkGraph::add_edge(uint16_t node_a, uint16_t node_b) {
-    if (node_a >= nodes_.size() || node_b >= nodes_.size()) {
-        return;
+bool NetworkGraph::add_edge(NodeIndex node_a, NodeIndex node_b) {
+    if (node_a >= positions_.size() || node_b >= positions_.size()) {
+        return false;
     }
-    if (node_a == node_b) {
-        return;
+    if (node_a == node_b || edge_source_ == EdgeSource::Tiles) {
+        return false;
     }
+    edge_source_ = EdgeSource::Manual;
+    pending_edges_.emplace_back(node_a, node_b);
+    return true;
+}
 
-    // Check if edge already exists (avoid duplicates)
-    auto& neighbors_a = nodes_[node_a].neighbor_indices;
-    if (std::find(neighbors_a.begin(), neighbors_a.end(), node_b) == neighbors_a.end()) {
-        neighbors_a.push_back(node_b);
+bool NetworkGraph::use_tile_edges() {
+    if (edge_source_ == EdgeSource::Tiles) {
+        return true;
+    }
+    if (edge_source_ == EdgeSource::Manual) {
+        return false;
     }
+    edge_source_ = EdgeSource::Tiles;
+    tile_adjacency_.assign(positions_.size(), TileAdjacency{});
+    for (NodeIndex i = 0; i < positions_.size(); ++i) {
+        link_tile(i);
+    }
+    return true;
+}
+
+void NetworkGraph::link_tile(NodeIndex index) {
+    TileAdjacency& adjacency = tile_adjacency_[index];
+    adjacency.count = static_cast<uint8_t>(tile_neighbors(positions_[index], adjacency.neighbors));
+}
 
-    auto& neighbors_b = nodes_[node_b].neighbor_indices;
-    if (std::find(neighbors_b.begin(), neighbors_b.end(), node_a) == neighbors_b.end()) {
-        neighbors_b.push_back(node_a);
+void NetworkGraph::link_tile_neighbors(const GridPosition& pos) {
+    NodeIndex adjacent[4];
+    const int count = tile_neighbors(pos, adjacent);
+    for (int i = 0; i < count; ++i) {
+        link_tile(adjacent[i]);
     }
 }
 
-bool NetworkGraph::is_connected(const GridPosition& a, const GridPosition& b) const {
-    auto it_a = position_to_node_.find(a);
-    auto it_b = position_to_node_.find(b);
+void NetworkGraph::compact_edges() const {
+    const size_t n = positions_.size();
+    if (pending_edges_.empty()) {
+        // Nodes added since the last compaction have no neighbors yet
+        if (offsets_.size() != n + 1) {
+            offsets_.resize(n + 1, offsets_.empty() ? 0 : offsets_.back());
+        }
+        return;
+    }
 
-    if (it_a == position_to_node_.end() || it_b == position_to_node_.end()) {
-        return false;
+    // Gather existing and staged edges as directed pairs, then dedupe
+    std::vector<std::pair<NodeIndex, NodeIndex>> directed;
+    directed.reserve(neighbors_.size() + pending_edges_.size() * 2);
+    for (NodeIndex i = 0; i + 1 < offsets_.size(); ++i) {
+        for (uint32_t e = offsets_[i]; e < offsets_[i + 1]; ++e) {
+            directed.emplace_back(i, neighbors_[e]);
+        }
     }
+    for (const auto& edge : pending_edges_) {
+        directed.emplace_back(edge.first, edge.second);
+        directed.emplace_back(edge.second, edge.first);
+    }
+    pending_edges_.clear();
+    std::sort(directed.begin(), directed.end());
+    directed.erase(std::unique(directed.begin(), directed.end()), directed.end());
+
+    offsets_.assign(n + 1, 0);
+    neighbors_.resize(directed.size());
+    for (size_t e = 0; e < directed.size(); ++e) {
+        ++offsets_[directed[e].first + 1];
+        neighbors_[e] = directed[e].second;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        offsets_[i + 1] += offsets_[i];
+    }
+}
 
-    uint16_t id_a = nodes_[it_a->second].network_id;
-    uint16_t id_b = nodes_[it_b->second].network_id;
+bool NetworkGraph::is_connected(const GridPosition& a, const GridPosition& b) const {
+    NetworkId id_a = get_network_id(a);
+    NetworkId id_b = get_network_id(b);
 
     // Both must have non-zero network_id and they must match
     return id_a != 0 && id_a == id_b;
 }
 
-uint16_t NetworkGraph::get_network_id(const GridPosition& pos) const {
-    auto it = position_to_node_.find(pos);
-    if (it == position_to_node_.end()) {
+NetworkId NetworkGraph::get_network_id(const GridPosition& pos) const {
+    NodeIndex index = get_node_index(pos);
+    if (index == INVALID_NODE_INDEX) {
         return 0;
     }
-    return nodes_[it->second].network_id;
+    return network_ids_[index];
 }
 
-uint16_t NetworkGraph::get_node_index(const GridPosition& pos) const {
-    auto it = position_to_node_.find(pos);
-    if (it == position_to_node_.end()) {
-        return UINT16_MAX;
+NodeIndex NetworkGraph::get_node_index(const GridPosition& pos) const {
+    if (pos.x < 0 || pos.y < 0
+        || static_cast<uint32_t>(pos.x) >= tile_width_
+        || static_cast<uint32_t>(pos.y) >= tile_height_) {
+        return INVALID_NODE_INDEX;
     }
-    return it->second;
+    return tile_to_node_[static_cast<size_t>(pos.y) * tile_width_ + static_cast<uint32_t>(pos.x)];
 }
 
 size_t NetworkGraph::node_count() const {
-    return nodes_.size();
+    return positions_.size();
+}
+
+NetworkNode NetworkGraph::get_node(NodeIndex index) const {
+    NetworkNode node;
+    node.position = positions_[index];
+    node.neighbor_indices = get_neighbors(index);
+    node.network_id = network_ids_[index];
+    return node;
 }
 
-const NetworkNode& NetworkGraph::get_node(uint16_t index) const {
-    return nodes_[index];
+NodeSpan NetworkGraph::get_neighbors(NodeIndex index) const {
+    if (edge_source_ == EdgeSource::Tiles) {
+        const TileAdjacency& adjacency = tile_adjacency_[index];
+        return NodeSpan{ adjacency.neighbors, adjacency.neighbors + adjacency.count };
+    }
+    compact_edges();
+    const NodeIndex* base = neighbors_.data();
+    return NodeSpan{ base + offsets_[index], base + offsets_[index + 1] };
 }
 
 void NetworkGraph::assign_network_ids() {
-    // Reset all network IDs
-    for (auto& node : nodes_) {
-        node.network_id = 0;
+    if (edge_source_ != EdgeSource::Tiles) {
+        compact_edges();
     }
-    next_network_id_ = 1;
 
-    // BFS over all nodes, assigning connected component IDs
-    for (size_t i = 0; i < nodes_.size(); ++i) {
-        if (nodes_[i].network_id != 0) {
+    // Reset all network IDs
+    std::fill(network_ids_.begin(), network_ids_.end(), 0u);
+    next_network_id_ = 1;
+    network_sizes_.assign(1, 0);
+    free_network_ids_.clear();
+
+    // BFS over all nodes, assigning connected component IDs. The frontier
+    // is a flat array reused across components.
+    std::vector<NodeIndex> frontier;
+    frontier.reserve(positions_.size());
+    for (NodeIndex i = 0; i < positions_.size(); ++i) {
+        if (network_ids_[i] != 0) {
             continue; // Already visited
         }
 
-        uint16_t current_id = next_network_id_++;
+        NetworkId current_id = next_network_id_++;
 
         // BFS from this node
-        std::queue<uint16_t> frontier;
-        frontier.push(static_cast<uint16_t>(i));
-        nodes_[i].network_id = current_id;
-
-        while (!frontier.empty()) {
-            uint16_t current = frontier.front();
-            frontier.pop();
-
-            for (uint16_t neighbor : nodes_[current].neighbor_indices) {
-                if (nodes_[neighbor].network_id == 0) {
-                    nodes_[neighbor].network_id = current_id;
-                    frontier.push(neighbor);
+        frontier.clear();
+        frontier.push_back(i);
+        network_ids_[i] = current_id;
+
+        for (size_t head = 0; head < frontier.size(); ++head) {
+            for (NodeIndex neighbor : get_neighbors(frontier[head])) {
+                if (network_ids_[neighbor] == 0) {
+                    network_ids_[neighbor] = current_id;
+                    frontier.push_back(neighbor);
                 }
             }
         }
+        network_sizes_.push_back(static_cast<uint32_t>(frontier.size()));
     }
+    network_count_ = next_network_id_ - 1;
 }
 
-std::vector<GridPosition> NetworkGraph::get_network_positions(uint16_t network_id) const {
+std::vector<GridPosition> NetworkGraph::get_network_positions(NetworkId network_id) const {
     std::vector<GridPosition> positions;
-    for (const auto& node : nodes_) {
-        if (node.network_id == network_id) {
-            positions.push_back(node.position);
+    for (size_t i = 0; i < positions_.size(); ++i) {
+        if (network_ids_[i] == network_id) {
+            positions.push_back(positions_[i]);
         }
     }
     return positions;
 }
 
-uint16_t NetworkGraph::get_network_count() const {
-    // next_network_id_ starts at 1 and increments for each component.
-    // After assign_network_ids(), it points one past the last assigned ID.
-    // If no nodes exist, next_network_id_ is 1, so count is 0.
-    return (next_network_id_ > 1) ? static_cast<uint16_t>(next_network_id_ - 1) : 0;
+NetworkId NetworkGraph::get_network_count() const {
+    // Counted by assign_network_ids() and kept current by the
+    // incremental tile operations
+    return network_count_;
 }
 
 void NetworkGraph::rebuild_from_grid(const PathwayGrid& grid) {
-    // 1. Clear existing graph
-    clear();
-
-    // 2. Scan PathwayGrid for all pathway tiles and create nodes
+    // 1. Clear existing graph and size the tile index to the grid
     const int32_t w = static_cast<int32_t>(grid.width());
     const int32_t h = static_cast<int32_t>(grid.height());
+    reserve_tiles(static_cast<uint32_t>(w), static_cast<uint32_t>(h));
+    clear();
 
+    // 2. Scan PathwayGrid for all pathway tiles and create nodes
     for (int32_t y = 0; y < h; ++y) {
         for (int32_t x = 0; x < w; ++x) {
             if (grid.has_pathway(x, y)) {
@@ -161,40 +269,247 @@ void NetworkGraph::rebuild_from_grid(const PathwayGrid& grid) {
         }
     }
 
-    // 3. Connect adjacent pathway tiles (N/S/E/W)
+    // 3. Connect adjacent pathway tiles (N/S/E/W) into the per-node slots.
     //    Cross-ownership per CCR-002: no owner check when connecting
-    static const int32_t dx[] = { 1, 0 };
-    static const int32_t dy[] = { 0, 1 };
+    use_tile_edges();
 
-    for (int32_t y = 0; y < h; ++y) {
-        for (int32_t x = 0; x < w; ++x) {
-            if (!grid.has_pathway(x, y)) {
-                continue;
+    // 4. Assign connected component network IDs
+    assign_network_ids();
+}
+
+// =============================================================================
+// Incremental maintenance
+// =============================================================================
+
+NetworkId NetworkGraph::allocate_network_id() {
+    ++network_count_;
+    if (!free_network_ids_.empty()) {
+        NetworkId id = free_network_ids_.back();
+        free_network_ids_.pop_back();
+        return id;
+    }
+    network_sizes_.resize(static_cast<size_t>(next_network_id_) + 1, 0);
+    return next_network_id_++;
+}
+
+void NetworkGraph::release_network_id(NetworkId id) {
+    --network_count_;
+    network_sizes_[id] = 0;
+    free_network_ids_.push_back(id);
+}
+
+int NetworkGraph::tile_neighbors(const GridPosition& pos, NodeIndex out[4]) const {
+    static const int32_t dx[] = { 0, -1, 1, 0 };
+    static const int32_t dy[] = { -1, 0, 0, 1 };
+    int count = 0;
+    for (int d = 0; d < 4; ++d) {
+        NodeIndex neighbor = get_node_index(GridPosition{pos.x + dx[d], pos.y + dy[d]});
+        if (neighbor != INVALID_NODE_INDEX) {
+            out[count++] = neighbor;
+        }
+    }
+    return count;
+}
+
+void NetworkGraph::relabel_component(NodeIndex start, NetworkId from, NetworkId to,
+                                     std::vector<GridPosition>* relabeled) {
+    // Nodes still carrying `from` are unvisited, so the ID doubles as the
+    // visited mark
+    frontier_.clear();
+    frontier_.push_back(start);
+    network_ids_[start] = to;
+    for (size_t head = 0; head < frontier_.size(); ++head) {
+        const NodeIndex current = frontier_[head];
+        if (relabeled) {
+            relabeled->push_back(positions_[current]);
+        }
+        for (NodeIndex neighbor : get_neighbors(current)) {
+            if (network_ids_[neighbor] == from) {
+                network_ids_[neighbor] = to;
+                frontier_.push_back(neighbor);
             }
+        }
+    }
+    const uint32_t moved = static_cast<uint32_t>(frontier_.size());
+    if (from != 0) {
+        network_sizes_[from] -= moved;
+    }
+    network_sizes_[to] += moved;
+}
 
-            uint16_t node_a = get_node_index(GridPosition{x, y});
+NodeIndex NetworkGraph::add_pathway_tile(const GridPosition& pos,
+                                         std::vector<GridPosition>* relabeled) {
+    NodeIndex existing = get_node_index(pos);
+    if (existing != INVALID_NODE_INDEX) {
+        return existing;
+    }
+    if (pos.x < 0 || pos.y < 0 || !use_tile_edges()) {
+        return INVALID_NODE_INDEX;
+    }
+    NodeIndex index = add_node(pos);
+
+    // Adopt the largest neighboring network
+    NodeIndex adjacent[4];
+    const int count = tile_neighbors(pos, adjacent);
+    NetworkId target = 0;
+    for (int i = 0; i < count; ++i) {
+        NetworkId id = network_ids_[adjacent[i]];
+        if (id != 0 && (target == 0 || network_sizes_[id] > network_sizes_[target])) {
+            target = id;
+        }
+    }
+    if (target == 0) {
+        target = allocate_network_id();
+    }
+    network_ids_[index] = target;
+    ++network_sizes_[target];
+    if (relabeled) {
+        relabeled->push_back(pos);
+    }
 
-            // Only check East and South to avoid duplicate edges
-            for (int d = 0; d < 2; ++d) {
-                int32_t nx = x + dx[d];
-                int32_t ny = y + dy[d];
+    // Merge the smaller networks into it
+    for (int i = 0; i < count; ++i) {
+        NetworkId id = network_ids_[adjacent[i]];
+        if (id != target) {
+            relabel_component(adjacent[i], id, target, relabeled);
+            if (id != 0) {
+                release_network_id(id);
+            }
+        }
+    }
+    return index;
+}
 
-                if (nx < 0 || ny < 0
-                    || static_cast<uint32_t>(nx) >= grid.width()
-                    || static_cast<uint32_t>(ny) >= grid.height()) {
-                    continue;
+bool NetworkGraph::remove_pathway_tile(const GridPosition& pos,
+                                       std::vector<GridPosition>* relabeled) {
+    const NodeIndex index = get_node_index(pos);
+    if (index == INVALID_NODE_INDEX || !use_tile_edges()) {
+        return false;
+    }
+
+    const NetworkId old_id = network_ids_[index];
+    if (old_id != 0) {
+        --network_sizes_[old_id];
+    }
+
+    // Swap-remove: move the last node into the freed index
+    const NodeIndex last = static_cast<NodeIndex>(positions_.size() - 1);
+    tile_to_node_[static_cast<size_t>(pos.y) * tile_width_ + static_cast<uint32_t>(pos.x)] = INVALID_NODE_INDEX;
+    if (index != last) {
+        positions_[index] = positions_[last];
+        network_ids_[index] = network_ids_[last];
+        const GridPosition moved = positions_[index];
+        tile_to_node_[static_cast<size_t>(moved.y) * tile_width_ + static_cast<uint32_t>(moved.x)] = index;
+    }
+    positions_.pop_back();
+    network_ids_.pop_back();
+    tile_adjacency_.pop_back();
+
+    // Patch the slots that named the removed or the moved index
+    link_tile_neighbors(pos);
+    if (index != last) {
+        link_tile(index);
+        link_tile_neighbors(positions_[index]);
+    }
+
+    NodeIndex starts[4];
+    const int count = tile_neighbors(pos, starts);
+    if (old_id == 0) {
+        return true;
+    }
+    if (count == 0) {
+        release_network_id(old_id);
+        return true;
+    }
+    if (count == 1) {
+        return true;
+    }
+
+    // Interleaved BFS from each neighbor. group[s] is a tiny union-find
+    // over the searches; searches that reach each other's tiles merge.
+    visit_stamp_.resize(positions_.size(), 0);
+    visit_search_.resize(positions_.size(), 0);
+    if (++visit_generation_ == 0) {
+        std::fill(visit_stamp_.begin(), visit_stamp_.end(), 0u);
+        visit_generation_ = 1;
+    }
+    const uint32_t gen = visit_generation_;
+
+    std::vector<NodeIndex>* queues = split_queues_;
+    for (int s = 0; s < 4; ++s) {
+        queues[s].clear();
+    }
+    size_t heads[4] = { 0, 0, 0, 0 };
+    uint8_t group[4] = { 0, 1, 2, 3 };
+    bool finished[4] = { false, false, false, false };
+    auto find = [&group](uint8_t s) {
+        while (group[s] != s) {
+            s = group[s];
+        }
+        return s;
+    };
+
+    int live_groups = count;
+    for (int s = 0; s < count; ++s) {
+        visit_stamp_[starts[s]] = gen;
+        visit_search_[starts[s]] = static_cast<uint8_t>(s);
+        queues[s].push_back(starts[s]);
+    }
+
+    while (live_groups > 1) {
+        for (int s = 0; s < count && live_groups > 1; ++s) {
+            if (find(static_cast<uint8_t>(s)) != s || finished[s]) {
+                continue;
+            }
+            // Advance this group by one node from any of its queues
+            int source = -1;
+            for (int q = 0; q < count; ++q) {
+                if (find(static_cast<uint8_t>(q)) == s && heads[q] < queues[q].size()) {
+                    source = q;
+                    break;
                 }
+            }
+            if (source < 0) {
+                // Exhausted without meeting the others: this piece split off
+                finished[s] = true;
+                --live_groups;
+                NetworkId split_id = allocate_network_id();
+                uint32_t moved = 0;
+                for (int q = 0; q < count; ++q) {
+                    if (find(static_cast<uint8_t>(q)) != s) {
+                        continue;
+                    }
+                    for (NodeIndex node : queues[q]) {
+                        network_ids_[node] = split_id;
+                        if (relabeled) {
+                            relabeled->push_back(positions_[node]);
+                        }
+                    }
+                    moved += static_cast<uint32_t>(queues[q].size());
+                }
+                network_sizes_[split_id] = moved;
+                network_sizes_[old_id] -= moved;
+                continue;
+            }
 
-                if (grid.has_pathway(nx, ny)) {
-                    uint16_t node_b = get_node_index(GridPosition{nx, ny});
-                    add_edge(node_a, node_b);
+            const NodeIndex current = queues[source][heads[source]++];
+            for (const NodeIndex next : get_neighbors(current)) {
+                if (visit_stamp_[next] != gen) {
+                    visit_stamp_[next] = gen;
+                    visit_search_[next] = static_cast<uint8_t>(source);
+                    queues[source].push_back(next);
+                    continue;
+                }
+                const uint8_t other = find(visit_search_[next]);
+                if (other != s) {
+                    // Met another search: same piece, merge the groups
+                    group[other] = static_cast<uint8_t>(s);
+                    --live_groups;
                 }
             }
         }
     }
-
-    // 4. Assign connected component network IDs
-    assign_network_ids();
+    return true;
 }
 
 } // namespace transport
@@ -6,15 +6,48 @@
  */
 
 #include <sims3000/transport/PathCache.h>
+#include <sims3000/core/TilePositionIndex.h>
+#include <algorithm>
+#include <bitset>
 
 namespace sims3000 {
 namespace transport {
 
-PathCache::PathCache(uint32_t max_age_ticks)
+namespace {
+
+/// Position of `bit` among the set bits of mask (mask must contain bit)
+uint32_t bit_rank(uint64_t mask, uint32_t bit) {
+    const uint64_t below = (uint64_t{1} << bit) - 1;
+    return static_cast<uint32_t>(std::bitset<64>(mask & below).count());
+}
+
+/// Swap-and-pop list[pos]; returns the slot moved into pos, or `removed`
+uint32_t swap_remove(std::vector<uint32_t>& list, uint32_t pos) {
+    const uint32_t removed = list[pos];
+    list[pos] = list.back();
+    list.pop_back();
+    return pos < list.size() ? list[pos] : removed;
+}
+
+} // anonymous namespace
+
+PathCache::PathCache(uint32_t max_age_ticks, size_t max_entries)
     : max_age_ticks_(max_age_ticks)
+    , max_entries_(max_entries > 0 ? max_entries : 1)
 {
 }
 
+void PathCache::set_map_size(uint32_t width, uint32_t height) {
+    const uint32_t side = std::max(width, height);
+    region_size_ = std::max<uint32_t>(1, (side + PATH_CACHE_REGIONS_PER_SIDE - 1) /
+                                             PATH_CACHE_REGIONS_PER_SIDE);
+    invalidate();
+}
+
+uint32_t PathCache::region_size() const {
+    return region_size_;
+}
+
 const PathResult* PathCache::get(const GridPosition& start, const GridPosition& end,
                                   uint32_t current_tick) const {
     PathCacheKey key;
@@ -23,32 +56,189 @@ const PathResult* PathCache::get(const GridPosition& start, const GridPosition&
 
     auto it = cache_.find(key);
     if (it == cache_.end()) {
+        ++stats_.misses;
         return nullptr;
     }
 
     // Check if entry has expired
-    if ((current_tick - it->second.cached_at_tick) >= max_age_ticks_) {
+    const Slot& slot = slots_[it->second];
+    if ((current_tick - slot.entry.cached_at_tick) >= max_age_ticks_) {
+        ++stats_.misses;
         return nullptr;
     }
 
-    return &it->second.result;
+    // Mark most recently used
+    lru_.splice(lru_.begin(), lru_, slot.lru_it);
+    ++stats_.hits;
+    return &slot.entry.result;
 }
 
 void PathCache::put(const GridPosition& start, const GridPosition& end,
                      const PathResult& result, uint32_t current_tick) {
+    store(start, end, result, current_tick, 0, 0);
+}
+
+void PathCache::put(const GridPosition& start, const GridPosition& end,
+                     const PathResult& result, uint32_t current_tick,
+                     const NetworkGraph& graph) {
+    store(start, end, result, current_tick,
+          graph.get_network_id(start), graph.get_network_id(end));
+}
+
+void PathCache::store(const GridPosition& start, const GridPosition& end,
+                      const PathResult& result, uint32_t current_tick,
+                      NetworkId start_network, NetworkId end_network) {
     PathCacheKey key;
     key.start = start;
     key.end = end;
 
-    CachedPath entry;
+    uint64_t mask = region_bit(start) | region_bit(end);
+    for (const GridPosition& pos : result.path) {
+        mask |= region_bit(pos);
+    }
+
+    uint32_t index;
+    auto it = cache_.find(key);
+    if (it == cache_.end()) {
+        if (cache_.size() >= max_entries_) {
+            // Drop the least recently used entry
+            evict(lru_.back());
+            ++stats_.evictions;
+        }
+        if (!free_slots_.empty()) {
+            index = free_slots_.back();
+            free_slots_.pop_back();
+        } else {
+            index = static_cast<uint32_t>(slots_.size());
+            slots_.emplace_back();
+        }
+        lru_.push_front(index);
+        slots_[index].key = key;
+        slots_[index].lru_it = lru_.begin();
+        cache_.emplace(key, index);
+    } else {
+        index = it->second;
+        unlink(index);
+        lru_.splice(lru_.begin(), lru_, slots_[index].lru_it);
+    }
+
+    CachedPath& entry = slots_[index].entry;
     entry.result = result;
     entry.cached_at_tick = current_tick;
-
-    cache_[key] = entry;
+    entry.start_network = start_network;
+    entry.end_network = end_network;
+    entry.region_mask = mask;
+    link(index);
 }
 
 void PathCache::invalidate() {
+    stats_.invalidations += cache_.size();
     cache_.clear();
+    slots_.clear();
+    free_slots_.clear();
+    lru_.clear();
+    for (std::vector<uint32_t>& list : region_slots_) {
+        list.clear();
+    }
+    network_slots_.clear();
+}
+
+void PathCache::link(uint32_t index) {
+    Slot& slot = slots_[index];
+    slot.region_pos.clear();
+    for (uint64_t bits = slot.entry.region_mask; bits != 0; bits &= bits - 1) {
+        std::vector<uint32_t>& list = region_slots_[lowest_set_bit(bits)];
+        slot.region_pos.push_back(static_cast<uint32_t>(list.size()));
+        list.push_back(index);
+    }
+
+    std::vector<uint32_t>& start_list = network_slots_[slot.entry.start_network];
+    slot.network_pos[0] = static_cast<uint32_t>(start_list.size());
+    start_list.push_back(index);
+    if (slot.entry.end_network != slot.entry.start_network) {
+        std::vector<uint32_t>& end_list = network_slots_[slot.entry.end_network];
+        slot.network_pos[1] = static_cast<uint32_t>(end_list.size());
+        end_list.push_back(index);
+    }
+}
+
+void PathCache::unlink(uint32_t index) {
+    const Slot& slot = slots_[index];
+    uint32_t rank = 0;
+    for (uint64_t bits = slot.entry.region_mask; bits != 0; bits &= bits - 1, ++rank) {
+        const uint32_t bit = lowest_set_bit(bits);
+        const uint32_t pos = slot.region_pos[rank];
+        const uint32_t moved = swap_remove(region_slots_[bit], pos);
+        if (moved != index) {
+            Slot& other = slots_[moved];
+            other.region_pos[bit_rank(other.entry.region_mask, bit)] = pos;
+        }
+    }
+
+    const NetworkId networks[2] = { slot.entry.start_network, slot.entry.end_network };
+    const int count = (networks[0] == networks[1]) ? 1 : 2;
+    for (int n = 0; n < count; ++n) {
+        auto it = network_slots_.find(networks[n]);
+        const uint32_t pos = slot.network_pos[n];
+        const uint32_t moved = swap_remove(it->second, pos);
+        if (moved != index) {
+            Slot& other = slots_[moved];
+            other.network_pos[other.entry.start_network == networks[n] ? 0 : 1] = pos;
+        }
+        if (it->second.empty()) {
+            network_slots_.erase(it);
+        }
+    }
+}
+
+void PathCache::evict(uint32_t index) {
+    unlink(index);
+    Slot& slot = slots_[index];
+    cache_.erase(slot.key);
+    lru_.erase(slot.lru_it);
+    slot.entry.result = PathResult{};
+    free_slots_.push_back(index);
+}
+
+size_t PathCache::invalidate_region(const GridPosition& pos) {
+    std::vector<uint32_t>& list = region_slots_[lowest_set_bit(region_bit(pos))];
+    size_t evicted = 0;
+    while (!list.empty()) {
+        evict(list.back());
+        ++evicted;
+    }
+    stats_.invalidations += evicted;
+    return evicted;
+}
+
+size_t PathCache::invalidate_network(NetworkId network_id) {
+    // Entries with an unknown endpoint network may be in any network
+    size_t evicted = 0;
+    for (NetworkId id : { network_id, NetworkId{0} }) {
+        for (auto it = network_slots_.find(id); it != network_slots_.end();
+             it = network_slots_.find(id)) {
+            evict(it->second.back());
+            ++evicted;
+        }
+    }
+    stats_.invalidations += evicted;
+    return evicted;
+}
+
+uint64_t PathCache::region_bit(const GridPosition& pos) const {
+    // Clamp into the 8x8 region grid; negative coordinates go to region 0
+    const uint32_t last = PATH_CACHE_REGIONS_PER_SIDE - 1;
+    const uint32_t rx = pos.x < 0 ? 0 : std::min(static_cast<uint32_t>(pos.x) / region_size_, last);
+    const uint32_t ry = pos.y < 0 ? 0 : std::min(static_cast<uint32_t>(pos.y) / region_size_, last);
+    return uint64_t{1} << (ry * PATH_CACHE_REGIONS_PER_SIDE + rx);
+}
+
+const PathCacheStats& PathCache::get_stats() const {
+    return stats_;
+}
+
+size_t PathCache::max_entries() const {
+    return max_entries_;
 }
 
 size_t PathCache::size() const {
@@ -2,7 +2,8 @@
  * @file Pathfinding.cpp
  * @brief A* pathfinding implementation (Epic 7, Ticket E7-023)
  *
- * Standard A* with Manhattan distance heuristic.
+ * Standard A* with Manhattan distance heuristic over generation-stamped
+ * dense scratch arrays and a 4-ary heap.
  * Early exit via network_id check (different connected component = no path).
  * Base edge cost = 10 (enhanced by E7-024).
  *
@@ -11,191 +12,263 @@
 
 #include <sims3000/transport/Pathfinding.h>
 #include <sims3000/transport/PathwayGrid.h>
-#include <queue>
-#include <unordered_map>
 #include <algorithm>
 #include <cmath>
 
 namespace sims3000 {
 namespace transport {
 
+/// Heap arity; 4 children share a cache line of HeapEntry
+static constexpr size_t HEAP_ARITY = 4;
+
 // =============================================================================
-// Position packing for hash map keys
+// Public API
 // =============================================================================
 
-static uint64_t pack_pos(int32_t x, int32_t y) {
-    uint64_t ux = static_cast<uint64_t>(static_cast<uint32_t>(x));
-    uint64_t uy = static_cast<uint64_t>(static_cast<uint32_t>(y));
-    return (uy << 32) | ux;
+PathResult Pathfinding::find_path(
+    const GridPosition& start,
+    const GridPosition& end,
+    const PathwayGrid& grid,
+    const NetworkGraph& graph)
+{
+    PathResult result;
+    search(start, end, grid, graph, result);
+    return result;
+}
+
+void Pathfinding::find_paths(
+    const std::vector<PathQuery>& queries,
+    const PathwayGrid& grid,
+    const NetworkGraph& graph,
+    std::vector<PathResult>& results)
+{
+    results.resize(queries.size());
+    for (size_t i = 0; i < queries.size(); ++i) {
+        search(queries[i].first, queries[i].second, grid, graph, results[i]);
+    }
 }
 
 // =============================================================================
 // A* implementation
 // =============================================================================
 
-PathResult Pathfinding::find_path(
+void Pathfinding::search(
     const GridPosition& start,
     const GridPosition& end,
     const PathwayGrid& grid,
-    const NetworkGraph& graph)
+    const NetworkGraph& graph,
+    PathResult& result)
 {
-    PathResult result;
+    result.found = false;
+    result.path.clear();
+    result.total_cost = 0;
 
     // Validate start is a pathway tile
     if (!grid.has_pathway(start.x, start.y)) {
-        return result;
+        return;
     }
 
     // Validate end is a pathway tile
     if (!grid.has_pathway(end.x, end.y)) {
-        return result;
+        return;
     }
 
     // Trivial case: start == end
     if (start == end) {
         result.found = true;
         result.path.push_back(start);
-        result.total_cost = 0;
-        return result;
+        return;
     }
 
     // Early exit: check if start and end are in the same connected component
-    uint16_t start_net = graph.get_network_id(start);
-    uint16_t end_net = graph.get_network_id(end);
+    NetworkId start_net = graph.get_network_id(start);
+    NetworkId end_net = graph.get_network_id(end);
 
     if (start_net == 0 || end_net == 0 || start_net != end_net) {
         // Different networks or not in graph -> no path possible
-        return result;
+        return;
     }
 
-    // A* data structures
-    struct AStarNode {
-        GridPosition pos;
-        uint32_t g_cost;     // cost from start
-        uint32_t f_cost;     // g_cost + heuristic
-        bool operator>(const AStarNode& other) const { return f_cost > other.f_cost; }
-    };
-
-    // Open set: min-heap by f_cost
-    std::priority_queue<AStarNode, std::vector<AStarNode>, std::greater<AStarNode>> open_set;
-
-    // g_cost for each visited position
-    std::unordered_map<uint64_t, uint32_t> g_costs;
-
-    // Parent tracking for path reconstruction
-    std::unordered_map<uint64_t, uint64_t> came_from;
+    begin_search(grid);
+    min_step_cost_ = (cost_plane_ != nullptr && cost_plane_->min_cost() != 0)
+                         ? cost_plane_->min_cost()
+                         : 10;
+    const uint32_t gen = generation_;
+    const uint32_t width = width_;
 
-    // Closed set
-    std::unordered_map<uint64_t, bool> closed;
+    const uint32_t start_tile = static_cast<uint32_t>(start.y) * width + static_cast<uint32_t>(start.x);
+    const uint32_t end_tile = static_cast<uint32_t>(end.y) * width + static_cast<uint32_t>(end.x);
 
-    // Initialize start node
-    uint64_t start_key = pack_pos(start.x, start.y);
-    uint64_t end_key = pack_pos(end.x, end.y);
-
-    uint32_t h = heuristic(start, end);
-    open_set.push({start, 0, h});
-    g_costs[start_key] = 0;
+    seen_stamp_[start_tile] = gen;
+    g_cost_[start_tile] = 0;
+    parent_[start_tile] = start_tile;
+    heap_push({heuristic(start, end), 0, start_tile});
 
     // Cardinal directions: N, S, E, W
     static const int32_t dx[] = { 0, 0, 1, -1 };
     static const int32_t dy[] = { -1, 1, 0, 0 };
 
-    while (!open_set.empty()) {
-        AStarNode current = open_set.top();
-        open_set.pop();
-
-        uint64_t current_key = pack_pos(current.pos.x, current.pos.y);
+    while (!heap_.empty()) {
+        const HeapEntry current = heap_pop();
 
-        // Skip if already processed
-        if (closed.count(current_key) > 0) {
+        // Skip stale entries and already-expanded tiles
+        if (closed_stamp_[current.tile] == gen || current.g_cost != g_cost_[current.tile]) {
             continue;
         }
-        closed[current_key] = true;
+        closed_stamp_[current.tile] = gen;
 
         // Check if we reached the goal
-        if (current_key == end_key) {
-            // Reconstruct path
+        if (current.tile == end_tile) {
             result.found = true;
             result.total_cost = current.g_cost;
 
-            // Build path by following came_from chain
-            std::vector<GridPosition> reversed_path;
-            uint64_t trace = current_key;
-
+            // Follow parents back to start, then reverse in place
+            uint32_t trace = current.tile;
             while (true) {
-                int32_t tx = static_cast<int32_t>(static_cast<uint32_t>(trace & 0xFFFFFFFF));
-                int32_t ty = static_cast<int32_t>(static_cast<uint32_t>(trace >> 32));
-                reversed_path.push_back({tx, ty});
-
-                auto it = came_from.find(trace);
-                if (it == came_from.end()) {
+                result.path.push_back({static_cast<int32_t>(trace % width),
+                                       static_cast<int32_t>(trace / width)});
+                if (trace == start_tile) {
                     break;
                 }
-                trace = it->second;
-            }
-
-            // Reverse to get start-to-end order
-            result.path.reserve(reversed_path.size());
-            for (auto it = reversed_path.rbegin(); it != reversed_path.rend(); ++it) {
-                result.path.push_back(*it);
+                trace = parent_[trace];
             }
-
-            return result;
+            std::reverse(result.path.begin(), result.path.end());
+            heap_.clear();
+            return;
         }
 
+        const GridPosition current_pos{static_cast<int32_t>(current.tile % width),
+                                       static_cast<int32_t>(current.tile / width)};
+
         // Explore neighbors
         for (int i = 0; i < 4; ++i) {
-            int32_t nx = current.pos.x + dx[i];
-            int32_t ny = current.pos.y + dy[i];
+            int32_t nx = current_pos.x + dx[i];
+            int32_t ny = current_pos.y + dy[i];
 
-            // Must be a pathway tile
+            // Must be a pathway tile (also rejects out-of-bounds)
             if (!grid.has_pathway(nx, ny)) {
                 continue;
             }
 
-            uint64_t neighbor_key = pack_pos(nx, ny);
+            const uint32_t neighbor = static_cast<uint32_t>(ny) * width + static_cast<uint32_t>(nx);
 
             // Skip if already in closed set
-            if (closed.count(neighbor_key) > 0) {
+            if (closed_stamp_[neighbor] == gen) {
                 continue;
             }
 
             GridPosition neighbor_pos{nx, ny};
-            uint32_t tentative_g = current.g_cost + edge_cost(current.pos, neighbor_pos);
+            uint32_t tentative_g = current.g_cost + edge_cost(current_pos, neighbor_pos);
 
             // Check if this is a better path
-            auto it = g_costs.find(neighbor_key);
-            if (it != g_costs.end() && tentative_g >= it->second) {
+            if (seen_stamp_[neighbor] == gen && tentative_g >= g_cost_[neighbor]) {
                 continue;
             }
 
             // Update best path
-            g_costs[neighbor_key] = tentative_g;
-            came_from[neighbor_key] = current_key;
+            seen_stamp_[neighbor] = gen;
+            g_cost_[neighbor] = tentative_g;
+            parent_[neighbor] = current.tile;
 
-            uint32_t f = tentative_g + heuristic(neighbor_pos, end);
-            open_set.push({neighbor_pos, tentative_g, f});
+            heap_push({tentative_g + heuristic(neighbor_pos, end), tentative_g, neighbor});
         }
     }
 
-    // No path found
-    return result;
+    // No path found (heap is already empty)
+}
+
+void Pathfinding::begin_search(const PathwayGrid& grid) {
+    const size_t tiles = static_cast<size_t>(grid.width()) * grid.height();
+    if (grid.width() != width_ || seen_stamp_.size() < tiles) {
+        // Layout changed: stale stamps would alias different tiles
+        width_ = grid.width();
+        seen_stamp_.assign(tiles, 0);
+        closed_stamp_.assign(tiles, 0);
+        g_cost_.resize(tiles);
+        parent_.resize(tiles);
+        generation_ = 0;
+    }
+
+    if (++generation_ == 0) {
+        // Stamp wrapped around; reset so old stamps cannot match
+        std::fill(seen_stamp_.begin(), seen_stamp_.end(), 0u);
+        std::fill(closed_stamp_.begin(), closed_stamp_.end(), 0u);
+        generation_ = 1;
+    }
+    heap_.clear();
+}
+
+// =============================================================================
+// 4-ary heap
+// =============================================================================
+
+void Pathfinding::heap_push(const HeapEntry& entry) {
+    size_t pos = heap_.size();
+    heap_.push_back(entry);
+    while (pos > 0) {
+        const size_t parent = (pos - 1) / HEAP_ARITY;
+        if (!heap_less(entry, heap_[parent])) {
+            break;
+        }
+        heap_[pos] = heap_[parent];
+        pos = parent;
+    }
+    heap_[pos] = entry;
+}
+
+Pathfinding::HeapEntry Pathfinding::heap_pop() {
+    const HeapEntry top = heap_.front();
+    const HeapEntry last = heap_.back();
+    heap_.pop_back();
+
+    const size_t size = heap_.size();
+    if (size == 0) {
+        return top;
+    }
+
+    // Sift the former last entry down from the root
+    size_t pos = 0;
+    while (true) {
+        const size_t first_child = pos * HEAP_ARITY + 1;
+        if (first_child >= size) {
+            break;
+        }
+        const size_t last_child = std::min(first_child + HEAP_ARITY, size);
+        size_t best = first_child;
+        for (size_t c = first_child + 1; c < last_child; ++c) {
+            if (heap_less(heap_[c], heap_[best])) {
+                best = c;
+            }
+        }
+        if (!heap_less(heap_[best], last)) {
+            break;
+        }
+        heap_[pos] = heap_[best];
+        pos = best;
+    }
+    heap_[pos] = last;
+    return top;
 }
 
 // =============================================================================
 // Heuristic and cost
 // =============================================================================
 
-uint32_t Pathfinding::heuristic(const GridPosition& a, const GridPosition& b) {
-    // Manhattan distance * base edge cost (10)
+uint32_t Pathfinding::heuristic(const GridPosition& a, const GridPosition& b) const {
+    // Manhattan distance * cheapest possible step (admissible)
     uint32_t dx = static_cast<uint32_t>(std::abs(a.x - b.x));
     uint32_t dy = static_cast<uint32_t>(std::abs(a.y - b.y));
-    return (dx + dy) * 10;
+    return (dx + dy) * min_step_cost_;
 }
 
-uint32_t Pathfinding::edge_cost(const GridPosition& /*from*/, const GridPosition& /*to*/) {
-    // Base cost = 10 per step. E7-024 will enhance this.
-    return 10;
+uint32_t Pathfinding::edge_cost(const GridPosition& /*from*/, const GridPosition& to) const {
+    if (cost_plane_ == nullptr) {
+        // Base cost = 10 per step
+        return 10;
+    }
+    // Cost of entering the destination; unset tiles cost the minimum
+    const uint16_t cost = cost_plane_->get_cost(to.x, to.y);
+    return cost != 0 ? cost : min_step_cost_;
 }
 
 } // namespace transport
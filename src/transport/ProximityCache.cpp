@@ -8,6 +8,7 @@
 
 #include <sims3000/transport/ProximityCache.h>
 #include <sims3000/transport/PathwayGrid.h>
+#include <algorithm>
 #include <queue>
 
 namespace sims3000 {
@@ -15,6 +16,7 @@ namespace transport {
 
 ProximityCache::ProximityCache(uint32_t width, uint32_t height)
     : distance_cache_(static_cast<size_t>(width) * height, 255)
+    , affected_(static_cast<size_t>(width) * height, 0)
     , dirty_(true)
     , width_(width)
     , height_(height)
@@ -34,6 +36,10 @@ uint8_t ProximityCache::get_distance(int32_t x, int32_t y) const {
     return distance_cache_[static_cast<size_t>(y) * width_ + static_cast<size_t>(x)];
 }
 
+const uint8_t* ProximityCache::get_distance_data() const {
+    return distance_cache_.data();
+}
+
 // ============================================================================
 // Rebuild
 // ============================================================================
@@ -106,6 +112,154 @@ void ProximityCache::rebuild(const PathwayGrid& grid) {
     dirty_ = false;
 }
 
+// ============================================================================
+// Incremental updates
+// ============================================================================
+
+void ProximityCache::on_pathway_added(int32_t x, int32_t y) {
+    if (dirty_ || x < 0 || y < 0
+        || static_cast<uint32_t>(x) >= width_
+        || static_cast<uint32_t>(y) >= height_) {
+        return;
+    }
+
+    const uint32_t start = static_cast<uint32_t>(y) * width_ + static_cast<uint32_t>(x);
+    if (distance_cache_[start] == 0) {
+        return;
+    }
+    distance_cache_[start] = 0;
+
+    // BFS outward while distances keep improving
+    queue_.clear();
+    queue_.push_back(start);
+    for (size_t head = 0; head < queue_.size(); ++head) {
+        const uint32_t current = queue_[head];
+        const uint8_t current_dist = distance_cache_[current];
+        if (current_dist >= MAX_TRACKED_DISTANCE) {
+            continue;
+        }
+        const uint8_t next_dist = current_dist + 1;
+        const uint32_t cx = current % width_;
+        const uint32_t cy = current / width_;
+
+        const uint32_t neighbors[4] = {
+            cy > 0 ? current - width_ : UINT32_MAX,
+            cy + 1 < height_ ? current + width_ : UINT32_MAX,
+            cx + 1 < width_ ? current + 1 : UINT32_MAX,
+            cx > 0 ? current - 1 : UINT32_MAX
+        };
+        for (uint32_t n : neighbors) {
+            if (n != UINT32_MAX && distance_cache_[n] > next_dist) {
+                distance_cache_[n] = next_dist;
+                queue_.push_back(n);
+            }
+        }
+    }
+}
+
+void ProximityCache::on_pathway_removed(int32_t x, int32_t y) {
+    if (dirty_ || x < 0 || y < 0
+        || static_cast<uint32_t>(x) >= width_
+        || static_cast<uint32_t>(y) >= height_) {
+        return;
+    }
+
+    const uint32_t start = static_cast<uint32_t>(y) * width_ + static_cast<uint32_t>(x);
+    if (distance_cache_[start] != 0) {
+        return;
+    }
+
+    // Step 1: collect the tiles the removed pathway could have been
+    // nearest to. Such a tile's distance equals its Manhattan distance to
+    // (x, y), and so does that of its neighbour one step closer, so they
+    // form a region reachable by stepping strictly away from (x, y).
+    queue_.clear();
+    queue_.push_back(start);
+    affected_[start] = 1;
+    for (size_t head = 0; head < queue_.size(); ++head) {
+        const uint32_t current = queue_[head];
+        const uint8_t current_dist = distance_cache_[current];
+        if (current_dist >= MAX_TRACKED_DISTANCE) {
+            continue;
+        }
+        const uint8_t next_dist = current_dist + 1;
+        const int32_t cx = static_cast<int32_t>(current % width_);
+        const int32_t cy = static_cast<int32_t>(current / width_);
+
+        // Only neighbours farther from (x, y) than current
+        const bool away_n = cy <= y && cy > 0;
+        const bool away_s = cy >= y && static_cast<uint32_t>(cy) + 1 < height_;
+        const bool away_e = cx >= x && static_cast<uint32_t>(cx) + 1 < width_;
+        const bool away_w = cx <= x && cx > 0;
+        const uint32_t neighbors[4] = {
+            away_n ? current - width_ : UINT32_MAX,
+            away_s ? current + width_ : UINT32_MAX,
+            away_e ? current + 1 : UINT32_MAX,
+            away_w ? current - 1 : UINT32_MAX
+        };
+        for (uint32_t n : neighbors) {
+            if (n != UINT32_MAX && !affected_[n] && distance_cache_[n] == next_dist) {
+                affected_[n] = 1;
+                queue_.push_back(n);
+            }
+        }
+    }
+
+    // Step 2: seed each affected tile from its unaffected neighbours,
+    // whose distances are still exact
+    for (uint32_t tile : queue_) {
+        const uint32_t tx = tile % width_;
+        const uint32_t ty = tile / width_;
+        const uint32_t neighbors[4] = {
+            ty > 0 ? tile - width_ : UINT32_MAX,
+            ty + 1 < height_ ? tile + width_ : UINT32_MAX,
+            tx + 1 < width_ ? tile + 1 : UINT32_MAX,
+            tx > 0 ? tile - 1 : UINT32_MAX
+        };
+        uint8_t best = 255;
+        for (uint32_t n : neighbors) {
+            if (n != UINT32_MAX && !affected_[n] && distance_cache_[n] < MAX_TRACKED_DISTANCE) {
+                best = std::min<uint8_t>(best, distance_cache_[n] + 1);
+            }
+        }
+        distance_cache_[tile] = best;
+        if (best != 255) {
+            buckets_[best].push_back(tile);
+        }
+    }
+
+    // Step 3: settle the affected region in increasing distance order
+    for (uint32_t dist = 1; dist <= MAX_TRACKED_DISTANCE; ++dist) {
+        std::vector<uint32_t>& bucket = buckets_[dist];
+        for (size_t i = 0; i < bucket.size(); ++i) {
+            const uint32_t tile = bucket[i];
+            if (distance_cache_[tile] != dist || dist == MAX_TRACKED_DISTANCE) {
+                continue;
+            }
+            const uint8_t next_dist = static_cast<uint8_t>(dist + 1);
+            const uint32_t tx = tile % width_;
+            const uint32_t ty = tile / width_;
+            const uint32_t neighbors[4] = {
+                ty > 0 ? tile - width_ : UINT32_MAX,
+                ty + 1 < height_ ? tile + width_ : UINT32_MAX,
+                tx + 1 < width_ ? tile + 1 : UINT32_MAX,
+                tx > 0 ? tile - 1 : UINT32_MAX
+            };
+            for (uint32_t n : neighbors) {
+                if (n != UINT32_MAX && affected_[n] && distance_cache_[n] > next_dist) {
+                    distance_cache_[n] = next_dist;
+                    buckets_[next_dist].push_back(n);
+                }
+            }
+        }
+        bucket.clear();
+    }
+
+    for (uint32_t tile : queue_) {
+        affected_[tile] = 0;
+    }
+}
+
 // ============================================================================
 // Dirty tracking
 // ============================================================================
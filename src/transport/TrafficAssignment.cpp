@@ -0,0 +1,434 @@
+/**
+ * @file TrafficAssignment.cpp
+ * @brief Origin-destination traffic assignment implementation
+ *
+ * Each origin tree is a node-weighted Dijkstra over the snapshotted CSR
+ * adjacency. Trips are loaded onto the tree by walking the settled nodes
+ * in reverse settle order and pushing each node's load to its parent, so
+ * loading an origin is O(nodes) however many destinations it has.
+ *
+ * @see TrafficAssignment.h for class documentation.
+ */
+
+#include <sims3000/transport/TrafficAssignment.h>
+#include <sims3000/sim/TaskScheduler.h>
+#include <algorithm>
+#include <chrono>
+
+namespace sims3000 {
+namespace transport {
+
+/// Bisection steps of the Frank-Wolfe line search (step resolution 2^-20)
+static constexpr int LINE_SEARCH_STEPS = 20;
+
+// =============================================================================
+// Configuration
+// =============================================================================
+
+void TrafficAssignment::set_config(const TrafficAssignmentConfig& config) {
+    config_ = config;
+    if (config_.iterations == 0) {
+        config_.iterations = 1;
+    }
+}
+
+const TrafficAssignmentConfig& TrafficAssignment::get_config() const {
+    return config_;
+}
+
+void TrafficAssignment::set_task_scheduler(sim::TaskScheduler* scheduler) {
+    scheduler_ = scheduler;
+}
+
+// =============================================================================
+// Round setup
+// =============================================================================
+
+void TrafficAssignment::begin_round(const NetworkGraph& graph,
+                                    const std::vector<uint32_t>& free_flow_cost,
+                                    const std::vector<uint32_t>& capacity,
+                                    const std::vector<TripZone>& origins,
+                                    const std::vector<TripZone>& destinations) {
+    const uint32_t node_count = static_cast<uint32_t>(graph.node_count());
+
+    // Snapshot the graph so edits during the round cannot disturb it
+    positions_.resize(node_count);
+    offsets_.resize(static_cast<size_t>(node_count) + 1);
+    neighbors_.clear();
+    free_flow_.resize(node_count);
+    capacity_.resize(node_count);
+    offsets_[0] = 0;
+    for (uint32_t n = 0; n < node_count; ++n) {
+        const NetworkNode node = graph.get_node(n);
+        positions_[n] = node.position;
+        for (NodeIndex neighbor : node.neighbor_indices) {
+            neighbors_.push_back(neighbor);
+        }
+        offsets_[n + 1] = static_cast<uint32_t>(neighbors_.size());
+        const uint32_t t0 = n < free_flow_cost.size() ? free_flow_cost[n] : 0;
+        const uint32_t cap = n < capacity.size() ? capacity[n] : 0;
+        free_flow_[n] = static_cast<float>(std::max<uint32_t>(t0, 1));
+        capacity_[n] = static_cast<float>(std::max<uint32_t>(cap, 1));
+    }
+
+    // Merge destinations by node and sort them by network so each origin
+    // only visits the destinations it can reach.
+    struct Attraction {
+        NetworkId network;
+        uint32_t node;
+        uint64_t weight;
+    };
+    std::vector<Attraction> attractions;
+    attractions.reserve(destinations.size());
+    for (const TripZone& zone : destinations) {
+        const NodeIndex node = graph.get_node_index(zone.access);
+        if (node == INVALID_NODE_INDEX || zone.trips == 0) {
+            continue;
+        }
+        attractions.push_back({graph.get_network_id(zone.access), node, zone.trips});
+    }
+    std::sort(attractions.begin(), attractions.end(),
+              [](const Attraction& a, const Attraction& b) {
+                  return a.network < b.network || (a.network == b.network && a.node < b.node);
+              });
+    size_t merged = 0;
+    for (size_t i = 0; i < attractions.size(); ++i) {
+        if (merged > 0 && attractions[merged - 1].node == attractions[i].node) {
+            attractions[merged - 1].weight += attractions[i].weight;
+        } else {
+            attractions[merged++] = attractions[i];
+        }
+    }
+    attractions.resize(merged);
+
+    // Merge origins by node (one tree per access tile), in node order
+    struct Production {
+        uint32_t node;
+        uint64_t trips;
+    };
+    std::vector<Production> productions;
+    productions.reserve(origins.size());
+    for (const TripZone& zone : origins) {
+        const NodeIndex node = graph.get_node_index(zone.access);
+        if (node == INVALID_NODE_INDEX || zone.trips == 0) {
+            continue;
+        }
+        productions.push_back({node, zone.trips});
+    }
+    std::sort(productions.begin(), productions.end(),
+              [](const Production& a, const Production& b) { return a.node < b.node; });
+
+    // Gravity split: T_ij = P_i * A_j / sum(A) over j in i's network
+    origin_nodes_.clear();
+    demand_offsets_.assign(1, 0);
+    demand_nodes_.clear();
+    demand_trips_.clear();
+    for (size_t i = 0; i < productions.size(); ++i) {
+        const uint32_t node = productions[i].node;
+        uint64_t trips = productions[i].trips;
+        while (i + 1 < productions.size() && productions[i + 1].node == node) {
+            trips += productions[++i].trips;
+        }
+
+        const NetworkId network = graph.get_network_id(positions_[node]);
+        auto first = std::lower_bound(attractions.begin(), attractions.end(), network,
+                                      [](const Attraction& a, NetworkId id) { return a.network < id; });
+        auto last = first;
+        uint64_t total_weight = 0;
+        while (last != attractions.end() && last->network == network) {
+            total_weight += last->weight;
+            ++last;
+        }
+        if (network == 0 || total_weight == 0) {
+            continue;
+        }
+
+        const double scale = static_cast<double>(trips) * static_cast<double>(TRIP_SCALE)
+                             / static_cast<double>(total_weight);
+        for (auto it = first; it != last; ++it) {
+            const uint64_t share = static_cast<uint64_t>(static_cast<double>(it->weight) * scale + 0.5);
+            if (share != 0) {
+                demand_nodes_.push_back(it->node);
+                demand_trips_.push_back(share);
+            }
+        }
+        if (demand_nodes_.size() > demand_offsets_.back()) {
+            origin_nodes_.push_back(node);
+            demand_offsets_.push_back(static_cast<uint32_t>(demand_nodes_.size()));
+        }
+    }
+
+    // One scratch slot per thread that can grow trees concurrently
+    const size_t slot_count = scheduler_ != nullptr ? scheduler_->worker_count() + 1u : 1u;
+    slots_.resize(slot_count);
+    for (Slot& slot : slots_) {
+        if (slot.stamp.size() != node_count) {
+            slot.dist.resize(node_count);
+            slot.parent.resize(node_count);
+            slot.load.resize(node_count);
+            slot.stamp.assign(node_count, 0);
+            slot.generation = 0;
+        }
+        slot.aux.resize(node_count);
+    }
+
+    volume_.assign(node_count, 0.0);
+    target_.resize(node_count);
+    cost_.resize(node_count);
+    iteration_ = 0;
+    running_ = true;
+    begin_iteration();
+}
+
+// =============================================================================
+// Stepping
+// =============================================================================
+
+bool TrafficAssignment::step() {
+    if (!running_) {
+        return false;
+    }
+
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point start = Clock::now();
+    const uint32_t origin_count = static_cast<uint32_t>(origin_nodes_.size());
+    const uint32_t slot_count = static_cast<uint32_t>(slots_.size());
+    uint32_t grown = 0;
+
+    while (true) {
+        if (next_origin_ == origin_count) {
+            finish_iteration();
+            if (!running_) {
+                return true;
+            }
+            continue;
+        }
+
+        // A batch of at most slot_count consecutive origins maps each
+        // origin to a distinct slot, and every slot sees its origins in
+        // ascending order however the round is sliced.
+        uint32_t batch = std::min(slot_count, origin_count - next_origin_);
+        if (config_.max_origins_per_step != 0) {
+            if (grown == config_.max_origins_per_step) {
+                return false;
+            }
+            batch = std::min(batch, config_.max_origins_per_step - grown);
+        }
+
+        const uint32_t first = next_origin_;
+        if (scheduler_ != nullptr && batch > 1) {
+            scheduler_->parallel_for(batch, [this, first, slot_count](size_t i) {
+                const uint32_t origin = first + static_cast<uint32_t>(i);
+                grow_tree(origin, slots_[origin % slot_count]);
+            });
+        } else {
+            for (uint32_t i = 0; i < batch; ++i) {
+                grow_tree(first + i, slots_[(first + i) % slot_count]);
+            }
+        }
+        next_origin_ += batch;
+        grown += batch;
+
+        if (config_.time_budget_us != 0) {
+            const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                Clock::now() - start);
+            if (elapsed.count() >= static_cast<long long>(config_.time_budget_us)) {
+                return false;
+            }
+        }
+    }
+}
+
+void TrafficAssignment::begin_iteration() {
+    const size_t node_count = volume_.size();
+    for (size_t n = 0; n < node_count; ++n) {
+        cost_[n] = static_cast<float>(node_cost(static_cast<uint32_t>(n), volume_[n]));
+    }
+    for (Slot& slot : slots_) {
+        std::fill(slot.aux.begin(), slot.aux.end(), 0u);
+    }
+    next_origin_ = 0;
+}
+
+void TrafficAssignment::finish_iteration() {
+    const size_t node_count = volume_.size();
+
+    // Reduce slot loads; integer sums are exact in any order
+    for (size_t n = 0; n < node_count; ++n) {
+        uint64_t total = 0;
+        for (const Slot& slot : slots_) {
+            total += slot.aux[n];
+        }
+        target_[n] = static_cast<double>(total) / static_cast<double>(TRIP_SCALE);
+    }
+
+    double lambda = 1.0;
+    if (iteration_ > 0) {
+        // Relative gap at the current volumes (costs were priced at volume_)
+        double current_cost = 0.0;
+        double target_cost = 0.0;
+        for (size_t n = 0; n < node_count; ++n) {
+            current_cost += static_cast<double>(cost_[n]) * volume_[n];
+            target_cost += static_cast<double>(cost_[n]) * target_[n];
+        }
+        relative_gap_ = current_cost > 0.0 ? (current_cost - target_cost) / current_cost : 0.0;
+
+        // Line search: the Beckmann objective along volume_ -> target_ is
+        // convex, so bisect on the sign of its derivative.
+        auto slope = [this, node_count](double step) {
+            double sum = 0.0;
+            for (size_t n = 0; n < node_count; ++n) {
+                const double d = target_[n] - volume_[n];
+                if (d != 0.0) {
+                    sum += d * node_cost(static_cast<uint32_t>(n), volume_[n] + step * d);
+                }
+            }
+            return sum;
+        };
+        if (slope(0.0) >= 0.0) {
+            lambda = 0.0;
+        } else if (slope(1.0) > 0.0) {
+            double low = 0.0;
+            double high = 1.0;
+            for (int i = 0; i < LINE_SEARCH_STEPS; ++i) {
+                const double mid = 0.5 * (low + high);
+                if (slope(mid) > 0.0) {
+                    high = mid;
+                } else {
+                    low = mid;
+                }
+            }
+            lambda = 0.5 * (low + high);
+        }
+    } else {
+        relative_gap_ = 0.0;
+    }
+
+    for (size_t n = 0; n < node_count; ++n) {
+        volume_[n] += lambda * (target_[n] - volume_[n]);
+    }
+
+    if (++iteration_ < config_.iterations) {
+        begin_iteration();
+        return;
+    }
+
+    // Publish
+    result_positions_.clear();
+    result_volumes_.clear();
+    for (size_t n = 0; n < node_count; ++n) {
+        const uint32_t volume = static_cast<uint32_t>(volume_[n] + 0.5);
+        if (volume != 0) {
+            result_positions_.push_back(positions_[n]);
+            result_volumes_.push_back(volume);
+        }
+    }
+    running_ = false;
+    ++round_count_;
+}
+
+// =============================================================================
+// Origin trees
+// =============================================================================
+
+void TrafficAssignment::grow_tree(uint32_t origin, Slot& slot) {
+    if (++slot.generation == 0) {
+        // Stamp wrapped around; reset so old stamps cannot match
+        std::fill(slot.stamp.begin(), slot.stamp.end(), 0u);
+        slot.generation = 1;
+    }
+    const uint32_t gen = slot.generation;
+    const uint32_t source = origin_nodes_[origin];
+
+    slot.order.clear();
+    slot.heap.clear();
+    slot.stamp[source] = gen;
+    slot.dist[source] = 0.0f;
+    slot.parent[source] = source;
+    slot.heap.push_back({0.0f, source});
+
+    // Node-weighted Dijkstra: entering a node costs cost_[node]
+    while (!slot.heap.empty()) {
+        std::pop_heap(slot.heap.begin(), slot.heap.end(), heap_after);
+        const HeapEntry current = slot.heap.back();
+        slot.heap.pop_back();
+        if (current.dist != slot.dist[current.node]) {
+            continue;  // stale entry; costs are positive so settled nodes never improve
+        }
+        slot.order.push_back(current.node);
+
+        for (uint32_t e = offsets_[current.node]; e < offsets_[current.node + 1]; ++e) {
+            const uint32_t next = neighbors_[e];
+            const float dist = current.dist + cost_[next];
+            if (slot.stamp[next] == gen && dist >= slot.dist[next]) {
+                continue;
+            }
+            slot.stamp[next] = gen;
+            slot.dist[next] = dist;
+            slot.parent[next] = current.node;
+            slot.heap.push_back({dist, next});
+            std::push_heap(slot.heap.begin(), slot.heap.end(), heap_after);
+        }
+    }
+
+    // Load trips: destinations hold their demand, then every node hands its
+    // subtree total to its parent in reverse settle order.
+    for (uint32_t node : slot.order) {
+        slot.load[node] = 0;
+    }
+    for (uint32_t k = demand_offsets_[origin]; k < demand_offsets_[origin + 1]; ++k) {
+        if (slot.stamp[demand_nodes_[k]] == gen) {
+            slot.load[demand_nodes_[k]] += demand_trips_[k];
+        }
+    }
+    for (size_t i = slot.order.size(); i-- > 0;) {
+        const uint32_t node = slot.order[i];
+        const uint64_t load = slot.load[node];
+        slot.aux[node] += load;
+        if (node != source) {
+            slot.load[slot.parent[node]] += load;
+        }
+    }
+}
+
+double TrafficAssignment::node_cost(uint32_t node, double volume) const {
+    const double ratio = volume / static_cast<double>(capacity_[node]);
+    const double ratio2 = ratio * ratio;
+    return static_cast<double>(free_flow_[node])
+           * (1.0 + static_cast<double>(config_.bpr_alpha) * ratio2 * ratio2);
+}
+
+bool TrafficAssignment::heap_after(const HeapEntry& a, const HeapEntry& b) {
+    return a.dist > b.dist || (a.dist == b.dist && a.node > b.node);
+}
+
+// =============================================================================
+// Queries
+// =============================================================================
+
+bool TrafficAssignment::is_running() const {
+    return running_;
+}
+
+uint32_t TrafficAssignment::get_iteration() const {
+    return iteration_;
+}
+
+uint32_t TrafficAssignment::get_round_count() const {
+    return round_count_;
+}
+
+double TrafficAssignment::get_relative_gap() const {
+    return relative_gap_;
+}
+
+const std::vector<GridPosition>& TrafficAssignment::get_result_positions() const {
+    return result_positions_;
+}
+
+const std::vector<uint32_t>& TrafficAssignment::get_result_volumes() const {
+    return result_volumes_;
+}
+
+} // namespace transport
+} // namespace sims3000
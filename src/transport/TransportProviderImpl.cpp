@@ -134,7 +134,9 @@ std::uint16_t TransportProviderImpl::get_network_id_at(std::int32_t x, std::int3
     if (!grid_ || !graph_) {
         return 0;
     }
-    return connectivity_.get_network_id_at(*grid_, *graph_, x, y);
+    // The provider interface carries 16-bit IDs; connectivity checks
+    // (are_connected) compare the full 32-bit IDs from the graph
+    return static_cast<std::uint16_t>(connectivity_.get_network_id_at(*grid_, *graph_, x, y));
 }
 
 } // namespace transport
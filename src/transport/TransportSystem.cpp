@@ -5,7 +5,7 @@
  * Ties all transport subsystems together with a 6-phase tick loop:
  * 1. Rebuild network graph + proximity cache if dirty
  * 2. Clear previous tick flow
- * 3. Propagate flow (diffusion model)
+ * 3. Propagate flow (diffusion model), then advance trip assignment
  * 4. Calculate congestion from flow vs capacity
  * 5. Apply decay (every 100 ticks)
  * 6. Emit events (clear at tick start)
@@ -14,7 +14,7 @@
  */
 
 #include <sims3000/transport/TransportSystem.h>
-#include <sims3000/transport/FlowDistribution.h>
+#include <algorithm>
 
 namespace sims3000 {
 namespace transport {
@@ -28,11 +28,17 @@ TransportSystem::TransportSystem(uint32_t map_width, uint32_t map_height)
     , map_height_(map_height)
     , pathway_grid_(map_width, map_height)
     , proximity_cache_(map_width, map_height)
+    , route_planner_(map_width, map_height)
+    , edge_costs_(map_width, map_height)
+    , flow_plane_(map_width, map_height)
 {
     // Wire up TransportProviderImpl with our internal data
     provider_impl_.set_pathway_grid(&pathway_grid_);
     provider_impl_.set_proximity_cache(&proximity_cache_);
     provider_impl_.set_network_graph(&network_graph_);
+
+    weighted_pathfinder_.set_cost_plane(&edge_costs_);
+    path_cache_.set_map_size(map_width, map_height);
 }
 
 // =============================================================================
@@ -57,6 +63,7 @@ void TransportSystem::tick(float delta_time) {
     phase1_rebuild_if_dirty();
     phase2_clear_flow();
     phase3_propagate_flow();
+    advance_traffic_assignment();
     phase4_calculate_congestion();
     phase5_apply_decay();
     phase6_emit_events();
@@ -102,17 +109,37 @@ uint32_t TransportSystem::place_pathway(int32_t x, int32_t y, PathwayType type,
     // Create TrafficComponent
     TrafficComponent traffic_comp;
 
-    // Store entity data
-    roads_[entity_id] = road;
-    traffic_[entity_id] = traffic_comp;
-    road_owners_[entity_id] = owner;
-    road_positions_[entity_id] = std::make_pair(x, y);
+    // Append to the packed store; the new flow slot is the same index
+    const uint32_t index = static_cast<uint32_t>(roads_.size());
+    roads_.push_back(road);
+    traffic_.push_back(traffic_comp);
+    road_owners_.push_back(owner);
+    road_positions_.push_back(GridPosition{x, y});
+    road_networks_.push_back(0);
+    road_entities_.push_back(entity_id);
+    if (road_index_.size() <= entity_id) {
+        road_index_.resize(static_cast<size_t>(entity_id) + 1, NO_ROAD_INDEX);
+    }
+    road_index_[entity_id] = index;
+    flow_plane_.add_tile(x, y);
+    refresh_edge_cost(x, y, road, traffic_comp.congestion_level);
 
-    // Place in grid (marks network dirty)
+    // Place in grid (marks network dirty). If the graph was current,
+    // update it in place instead of leaving a full rebuild for phase 1.
+    const bool graph_current = !pathway_grid_.is_network_dirty();
     pathway_grid_.set_pathway(x, y, entity_id);
+    route_planner_.on_pathway_changed(x, y);
+    if (graph_current) {
+        network_graph_.add_pathway_tile(GridPosition{x, y}, &relabeled_positions_);
+        apply_network_relabels();
+        pathway_grid_.mark_network_clean();
+        // The new tile can shorten or connect routes anywhere in its network
+        path_cache_.invalidate_network(network_graph_.get_network_id(GridPosition{x, y}));
+    }
+    path_cache_.invalidate_region(GridPosition{x, y});
 
-    // Mark proximity cache dirty
-    proximity_cache_.mark_dirty();
+    // Lower nearby distances (no-op until the first rebuild)
+    proximity_cache_.on_pathway_added(x, y);
 
     // Emit placed event
     placed_events_.emplace_back(entity_id,
@@ -125,35 +152,41 @@ uint32_t TransportSystem::place_pathway(int32_t x, int32_t y, PathwayType type,
 
 bool TransportSystem::remove_pathway(uint32_t entity_id, int32_t x, int32_t y, uint8_t owner) {
     // Validate entity exists
-    auto it = roads_.find(entity_id);
-    if (it == roads_.end()) {
+    const uint32_t index = road_index_of(entity_id);
+    if (index == NO_ROAD_INDEX) {
         return false;
     }
 
     // Validate ownership
-    auto owner_it = road_owners_.find(entity_id);
-    if (owner_it == road_owners_.end() || owner_it->second != owner) {
+    if (road_owners_[index] != owner) {
         return false;
     }
 
     // Validate position matches
-    auto pos_it = road_positions_.find(entity_id);
-    if (pos_it == road_positions_.end() ||
-        pos_it->second.first != x || pos_it->second.second != y) {
+    if (road_positions_[index].x != x || road_positions_[index].y != y) {
         return false;
     }
 
-    // Clear from grid (marks network dirty)
+    // Clear from grid (marks network dirty), splitting the graph in place
+    // when it was current
+    const bool graph_current = !pathway_grid_.is_network_dirty();
     pathway_grid_.clear_pathway(x, y);
+    route_planner_.on_pathway_changed(x, y);
+    edge_costs_.clear_cost(x, y);
+    if (graph_current) {
+        network_graph_.remove_pathway_tile(GridPosition{x, y}, &relabeled_positions_);
+        apply_network_relabels();
+        pathway_grid_.mark_network_clean();
+    }
+    // Routes that avoid the tile stay walkable and shortest
+    path_cache_.invalidate_region(GridPosition{x, y});
 
-    // Mark proximity cache dirty
-    proximity_cache_.mark_dirty();
+    // Re-evaluate distances the tile supplied (no-op until the first rebuild)
+    proximity_cache_.on_pathway_removed(x, y);
 
-    // Remove entity data
-    roads_.erase(entity_id);
-    traffic_.erase(entity_id);
-    road_owners_.erase(entity_id);
-    road_positions_.erase(entity_id);
+    // Remove entity data; both swap the last entry into the hole
+    flow_plane_.remove_tile(x, y);
+    erase_road(index);
 
     // Emit removed event
     removed_events_.emplace_back(entity_id,
@@ -190,27 +223,19 @@ bool TransportSystem::are_connected(int32_t x1, int32_t y1, int32_t x2, int32_t
 
 float TransportSystem::get_congestion_at(int32_t x, int32_t y) const {
     // Look up entity at position, return congestion from TrafficComponent
-    uint32_t entity_id = pathway_grid_.get_pathway_at(x, y);
-    if (entity_id == 0) {
+    const uint32_t index = road_index_of(pathway_grid_.get_pathway_at(x, y));
+    if (index == NO_ROAD_INDEX) {
         return 0.0f;
     }
-    auto it = traffic_.find(entity_id);
-    if (it == traffic_.end()) {
-        return 0.0f;
-    }
-    return static_cast<float>(it->second.congestion_level) / 255.0f;
+    return static_cast<float>(traffic_[index].congestion_level) / 255.0f;
 }
 
 uint32_t TransportSystem::get_traffic_volume_at(int32_t x, int32_t y) const {
-    uint32_t entity_id = pathway_grid_.get_pathway_at(x, y);
-    if (entity_id == 0) {
+    const uint32_t index = road_index_of(pathway_grid_.get_pathway_at(x, y));
+    if (index == NO_ROAD_INDEX) {
         return 0;
     }
-    auto it = traffic_.find(entity_id);
-    if (it == traffic_.end()) {
-        return 0;
-    }
-    return it->second.flow_current;
+    return traffic_[index].flow_current;
 }
 
 uint16_t TransportSystem::get_network_id_at(int32_t x, int32_t y) const {
@@ -241,6 +266,59 @@ const NetworkGraph& TransportSystem::get_network_graph() const {
     return network_graph_;
 }
 
+// =============================================================================
+// Routing
+// =============================================================================
+
+PathResult TransportSystem::find_path(const GridPosition& start, const GridPosition& end) {
+    if (const PathResult* cached = path_cache_.get(start, end, current_tick_)) {
+        return *cached;
+    }
+    PathResult result = route_planner_.find_path(start, end, pathway_grid_, network_graph_);
+    path_cache_.put(start, end, result, current_tick_, network_graph_);
+    return result;
+}
+
+const PathCache& TransportSystem::get_path_cache() const {
+    return path_cache_;
+}
+
+PathResult TransportSystem::find_weighted_path(const GridPosition& start, const GridPosition& end) {
+    return weighted_pathfinder_.find_path(start, end, pathway_grid_, network_graph_);
+}
+
+const EdgeCostPlane& TransportSystem::get_edge_cost_plane() const {
+    return edge_costs_;
+}
+
+void TransportSystem::refresh_edge_cost(int32_t x, int32_t y, const RoadComponent& road,
+                                        uint8_t congestion_level) {
+    const uint32_t cost = calculate_edge_cost(road.type, congestion_level, road.health);
+    edge_costs_.set_cost(x, y, static_cast<uint16_t>(std::min<uint32_t>(std::max<uint32_t>(cost, 1u), UINT16_MAX)));
+}
+
+// =============================================================================
+// Trip Assignment
+// =============================================================================
+
+void TransportSystem::set_trip_zones(const std::vector<TripZone>& origins,
+                                     const std::vector<TripZone>& destinations) {
+    trip_origins_ = origins;
+    trip_destinations_ = destinations;
+}
+
+void TransportSystem::set_assignment_config(const TrafficAssignmentConfig& config) {
+    traffic_assignment_.set_config(config);
+}
+
+void TransportSystem::set_task_scheduler(sim::TaskScheduler* scheduler) {
+    traffic_assignment_.set_task_scheduler(scheduler);
+}
+
+const TrafficAssignment& TransportSystem::get_traffic_assignment() const {
+    return traffic_assignment_;
+}
+
 // =============================================================================
 // Events
 // =============================================================================
@@ -269,20 +347,16 @@ void TransportSystem::phase1_rebuild_if_dirty() {
     if (pathway_grid_.is_network_dirty()) {
         // Rebuild network graph from grid
         network_graph_.rebuild_from_grid(pathway_grid_);
+        path_cache_.invalidate();
 
         // Mark grid network clean
         pathway_grid_.mark_network_clean();
 
-        // Update road components with network IDs
-        for (auto& pair : roads_) {
-            uint32_t entity_id = pair.first;
-            auto pos_it = road_positions_.find(entity_id);
-            if (pos_it != road_positions_.end()) {
-                GridPosition pos;
-                pos.x = pos_it->second.first;
-                pos.y = pos_it->second.second;
-                pair.second.network_id = network_graph_.get_network_id(pos);
-            }
+        // Update road components with network IDs; RoadComponent only has
+        // 16 bits, so the full ID is kept in road_networks_
+        for (size_t i = 0; i < roads_.size(); ++i) {
+            road_networks_[i] = network_graph_.get_network_id(road_positions_[i]);
+            roads_[i].network_id = static_cast<uint16_t>(road_networks_[i]);
         }
     }
 
@@ -290,63 +364,175 @@ void TransportSystem::phase1_rebuild_if_dirty() {
     proximity_cache_.rebuild_if_dirty(pathway_grid_);
 }
 
-void TransportSystem::phase2_clear_flow() {
-    // Shift current flow to previous, then clear current
-    for (auto& pair : traffic_) {
-        pair.second.flow_previous = pair.second.flow_current;
-        pair.second.flow_current = 0;
+uint32_t TransportSystem::road_index_of(uint32_t entity_id) const {
+    return entity_id < road_index_.size() ? road_index_[entity_id] : NO_ROAD_INDEX;
+}
+
+void TransportSystem::erase_road(uint32_t index) {
+    // Swap-and-pop; the moved road's entity now points at index
+    const uint32_t last = static_cast<uint32_t>(roads_.size() - 1);
+    road_index_[road_entities_[index]] = NO_ROAD_INDEX;
+    if (index != last) {
+        roads_[index] = roads_[last];
+        traffic_[index] = traffic_[last];
+        road_owners_[index] = road_owners_[last];
+        road_positions_[index] = road_positions_[last];
+        road_networks_[index] = road_networks_[last];
+        road_entities_[index] = road_entities_[last];
+        road_index_[road_entities_[index]] = index;
     }
-    // Clear flow accumulator
-    flow_accumulator_.clear();
+    roads_.pop_back();
+    traffic_.pop_back();
+    road_owners_.pop_back();
+    road_positions_.pop_back();
+    road_networks_.pop_back();
+    road_entities_.pop_back();
 }
 
-void TransportSystem::phase3_propagate_flow() {
-    // Skip if no flow to propagate
-    if (flow_accumulator_.empty()) {
-        // Apply any remaining flow from previous tick propagation
-        // Use flow_previous from traffic components as source
-        for (const auto& pair : traffic_) {
-            if (pair.second.flow_previous > 0) {
-                auto pos_it = road_positions_.find(pair.first);
-                if (pos_it != road_positions_.end()) {
-                    uint64_t key = FlowDistribution::pack_position(
-                        pos_it->second.first, pos_it->second.second);
-                    flow_accumulator_[key] = pair.second.flow_previous;
+void TransportSystem::apply_network_relabels() {
+    // Networks that lost tiles to a merge or split; cached routes tagged
+    // with their old IDs would otherwise escape later invalidate_network()
+    NetworkId previous_ids[4] = {};
+    size_t previous_count = 0;
+    bool overflow = false;
+
+    for (const GridPosition& pos : relabeled_positions_) {
+        const uint32_t index = road_index_of(pathway_grid_.get_pathway_at(pos.x, pos.y));
+        if (index != NO_ROAD_INDEX) {
+            const NetworkId old_id = road_networks_[index];
+            if (old_id != 0 &&
+                std::find(previous_ids, previous_ids + previous_count, old_id) ==
+                    previous_ids + previous_count) {
+                if (previous_count < 4) {
+                    previous_ids[previous_count++] = old_id;
+                } else {
+                    overflow = true;
                 }
             }
+            road_networks_[index] = network_graph_.get_network_id(pos);
+            roads_[index].network_id = static_cast<uint16_t>(road_networks_[index]);
         }
     }
+    relabeled_positions_.clear();
+
+    if (overflow) {
+        path_cache_.invalidate();
+        return;
+    }
+    for (size_t i = 0; i < previous_count; ++i) {
+        path_cache_.invalidate_network(previous_ids[i]);
+    }
+}
+
+void TransportSystem::phase2_clear_flow() {
+    // Shift current flow to previous, then clear current
+    for (TrafficComponent& traffic : traffic_) {
+        traffic.flow_previous = traffic.flow_current;
+        traffic.flow_current = 0;
+    }
+}
+
+void TransportSystem::phase3_propagate_flow() {
+    // Seed the plane from last tick's flow; flow slots are store indices
+    const uint32_t count = flow_plane_.tile_count();
+    for (uint32_t slot = 0; slot < count; ++slot) {
+        flow_plane_.set_slot_flow(slot, traffic_[slot].flow_previous);
+    }
 
     // Propagate flow via diffusion
-    flow_propagation_.propagate(flow_accumulator_, pathway_grid_);
-
-    // Write accumulated flow back to TrafficComponents
-    for (const auto& flow_entry : flow_accumulator_) {
-        int32_t fx = FlowDistribution::unpack_x(flow_entry.first);
-        int32_t fy = FlowDistribution::unpack_y(flow_entry.first);
-        uint32_t entity_id = pathway_grid_.get_pathway_at(fx, fy);
-        if (entity_id != 0) {
-            auto it = traffic_.find(entity_id);
-            if (it != traffic_.end()) {
-                it->second.flow_current = flow_entry.second;
+    flow_propagation_.propagate(flow_plane_);
+
+    // Write the result straight back to TrafficComponents
+    for (uint32_t slot = 0; slot < count; ++slot) {
+        traffic_[slot].flow_current = flow_plane_.get_slot_flow(slot);
+    }
+}
+
+void TransportSystem::advance_traffic_assignment() {
+    if (!traffic_assignment_.is_running()) {
+        if (trip_origins_.empty() || trip_destinations_.empty()
+            || pathway_grid_.is_network_dirty()) {
+            return;
+        }
+
+        // Price each graph node at free flow and its current capacity
+        const size_t node_count = network_graph_.node_count();
+        node_free_flow_.resize(node_count);
+        node_capacity_.resize(node_count);
+        for (size_t n = 0; n < node_count; ++n) {
+            const GridPosition pos = network_graph_.get_node(static_cast<NodeIndex>(n)).position;
+            const uint32_t index = road_index_of(pathway_grid_.get_pathway_at(pos.x, pos.y));
+            if (index == NO_ROAD_INDEX) {
+                node_free_flow_[n] = 0;
+                node_capacity_[n] = 0;
+                continue;
             }
+            node_free_flow_[n] = calculate_edge_cost(roads_[index].type, 0, roads_[index].health);
+            node_capacity_[n] = roads_[index].current_capacity;
+        }
+
+        snap_trip_zones(trip_origins_, snapped_origins_);
+        snap_trip_zones(trip_destinations_, snapped_destinations_);
+        traffic_assignment_.begin_round(network_graph_, node_free_flow_, node_capacity_,
+                                        snapped_origins_, snapped_destinations_);
+    }
+
+    if (!traffic_assignment_.step()) {
+        return;
+    }
+
+    // Round finished: its volumes replace the diffused flow on its tiles.
+    // Tiles removed since the round started are skipped.
+    const std::vector<GridPosition>& positions = traffic_assignment_.get_result_positions();
+    const std::vector<uint32_t>& volumes = traffic_assignment_.get_result_volumes();
+    for (size_t i = 0; i < positions.size(); ++i) {
+        const uint32_t index = road_index_of(pathway_grid_.get_pathway_at(positions[i].x, positions[i].y));
+        if (index != NO_ROAD_INDEX) {
+            traffic_[index].flow_current = volumes[i];
         }
     }
 }
 
-void TransportSystem::phase4_calculate_congestion() {
-    for (auto& traffic_pair : traffic_) {
-        uint32_t entity_id = traffic_pair.first;
-        auto road_it = roads_.find(entity_id);
-        if (road_it == roads_.end()) {
+void TransportSystem::snap_trip_zones(const std::vector<TripZone>& zones,
+                                      std::vector<TripZone>& out) const {
+    out.clear();
+    for (const TripZone& zone : zones) {
+        const uint8_t distance = proximity_cache_.get_distance(zone.access.x, zone.access.y);
+        if (distance > TRIP_ACCESS_DISTANCE) {
             continue;
         }
 
-        // Update congestion level
-        CongestionCalculator::update_congestion(traffic_pair.second, road_it->second);
+        // Walk the ring at that Manhattan distance; the cache guarantees a hit
+        const int32_t d = distance;
+        for (int32_t dy = -d; dy <= d; ++dy) {
+            const int32_t rest = d - (dy < 0 ? -dy : dy);
+            const int32_t y = zone.access.y + dy;
+            if (pathway_grid_.has_pathway(zone.access.x - rest, y)) {
+                out.push_back({GridPosition{zone.access.x - rest, y}, zone.trips});
+                break;
+            }
+            if (rest != 0 && pathway_grid_.has_pathway(zone.access.x + rest, y)) {
+                out.push_back({GridPosition{zone.access.x + rest, y}, zone.trips});
+                break;
+            }
+        }
+    }
+}
+
+void TransportSystem::phase4_calculate_congestion() {
+    for (size_t i = 0; i < traffic_.size(); ++i) {
+        TrafficComponent& traffic = traffic_[i];
+
+        // Update congestion level, then the routing cost if it moved
+        const uint8_t before = traffic.congestion_level;
+        CongestionCalculator::update_congestion(traffic, roads_[i]);
+        if (traffic.congestion_level != before) {
+            refresh_edge_cost(road_positions_[i].x, road_positions_[i].y,
+                              roads_[i], traffic.congestion_level);
+        }
 
         // Update blockage ticks
-        CongestionCalculator::update_blockage_ticks(traffic_pair.second);
+        CongestionCalculator::update_blockage_ticks(traffic);
     }
 }
 
@@ -362,39 +548,30 @@ void TransportSystem::phase5_apply_decay() {
     decay_tick_counter_ = 0;
 
     // Apply decay to all roads
-    for (auto& road_pair : roads_) {
-        uint32_t entity_id = road_pair.first;
-
-        // Get optional traffic component
-        const TrafficComponent* traffic_ptr = nullptr;
-        auto traffic_it = traffic_.find(entity_id);
-        if (traffic_it != traffic_.end()) {
-            traffic_ptr = &traffic_it->second;
-        }
+    for (size_t i = 0; i < roads_.size(); ++i) {
+        RoadComponent& road = roads_[i];
+        const TrafficComponent& traffic = traffic_[i];
 
-        // Apply decay, check if threshold crossed
-        bool crossed = PathwayDecay::apply_decay(road_pair.second, traffic_ptr, config);
-
-        if (crossed) {
-            auto pos_it = road_positions_.find(entity_id);
-            if (pos_it != road_positions_.end()) {
-                // Threshold was crossed - could emit PathwayDeterioratedEvent
-                // (event emission handled in phase6 if needed)
-                (void)pos_it;
-            }
-        }
+        // Apply decay; a crossed threshold could emit PathwayDeterioratedEvent
+        // (event emission handled in phase6 if needed)
+        bool crossed = PathwayDecay::apply_decay(road, &traffic, config);
+        (void)crossed;
 
         // Update capacity based on health
         // Capacity scales linearly with health: capacity = base * (health / 255)
-        uint16_t base = road_pair.second.base_capacity;
-        uint8_t health = road_pair.second.health;
-        road_pair.second.current_capacity = static_cast<uint16_t>(
+        uint16_t base = road.base_capacity;
+        uint8_t health = road.health;
+        road.current_capacity = static_cast<uint16_t>(
             (static_cast<uint32_t>(base) * health) / 255
         );
         // Minimum capacity of 1 to avoid division by zero
-        if (road_pair.second.current_capacity == 0 && base > 0) {
-            road_pair.second.current_capacity = 1;
+        if (road.current_capacity == 0 && base > 0) {
+            road.current_capacity = 1;
         }
+
+        // Lower health raises the routing cost
+        refresh_edge_cost(road_positions_[i].x, road_positions_[i].y, road,
+                          traffic.congestion_level);
     }
 }
 
@@ -25,6 +25,7 @@ ZoneSystem::ZoneSystem(terrain::ITerrainQueryable* terrain,
 {
     // Initialize zone info storage (same size as grid)
     m_zone_info.resize(static_cast<std::size_t>(grid_size) * grid_size);
+    m_candidate_slot.assign(m_zone_info.size(), NO_CANDIDATE_SLOT);
 
     // ZoneCounts and ZoneDemandData are zero-initialized by their default constructors
 }
@@ -162,7 +163,14 @@ bool ZoneSystem::set_zone_state(std::int32_t x, std::int32_t y, ZoneState new_st
         }
     }
 
+    const std::size_t index = static_cast<std::size_t>(y) * m_grid_width + static_cast<std::size_t>(x);
+    if (old_state == ZoneState::Designated) {
+        remove_spawn_candidate(index);
+    }
     info->component.setState(new_state);
+    if (new_state == ZoneState::Designated) {
+        add_spawn_candidate(index);
+    }
 
     // Emit state changed event
     std::uint32_t entity_id = m_grid.get_zone_at(x, y);
@@ -190,6 +198,7 @@ bool ZoneSystem::place_zone(std::int32_t x, std::int32_t y,
     info.component.desirability = 0;
     info.player_id = player_id;
     info.valid = true;
+    add_spawn_candidate(index);
 
     // Update counts
     if (player_id < MAX_OVERSEERS) {
@@ -215,6 +224,45 @@ bool ZoneSystem::place_zone(std::int32_t x, std::int32_t y,
     return true;
 }
 
+void ZoneSystem::add_spawn_candidate(std::size_t index) {
+    const ZoneInfo& info = m_zone_info[index];
+    const std::uint8_t type = static_cast<std::uint8_t>(info.component.getZoneType());
+    if (!info.valid || info.player_id >= MAX_OVERSEERS || type >= ZONE_TYPE_COUNT ||
+        m_candidate_slot[index] != NO_CANDIDATE_SLOT) {
+        return;
+    }
+    std::vector<std::uint32_t>& set = m_spawn_candidates[info.player_id][type];
+    m_candidate_slot[index] = static_cast<std::uint32_t>(set.size());
+    set.push_back(static_cast<std::uint32_t>(index));
+}
+
+void ZoneSystem::remove_spawn_candidate(std::size_t index) {
+    const std::uint32_t slot = m_candidate_slot[index];
+    if (slot == NO_CANDIDATE_SLOT) {
+        return;
+    }
+    const ZoneInfo& info = m_zone_info[index];
+    const std::uint8_t type = static_cast<std::uint8_t>(info.component.getZoneType());
+    std::vector<std::uint32_t>& set = m_spawn_candidates[info.player_id][type];
+
+    // Swap with last element and pop (order doesn't matter)
+    const std::uint32_t moved = set.back();
+    set[slot] = moved;
+    m_candidate_slot[moved] = slot;
+    set.pop_back();
+    m_candidate_slot[index] = NO_CANDIDATE_SLOT;
+}
+
+const std::vector<std::uint32_t>& ZoneSystem::get_spawn_candidates(std::uint8_t player_id,
+                                                                   ZoneType type) const {
+    static const std::vector<std::uint32_t> empty;
+    const std::uint8_t type_idx = static_cast<std::uint8_t>(type);
+    if (player_id >= MAX_OVERSEERS || type_idx >= ZONE_TYPE_COUNT) {
+        return empty;
+    }
+    return m_spawn_candidates[player_id][type_idx];
+}
+
 const ZoneCounts& ZoneSystem::get_zone_counts(std::uint8_t player_id) const {
     assert(player_id < MAX_OVERSEERS);
     return m_zone_counts[player_id];
@@ -663,6 +711,8 @@ void ZoneSystem::remove_zone_at(std::int32_t x, std::int32_t y) {
         if (counts.total > 0) --counts.total;
     }
 
+    remove_spawn_candidate(static_cast<std::size_t>(y) * m_grid_width + static_cast<std::size_t>(x));
+
     // Clear zone info
     info->valid = false;
     info->component = ZoneComponent();
@@ -807,8 +857,14 @@ RedesignateResult ZoneSystem::redesignate_zone(std::int32_t x, std::int32_t y,
         }
     }
 
+    // Type decides which candidate set a Designated tile is in
+    const std::size_t index = static_cast<std::size_t>(y) * m_grid_width + static_cast<std::size_t>(x);
+    remove_spawn_candidate(index);
     info->component.setZoneType(new_type);
     info->component.setDensity(new_density);
+    if (state == ZoneState::Designated) {
+        add_spawn_candidate(index);
+    }
 
     return RedesignateResult(true, RedesignateResult::Reason::Ok);
 }
@@ -834,20 +890,15 @@ std::uint32_t ZoneSystem::get_zone_count_for(std::uint8_t player_id, ZoneType ty
 }
 
 std::vector<GridPosition> ZoneSystem::get_designated_zones(std::uint8_t player_id, ZoneType type) const {
-    std::vector<GridPosition> result;
+    // Row-major order, as a grid scan would give
+    std::vector<std::uint32_t> indices = get_spawn_candidates(player_id, type);
+    std::sort(indices.begin(), indices.end());
 
-    std::uint16_t grid_size = m_grid_width;
-    for (std::int32_t y = 0; y < static_cast<std::int32_t>(grid_size); ++y) {
-        for (std::int32_t x = 0; x < static_cast<std::int32_t>(grid_size); ++x) {
-            std::size_t index = static_cast<std::size_t>(y) * m_grid_width + static_cast<std::size_t>(x);
-            const ZoneInfo& info = m_zone_info[index];
-            if (info.valid &&
-                info.player_id == player_id &&
-                info.component.getZoneType() == type &&
-                info.component.getState() == ZoneState::Designated) {
-                result.emplace_back(x, y);
-            }
-        }
+    std::vector<GridPosition> result;
+    result.reserve(indices.size());
+    for (std::uint32_t index : indices) {
+        result.emplace_back(static_cast<std::int32_t>(index % m_grid_width),
+                            static_cast<std::int32_t>(index / m_grid_width));
     }
 
     return result;
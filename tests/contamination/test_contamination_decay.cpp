@@ -9,6 +9,7 @@
  * - Decay rate calculation
  * - Grid decay application
  * - Uniform decay (nullptr tile_info)
+ * - Clean blocks drop out of the activity mask
  */
 
 #include <sims3000/contamination/ContaminationDecay.h>
@@ -290,6 +291,22 @@ TEST(apply_decay_multiple_ticks) {
     ASSERT_EQ(grid.get_level(0, 0), static_cast<uint8_t>(80));
 }
 
+TEST(apply_decay_deactivates_clean_blocks) {
+    ContaminationGrid grid(64, 64);
+    grid.add_contamination(3, 3, 4, 1);    // block (0, 0)
+    grid.add_contamination(40, 50, 9, 2);  // block (2, 3)
+    ASSERT_EQ(grid.get_activity().active_block_count(), 2u);
+
+    // 4 decays to zero after two ticks; 9 survives
+    apply_contamination_decay(grid, nullptr);
+    apply_contamination_decay(grid, nullptr);
+    ASSERT_EQ(grid.get_level(3, 3), static_cast<uint8_t>(0));
+    ASSERT_EQ(grid.get_level(40, 50), static_cast<uint8_t>(5));
+    ASSERT(!grid.get_activity().is_block_active(0, 0));
+    ASSERT(grid.get_activity().is_block_active(2, 3));
+    ASSERT_EQ(grid.get_activity().active_block_count(), 1u);
+}
+
 // =============================================================================
 // Constant Verification Tests
 // =============================================================================
@@ -330,6 +347,7 @@ int main() {
     RUN_TEST(apply_decay_preserves_type_above_zero);
     RUN_TEST(apply_decay_empty_grid);
     RUN_TEST(apply_decay_multiple_ticks);
+    RUN_TEST(apply_decay_deactivates_clean_blocks);
 
     // Constants tests
     RUN_TEST(constants_values);
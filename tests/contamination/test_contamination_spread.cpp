@@ -10,12 +10,14 @@
  * - Reading from previous tick buffer
  * - Bounds checking at grid edges
  * - Multiple sources accumulating correctly
+ * - Vectorized kernel matches the reference scatter on random grids
  */
 
 #include <sims3000/contamination/ContaminationSpread.h>
 #include <sims3000/contamination/ContaminationGrid.h>
 #include <cstdio>
 #include <cstdlib>
+#include <vector>
 
 using namespace sims3000::contamination;
 
@@ -332,6 +334,149 @@ TEST(empty_grid_no_spread) {
     }
 }
 
+// =============================================================================
+// Reference Comparison Tests
+// =============================================================================
+
+/**
+ * Reference scatter implementation: every source at or above the
+ * threshold adds level/8 to its cardinals and level/16 to its diagonals,
+ * and the last source (row-major) to reach a tile sets its type.
+ */
+static void reference_spread(ContaminationGrid& grid) {
+    const int w = grid.get_width();
+    const int h = grid.get_height();
+    std::vector<uint8_t> amount(static_cast<size_t>(w) * h, 0);
+    std::vector<uint8_t> type(static_cast<size_t>(w) * h, 0);
+    const int card[4][2] = {{0, -1}, {0, 1}, {1, 0}, {-1, 0}};
+    const int diag[4][2] = {{1, -1}, {-1, -1}, {1, 1}, {-1, 1}};
+    for (int y = 0; y < h; ++y) {
+        for (int x = 0; x < w; ++x) {
+            const uint8_t level = grid.get_level_previous_tick(x, y);
+            if (level < CONTAM_SPREAD_THRESHOLD) {
+                continue;
+            }
+            const uint8_t t = grid.get_dominant_type_previous_tick(x, y);
+            for (int pass = 0; pass < 2; ++pass) {
+                const int (*offsets)[2] = pass == 0 ? card : diag;
+                const uint8_t share = pass == 0 ? level / 8 : level / 16;
+                for (int i = 0; i < 4; ++i) {
+                    const int nx = x + offsets[i][0];
+                    const int ny = y + offsets[i][1];
+                    if (!grid.is_valid(nx, ny)) {
+                        continue;
+                    }
+                    const size_t idx = static_cast<size_t>(ny) * w + nx;
+                    const int sum = amount[idx] + share;
+                    amount[idx] = static_cast<uint8_t>(sum > 255 ? 255 : sum);
+                    type[idx] = t;
+                }
+            }
+        }
+    }
+    for (int y = 0; y < h; ++y) {
+        for (int x = 0; x < w; ++x) {
+            const size_t idx = static_cast<size_t>(y) * w + x;
+            if (amount[idx] > 0) {
+                grid.add_contamination(x, y, amount[idx], type[idx]);
+            }
+        }
+    }
+}
+
+/// Fill both buffers of two identical grids with pseudo-random data.
+static void fill_random(ContaminationGrid& a, ContaminationGrid& b, uint32_t seed) {
+    uint32_t state = seed;
+    auto next = [&state]() {
+        state = state * 1664525u + 1013904223u;
+        return state >> 24;
+    };
+    for (int pass = 0; pass < 2; ++pass) {
+        for (int y = 0; y < a.get_height(); ++y) {
+            for (int x = 0; x < a.get_width(); ++x) {
+                // Mix of clean, sub-threshold and spreading tiles
+                uint8_t level = static_cast<uint8_t>(next());
+                if (level < 96) {
+                    level = 0;
+                }
+                const uint8_t type = static_cast<uint8_t>(next() % 5);
+                a.set_level(x, y, 0);
+                b.set_level(x, y, 0);
+                a.add_contamination(x, y, level, type);
+                b.add_contamination(x, y, level, type);
+            }
+        }
+        a.swap_buffers();
+        b.swap_buffers();
+    }
+}
+
+TEST(matches_reference_on_random_grids) {
+    // Widths exercise full vectors, scalar tails and tiny grids
+    const int sizes[][2] = {{1, 1}, {3, 2}, {17, 5}, {37, 29}, {64, 64}, {100, 33}};
+    uint32_t seed = 12345;
+    for (const auto& size : sizes) {
+        ContaminationGrid kernel(static_cast<uint16_t>(size[0]), static_cast<uint16_t>(size[1]));
+        ContaminationGrid reference(static_cast<uint16_t>(size[0]), static_cast<uint16_t>(size[1]));
+        fill_random(kernel, reference, seed++);
+
+        apply_contamination_spread(kernel);
+        reference_spread(reference);
+
+        for (int y = 0; y < size[1]; ++y) {
+            for (int x = 0; x < size[0]; ++x) {
+                ASSERT_EQ(kernel.get_level(x, y), reference.get_level(x, y));
+                ASSERT_EQ(kernel.get_dominant_type(x, y), reference.get_dominant_type(x, y));
+            }
+        }
+    }
+}
+
+TEST(sparse_sources_match_reference_across_ticks) {
+    // Sources move between ticks, straddle 16x16 block edges and leave
+    // blocks empty, so stale active-block data would show up as a mismatch
+    const int w = 100;
+    const int h = 70;
+    ContaminationGrid kernel(w, h);
+    ContaminationGrid reference(w, h);
+    uint32_t state = 777;
+    auto next = [&state]() {
+        state = state * 1664525u + 1013904223u;
+        return state >> 16;
+    };
+    for (int tick = 0; tick < 6; ++tick) {
+        for (int y = 0; y < h; ++y) {
+            for (int x = 0; x < w; ++x) {
+                kernel.set_level(x, y, 0);
+                reference.set_level(x, y, 0);
+            }
+        }
+        for (int i = 0; i < 6; ++i) {
+            const int x = static_cast<int>(next() % w);
+            const int y = static_cast<int>(next() % h);
+            const uint8_t level = static_cast<uint8_t>(32 + next() % 224);
+            const uint8_t type = static_cast<uint8_t>(1 + next() % 4);
+            kernel.add_contamination(x, y, level, type);
+            reference.add_contamination(x, y, level, type);
+        }
+        // Block-edge pair
+        kernel.add_contamination(15, 16, 200, 1);
+        reference.add_contamination(15, 16, 200, 1);
+        kernel.swap_buffers();
+        reference.swap_buffers();
+
+        apply_contamination_spread(kernel);
+        reference_spread(reference);
+
+        for (int y = 0; y < h; ++y) {
+            for (int x = 0; x < w; ++x) {
+                ASSERT_EQ(kernel.get_level(x, y), reference.get_level(x, y));
+                ASSERT_EQ(kernel.get_dominant_type(x, y), reference.get_dominant_type(x, y));
+            }
+        }
+    }
+}
+
 // =============================================================================
 // Main Entry Point
 // =============================================================================
@@ -371,6 +516,10 @@ int main() {
     RUN_TEST(full_grid_spread_iteration);
     RUN_TEST(empty_grid_no_spread);
 
+    // Reference comparison
+    RUN_TEST(matches_reference_on_random_grids);
+    RUN_TEST(sparse_sources_match_reference_across_ticks);
+
     printf("\n=== Results ===\n");
     printf("Passed: %d\n", tests_passed);
     printf("Failed: %d\n", tests_failed);
@@ -0,0 +1,93 @@
+/**
+ * @file test_byte_plane.cpp
+ * @brief Unit tests for BytePlane reductions.
+ */
+
+#include "sims3000/core/BytePlane.h"
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace sims3000;
+
+void test_empty_plane() {
+    printf("Testing empty plane...\n");
+
+    assert(byte_plane_sum(nullptr, 0) == 0);
+    assert(byte_plane_count_at_least(nullptr, 0, 1) == 0);
+    assert(byte_plane_max(nullptr, 0) == 0);
+
+    printf("  PASS: Empty plane reduces to zero\n");
+}
+
+void test_saturated_plane() {
+    printf("Testing saturated plane...\n");
+
+    // 512x512 at full level is the largest sum a grid can produce
+    std::vector<uint8_t> plane(512 * 512, 255);
+    assert(byte_plane_sum(plane.data(), plane.size()) == 255u * 512u * 512u);
+    assert(byte_plane_count_at_least(plane.data(), plane.size(), 255) == plane.size());
+    assert(byte_plane_count_at_least(plane.data(), plane.size(), 0) == plane.size());
+    assert(byte_plane_max(plane.data(), plane.size()) == 255);
+
+    printf("  PASS: Full plane sums without overflow\n");
+}
+
+void test_max_in_tail() {
+    printf("Testing max in scalar tail...\n");
+
+    std::vector<uint8_t> plane(37, 3);
+    plane[36] = 200;
+    assert(byte_plane_max(plane.data(), plane.size()) == 200);
+    plane[36] = 0;
+    plane[5] = 201;
+    assert(byte_plane_max(plane.data(), plane.size()) == 201);
+
+    printf("  PASS: Max found in both vector body and tail\n");
+}
+
+void test_random_planes_match_scalar() {
+    printf("Testing random planes match scalar...\n");
+
+    std::srand(1234);
+    const size_t lengths[] = { 1, 15, 16, 17, 31, 33, 100, 255, 1000, 4097 };
+    for (size_t count : lengths) {
+        std::vector<uint8_t> plane(count);
+        for (auto& v : plane) {
+            v = static_cast<uint8_t>(std::rand() & 0xFF);
+        }
+
+        uint32_t sum = 0;
+        uint8_t max = 0;
+        for (uint8_t v : plane) {
+            sum += v;
+            max = v > max ? v : max;
+        }
+        assert(byte_plane_sum(plane.data(), count) == sum);
+        assert(byte_plane_max(plane.data(), count) == max);
+
+        const uint8_t thresholds[] = { 0, 1, 64, 127, 128, 129, 255 };
+        for (uint8_t t : thresholds) {
+            uint32_t expected = 0;
+            for (uint8_t v : plane) {
+                expected += (v >= t) ? 1u : 0u;
+            }
+            assert(byte_plane_count_at_least(plane.data(), count, t) == expected);
+        }
+    }
+
+    printf("  PASS: Sum, count and max match scalar reference\n");
+}
+
+int main() {
+    printf("=== BytePlane Tests ===\n\n");
+
+    test_empty_plane();
+    test_saturated_plane();
+    test_max_in_tail();
+    test_random_planes_match_scalar();
+
+    printf("\n=== All BytePlane tests passed ===\n");
+    return 0;
+}
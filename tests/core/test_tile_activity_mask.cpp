@@ -0,0 +1,149 @@
+/**
+ * @file test_tile_activity_mask.cpp
+ * @brief Unit tests for TileActivityMask.
+ */
+
+#include "sims3000/core/TileActivityMask.h"
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace sims3000;
+
+void test_dimensions_round_up() {
+    printf("Testing dimensions round up...\n");
+
+    TileActivityMask mask(33, 16);
+    assert(mask.blocks_x() == 3);
+    assert(mask.blocks_y() == 1);
+    assert(mask.active_block_count() == 0);
+
+    TileActivityMask empty(0, 0);
+    assert(empty.blocks_x() == 0);
+    assert(empty.blocks_y() == 0);
+
+    printf("  PASS: Partial blocks are counted\n");
+}
+
+void test_zero_crossings() {
+    printf("Testing zero crossings...\n");
+
+    TileActivityMask mask(32, 32);
+    mask.on_tile_changed(1, 1, 0, 10);
+    mask.on_tile_changed(2, 1, 0, 20);
+    assert(mask.is_block_active(0, 0));
+    assert(mask.block_count(0, 0) == 2);
+    assert(mask.active_block_count() == 1);
+
+    // Non-zero to non-zero leaves counts alone
+    mask.on_tile_changed(1, 1, 10, 200);
+    assert(mask.block_count(0, 0) == 2);
+
+    mask.on_tile_changed(1, 1, 200, 0);
+    assert(mask.is_block_active(0, 0));
+    mask.on_tile_changed(2, 1, 20, 0);
+    assert(!mask.is_block_active(0, 0));
+    assert(mask.active_block_count() == 0);
+
+    // Zero to zero is a no-op
+    mask.on_tile_changed(17, 17, 0, 0);
+    assert(!mask.is_block_active(1, 1));
+
+    printf("  PASS: Blocks activate and deactivate on zero crossings\n");
+}
+
+void test_halo() {
+    printf("Testing halo...\n");
+
+    TileActivityMask mask(80, 48);  // 5 x 3 blocks
+    std::vector<uint8_t> halo;
+    mask.build_halo(halo);
+    assert(halo.size() == 15);
+    for (uint8_t h : halo) {
+        assert(h == 0);
+    }
+
+    mask.on_tile_changed(0, 0, 0, 1);      // block (0, 0)
+    mask.on_tile_changed(79, 47, 0, 1);    // block (4, 2)
+    mask.build_halo(halo);
+    const uint8_t expected[3][5] = {
+        {1, 1, 0, 0, 0},
+        {1, 1, 0, 1, 1},
+        {0, 0, 0, 1, 1},
+    };
+    for (uint32_t by = 0; by < 3; ++by) {
+        for (uint32_t bx = 0; bx < 5; ++bx) {
+            assert(halo[by * 5 + bx] == expected[by][bx]);
+        }
+    }
+
+    printf("  PASS: Halo covers active blocks and their neighbours\n");
+}
+
+void test_swap_and_clear() {
+    printf("Testing swap and clear...\n");
+
+    TileActivityMask a(32, 32);
+    TileActivityMask b(32, 32);
+    a.on_tile_changed(20, 5, 0, 7);
+    a.swap(b);
+    assert(a.active_block_count() == 0);
+    assert(b.is_block_active(1, 0));
+
+    b.clear();
+    assert(b.active_block_count() == 0);
+    assert(!b.is_block_active(1, 0));
+
+    printf("  PASS: Swap exchanges and clear resets\n");
+}
+
+void test_random_edits_match_recount() {
+    printf("Testing random edits match recount...\n");
+
+    const int w = 50;
+    const int h = 37;
+    TileActivityMask mask(w, h);
+    std::vector<uint8_t> plane(static_cast<size_t>(w) * h, 0);
+
+    std::srand(99);
+    for (int step = 0; step < 20000; ++step) {
+        const int x = std::rand() % w;
+        const int y = std::rand() % h;
+        // Bias towards zero so tiles toggle often
+        const uint8_t level = (std::rand() % 3 == 0) ? static_cast<uint8_t>(std::rand() & 0xFF) : 0;
+        uint8_t& tile = plane[static_cast<size_t>(y) * w + x];
+        mask.on_tile_changed(x, y, tile, level);
+        tile = level;
+    }
+
+    uint32_t active = 0;
+    for (uint32_t by = 0; by < mask.blocks_y(); ++by) {
+        for (uint32_t bx = 0; bx < mask.blocks_x(); ++bx) {
+            uint32_t count = 0;
+            for (int y = static_cast<int>(by * TILE_BLOCK_SIZE); y < h && y < static_cast<int>((by + 1) * TILE_BLOCK_SIZE); ++y) {
+                for (int x = static_cast<int>(bx * TILE_BLOCK_SIZE); x < w && x < static_cast<int>((bx + 1) * TILE_BLOCK_SIZE); ++x) {
+                    count += plane[static_cast<size_t>(y) * w + x] != 0 ? 1u : 0u;
+                }
+            }
+            assert(mask.block_count(bx, by) == count);
+            active += count != 0 ? 1u : 0u;
+        }
+    }
+    assert(mask.active_block_count() == active);
+
+    printf("  PASS: Block counts match a full recount\n");
+}
+
+int main() {
+    printf("=== TileActivityMask Tests ===\n\n");
+
+    test_dimensions_round_up();
+    test_zero_crossings();
+    test_halo();
+    test_swap_and_clear();
+    test_random_edits_match_recount();
+
+    printf("\n=== All TileActivityMask tests passed ===\n");
+    return 0;
+}
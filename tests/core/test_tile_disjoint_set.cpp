@@ -0,0 +1,278 @@
+/**
+ * @file test_tile_disjoint_set.cpp
+ * @brief Unit tests for TileDisjointSet.
+ */
+
+#include "sims3000/core/TileDisjointSet.h"
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace sims3000;
+
+void test_insert_unions_neighbours() {
+    printf("Testing insert unions neighbours...\n");
+
+    TileDisjointSet sets(8, 8);
+    assert(sets.empty());
+
+    sets.insert(1, 1);
+    sets.insert(3, 1);
+    assert(sets.component_count() == 2);
+    assert(!sets.connected(1, 1, 3, 1));
+
+    // Bridge tile joins both
+    assert(sets.insert(2, 1));
+    assert(!sets.insert(2, 1));
+    assert(sets.component_count() == 1);
+    assert(sets.connected(1, 1, 3, 1));
+    assert(sets.component_size(3, 1) == 3);
+
+    // Diagonal is not adjacent
+    sets.insert(4, 2);
+    assert(sets.component_count() == 2);
+
+    printf("  PASS: Inserted tiles merge with 4-neighbours only\n");
+}
+
+void test_source_flags() {
+    printf("Testing source flags...\n");
+
+    TileDisjointSet sets(8, 8);
+    sets.insert(0, 0);
+    sets.set_source(0, 0, true);
+    sets.insert(5, 5);
+    assert(sets.has_source(0, 0));
+    assert(!sets.has_source(5, 5));
+
+    // Extending the sourced component propagates the flag
+    sets.insert(1, 0);
+    sets.insert(2, 0);
+    assert(sets.has_source(2, 0));
+
+    assert(sets.set_source(0, 0, false));
+    assert(!sets.set_source(0, 0, false));
+    assert(!sets.has_source(2, 0));
+
+    // Not a member
+    assert(!sets.set_source(7, 7, true));
+    assert(!sets.has_source(7, 7));
+
+    printf("  PASS: Component source counts follow set_source\n");
+}
+
+void test_erase_splits_component() {
+    printf("Testing erase splits a component...\n");
+
+    // Line 0..4 on row 2 with a source at (0, 2)
+    TileDisjointSet sets(8, 8);
+    for (uint32_t x = 0; x < 5; ++x) {
+        sets.insert(x, 2);
+    }
+    sets.set_source(0, 2, true);
+    assert(sets.component_count() == 1);
+
+    assert(sets.erase(2, 2));
+    assert(!sets.erase(2, 2));
+    assert(sets.component_count() == 2);
+    assert(sets.has_source(1, 2));
+    assert(!sets.has_source(3, 2));
+    assert(sets.component_size(0, 2) == 2);
+    assert(sets.component_size(4, 2) == 2);
+
+    // Removing a non-bridge keeps one component
+    sets.insert(2, 2);
+    sets.insert(2, 3);
+    assert(sets.erase(2, 3));
+    assert(sets.component_count() == 1);
+    assert(sets.has_source(4, 2));
+
+    // Removing an isolated tile drops its component
+    sets.insert(7, 7);
+    assert(sets.component_count() == 2);
+    sets.erase(7, 7);
+    assert(sets.component_count() == 1);
+
+    printf("  PASS: Erase relabels each remaining piece\n");
+}
+
+void test_erase_keeps_largest_piece_root() {
+    printf("Testing erase keeps the largest piece's root...\n");
+
+    // 6x6 block with a 3-tile spur hanging off (6, 2) via bridge (6, 2)
+    TileDisjointSet sets(16, 16);
+    for (uint32_t y = 0; y < 6; ++y) {
+        for (uint32_t x = 0; x < 6; ++x) {
+            sets.insert(x, y);
+        }
+    }
+    for (uint32_t x = 6; x < 10; ++x) {
+        sets.insert(x, 2);
+    }
+    sets.set_source(9, 2, true);
+    const uint32_t block_id = sets.find(0, 0);
+    assert(sets.component_size(0, 0) == 40);
+
+    // Cutting the bridge leaves the block under its old id
+    assert(sets.erase(6, 2));
+    assert(sets.component_count() == 2);
+    assert(sets.find(0, 0) == block_id);
+    assert(sets.find(5, 5) == block_id);
+    assert(sets.find(7, 2) != block_id);
+    assert(sets.component_size(0, 0) == 36);
+    assert(sets.component_size(8, 2) == 3);
+    assert(sets.has_source(7, 2));
+    assert(!sets.has_source(0, 0));
+
+    // A four-way cut around a plus shape splits into four pieces
+    TileDisjointSet plus(9, 9);
+    for (uint32_t i = 0; i < 9; ++i) {
+        plus.insert(i, 4);
+        plus.insert(4, i);
+    }
+    assert(plus.component_count() == 1);
+    assert(plus.erase(4, 4));
+    assert(plus.component_count() == 4);
+    assert(plus.component_size(0, 4) == 4);
+    assert(plus.component_size(4, 8) == 4);
+    assert(!plus.connected(0, 4, 8, 4));
+
+    // Re-inserting the centre joins them again
+    assert(plus.insert(4, 4));
+    assert(plus.component_count() == 1);
+    assert(plus.component_size(4, 0) == 17);
+
+    printf("  PASS: Only the split-off pieces are relabelled\n");
+}
+
+void test_for_each_in_component() {
+    printf("Testing for_each_in_component...\n");
+
+    TileDisjointSet sets(8, 8);
+    sets.insert(1, 1);
+    sets.insert(1, 2);
+    sets.insert(2, 2);
+    sets.insert(6, 6);
+
+    int visited = 0;
+    sets.for_each_in_component(1, 1, [&](uint32_t x, uint32_t y) {
+        assert(!(x == 6 && y == 6));
+        ++visited;
+    });
+    assert(visited == 3);
+
+    printf("  PASS: Only tiles in the same component are visited\n");
+}
+
+// Flood-fill reference: label components of a member grid.
+static void label_reference(const std::vector<uint8_t>& member, uint32_t w, uint32_t h,
+                            std::vector<int>& label) {
+    label.assign(member.size(), -1);
+    int next = 0;
+    std::vector<uint32_t> stack;
+    for (uint32_t i = 0; i < member.size(); ++i) {
+        if (!member[i] || label[i] >= 0) {
+            continue;
+        }
+        stack.push_back(i);
+        label[i] = next;
+        while (!stack.empty()) {
+            uint32_t cur = stack.back();
+            stack.pop_back();
+            uint32_t x = cur % w;
+            uint32_t y = cur / w;
+            uint32_t adj[4];
+            int n = 0;
+            if (x + 1 < w) adj[n++] = cur + 1;
+            if (x > 0) adj[n++] = cur - 1;
+            if (y + 1 < h) adj[n++] = cur + w;
+            if (y > 0) adj[n++] = cur - w;
+            for (int a = 0; a < n; ++a) {
+                if (member[adj[a]] && label[adj[a]] < 0) {
+                    label[adj[a]] = next;
+                    stack.push_back(adj[a]);
+                }
+            }
+        }
+        ++next;
+    }
+}
+
+void test_random_edits_match_flood_fill() {
+    printf("Testing random edits against flood fill...\n");
+
+    const uint32_t w = 16;
+    const uint32_t h = 12;
+    TileDisjointSet sets(w, h);
+    std::vector<uint8_t> member(w * h, 0);
+    std::vector<uint8_t> source(w * h, 0);
+    std::vector<int> label;
+    srand(1234);
+
+    for (int step = 0; step < 20000; ++step) {
+        uint32_t x = static_cast<uint32_t>(rand()) % w;
+        uint32_t y = static_cast<uint32_t>(rand()) % h;
+        uint32_t i = y * w + x;
+        if (member[i]) {
+            sets.erase(x, y);
+            member[i] = 0;
+            source[i] = 0;
+        } else {
+            sets.insert(x, y);
+            member[i] = 1;
+            if (rand() % 8 == 0) {
+                sets.set_source(x, y, true);
+                source[i] = 1;
+            }
+        }
+
+        if (step % 50 != 0) {
+            continue;
+        }
+        label_reference(member, w, h, label);
+        int components = 0;
+        for (int l : label) {
+            components = (l + 1 > components) ? l + 1 : components;
+        }
+        assert(sets.component_count() == static_cast<uint32_t>(components));
+
+        std::vector<int> has_source(components, 0);
+        std::vector<uint32_t> sizes(components, 0);
+        for (uint32_t t = 0; t < member.size(); ++t) {
+            if (member[t]) {
+                has_source[label[t]] |= source[t];
+                ++sizes[label[t]];
+            }
+        }
+        for (uint32_t t = 0; t < member.size(); ++t) {
+            uint32_t tx = t % w;
+            uint32_t ty = t / w;
+            assert(sets.contains(tx, ty) == (member[t] != 0));
+            if (!member[t]) {
+                continue;
+            }
+            assert(sets.has_source(tx, ty) == (has_source[label[t]] != 0));
+            assert(sets.component_size(tx, ty) == sizes[label[t]]);
+            if (tx + 1 < w && member[t + 1]) {
+                assert(sets.connected(tx, ty, tx + 1, ty) == (label[t] == label[t + 1]));
+            }
+        }
+    }
+
+    printf("  PASS: Components, sizes and source flags match flood fill\n");
+}
+
+int main() {
+    printf("=== TileDisjointSet Tests ===\n\n");
+
+    test_insert_unions_neighbours();
+    test_source_flags();
+    test_erase_splits_component();
+    test_erase_keeps_largest_piece_root();
+    test_for_each_in_component();
+    test_random_edits_match_flood_fill();
+
+    printf("\n=== All TileDisjointSet tests passed ===\n");
+    return 0;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file test_tile_position_index.cpp
+ * @brief Unit tests for TilePositionIndex.
+ */
+
+#include "sims3000/core/TilePositionIndex.h"
+#include <cassert>
+#include <cstdio>
+#include <vector>
+
+using namespace sims3000;
+
+void test_set_get_erase() {
+    printf("Testing set/get/erase...\n");
+
+    TilePositionIndex index(16, 8);
+    assert(index.empty());
+    assert(index.get(3, 4) == TilePositionIndex::INVALID_ID);
+
+    assert(index.set(3, 4, 42));
+    assert(index.contains(3, 4));
+    assert(index.get(3, 4) == 42);
+    assert(index.size() == 1);
+
+    // Replacing keeps the count
+    assert(!index.set(3, 4, 43));
+    assert(index.get(3, 4) == 43);
+    assert(index.size() == 1);
+
+    assert(index.erase(3, 4));
+    assert(!index.erase(3, 4));
+    assert(!index.contains(3, 4));
+    assert(index.empty());
+
+    printf("  PASS: set/get/erase behave like a map\n");
+}
+
+void test_out_of_bounds() {
+    printf("Testing out-of-bounds positions...\n");
+
+    TilePositionIndex index(16, 8);
+    assert(!index.set(16, 0, 1));
+    assert(!index.set(0, 8, 1));
+    assert(!index.contains(100, 100));
+    assert(index.get(100, 100) == TilePositionIndex::INVALID_ID);
+    assert(index.size() == 0);
+
+    printf("  PASS: Out-of-bounds positions are rejected\n");
+}
+
+void test_for_each_row_major() {
+    printf("Testing for_each order...\n");
+
+    // 10x10 = 100 tiles spans two bitset words
+    TilePositionIndex index(10, 10);
+    index.set(9, 9, 4);
+    index.set(0, 0, 1);
+    index.set(3, 6, 3);
+    index.set(5, 2, 2);
+
+    std::vector<uint32_t> ids;
+    std::vector<uint32_t> xs;
+    index.for_each([&](uint32_t x, uint32_t y, uint32_t id) {
+        ids.push_back(id);
+        xs.push_back(x + y * 10);
+    });
+
+    assert(ids.size() == 4);
+    for (size_t i = 0; i < ids.size(); ++i) {
+        assert(ids[i] == i + 1);
+    }
+    assert(xs[0] == 0 && xs[1] == 25 && xs[2] == 63 && xs[3] == 99);
+
+    printf("  PASS: Occupied tiles visited in row-major order\n");
+}
+
+void test_clear() {
+    printf("Testing clear...\n");
+
+    TilePositionIndex index(64, 64);
+    for (uint32_t i = 0; i < 64; ++i) {
+        index.set(i, i, i);
+    }
+    assert(index.size() == 64);
+
+    index.clear();
+    assert(index.empty());
+    assert(!index.contains(10, 10));
+    int visited = 0;
+    index.for_each([&](uint32_t, uint32_t, uint32_t) { ++visited; });
+    assert(visited == 0);
+
+    // Reusable after clear
+    assert(index.set(10, 10, 7));
+    assert(index.get(10, 10) == 7);
+
+    printf("  PASS: clear() empties the index and keeps it usable\n");
+}
+
+int main() {
+    printf("=== TilePositionIndex Tests ===\n\n");
+
+    test_set_get_erase();
+    test_out_of_bounds();
+    test_for_each_row_major();
+    test_clear();
+
+    printf("\n=== All TilePositionIndex tests passed ===\n");
+    return 0;
+}
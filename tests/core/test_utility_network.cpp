@@ -0,0 +1,242 @@
+/**
+ * @file test_utility_network.cpp
+ * @brief Unit tests for the shared UtilityNetwork<Traits> helpers.
+ *
+ * Uses a minimal test traits struct so the kernel is exercised
+ * independently of the energy and fluid systems.
+ */
+
+#include "sims3000/core/UtilityNetwork.h"
+#include <cassert>
+#include <cstdio>
+#include <vector>
+
+using namespace sims3000;
+
+namespace {
+
+struct TestGrid {
+    uint32_t width;
+    uint32_t height;
+    std::vector<uint8_t> cells;
+
+    TestGrid(uint32_t w, uint32_t h) : width(w), height(h), cells(w * h, 0) {}
+
+    void set(uint32_t x, uint32_t y, uint8_t owner) { cells[y * width + x] = owner; }
+    uint8_t get_coverage_owner(uint32_t x, uint32_t y) const { return cells[y * width + x]; }
+    bool is_in_coverage(uint32_t x, uint32_t y, uint8_t owner) const {
+        return get_coverage_owner(x, y) == owner;
+    }
+};
+
+struct TestConduit {
+    uint8_t coverage_radius = 1;
+    bool is_connected = false;
+    bool is_active = false;
+};
+
+struct TestConsumer {
+    uint32_t required = 0;
+};
+
+struct TestTraits {
+    using Grid = TestGrid;
+    using ConduitComponent = TestConduit;
+    using ConsumerComponent = TestConsumer;
+    static constexpr uint8_t DEFAULT_CONDUIT_RADIUS = 2;
+    static uint32_t demand(const TestConsumer& c) { return c.required; }
+};
+
+using Network = UtilityNetwork<TestTraits>;
+
+uint32_t count_owned(const TestGrid& grid, uint8_t owner) {
+    uint32_t count = 0;
+    for (uint8_t c : grid.cells) {
+        if (c == owner) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+} // namespace
+
+void test_mark_coverage_radius_clamps() {
+    printf("Testing mark_coverage_radius clamping...\n");
+
+    TestGrid grid(8, 8);
+    Network::mark_coverage_radius(grid, 4, 4, 1, 1, 8, 8);
+    assert(count_owned(grid, 1) == 9);
+
+    Network::mark_coverage_radius(grid, 0, 0, 2, 2, 8, 8);
+    assert(count_owned(grid, 2) == 9);   // 3x3 in the corner
+
+    Network::mark_coverage_radius(grid, 7, 7, 200, 3, 8, 8);
+    assert(count_owned(grid, 3) == 64);  // whole map
+
+    printf("  PASS: Square stamp clamps to the map\n");
+}
+
+void test_flood_connects_reachable_conduits() {
+    printf("Testing flood through conduits...\n");
+
+    entt::registry registry;
+    TilePositionIndex conduits(8, 8);
+
+    // Line of conduits (1..3, 0) touching the seed at (0, 0), plus an
+    // isolated conduit at (6, 6).
+    std::vector<entt::entity> line;
+    for (uint32_t x = 1; x <= 3; ++x) {
+        auto e = registry.create();
+        registry.emplace<TestConduit>(e);
+        conduits.set(x, 0, static_cast<uint32_t>(e));
+        line.push_back(e);
+    }
+    auto isolated = registry.create();
+    registry.emplace<TestConduit>(isolated);
+    conduits.set(6, 6, static_cast<uint32_t>(isolated));
+
+    std::vector<uint8_t> visited(64, 0);
+    std::vector<uint64_t> frontier;
+    visited[0] = 1;
+    frontier.push_back(Network::pack(0, 0));
+
+    int visits = 0;
+    Network::flood(
+        frontier, conduits, 8, 8,
+        [](uint32_t, uint32_t) { return true; },
+        [&](uint32_t x, uint32_t y) { return visited[y * 8 + x] != 0; },
+        [&](uint32_t x, uint32_t y, uint32_t id) {
+            visited[y * 8 + x] = 1;
+            Network::connect(&registry, id);
+            ++visits;
+        });
+
+    assert(visits == 3);
+    assert(frontier.size() == 4);
+    for (auto e : line) {
+        assert(registry.get<TestConduit>(e).is_connected);
+    }
+    assert(!registry.get<TestConduit>(isolated).is_connected);
+
+    // Reset clears every conduit
+    Network::reset_connections(&registry, conduits);
+    for (auto e : line) {
+        assert(!registry.get<TestConduit>(e).is_connected);
+    }
+
+    printf("  PASS: Only conduits reachable from the seed are connected\n");
+}
+
+void test_flood_respects_can_extend() {
+    printf("Testing flood ownership boundary...\n");
+
+    TilePositionIndex conduits(8, 1);
+    for (uint32_t x = 1; x < 8; ++x) {
+        conduits.set(x, 0, x);
+    }
+
+    std::vector<uint8_t> visited(8, 0);
+    std::vector<uint64_t> frontier{ Network::pack(0, 0) };
+    visited[0] = 1;
+
+    Network::flood(
+        frontier, conduits, 8, 1,
+        [](uint32_t x, uint32_t) { return x != 4; },
+        [&](uint32_t x, uint32_t) { return visited[x] != 0; },
+        [&](uint32_t x, uint32_t, uint32_t) { visited[x] = 1; });
+
+    assert(visited[3] == 1);
+    assert(visited[4] == 0);
+    assert(visited[5] == 0);
+
+    printf("  PASS: Flood stops at tiles rejected by can_extend\n");
+}
+
+void test_connect_default_radius() {
+    printf("Testing connect fallback radius...\n");
+
+    entt::registry registry;
+    auto e = registry.create();
+    registry.emplace<TestConduit>(e).coverage_radius = 5;
+
+    assert(Network::connect(&registry, static_cast<uint32_t>(e)) == 5);
+    assert(registry.get<TestConduit>(e).is_connected);
+
+    auto bare = registry.create();
+    assert(Network::connect(&registry, static_cast<uint32_t>(bare)) == 2);
+    assert(Network::connect(nullptr, 0) == 2);
+
+    printf("  PASS: Missing components fall back to DEFAULT_CONDUIT_RADIUS\n");
+}
+
+void test_active_states_and_preview() {
+    printf("Testing active states and preview delta...\n");
+
+    entt::registry registry;
+    TilePositionIndex conduits(8, 8);
+    auto a = registry.create();
+    registry.emplace<TestConduit>(a).is_connected = true;
+    conduits.set(1, 1, static_cast<uint32_t>(a));
+    auto b = registry.create();
+    registry.emplace<TestConduit>(b);
+    conduits.set(2, 1, static_cast<uint32_t>(b));
+
+    Network::update_active_states(&registry, conduits, true);
+    assert(registry.get<TestConduit>(a).is_active);
+    assert(!registry.get<TestConduit>(b).is_active);
+
+    Network::update_active_states(&registry, conduits, false);
+    assert(!registry.get<TestConduit>(a).is_active);
+
+    TestGrid grid(8, 8);
+    Network::mark_coverage_radius(grid, 2, 2, 1, 1, 8, 8);
+    auto delta = Network::preview_delta(grid, 3, 2, 1, 1, 8, 8);
+    assert(delta.size() == 3);  // only the x = 4 column is new
+    for (const auto& tile : delta) {
+        assert(tile.first == 4);
+    }
+
+    printf("  PASS: is_active follows connection and generation; preview is a delta\n");
+}
+
+void test_aggregate_consumption() {
+    printf("Testing aggregate_consumption...\n");
+
+    entt::registry registry;
+    TilePositionIndex consumers(8, 8);
+    TestGrid grid(8, 8);
+    Network::mark_coverage_radius(grid, 1, 1, 1, 1, 8, 8);
+
+    auto inside = registry.create();
+    registry.emplace<TestConsumer>(inside).required = 10;
+    consumers.set(1, 1, static_cast<uint32_t>(inside));
+
+    auto also_inside = registry.create();
+    registry.emplace<TestConsumer>(also_inside).required = 5;
+    consumers.set(2, 2, static_cast<uint32_t>(also_inside));
+
+    auto outside = registry.create();
+    registry.emplace<TestConsumer>(outside).required = 100;
+    consumers.set(6, 6, static_cast<uint32_t>(outside));
+
+    auto result = Network::aggregate_consumption(registry, grid, consumers, 1);
+    assert(result.total == 15);
+    assert(result.count == 2);
+
+    printf("  PASS: Only covered consumers are summed\n");
+}
+
+int main() {
+    printf("=== UtilityNetwork Tests ===\n\n");
+
+    test_mark_coverage_radius_clamps();
+    test_flood_connects_reachable_conduits();
+    test_flood_respects_can_extend();
+    test_connect_default_radius();
+    test_active_states_and_preview();
+    test_aggregate_consumption();
+
+    printf("\n=== All UtilityNetwork tests passed ===\n");
+    return 0;
+}
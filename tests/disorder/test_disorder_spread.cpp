@@ -9,10 +9,12 @@
  * - Source loses disorder after spreading
  * - Delta buffer prevents order-dependent results
  * - Edge cells spread to fewer neighbors
+ * - Active-block skipping matches a full-grid scan
  */
 
 #include <sims3000/disorder/DisorderSpread.h>
 #include <sims3000/disorder/DisorderGrid.h>
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <vector>
@@ -303,6 +305,80 @@ TEST(bottom_right_corner_spreads_to_2_neighbors) {
     ASSERT_EQ(grid.get_level(15, 15), 112); // 128 - 16
 }
 
+// =============================================================================
+// Active-block skipping
+// =============================================================================
+
+/// Full-grid scan of the spread rule, for comparison with the block version.
+static void reference_spread(std::vector<int>& levels, int w, int h,
+                             const std::vector<bool>& water) {
+    std::vector<int> delta(levels.size(), 0);
+    const int dx[] = { 1, -1, 0, 0 };
+    const int dy[] = { 0, 0, 1, -1 };
+    for (int y = 0; y < h; ++y) {
+        for (int x = 0; x < w; ++x) {
+            const int level = levels[y * w + x];
+            const int spread = level > SPREAD_THRESHOLD ? (level - SPREAD_THRESHOLD) / 8 : 0;
+            if (spread == 0) {
+                continue;
+            }
+            for (int d = 0; d < 4; ++d) {
+                const int nx = x + dx[d];
+                const int ny = y + dy[d];
+                if (nx < 0 || ny < 0 || nx >= w || ny >= h || water[ny * w + nx]) {
+                    continue;
+                }
+                delta[ny * w + nx] += spread;
+                delta[y * w + x] -= spread;
+            }
+        }
+    }
+    for (size_t i = 0; i < levels.size(); ++i) {
+        levels[i] = std::min(255, std::max(0, levels[i] + delta[i]));
+    }
+}
+
+TEST(sparse_grid_matches_full_scan) {
+    const int w = 75;
+    const int h = 50;
+    DisorderGrid grid(w, h);
+    std::vector<int> expected(static_cast<size_t>(w) * h, 0);
+    std::vector<bool> water(static_cast<size_t>(w) * h, false);
+
+    uint32_t state = 4242;
+    auto next = [&state]() {
+        state = state * 1664525u + 1013904223u;
+        return state >> 16;
+    };
+    for (int i = 0; i < 40; ++i) {
+        water[next() % water.size()] = true;
+    }
+    // Hot spots on and next to 16x16 block edges, plus random ones
+    const int spots[][2] = {{15, 15}, {16, 16}, {31, 0}, {74, 49}, {47, 32}};
+    for (const auto& spot : spots) {
+        grid.set_level(spot[0], spot[1], 255);
+        expected[spot[1] * w + spot[0]] = 255;
+    }
+    for (int i = 0; i < 8; ++i) {
+        const int x = static_cast<int>(next() % w);
+        const int y = static_cast<int>(next() % h);
+        const uint8_t level = static_cast<uint8_t>(next() & 0xFF);
+        grid.set_level(x, y, level);
+        expected[y * w + x] = level;
+    }
+
+    // Repeated ticks let disorder cross into neighbouring blocks
+    for (int tick = 0; tick < 12; ++tick) {
+        apply_disorder_spread(grid, &water);
+        reference_spread(expected, w, h, water);
+        for (int y = 0; y < h; ++y) {
+            for (int x = 0; x < w; ++x) {
+                ASSERT_EQ(grid.get_level(x, y), expected[y * w + x]);
+            }
+        }
+    }
+}
+
 // =============================================================================
 // Constant check
 // =============================================================================
@@ -332,6 +408,7 @@ int main() {
     RUN_TEST(corner_cell_spreads_to_2_neighbors);
     RUN_TEST(edge_cell_spreads_to_3_neighbors);
     RUN_TEST(bottom_right_corner_spreads_to_2_neighbors);
+    RUN_TEST(sparse_grid_matches_full_scan);
     RUN_TEST(spread_threshold_is_64);
 
     printf("\n=== Results: %d passed, %d failed ===\n",
@@ -368,7 +368,8 @@ TEST(active_becomes_inactive_when_nexus_goes_offline) {
     prod->is_online = false;
     prod->current_output = 0;
 
-    // Recalculate pool (generation now 0)
+    // Refresh outputs and recalculate pool (generation now 0)
+    sys.update_all_nexus_outputs(0);
     sys.calculate_pool(0);
     ASSERT_EQ(sys.get_pool(0).total_generated, 0u);
 
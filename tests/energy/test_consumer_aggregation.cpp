@@ -484,6 +484,7 @@ TEST(tick_total_consumed_updates_each_tick) {
 
     // Change energy_required and tick again
     ec1.energy_required = 500;
+    sys.on_consumer_demand_changed(static_cast<uint32_t>(e1), 0, 5, 5);
     sys.tick(0.05f);
     ASSERT_EQ(sys.get_pool(0).total_consumed, 500u);
 }
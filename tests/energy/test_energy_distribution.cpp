@@ -402,6 +402,7 @@ TEST(tick_transitions_powered_to_unpowered) {
 
     // Increase consumption to create deficit
     ec1->energy_required = 5000;
+    sys.on_consumer_demand_changed(c1, 0, 12, 10);
 
     sys.tick(0.05f);
 
@@ -427,6 +428,7 @@ TEST(tick_transitions_unpowered_to_powered) {
 
     // Reduce consumption to restore surplus
     ec1->energy_required = 100;
+    sys.on_consumer_demand_changed(c1, 0, 12, 10);
 
     sys.tick(0.05f);
 
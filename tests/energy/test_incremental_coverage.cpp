@@ -0,0 +1,392 @@
+/**
+ * @file test_incremental_coverage.cpp
+ * @brief Unit tests for incremental energy coverage updates
+ *
+ * Tests cover:
+ * - Conduit placement floods only from the new conduit and connects it
+ * - Placing a bridge conduit connects a previously isolated chain
+ * - Removing a bridge conduit disconnects the stranded piece only
+ * - Overlapping radii are reference counted and released correctly
+ * - Coverage released by one player falls back to another covering player
+ * - Nexus changes and mark_coverage_dirty() still force a full rebuild
+ * - Network component flags (union-find) update before the next tick
+ * - Random place/remove sequences match a full recalculate_coverage()
+ */
+
+#include <sims3000/energy/EnergySystem.h>
+#include <sims3000/energy/EnergyConduitComponent.h>
+#include <sims3000/energy/EnergyProducerComponent.h>
+#include <entt/entt.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace sims3000::energy;
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST(name) void test_##name()
+#define RUN_TEST(name) do { \
+    printf("Running %s...", #name); \
+    test_##name(); \
+    printf(" PASSED\n"); \
+    tests_passed++; \
+} while(0)
+
+#define ASSERT(condition) do { \
+    if (!(condition)) { \
+        printf("\n  FAILED: %s (line %d)\n", #condition, __LINE__); \
+        tests_failed++; \
+        return; \
+    } \
+} while(0)
+
+#define ASSERT_EQ(a, b) do { \
+    if ((a) != (b)) { \
+        printf("\n  FAILED: %s == %s (line %d)\n", #a, #b, __LINE__); \
+        tests_failed++; \
+        return; \
+    } \
+} while(0)
+
+static bool is_connected(entt::registry& registry, uint32_t eid) {
+    auto* conduit = registry.try_get<EnergyConduitComponent>(static_cast<entt::entity>(eid));
+    return conduit && conduit->is_connected;
+}
+
+// =============================================================================
+// Placement
+// =============================================================================
+
+TEST(placement_connects_adjacent_conduit) {
+    EnergySystem sys(64, 64);
+    entt::registry registry;
+    sys.set_registry(&registry);
+
+    sys.place_nexus(NexusType::Carbon, 20, 20, 0);
+    sys.tick(0.05f);
+
+    uint32_t c1 = sys.place_conduit(21, 20, 0);
+    uint32_t c2 = sys.place_conduit(22, 20, 0);
+    ASSERT(sys.is_coverage_dirty(0));
+    sys.update_coverage_incremental(0);
+    ASSERT(!sys.is_coverage_dirty(0));
+
+    ASSERT(is_connected(registry, c1));
+    ASSERT(is_connected(registry, c2));
+    // (20,20): nexus + both conduits; (25,20): nexus + conduit at x=22
+    ASSERT_EQ(sys.get_coverage_ref_count(20, 20, 0), 3u);
+    ASSERT_EQ(sys.get_coverage_ref_count(25, 20, 0), 2u);
+}
+
+TEST(isolated_conduit_stays_disconnected) {
+    EnergySystem sys(64, 64);
+    entt::registry registry;
+    sys.set_registry(&registry);
+
+    sys.place_nexus(NexusType::Carbon, 10, 10, 0);
+    sys.tick(0.05f);
+
+    uint32_t c = sys.place_conduit(40, 40, 0);
+    sys.update_coverage_incremental(0);
+
+    ASSERT(!is_connected(registry, c));
+    ASSERT_EQ(sys.get_coverage_at(40, 40), 0);
+    ASSERT_EQ(sys.get_coverage_ref_count(40, 40, 0), 0u);
+}
+
+TEST(bridge_connects_isolated_chain) {
+    EnergySystem sys(64, 64);
+    entt::registry registry;
+    sys.set_registry(&registry);
+
+    sys.place_nexus(NexusType::Carbon, 10, 10, 0);
+    std::vector<uint32_t> chain;
+    for (uint32_t x = 12; x < 30; ++x) {
+        chain.push_back(sys.place_conduit(x, 10, 0));
+    }
+    sys.tick(0.05f);
+    for (uint32_t eid : chain) {
+        ASSERT(!is_connected(registry, eid));
+    }
+
+    uint32_t bridge = sys.place_conduit(11, 10, 0);
+    sys.update_coverage_incremental(0);
+
+    ASSERT(is_connected(registry, bridge));
+    for (uint32_t eid : chain) {
+        ASSERT(is_connected(registry, eid));
+    }
+    ASSERT_EQ(sys.get_coverage_at(32, 10), 1);
+}
+
+TEST(component_flags_update_before_tick) {
+    EnergySystem sys(64, 64);
+    entt::registry registry;
+    sys.set_registry(&registry);
+
+    sys.place_nexus(NexusType::Carbon, 10, 10, 0);
+    uint32_t c1 = sys.place_conduit(11, 10, 0);
+    sys.place_conduit(12, 10, 0);
+    sys.place_conduit(30, 30, 0);
+
+    // Answered immediately from the union-find, no tick required
+    ASSERT(sys.is_connected_to_nexus(12, 10, 0));
+    ASSERT(!sys.is_connected_to_nexus(30, 30, 0));
+    ASSERT(!sys.is_connected_to_nexus(40, 40, 0));
+    ASSERT_EQ(sys.get_network_component_count(0), 2u);
+
+    // Removing the bridge splits the network
+    ASSERT(sys.remove_conduit(c1, 0, 11, 10));
+    ASSERT(sys.is_connected_to_nexus(10, 10, 0));
+    ASSERT(!sys.is_connected_to_nexus(12, 10, 0));
+    ASSERT_EQ(sys.get_network_component_count(0), 3u);
+}
+
+// =============================================================================
+// Removal
+// =============================================================================
+
+TEST(removing_bridge_disconnects_stranded_piece) {
+    EnergySystem sys(64, 64);
+    entt::registry registry;
+    sys.set_registry(&registry);
+
+    sys.place_nexus(NexusType::Carbon, 10, 10, 0);
+    std::vector<uint32_t> chain;
+    for (uint32_t x = 11; x < 30; ++x) {
+        chain.push_back(sys.place_conduit(x, 10, 0));
+    }
+    sys.tick(0.05f);
+    ASSERT_EQ(sys.get_coverage_at(32, 10), 1);
+
+    // Remove the conduit at x=20: 11..19 stay connected, 21..29 strand
+    ASSERT(sys.remove_conduit(chain[9], 0, 20, 10));
+    sys.update_coverage_incremental(0);
+
+    for (size_t i = 0; i < 9; ++i) {
+        ASSERT(is_connected(registry, chain[i]));
+    }
+    for (size_t i = 10; i < chain.size(); ++i) {
+        ASSERT(!is_connected(registry, chain[i]));
+    }
+    // x=22 still within radius 3 of the conduit at x=19
+    ASSERT_EQ(sys.get_coverage_at(22, 10), 1);
+    ASSERT_EQ(sys.get_coverage_at(23, 10), 0);
+    ASSERT_EQ(sys.get_coverage_at(32, 10), 0);
+}
+
+TEST(removing_loop_edge_keeps_everything_connected) {
+    EnergySystem sys(64, 64);
+    entt::registry registry;
+    sys.set_registry(&registry);
+
+    // Square loop of conduits attached to the nexus at (10,10)
+    sys.place_nexus(NexusType::Carbon, 10, 10, 0);
+    std::vector<uint32_t> loop;
+    for (uint32_t x = 11; x <= 15; ++x) loop.push_back(sys.place_conduit(x, 10, 0));
+    for (uint32_t y = 11; y <= 15; ++y) loop.push_back(sys.place_conduit(15, y, 0));
+    for (uint32_t x = 14; x >= 10; --x) loop.push_back(sys.place_conduit(x, 15, 0));
+    for (uint32_t y = 14; y >= 11; --y) loop.push_back(sys.place_conduit(10, y, 0));
+    sys.tick(0.05f);
+
+    uint32_t before = sys.get_coverage_count(1);
+    ASSERT(sys.remove_conduit(loop[2], 0, 13, 10));
+    sys.update_coverage_incremental(0);
+
+    for (size_t i = 0; i < loop.size(); ++i) {
+        if (i != 2) {
+            ASSERT(is_connected(registry, loop[i]));
+        }
+    }
+    ASSERT_EQ(sys.get_coverage_count(1), before);
+}
+
+// =============================================================================
+// Reference counting and ownership
+// =============================================================================
+
+TEST(overlapping_radii_release_correctly) {
+    EnergySystem sys(64, 64);
+    entt::registry registry;
+    sys.set_registry(&registry);
+
+    sys.place_nexus(NexusType::Carbon, 10, 10, 0);
+    uint32_t a = sys.place_conduit(11, 10, 0);
+    uint32_t b = sys.place_conduit(12, 10, 0);
+    sys.tick(0.05f);
+
+    // Nexus covers x 2..18, a covers 8..14, b covers 9..15
+    ASSERT_EQ(sys.get_coverage_ref_count(15, 10, 0), 2u);
+    ASSERT_EQ(sys.get_coverage_ref_count(12, 10, 0), 3u);
+    ASSERT(sys.remove_conduit(b, 0, 12, 10));
+    sys.update_coverage_incremental(0);
+    ASSERT_EQ(sys.get_coverage_ref_count(15, 10, 0), 1u);
+    ASSERT_EQ(sys.get_coverage_at(15, 10), 1);
+
+    ASSERT(sys.remove_conduit(a, 0, 11, 10));
+    sys.update_coverage_incremental(0);
+    ASSERT_EQ(sys.get_coverage_ref_count(15, 10, 0), 1u);
+    ASSERT_EQ(sys.get_coverage_count(1), 17u * 17u);
+}
+
+TEST(released_tile_falls_back_to_other_player) {
+    EnergySystem sys(64, 64);
+    entt::registry registry;
+    sys.set_registry(&registry);
+
+    sys.place_nexus(NexusType::Carbon, 10, 10, 0);
+    sys.place_nexus(NexusType::Carbon, 40, 10, 1);
+    sys.tick(0.05f);
+    // Player 1's nexus covers 32..48; (30,10) belongs to nobody yet
+    ASSERT_EQ(sys.get_coverage_at(30, 10), 0);
+
+    // Player 0 runs a line east until it overlaps player 1's area
+    std::vector<uint32_t> line;
+    for (uint32_t x = 11; x <= 31; ++x) {
+        line.push_back(sys.place_conduit(x, 10, 0));
+    }
+    sys.tick(0.05f);
+    ASSERT_EQ(sys.get_coverage_at(33, 10), 1);   // most recent claimant
+    ASSERT_EQ(sys.get_coverage_ref_count(33, 10, 1), 1u);
+
+    // Cut the line near the nexus: player 0 loses (33,10), player 1 keeps it
+    ASSERT(sys.remove_conduit(line[0], 0, 11, 10));
+    sys.tick(0.05f);
+    ASSERT_EQ(sys.get_coverage_at(33, 10), 2);
+    ASSERT_EQ(sys.get_coverage_at(30, 10), 0);
+}
+
+// =============================================================================
+// Dirty flag interplay
+// =============================================================================
+
+TEST(conduit_changes_stay_dirty_until_applied) {
+    EnergySystem sys(64, 64);
+    entt::registry registry;
+    sys.set_registry(&registry);
+
+    sys.place_nexus(NexusType::Carbon, 10, 10, 0);
+    sys.tick(0.05f);
+    ASSERT(!sys.is_coverage_dirty(0));
+
+    uint32_t c = sys.place_conduit(11, 10, 0);
+    ASSERT(sys.is_coverage_dirty(0));
+    ASSERT(!is_connected(registry, c));   // deferred to next tick
+
+    sys.tick(0.05f);
+    ASSERT(!sys.is_coverage_dirty(0));
+    ASSERT(is_connected(registry, c));
+}
+
+TEST(mark_dirty_forces_full_rebuild) {
+    EnergySystem sys(64, 64);
+    entt::registry registry;
+    sys.set_registry(&registry);
+
+    sys.place_nexus(NexusType::Carbon, 10, 10, 0);
+    sys.tick(0.05f);
+
+    // Stray coverage written behind the system's back is only removed
+    // by a full rebuild, never by an incremental update.
+    sys.get_coverage_grid_mut().set(60, 60, 1);
+    sys.place_conduit(11, 10, 0);
+    sys.tick(0.05f);
+    ASSERT_EQ(sys.get_coverage_at(60, 60), 1);
+
+    sys.mark_coverage_dirty(0);
+    sys.place_conduit(12, 10, 0);
+    sys.tick(0.05f);
+    ASSERT_EQ(sys.get_coverage_at(60, 60), 0);
+}
+
+// =============================================================================
+// Equivalence with full rebuild
+// =============================================================================
+
+TEST(random_edits_match_full_rebuild) {
+    const uint32_t size = 48;
+    EnergySystem sys(size, size);
+    entt::registry registry;
+    sys.set_registry(&registry);
+
+    sys.place_nexus(NexusType::Carbon, 8, 8, 0);
+    sys.place_nexus(NexusType::Carbon, 40, 36, 0);
+    sys.tick(0.05f);
+
+    std::mt19937 rng(1234);
+    std::vector<std::vector<uint32_t>> conduit_at(size, std::vector<uint32_t>(size, INVALID_ENTITY_ID));
+
+    for (int round = 0; round < 40; ++round) {
+        for (int edit = 0; edit < 25; ++edit) {
+            uint32_t x = rng() % size;
+            uint32_t y = rng() % size;
+            if ((x == 8 && y == 8) || (x == 40 && y == 36)) {
+                continue;
+            }
+            uint32_t& eid = conduit_at[y][x];
+            if (eid == INVALID_ENTITY_ID) {
+                eid = sys.place_conduit(x, y, 0);
+            } else {
+                sys.remove_conduit(eid, 0, x, y);
+                eid = INVALID_ENTITY_ID;
+            }
+        }
+        sys.tick(0.05f);
+
+        // Snapshot incremental result, then rebuild from scratch
+        std::vector<uint8_t> owners;
+        std::vector<uint32_t> refs;
+        std::vector<uint8_t> connected;
+        for (uint32_t y = 0; y < size; ++y) {
+            for (uint32_t x = 0; x < size; ++x) {
+                owners.push_back(sys.get_coverage_at(x, y));
+                refs.push_back(sys.get_coverage_ref_count(x, y, 0));
+                connected.push_back(conduit_at[y][x] != INVALID_ENTITY_ID &&
+                                    is_connected(registry, conduit_at[y][x]));
+            }
+        }
+
+        sys.recalculate_coverage(0);
+
+        size_t i = 0;
+        for (uint32_t y = 0; y < size; ++y) {
+            for (uint32_t x = 0; x < size; ++x, ++i) {
+                ASSERT_EQ(owners[i], sys.get_coverage_at(x, y));
+                ASSERT_EQ(refs[i], sys.get_coverage_ref_count(x, y, 0));
+                bool now = conduit_at[y][x] != INVALID_ENTITY_ID &&
+                           is_connected(registry, conduit_at[y][x]);
+                ASSERT_EQ(connected[i] != 0, now);
+            }
+        }
+    }
+}
+
+// =============================================================================
+// Main Entry Point
+// =============================================================================
+
+int main() {
+    printf("=== Incremental Coverage Tests ===\n\n");
+
+    RUN_TEST(placement_connects_adjacent_conduit);
+    RUN_TEST(isolated_conduit_stays_disconnected);
+    RUN_TEST(bridge_connects_isolated_chain);
+    RUN_TEST(component_flags_update_before_tick);
+    RUN_TEST(removing_bridge_disconnects_stranded_piece);
+    RUN_TEST(removing_loop_edge_keeps_everything_connected);
+    RUN_TEST(overlapping_radii_release_correctly);
+    RUN_TEST(released_tile_falls_back_to_other_player);
+    RUN_TEST(conduit_changes_stay_dirty_until_applied);
+    RUN_TEST(mark_dirty_forces_full_rebuild);
+    RUN_TEST(random_edits_match_full_rebuild);
+
+    printf("\n=== Results ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+
+    return tests_failed > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -10,6 +10,7 @@
  * - nexus_count and consumer_count updated
  * - tick() phase 3 calls calculate_pool() for each overseer
  * - Scenarios: healthy, marginal, deficit, collapse
+ * - Running totals follow coverage, consumer and nexus changes
  */
 
 #include <sims3000/energy/EnergySystem.h>
@@ -538,6 +539,7 @@ TEST(tick_updates_pool_each_tick) {
     auto consumer_entity = static_cast<entt::entity>(consumer_eid);
     auto* ec = reg.try_get<EnergyComponent>(consumer_entity);
     ec->energy_required = 900;
+    sys.on_consumer_demand_changed(consumer_eid, 0, 12, 10);
 
     sys.tick(0.05f);
     // After aging, total_generated < 1000, so surplus < 100
@@ -547,6 +549,7 @@ TEST(tick_updates_pool_each_tick) {
 
     // Push into deficit: consumption >> generation
     ec->energy_required = 1500;
+    sys.on_consumer_demand_changed(consumer_eid, 0, 12, 10);
     sys.tick(0.05f);
     ASSERT(sys.get_pool(0).surplus < 0);
     ASSERT_EQ(sys.get_pool(0).total_consumed, 1500u);
@@ -618,6 +621,97 @@ TEST(multi_player_pool_isolation) {
               static_cast<int32_t>(sys.get_pool(3).total_generated));
 }
 
+// =============================================================================
+// Running totals (event-driven pool aggregation)
+// =============================================================================
+
+TEST(running_totals_follow_coverage_changes) {
+    entt::registry reg;
+    EnergySystem sys(64, 64);
+    sys.set_registry(&reg);
+
+    // Nexus at (10,10) covers x 2..18; consumer at (22,10) starts uncovered
+    create_nexus_at(reg, sys, 0, 1000, 10, 10, true);
+    create_consumer_no_coverage(reg, sys, 0, 12, 10, 200);
+    create_consumer_no_coverage(reg, sys, 0, 22, 10, 300);
+
+    sys.tick(0.05f);
+    ASSERT_EQ(sys.get_pool(0).total_consumed, 200u);
+    ASSERT(sys.verify_pool_totals(0));
+
+    // Conduit chain to (19,10) extends coverage to x 22
+    uint32_t last = 0;
+    for (uint32_t x = 11; x <= 19; ++x) {
+        last = sys.place_conduit(x, 10, 0);
+        ASSERT(last != INVALID_ENTITY_ID);
+    }
+    sys.tick(0.05f);
+    ASSERT_EQ(sys.get_pool(0).total_consumed, 500u);
+    ASSERT(sys.verify_pool_totals(0));
+
+    // Removing the end of the chain drops the consumer again
+    ASSERT(sys.remove_conduit(last, 0, 19, 10));
+    sys.tick(0.05f);
+    ASSERT_EQ(sys.get_pool(0).total_consumed, 200u);
+    ASSERT(sys.verify_pool_totals(0));
+}
+
+TEST(running_totals_follow_consumer_changes) {
+    entt::registry reg;
+    EnergySystem sys(64, 64);
+    sys.set_registry(&reg);
+
+    create_nexus_at(reg, sys, 0, 1000, 10, 10, true);
+    uint32_t c1 = create_consumer_no_coverage(reg, sys, 0, 12, 10, 200);
+    sys.tick(0.05f);
+    ASSERT_EQ(sys.get_pool(0).total_consumed, 200u);
+
+    // Constructed between ticks
+    uint32_t c2 = create_consumer_no_coverage(reg, sys, 0, 8, 8, 50);
+    sys.calculate_pool(0);
+    ASSERT_EQ(sys.get_pool(0).total_consumed, 250u);
+    ASSERT(sys.verify_pool_totals(0));
+
+    // Demand change reported
+    reg.get<EnergyComponent>(static_cast<entt::entity>(c2)).energy_required = 70;
+    sys.on_consumer_demand_changed(c2, 0, 8, 8);
+    sys.calculate_pool(0);
+    ASSERT_EQ(sys.get_pool(0).total_consumed, 270u);
+
+    // Deconstructed
+    sys.unregister_consumer_position(c1, 0, 12, 10);
+    sys.unregister_consumer(c1, 0);
+    sys.calculate_pool(0);
+    ASSERT_EQ(sys.get_pool(0).total_consumed, 70u);
+    ASSERT(sys.verify_pool_totals(0));
+
+    // An unreported demand change is caught by the verifier
+    reg.get<EnergyComponent>(static_cast<entt::entity>(c2)).energy_required = 90;
+    ASSERT(!sys.verify_pool_totals(0));
+}
+
+TEST(running_generation_follows_nexus_changes) {
+    entt::registry reg;
+    EnergySystem sys(64, 64);
+    sys.set_registry(&reg);
+
+    create_nexus(reg, sys, 0, 500, true);
+    sys.update_all_nexus_outputs(0);
+    sys.calculate_pool(0);
+    ASSERT_EQ(sys.get_pool(0).total_generated, 500u);
+
+    // Registered between output updates: rebuilt on the next pool
+    uint32_t n2 = create_nexus(reg, sys, 0, 300, true);
+    reg.get<EnergyProducerComponent>(static_cast<entt::entity>(n2)).current_output = 300;
+    sys.calculate_pool(0);
+    ASSERT_EQ(sys.get_pool(0).total_generated, 800u);
+
+    sys.unregister_nexus(n2, 0);
+    sys.calculate_pool(0);
+    ASSERT_EQ(sys.get_pool(0).total_generated, 500u);
+    ASSERT(sys.verify_pool_totals(0));
+}
+
 // =============================================================================
 // Main Entry Point
 // =============================================================================
@@ -661,6 +755,11 @@ int main() {
     // Multi-player isolation
     RUN_TEST(multi_player_pool_isolation);
 
+    // Running totals
+    RUN_TEST(running_totals_follow_coverage_changes);
+    RUN_TEST(running_totals_follow_consumer_changes);
+    RUN_TEST(running_generation_follows_nexus_changes);
+
     printf("\n=== Results ===\n");
     printf("Passed: %d\n", tests_passed);
     printf("Failed: %d\n", tests_failed);
@@ -500,6 +500,7 @@ TEST(tick_updates_previous_state_across_ticks) {
     auto consumer_entity = static_cast<entt::entity>(consumer_eid);
     auto* ec = reg.try_get<EnergyComponent>(consumer_entity);
     ec->energy_required = 5000;
+    sys.on_consumer_demand_changed(consumer_eid, 0, 12, 10);
 
     sys.tick(0.05f);
     ASSERT_EQ(sys.get_pool_state(0), EnergyPoolState::Collapse);
@@ -507,6 +508,7 @@ TEST(tick_updates_previous_state_across_ticks) {
 
     // Recover to healthy
     ec->energy_required = 100;
+    sys.on_consumer_demand_changed(consumer_eid, 0, 12, 10);
     sys.tick(0.05f);
     ASSERT_EQ(sys.get_pool_state(0), EnergyPoolState::Healthy);
     ASSERT_EQ(sys.get_pool(0).previous_state, EnergyPoolState::Healthy);
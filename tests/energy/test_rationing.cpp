@@ -6,21 +6,27 @@
  * - apply_rationing() powers critical consumers first during deficit
  * - Priority ordering: 1=Critical, 2=Important, 3=Normal, 4=Low
  * - Entity ID tie-breaking for same priority
+ * - Priority changes after registration are re-filed
+ * - Greedy allocation continues past a consumer that does not fit
  * - Available energy = pool.total_generated (not surplus)
  * - Consumers outside coverage always unpowered during rationing
  * - distribute_energy() calls apply_rationing() when surplus < 0
  * - Edge cases: no consumers, no registry, zero generation
  * - tick() integration with rationing
+ * - Incremental buckets match a reference greedy pass under random edits
  */
 
 #include <sims3000/energy/EnergySystem.h>
 #include <sims3000/energy/EnergyComponent.h>
 #include <sims3000/energy/EnergyProducerComponent.h>
+#include <sims3000/energy/EnergyConduitComponent.h>
 #include <sims3000/energy/EnergyEnums.h>
 #include <sims3000/energy/EnergyPriorities.h>
 #include <entt/entt.hpp>
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
+#include <vector>
 
 using namespace sims3000::energy;
 
@@ -611,6 +617,200 @@ TEST(multi_player_rationing_isolation) {
     ASSERT_EQ(get_ec(c1_normal)->energy_received, 100u);
 }
 
+// =============================================================================
+// Test: Smaller lower-priority consumer still fits after a skip
+// =============================================================================
+
+TEST(greedy_skip_powers_smaller_later_consumer) {
+    entt::registry reg;
+    EnergySystem sys(64, 64);
+    sys.set_registry(&reg);
+
+    // Generator: 150 units total
+    create_nexus(reg, sys, 0, 150, true);
+
+    uint32_t c_crit = create_consumer_with_priority(reg, sys, 0, 1, 1, 100, ENERGY_PRIORITY_CRITICAL);
+    // Does not fit in the remaining 50
+    uint32_t c_big = create_consumer_with_priority(reg, sys, 0, 2, 2, 80, ENERGY_PRIORITY_IMPORTANT);
+    // Fits in the remaining 50
+    uint32_t c_small = create_consumer_with_priority(reg, sys, 0, 3, 3, 40, ENERGY_PRIORITY_LOW);
+    // Does not fit in the remaining 10
+    uint32_t c_last = create_consumer_with_priority(reg, sys, 0, 4, 4, 20, ENERGY_PRIORITY_LOW);
+
+    sys.update_all_nexus_outputs(0);
+    sys.calculate_pool(0);
+    ASSERT(sys.get_pool(0).surplus < 0);
+    sys.distribute_energy(0);
+
+    auto get_ec = [&](uint32_t eid) -> const EnergyComponent* {
+        return reg.try_get<EnergyComponent>(static_cast<entt::entity>(eid));
+    };
+
+    ASSERT(get_ec(c_crit)->is_powered);
+    ASSERT(!get_ec(c_big)->is_powered);
+    ASSERT_EQ(get_ec(c_big)->energy_received, 0u);
+    ASSERT(get_ec(c_small)->is_powered);
+    ASSERT_EQ(get_ec(c_small)->energy_received, 40u);
+    ASSERT(!get_ec(c_last)->is_powered);
+}
+
+// =============================================================================
+// Test: Priority changed after registration is honoured
+// =============================================================================
+
+TEST(priority_change_after_registration) {
+    entt::registry reg;
+    EnergySystem sys(64, 64);
+    sys.set_registry(&reg);
+
+    // Generator: 100 units total
+    create_nexus(reg, sys, 0, 100, true);
+
+    uint32_t c1 = create_consumer_with_priority(reg, sys, 0, 1, 1, 100, ENERGY_PRIORITY_CRITICAL);
+    uint32_t c2 = create_consumer_with_priority(reg, sys, 0, 2, 2, 100, ENERGY_PRIORITY_LOW);
+
+    // Swap priorities after both are registered
+    reg.get<EnergyComponent>(static_cast<entt::entity>(c1)).priority = ENERGY_PRIORITY_LOW;
+    reg.get<EnergyComponent>(static_cast<entt::entity>(c2)).priority = ENERGY_PRIORITY_CRITICAL;
+    sys.on_consumer_demand_changed(c1, 0, 1, 1);
+    sys.on_consumer_demand_changed(c2, 0, 2, 2);
+
+    sys.update_all_nexus_outputs(0);
+    sys.calculate_pool(0);
+    ASSERT(sys.get_pool(0).surplus < 0);
+    sys.distribute_energy(0);
+
+    auto get_ec = [&](uint32_t eid) -> const EnergyComponent* {
+        return reg.try_get<EnergyComponent>(static_cast<entt::entity>(eid));
+    };
+
+    ASSERT(!get_ec(c1)->is_powered);
+    ASSERT(get_ec(c2)->is_powered);
+
+    // Unregistering the re-filed consumer removes it from rationing
+    sys.unregister_consumer_position(c2, 0, 2, 2);
+    sys.unregister_consumer(c2, 0);
+    sys.calculate_pool(0);
+    sys.distribute_energy(0);
+    ASSERT(get_ec(c1)->is_powered);
+}
+
+// =============================================================================
+// Test: Incremental buckets match a reference greedy pass
+// =============================================================================
+
+TEST(random_edits_match_reference_greedy) {
+    entt::registry reg;
+    EnergySystem sys(32, 32);
+    sys.set_registry(&reg);
+
+    uint32_t nexus = create_nexus_at(reg, sys, 0, 400, 16, 16, true);
+
+    struct Consumer { uint32_t eid; uint32_t x; uint32_t y; };
+    std::vector<Consumer> consumers;
+    std::vector<uint32_t> conduits(32, 0);
+    bool occupied[32][32] = {};
+
+    uint32_t seed = 12345u;
+    auto next = [&seed](uint32_t bound) {
+        seed = seed * 1103515245u + 12345u;
+        return (seed >> 16) % bound;
+    };
+
+    for (int step = 0; step < 400; ++step) {
+        uint32_t op = next(8);
+        if (op <= 1 || consumers.empty()) {
+            uint32_t x = next(32);
+            uint32_t y = 10 + next(13);
+            if (!occupied[y][x]) {
+                uint32_t eid = create_consumer_no_coverage_with_priority(
+                    reg, sys, 0, x, y, 1 + next(60), static_cast<uint8_t>(next(7)));
+                consumers.push_back({ eid, x, y });
+                occupied[y][x] = true;
+            }
+        } else if (op == 2) {
+            size_t i = next(static_cast<uint32_t>(consumers.size()));
+            Consumer c = consumers[i];
+            sys.unregister_consumer_position(c.eid, 0, c.x, c.y);
+            sys.unregister_consumer(c.eid, 0);
+            reg.destroy(static_cast<entt::entity>(c.eid));
+            occupied[c.y][c.x] = false;
+            consumers[i] = consumers.back();
+            consumers.pop_back();
+        } else if (op == 3) {
+            const Consumer& c = consumers[next(static_cast<uint32_t>(consumers.size()))];
+            reg.get<EnergyComponent>(static_cast<entt::entity>(c.eid)).energy_required = 1 + next(60);
+            sys.on_consumer_demand_changed(c.eid, 0, c.x, c.y);
+        } else if (op == 4) {
+            const Consumer& c = consumers[next(static_cast<uint32_t>(consumers.size()))];
+            reg.get<EnergyComponent>(static_cast<entt::entity>(c.eid)).priority =
+                static_cast<uint8_t>(next(7));
+            sys.on_consumer_demand_changed(c.eid, 0, c.x, c.y);
+        } else if (op == 5) {
+            reg.get<EnergyProducerComponent>(static_cast<entt::entity>(nexus)).base_output =
+                100 + next(900);
+        } else {
+            // Grow or shrink the conduit line through the nexus to move coverage
+            bool left = next(2) == 0;
+            uint32_t x = 16;
+            while (x > 0 && x < 31 && conduits[left ? x - 1 : x + 1] != 0) {
+                x = left ? x - 1 : x + 1;
+            }
+            bool grow = (x == 16) || (x > 0 && x < 31 && next(2) == 0);
+            if (grow) {
+                x = left ? x - 1 : x + 1;
+            }
+            if (grow) {
+                auto entity = reg.create();
+                EnergyConduitComponent conduit{};
+                conduit.coverage_radius = 3;
+                reg.emplace<EnergyConduitComponent>(entity, conduit);
+                conduits[x] = static_cast<uint32_t>(entity);
+                sys.register_conduit_position(conduits[x], 0, x, 16);
+            } else {
+                sys.unregister_conduit_position(conduits[x], 0, x, 16);
+                reg.destroy(static_cast<entt::entity>(conduits[x]));
+                conduits[x] = 0;
+            }
+        }
+
+        sys.tick(0.05f);
+
+        // Reference: greedy over in-coverage consumers by (priority, entity_id)
+        std::vector<Consumer> order;
+        for (const Consumer& c : consumers) {
+            if (sys.is_in_coverage(c.x, c.y, 1)) {
+                order.push_back(c);
+            }
+        }
+        std::sort(order.begin(), order.end(), [&reg](const Consumer& a, const Consumer& b) {
+            const auto& ea = reg.get<EnergyComponent>(static_cast<entt::entity>(a.eid));
+            const auto& eb = reg.get<EnergyComponent>(static_cast<entt::entity>(b.eid));
+            if (ea.priority != eb.priority) {
+                return ea.priority < eb.priority;
+            }
+            return a.eid < b.eid;
+        });
+        uint64_t available = sys.get_pool(0).total_generated;
+        std::vector<uint32_t> expected_powered;
+        for (const Consumer& c : order) {
+            uint32_t demand = reg.get<EnergyComponent>(static_cast<entt::entity>(c.eid)).energy_required;
+            if (available >= demand) {
+                available -= demand;
+                expected_powered.push_back(c.eid);
+            }
+        }
+
+        for (const Consumer& c : consumers) {
+            const auto& ec = reg.get<EnergyComponent>(static_cast<entt::entity>(c.eid));
+            bool expected = std::find(expected_powered.begin(), expected_powered.end(), c.eid)
+                            != expected_powered.end();
+            ASSERT_EQ(ec.is_powered, expected);
+            ASSERT_EQ(ec.energy_received, expected ? ec.energy_required : 0u);
+        }
+    }
+}
+
 // =============================================================================
 // Main Entry Point
 // =============================================================================
@@ -622,11 +822,13 @@ int main() {
     RUN_TEST(critical_powered_first_during_deficit);
     RUN_TEST(full_priority_ordering);
     RUN_TEST(entity_id_tiebreaker_same_priority);
+    RUN_TEST(priority_change_after_registration);
 
     // Energy budget
     RUN_TEST(available_energy_is_total_generated);
     RUN_TEST(exact_energy_boundary);
     RUN_TEST(all_consumers_fit_during_deficit);
+    RUN_TEST(greedy_skip_powers_smaller_later_consumer);
 
     // Coverage interaction
     RUN_TEST(outside_coverage_unpowered_during_rationing);
@@ -643,6 +845,9 @@ int main() {
     // Multi-player
     RUN_TEST(multi_player_rationing_isolation);
 
+    // Incremental state
+    RUN_TEST(random_edits_match_reference_greedy);
+
     printf("\n=== Results ===\n");
     printf("Passed: %d\n", tests_passed);
     printf("Failed: %d\n", tests_failed);
@@ -202,6 +202,7 @@ TEST(powered_to_unpowered_emits_event) {
 
     // Create deficit by increasing demand
     ec1->energy_required = 5000;
+    sys.on_consumer_demand_changed(c1, 0, 5, 5);
     sys.calculate_pool(0);
     sys.distribute_energy(0);
 
@@ -391,6 +392,7 @@ TEST(tick_powered_to_unpowered_event) {
 
     // Increase demand to cause deficit
     ec1->energy_required = 5000;
+    sys.on_consumer_demand_changed(c1, 0, 12, 10);
 
     // Second tick: should detect powered -> unpowered
     sys.tick(0.05f);
@@ -21,6 +21,7 @@
 #include <cstdlib>
 
 using namespace sims3000::fluid;
+using sims3000::TilePositionIndex;
 
 // Test result tracking
 static int tests_passed = 0;
@@ -87,11 +88,11 @@ TEST(connected_conduit_is_marked_true) {
     uint32_t cond_id = static_cast<uint32_t>(cond_ent);
 
     FluidCoverageGrid grid(128, 128);
-    std::unordered_map<uint64_t, uint32_t> ext_pos;
-    ext_pos[pack_pos(50, 50)] = ext_id;
-    std::unordered_map<uint64_t, uint32_t> res_pos;
-    std::unordered_map<uint64_t, uint32_t> cond_pos;
-    cond_pos[pack_pos(51, 50)] = cond_id;
+    TilePositionIndex ext_pos(128, 128);
+    ext_pos.set(50, 50, ext_id);
+    TilePositionIndex res_pos(128, 128);
+    TilePositionIndex cond_pos(128, 128);
+    cond_pos.set(51, 50, cond_id);
 
     BFSContext ctx{
         grid,
@@ -123,11 +124,11 @@ TEST(isolated_conduit_remains_disconnected) {
     uint32_t cond_id = static_cast<uint32_t>(cond_ent);
 
     FluidCoverageGrid grid(128, 128);
-    std::unordered_map<uint64_t, uint32_t> ext_pos;
-    ext_pos[pack_pos(20, 50)] = ext_id;
-    std::unordered_map<uint64_t, uint32_t> res_pos;
-    std::unordered_map<uint64_t, uint32_t> cond_pos;
-    cond_pos[pack_pos(100, 100)] = cond_id; // far away
+    TilePositionIndex ext_pos(128, 128);
+    ext_pos.set(20, 50, ext_id);
+    TilePositionIndex res_pos(128, 128);
+    TilePositionIndex cond_pos(128, 128);
+    cond_pos.set(100, 100, cond_id); // far away
 
     BFSContext ctx{
         grid,
@@ -163,14 +164,14 @@ TEST(chain_of_conduits_all_connected) {
     }
 
     FluidCoverageGrid grid(128, 128);
-    std::unordered_map<uint64_t, uint32_t> ext_pos;
-    ext_pos[pack_pos(50, 50)] = ext_id;
-    std::unordered_map<uint64_t, uint32_t> res_pos;
-    std::unordered_map<uint64_t, uint32_t> cond_pos;
+    TilePositionIndex ext_pos(128, 128);
+    ext_pos.set(50, 50, ext_id);
+    TilePositionIndex res_pos(128, 128);
+    TilePositionIndex cond_pos(128, 128);
 
     // Chain: (51,50), (52,50), (53,50), (54,50), (55,50)
     for (int i = 0; i < 5; ++i) {
-        cond_pos[pack_pos(51 + i, 50)] = cond_ids[i];
+        cond_pos.set(51 + i, 50, cond_ids[i]);
     }
 
     BFSContext ctx{
@@ -205,11 +206,11 @@ TEST(bfs_resets_is_connected_before_traversal) {
     uint32_t cond_id = static_cast<uint32_t>(cond_ent);
 
     FluidCoverageGrid grid(128, 128);
-    std::unordered_map<uint64_t, uint32_t> ext_pos;
-    ext_pos[pack_pos(50, 50)] = ext_id;
-    std::unordered_map<uint64_t, uint32_t> res_pos;
-    std::unordered_map<uint64_t, uint32_t> cond_pos;
-    cond_pos[pack_pos(51, 50)] = cond_id;
+    TilePositionIndex ext_pos(128, 128);
+    ext_pos.set(50, 50, ext_id);
+    TilePositionIndex res_pos(128, 128);
+    TilePositionIndex cond_pos(128, 128);
+    cond_pos.set(51, 50, cond_id);
 
     BFSContext ctx{
         grid,
@@ -227,7 +228,7 @@ TEST(bfs_resets_is_connected_before_traversal) {
     ASSERT(registry.get<FluidConduitComponent>(cond_ent).is_connected);
 
     // Remove extractor from positions - conduit should become disconnected
-    std::unordered_map<uint64_t, uint32_t> empty_ext_pos;
+    TilePositionIndex empty_ext_pos(128, 128);
     BFSContext ctx2{
         grid,
         empty_ext_pos,
@@ -266,12 +267,12 @@ TEST(conduit_with_gap_partially_connected) {
     uint32_t c2_id = static_cast<uint32_t>(c2_ent);
 
     FluidCoverageGrid grid(128, 128);
-    std::unordered_map<uint64_t, uint32_t> ext_pos;
-    ext_pos[pack_pos(20, 50)] = ext_id;
-    std::unordered_map<uint64_t, uint32_t> res_pos;
-    std::unordered_map<uint64_t, uint32_t> cond_pos;
-    cond_pos[pack_pos(21, 50)] = c1_id;
-    cond_pos[pack_pos(80, 50)] = c2_id;
+    TilePositionIndex ext_pos(128, 128);
+    ext_pos.set(20, 50, ext_id);
+    TilePositionIndex res_pos(128, 128);
+    TilePositionIndex cond_pos(128, 128);
+    cond_pos.set(21, 50, c1_id);
+    cond_pos.set(80, 50, c2_id);
 
     BFSContext ctx{
         grid,
@@ -308,11 +309,11 @@ TEST(conduit_connected_via_reservoir) {
     uint32_t cond_id = static_cast<uint32_t>(cond_ent);
 
     FluidCoverageGrid grid(128, 128);
-    std::unordered_map<uint64_t, uint32_t> ext_pos;
-    std::unordered_map<uint64_t, uint32_t> res_pos;
-    res_pos[pack_pos(50, 50)] = res_id;
-    std::unordered_map<uint64_t, uint32_t> cond_pos;
-    cond_pos[pack_pos(51, 50)] = cond_id;
+    TilePositionIndex ext_pos(128, 128);
+    TilePositionIndex res_pos(128, 128);
+    res_pos.set(50, 50, res_id);
+    TilePositionIndex cond_pos(128, 128);
+    cond_pos.set(51, 50, cond_id);
 
     BFSContext ctx{
         grid,
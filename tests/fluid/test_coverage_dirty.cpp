@@ -8,6 +8,7 @@
  * - Set on place_extractor
  * - Cleared after recalculate (via tick)
  * - Per-player isolation
+ * - Network component flags: unsourced conduit edits skip the BFS
  *
  * Uses printf test pattern matching existing fluid tests.
  */
@@ -270,6 +271,49 @@ TEST(per_player_dirty_flag_survives_other_player_tick) {
     ASSERT(!sys.is_coverage_dirty(1));
 }
 
+// =============================================================================
+// Network components
+// =============================================================================
+
+TEST(unsourced_conduit_edits_leave_coverage_unchanged) {
+    FluidSystem sys(64, 64);
+    entt::registry registry;
+    sys.set_registry(&registry);
+
+    sys.place_reservoir(10, 10, 0);
+    sys.tick(0.016f);
+    uint32_t base_coverage = sys.get_coverage_count(1);
+    ASSERT(base_coverage > 0);
+
+    // Isolated conduit: still reported dirty, but cannot add coverage
+    ASSERT(!sys.is_network_dirty(0));
+    uint32_t isolated = sys.place_conduit(30, 30, 0);
+    ASSERT(sys.is_coverage_dirty(0));
+    ASSERT(sys.is_network_dirty(0));
+    ASSERT(!sys.is_network_dirty(1));
+    ASSERT(!sys.is_network_dirty(7));
+    ASSERT(!sys.is_connected_to_source(30, 30, 0));
+    ASSERT_EQ(sys.get_network_component_count(0), 2u);
+    sys.tick(0.016f);
+    ASSERT(!sys.is_coverage_dirty(0));
+    ASSERT(!sys.is_network_dirty(0));
+    ASSERT_EQ(sys.get_coverage_count(1), base_coverage);
+
+    ASSERT(sys.remove_conduit(isolated, 0, 30, 30));
+    ASSERT(sys.is_coverage_dirty(0));
+    sys.tick(0.016f);
+    ASSERT_EQ(sys.get_coverage_count(1), base_coverage);
+
+    // Conduits chained from the reservoir join a sourced network
+    for (uint32_t x = 11; x <= 16; ++x) {
+        sys.place_conduit(x, 10, 0);
+    }
+    ASSERT(sys.is_connected_to_source(16, 10, 0));
+    ASSERT(!sys.is_network_dirty(0));
+    sys.tick(0.016f);
+    ASSERT(sys.get_coverage_count(1) > base_coverage);
+}
+
 // =============================================================================
 // Main
 // =============================================================================
@@ -306,6 +350,9 @@ int main() {
     RUN_TEST(per_player_dirty_flag_isolation);
     RUN_TEST(per_player_dirty_flag_survives_other_player_tick);
 
+    // Network components
+    RUN_TEST(unsourced_conduit_edits_leave_coverage_unchanged);
+
     printf("\n=== Results: %d passed, %d failed ===\n",
            tests_passed, tests_failed);
 
@@ -27,9 +27,9 @@
 #include <chrono>
 #include <cstdio>
 #include <cstdlib>
-#include <unordered_map>
 
 using namespace sims3000::fluid;
+using sims3000::TilePositionIndex;
 
 // Test result tracking
 static int tests_passed = 0;
@@ -111,12 +111,12 @@ TEST(single_extractor_seeds_coverage) {
 
     uint32_t ext_id = create_extractor(registry, true);
 
-    std::unordered_map<uint64_t, uint32_t> extractor_positions;
-    std::unordered_map<uint64_t, uint32_t> reservoir_positions;
-    std::unordered_map<uint64_t, uint32_t> conduit_positions;
+    TilePositionIndex extractor_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex reservoir_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex conduit_positions(MAP_SIZE, MAP_SIZE);
 
     // Place extractor at (30, 30)
-    extractor_positions[pack_pos(30, 30)] = ext_id;
+    extractor_positions.set(30, 30, ext_id);
 
     BFSContext ctx{
         grid,
@@ -157,12 +157,12 @@ TEST(reservoir_seeds_coverage) {
 
     uint32_t res_id = create_reservoir(registry);
 
-    std::unordered_map<uint64_t, uint32_t> extractor_positions;
-    std::unordered_map<uint64_t, uint32_t> reservoir_positions;
-    std::unordered_map<uint64_t, uint32_t> conduit_positions;
+    TilePositionIndex extractor_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex reservoir_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex conduit_positions(MAP_SIZE, MAP_SIZE);
 
     // Place reservoir at (20, 20)
-    reservoir_positions[pack_pos(20, 20)] = res_id;
+    reservoir_positions.set(20, 20, res_id);
 
     BFSContext ctx{
         grid,
@@ -199,13 +199,13 @@ TEST(conduit_extends_coverage_from_extractor) {
     uint32_t ext_id = create_extractor(registry, true);
     uint32_t cond_id = create_conduit(registry, 2);
 
-    std::unordered_map<uint64_t, uint32_t> extractor_positions;
-    std::unordered_map<uint64_t, uint32_t> reservoir_positions;
-    std::unordered_map<uint64_t, uint32_t> conduit_positions;
+    TilePositionIndex extractor_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex reservoir_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex conduit_positions(MAP_SIZE, MAP_SIZE);
 
     // Extractor at (30, 30), conduit adjacent at (31, 30)
-    extractor_positions[pack_pos(30, 30)] = ext_id;
-    conduit_positions[pack_pos(31, 30)] = cond_id;
+    extractor_positions.set(30, 30, ext_id);
+    conduit_positions.set(31, 30, cond_id);
 
     BFSContext ctx{
         grid,
@@ -242,18 +242,18 @@ TEST(chain_of_conduits_extends_coverage) {
 
     uint32_t ext_id = create_extractor(registry, true);
 
-    std::unordered_map<uint64_t, uint32_t> extractor_positions;
-    std::unordered_map<uint64_t, uint32_t> reservoir_positions;
-    std::unordered_map<uint64_t, uint32_t> conduit_positions;
+    TilePositionIndex extractor_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex reservoir_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex conduit_positions(MAP_SIZE, MAP_SIZE);
 
     // Extractor at (50, 50)
-    extractor_positions[pack_pos(50, 50)] = ext_id;
+    extractor_positions.set(50, 50, ext_id);
 
     // Chain of conduits extending right: (51,50), (52,50), (53,50), (54,50), (55,50)
     uint32_t cond_ids[5];
     for (int i = 0; i < 5; ++i) {
         cond_ids[i] = create_conduit(registry, 2);
-        conduit_positions[pack_pos(51 + i, 50)] = cond_ids[i];
+        conduit_positions.set(51 + i, 50, cond_ids[i]);
     }
 
     BFSContext ctx{
@@ -299,15 +299,15 @@ TEST(isolated_conduit_stays_disconnected) {
     uint32_t ext_id = create_extractor(registry, true);
     uint32_t isolated_cond_id = create_conduit(registry, 2);
 
-    std::unordered_map<uint64_t, uint32_t> extractor_positions;
-    std::unordered_map<uint64_t, uint32_t> reservoir_positions;
-    std::unordered_map<uint64_t, uint32_t> conduit_positions;
+    TilePositionIndex extractor_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex reservoir_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex conduit_positions(MAP_SIZE, MAP_SIZE);
 
     // Extractor at (10, 10)
-    extractor_positions[pack_pos(10, 10)] = ext_id;
+    extractor_positions.set(10, 10, ext_id);
 
     // Isolated conduit far away at (50, 50) - not adjacent to anything
-    conduit_positions[pack_pos(50, 50)] = isolated_cond_id;
+    conduit_positions.set(50, 50, isolated_cond_id);
 
     BFSContext ctx{
         grid,
@@ -343,12 +343,12 @@ TEST(non_operational_extractor_no_coverage) {
     // Create a non-operational extractor (is_operational = false)
     uint32_t ext_id = create_extractor(registry, false);
 
-    std::unordered_map<uint64_t, uint32_t> extractor_positions;
-    std::unordered_map<uint64_t, uint32_t> reservoir_positions;
-    std::unordered_map<uint64_t, uint32_t> conduit_positions;
+    TilePositionIndex extractor_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex reservoir_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex conduit_positions(MAP_SIZE, MAP_SIZE);
 
     // Place non-operational extractor at (30, 30)
-    extractor_positions[pack_pos(30, 30)] = ext_id;
+    extractor_positions.set(30, 30, ext_id);
 
     BFSContext ctx{
         grid,
@@ -379,13 +379,13 @@ TEST(multiple_producers_seed_independently) {
     uint32_t ext_id = create_extractor(registry, true);
     uint32_t res_id = create_reservoir(registry);
 
-    std::unordered_map<uint64_t, uint32_t> extractor_positions;
-    std::unordered_map<uint64_t, uint32_t> reservoir_positions;
-    std::unordered_map<uint64_t, uint32_t> conduit_positions;
+    TilePositionIndex extractor_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex reservoir_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex conduit_positions(MAP_SIZE, MAP_SIZE);
 
     // Extractor at (20, 20), Reservoir at (80, 80) - far apart
-    extractor_positions[pack_pos(20, 20)] = ext_id;
-    reservoir_positions[pack_pos(80, 80)] = res_id;
+    extractor_positions.set(20, 20, ext_id);
+    reservoir_positions.set(80, 80, res_id);
 
     BFSContext ctx{
         grid,
@@ -425,11 +425,11 @@ TEST(bfs_doesnt_cross_map_boundaries) {
     // Extractor at corner (0, 0)
     uint32_t ext_id = create_extractor(registry, true);
 
-    std::unordered_map<uint64_t, uint32_t> extractor_positions;
-    std::unordered_map<uint64_t, uint32_t> reservoir_positions;
-    std::unordered_map<uint64_t, uint32_t> conduit_positions;
+    TilePositionIndex extractor_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex reservoir_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex conduit_positions(MAP_SIZE, MAP_SIZE);
 
-    extractor_positions[pack_pos(0, 0)] = ext_id;
+    extractor_positions.set(0, 0, ext_id);
 
     BFSContext ctx{
         grid,
@@ -466,11 +466,11 @@ TEST(bfs_at_bottom_right_corner) {
     // Extractor at bottom-right corner (31, 31)
     uint32_t ext_id = create_extractor(registry, true);
 
-    std::unordered_map<uint64_t, uint32_t> extractor_positions;
-    std::unordered_map<uint64_t, uint32_t> reservoir_positions;
-    std::unordered_map<uint64_t, uint32_t> conduit_positions;
+    TilePositionIndex extractor_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex reservoir_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex conduit_positions(MAP_SIZE, MAP_SIZE);
 
-    extractor_positions[pack_pos(31, 31)] = ext_id;
+    extractor_positions.set(31, 31, ext_id);
 
     BFSContext ctx{
         grid,
@@ -507,16 +507,16 @@ TEST(conduit_not_adjacent_to_producer_disconnected) {
     uint32_t cond1_id = create_conduit(registry, 2);
     uint32_t cond2_id = create_conduit(registry, 2);
 
-    std::unordered_map<uint64_t, uint32_t> extractor_positions;
-    std::unordered_map<uint64_t, uint32_t> reservoir_positions;
-    std::unordered_map<uint64_t, uint32_t> conduit_positions;
+    TilePositionIndex extractor_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex reservoir_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex conduit_positions(MAP_SIZE, MAP_SIZE);
 
     // Extractor at (10, 10), conduit adjacent at (11, 10)
-    extractor_positions[pack_pos(10, 10)] = ext_id;
-    conduit_positions[pack_pos(11, 10)] = cond1_id;
+    extractor_positions.set(10, 10, ext_id);
+    conduit_positions.set(11, 10, cond1_id);
 
     // Conduit at (13, 10) - gap of 1 tile from first conduit, not adjacent
-    conduit_positions[pack_pos(13, 10)] = cond2_id;
+    conduit_positions.set(13, 10, cond2_id);
 
     BFSContext ctx{
         grid,
@@ -559,12 +559,12 @@ TEST(coverage_clears_before_recalculation) {
 
     uint32_t ext_id = create_extractor(registry, true);
 
-    std::unordered_map<uint64_t, uint32_t> extractor_positions;
-    std::unordered_map<uint64_t, uint32_t> reservoir_positions;
-    std::unordered_map<uint64_t, uint32_t> conduit_positions;
+    TilePositionIndex extractor_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex reservoir_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex conduit_positions(MAP_SIZE, MAP_SIZE);
 
     // Extractor at (10, 10) - far from pre-set coverage
-    extractor_positions[pack_pos(10, 10)] = ext_id;
+    extractor_positions.set(10, 10, ext_id);
 
     BFSContext ctx{
         grid,
@@ -602,11 +602,11 @@ TEST(different_owners_dont_interfere) {
     // Now run BFS for owner 1 (player 0)
     uint32_t ext_id = create_extractor(registry, true);
 
-    std::unordered_map<uint64_t, uint32_t> extractor_positions;
-    std::unordered_map<uint64_t, uint32_t> reservoir_positions;
-    std::unordered_map<uint64_t, uint32_t> conduit_positions;
+    TilePositionIndex extractor_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex reservoir_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex conduit_positions(MAP_SIZE, MAP_SIZE);
 
-    extractor_positions[pack_pos(10, 10)] = ext_id;
+    extractor_positions.set(10, 10, ext_id);
 
     BFSContext ctx{
         grid,
@@ -640,13 +640,13 @@ TEST(reservoir_connects_to_conduits) {
     uint32_t res_id = create_reservoir(registry);
     uint32_t cond_id = create_conduit(registry, 2);
 
-    std::unordered_map<uint64_t, uint32_t> extractor_positions;
-    std::unordered_map<uint64_t, uint32_t> reservoir_positions;
-    std::unordered_map<uint64_t, uint32_t> conduit_positions;
+    TilePositionIndex extractor_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex reservoir_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex conduit_positions(MAP_SIZE, MAP_SIZE);
 
     // Reservoir at (20, 20), conduit adjacent at (21, 20)
-    reservoir_positions[pack_pos(20, 20)] = res_id;
-    conduit_positions[pack_pos(21, 20)] = cond_id;
+    reservoir_positions.set(20, 20, res_id);
+    conduit_positions.set(21, 20, cond_id);
 
     BFSContext ctx{
         grid,
@@ -676,9 +676,9 @@ TEST(empty_grid_no_coverage) {
     FluidCoverageGrid grid(MAP_SIZE, MAP_SIZE);
     entt::registry registry;
 
-    std::unordered_map<uint64_t, uint32_t> extractor_positions;
-    std::unordered_map<uint64_t, uint32_t> reservoir_positions;
-    std::unordered_map<uint64_t, uint32_t> conduit_positions;
+    TilePositionIndex extractor_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex reservoir_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex conduit_positions(MAP_SIZE, MAP_SIZE);
 
     BFSContext ctx{
         grid,
@@ -708,13 +708,13 @@ TEST(conduit_connected_resets_between_runs) {
     uint32_t ext_id = create_extractor(registry, true);
     uint32_t cond_id = create_conduit(registry, 2);
 
-    std::unordered_map<uint64_t, uint32_t> extractor_positions;
-    std::unordered_map<uint64_t, uint32_t> reservoir_positions;
-    std::unordered_map<uint64_t, uint32_t> conduit_positions;
+    TilePositionIndex extractor_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex reservoir_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex conduit_positions(MAP_SIZE, MAP_SIZE);
 
     // Extractor at (10, 10), conduit adjacent at (11, 10)
-    extractor_positions[pack_pos(10, 10)] = ext_id;
-    conduit_positions[pack_pos(11, 10)] = cond_id;
+    extractor_positions.set(10, 10, ext_id);
+    conduit_positions.set(11, 10, cond_id);
 
     BFSContext ctx{
         grid,
@@ -753,9 +753,9 @@ TEST(large_grid_performance) {
     FluidCoverageGrid grid(MAP_SIZE, MAP_SIZE);
     entt::registry registry;
 
-    std::unordered_map<uint64_t, uint32_t> extractor_positions;
-    std::unordered_map<uint64_t, uint32_t> reservoir_positions;
-    std::unordered_map<uint64_t, uint32_t> conduit_positions;
+    TilePositionIndex extractor_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex reservoir_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex conduit_positions(MAP_SIZE, MAP_SIZE);
 
     // Place 4 extractors in different quadrants
     uint32_t ext1 = create_extractor(registry, true);
@@ -763,16 +763,16 @@ TEST(large_grid_performance) {
     uint32_t ext3 = create_extractor(registry, true);
     uint32_t ext4 = create_extractor(registry, true);
 
-    extractor_positions[pack_pos(50, 50)] = ext1;
-    extractor_positions[pack_pos(200, 50)] = ext2;
-    extractor_positions[pack_pos(50, 200)] = ext3;
-    extractor_positions[pack_pos(200, 200)] = ext4;
+    extractor_positions.set(50, 50, ext1);
+    extractor_positions.set(200, 50, ext2);
+    extractor_positions.set(50, 200, ext3);
+    extractor_positions.set(200, 200, ext4);
 
     // Place 1000 conduits in a connected chain from extractor 1
     // Create a long chain going right then down
     for (uint32_t i = 0; i < 500; ++i) {
         uint32_t cid = create_conduit(registry, 2);
-        conduit_positions[pack_pos(51 + i, 50)] = cid;
+        conduit_positions.set(51 + i, 50, cid);
     }
     // Chain going down from (51, 50) isn't connected to above,
     // so let's place chain going down from (50, 51)
@@ -781,7 +781,7 @@ TEST(large_grid_performance) {
         // Make sure we don't go out of bounds (map is 256)
         uint32_t y = 51 + i;
         if (y >= MAP_SIZE) break;
-        conduit_positions[pack_pos(50, y)] = cid;
+        conduit_positions.set(50, y, cid);
     }
 
     BFSContext ctx{
@@ -821,12 +821,12 @@ TEST(l_shaped_conduit_network) {
 
     uint32_t ext_id = create_extractor(registry, true);
 
-    std::unordered_map<uint64_t, uint32_t> extractor_positions;
-    std::unordered_map<uint64_t, uint32_t> reservoir_positions;
-    std::unordered_map<uint64_t, uint32_t> conduit_positions;
+    TilePositionIndex extractor_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex reservoir_positions(MAP_SIZE, MAP_SIZE);
+    TilePositionIndex conduit_positions(MAP_SIZE, MAP_SIZE);
 
     // Extractor at (30, 30)
-    extractor_positions[pack_pos(30, 30)] = ext_id;
+    extractor_positions.set(30, 30, ext_id);
 
     // L-shaped conduit chain: right 3, then down 3
     uint32_t c1 = create_conduit(registry, 2);
@@ -836,12 +836,12 @@ TEST(l_shaped_conduit_network) {
     uint32_t c5 = create_conduit(registry, 2);
     uint32_t c6 = create_conduit(registry, 2);
 
-    conduit_positions[pack_pos(31, 30)] = c1; // right
-    conduit_positions[pack_pos(32, 30)] = c2; // right
-    conduit_positions[pack_pos(33, 30)] = c3; // right (corner)
-    conduit_positions[pack_pos(33, 31)] = c4; // down
-    conduit_positions[pack_pos(33, 32)] = c5; // down
-    conduit_positions[pack_pos(33, 33)] = c6; // down
+    conduit_positions.set(31, 30, c1); // right
+    conduit_positions.set(32, 30, c2); // right
+    conduit_positions.set(33, 30, c3); // right (corner)
+    conduit_positions.set(33, 31, c4); // down
+    conduit_positions.set(33, 32, c5); // down
+    conduit_positions.set(33, 33, c6); // down
 
     BFSContext ctx{
         grid,
@@ -11,6 +11,8 @@
  * - Combined factor calculations
  * - Clamping to [0, 255]
  * - Full grid recalculation
+ * - Lookup tables and the fused planar kernel match per-tile results
+ * - Rectangle recalculation touches only the (clipped) rectangle
  */
 
 #include <sims3000/landvalue/FullValueRecalculation.h>
@@ -360,6 +362,118 @@ TEST(recalculate_mixed_factors) {
     ASSERT(odd_value > 0 && odd_value < 50);  // Should be low but not zero
 }
 
+// =============================================================================
+// Fused Planar Kernel Tests
+// =============================================================================
+
+TEST(tables_match_tile_value) {
+    const LandValueTables& tables = get_land_value_tables();
+    for (int t = 0; t < 256; ++t) {
+        for (int w = 0; w < 256; ++w) {
+            LandValueTileInput input = {static_cast<uint8_t>(t), static_cast<uint8_t>(w), 255, 0, 0};
+            const int sum = BASE_LAND_VALUE + tables.terrain[t] + tables.water[w];
+            ASSERT_EQ(calculate_tile_value(input), static_cast<uint8_t>(sum));
+        }
+    }
+    for (int v = 0; v < 256; ++v) {
+        const uint8_t b = static_cast<uint8_t>(v);
+        ASSERT_EQ(tables.road[v], calculate_tile_value({0, 255, b, 0, 0}) - BASE_LAND_VALUE);
+        ASSERT_EQ(tables.disorder[v], calculate_tile_value({0, 255, 255, b, 0}) - BASE_LAND_VALUE);
+        ASSERT_EQ(tables.contamination[v], calculate_tile_value({0, 255, 255, 0, b}) - BASE_LAND_VALUE);
+    }
+}
+
+TEST(planar_kernel_matches_tile_inputs) {
+    // Odd width exercises the scalar tail and a partial second chunk;
+    // terrain is read with a 4-byte stride like TerrainGrid::tiles.
+    const uint16_t width = 301;
+    const uint16_t height = 5;
+    const size_t count = static_cast<size_t>(width) * height;
+
+    std::vector<uint8_t> terrain(count * 4, 0xEE);
+    std::vector<uint8_t> water(count), road(count), disorder(count), contam(count);
+    std::vector<LandValueTileInput> inputs(count);
+    uint32_t seed = 12345;
+    auto next = [&seed]() {
+        seed = seed * 1103515245u + 12345u;
+        return static_cast<uint8_t>(seed >> 16);
+    };
+    for (size_t i = 0; i < count; ++i) {
+        terrain[i * 4] = next() % 10;
+        water[i] = next() % 6;
+        road[i] = (i % 7 == 0) ? 255 : next() % 5;
+        disorder[i] = next();
+        contam[i] = (i % 3 == 0) ? 255 : next();
+        inputs[i] = {terrain[i * 4], water[i], road[i], disorder[i], contam[i]};
+    }
+
+    LandValueGrid expected(width, height);
+    recalculate_all_values(expected, inputs.data(), static_cast<uint32_t>(count));
+
+    LandValueInputPlanes planes;
+    planes.terrain_types = terrain.data();
+    planes.terrain_stride = 4;
+    planes.water_distances = water.data();
+    planes.road_distances = road.data();
+    planes.disorder_levels = disorder.data();
+    planes.contam_levels = contam.data();
+
+    LandValueGrid actual(width, height);
+    (void)actual.get_value_data();  // overlay buffer clean before the kernel runs
+    recalculate_all_values(actual, planes);
+
+    const uint8_t* overlay = actual.get_value_data();
+    for (int32_t y = 0; y < height; ++y) {
+        for (int32_t x = 0; x < width; ++x) {
+            ASSERT_EQ(actual.get_value(x, y), expected.get_value(x, y));
+            ASSERT_EQ(overlay[static_cast<size_t>(y) * width + x], expected.get_value(x, y));
+        }
+    }
+}
+
+TEST(planar_kernel_missing_plane_noop) {
+    LandValueGrid grid(4, 4);
+    grid.set_value(0, 0, 200);
+
+    std::vector<uint8_t> plane(16, 0);
+    LandValueInputPlanes planes;
+    planes.terrain_types = plane.data();
+    planes.water_distances = plane.data();
+    planes.road_distances = plane.data();
+    planes.disorder_levels = plane.data();
+    // contam_levels left null
+
+    recalculate_all_values(grid, planes);
+    ASSERT_EQ(grid.get_value(0, 0), static_cast<uint8_t>(200));
+}
+
+TEST(planar_kernel_rect_clipped) {
+    LandValueGrid grid(8, 8);
+    for (int32_t y = 0; y < 8; ++y) {
+        for (int32_t x = 0; x < 8; ++x) {
+            grid.set_value(x, y, 7);
+        }
+    }
+
+    std::vector<uint8_t> terrain(64, TERRAIN_PRISMA_FIELDS);  // +25
+    std::vector<uint8_t> far(64, 255);
+    std::vector<uint8_t> zero(64, 0);
+    LandValueInputPlanes planes;
+    planes.terrain_types = terrain.data();
+    planes.water_distances = far.data();
+    planes.road_distances = far.data();
+    planes.disorder_levels = zero.data();
+    planes.contam_levels = zero.data();
+
+    // Extends past the right and bottom edges
+    recalculate_values_in_rect(grid, planes, 5, 6, 10, 10);
+
+    ASSERT_EQ(grid.get_value(5, 6), static_cast<uint8_t>(153));
+    ASSERT_EQ(grid.get_value(7, 7), static_cast<uint8_t>(153));
+    ASSERT_EQ(grid.get_value(4, 6), static_cast<uint8_t>(7));
+    ASSERT_EQ(grid.get_value(5, 5), static_cast<uint8_t>(7));
+}
+
 // =============================================================================
 // Constant Verification Tests
 // =============================================================================
@@ -408,6 +522,12 @@ int main() {
     RUN_TEST(recalculate_wrong_count_noop);
     RUN_TEST(recalculate_mixed_factors);
 
+    // Fused planar kernel tests
+    RUN_TEST(tables_match_tile_value);
+    RUN_TEST(planar_kernel_matches_tile_inputs);
+    RUN_TEST(planar_kernel_missing_plane_noop);
+    RUN_TEST(planar_kernel_rect_clipped);
+
     // Constants tests
     RUN_TEST(constants_values);
 
@@ -9,6 +9,9 @@
  * - get_land_value() returns float value
  * - tick() resets grid values (all become 128 neutral after tick since stubs are empty)
  * - tick() runs without crash
+ * - tick() recalculates from source grids once they are set
+ * - Only dirty blocks are recomputed; notifications and the
+ *   reconciliation sweep pick up changes
  */
 
 #include <cassert>
@@ -18,6 +21,12 @@
 
 #include "sims3000/landvalue/LandValueSystem.h"
 #include "sims3000/core/ISimulationTime.h"
+#include "sims3000/terrain/TerrainGrid.h"
+#include "sims3000/terrain/WaterDistanceField.h"
+#include "sims3000/transport/PathwayGrid.h"
+#include "sims3000/transport/ProximityCache.h"
+#include "sims3000/disorder/DisorderGrid.h"
+#include "sims3000/contamination/ContaminationGrid.h"
 
 using namespace sims3000;
 using namespace sims3000::landvalue;
@@ -179,6 +188,127 @@ static void test_tick_resets_values() {
     std::printf("  PASS: tick() resets grid values to 128 (neutral)\n");
 }
 
+// --------------------------------------------------------------------------
+// Test: tick() recalculates from source grids once they are set
+// --------------------------------------------------------------------------
+static void test_tick_uses_sources() {
+    LandValueSystem system(128, 128);
+    MockSimulationTime time(0);
+
+    terrain::TerrainGrid terrain(terrain::MapSize::Small);
+    terrain::WaterDistanceField water(terrain::MapSize::Small);
+    transport::PathwayGrid pathways(128, 128);
+    transport::ProximityCache roads(128, 128);
+    disorder::DisorderGrid disorder_grid(128, 128);
+    contamination::ContaminationGrid contam_grid(128, 128);
+
+    // (5,5): prisma fields (+25), next to water (+30), road 1 away (+15)
+    terrain.tiles[5 * 128 + 5].terrain_type = 6;
+    water.distances[5 * 128 + 5] = 1;
+    pathways.set_pathway(5, 6, 1);
+    roads.rebuild_if_dirty(pathways);
+
+    // Incomplete sources keep the stub phases
+    LandValueSources sources;
+    sources.terrain = &terrain;
+    system.set_sources(sources);
+    system.tick(time);
+    assert(system.get_grid().get_value(5, 5) == 128 && "Incomplete sources leave values neutral");
+
+    sources.water = &water;
+    sources.roads = &roads;
+    sources.disorder = &disorder_grid;
+    sources.contamination = &contam_grid;
+    system.set_sources(sources);
+
+    system.tick(time);
+    assert(system.get_grid().get_value(5, 5) == 198 && "128 + 25 + 30 + 15");
+    assert(system.get_grid().get_value(5, 6) == 148 && "On road: 128 + 20");
+    assert(system.get_grid().get_value(100, 100) == 128 && "No factors: neutral");
+
+    // Penalties read the previous tick buffers, which swap each tick
+    disorder_grid.set_level(5, 5, 255);    // -40
+    contam_grid.set_level(5, 5, 255);      // -50
+    system.tick(time);
+    assert(system.get_grid().get_value(5, 5) == 198 && "Current buffers are not read");
+    disorder_grid.swap_buffers();
+    contam_grid.swap_buffers();
+    system.tick(time);
+    assert(system.get_grid().get_value(5, 5) == 108 && "198 - 40 - 50");
+
+    std::printf("  PASS: tick() recalculates from source grids\n");
+}
+
+// --------------------------------------------------------------------------
+// Test: incremental recomputation of dirty blocks
+// --------------------------------------------------------------------------
+static void test_incremental_dirty_blocks() {
+    LandValueSystem system(128, 128);  // 8x8 blocks
+    MockSimulationTime time(0);
+
+    terrain::TerrainGrid terrain(terrain::MapSize::Small);
+    terrain::WaterDistanceField water(terrain::MapSize::Small);
+    transport::PathwayGrid pathways(128, 128);
+    transport::ProximityCache roads(128, 128);
+    disorder::DisorderGrid disorder_grid(128, 128);
+    contamination::ContaminationGrid contam_grid(128, 128);
+    roads.rebuild_if_dirty(pathways);
+
+    LandValueSources sources;
+    sources.terrain = &terrain;
+    sources.water = &water;
+    sources.roads = &roads;
+    sources.disorder = &disorder_grid;
+    sources.contamination = &contam_grid;
+    system.set_sources(sources);
+
+    // First tick recomputes everything
+    system.tick(time);
+    assert(system.get_last_recomputed_blocks() == 64 && "First tick is a full pass");
+
+    // Quiet tick: only the reconciliation row (block row 0)
+    system.tick(time);
+    assert(system.get_last_recomputed_blocks() == 8 && "Quiet tick recomputes one block row");
+
+    // Unreported terrain change stays stale until notified
+    terrain.tiles[90 * 128 + 40].terrain_type = 6;  // +25
+    system.tick(time);  // sweep reconciles block row 2 (rows 32-47)
+    assert(system.get_grid().get_value(40, 90) == 128 && "Unreported change not yet picked up");
+
+    terrain::TerrainModifiedEvent event(40, 90, terrain::ModificationType::Terraformed);
+    system.on_terrain_modified(event);
+    system.tick(time);  // block (2,5) dirty + block row 3 sweep
+    assert(system.get_grid().get_value(40, 90) == 153 && "Reported change applied");
+    assert(system.get_last_recomputed_blocks() == 9 && "One dirty block plus one sweep row");
+
+    // Pathway edits reach FACTOR_REACH tiles, across block edges
+    pathways.set_pathway(47, 60, 1);
+    roads.on_pathway_added(47, 60);
+    system.on_pathway_changed(47, 60);
+    system.tick(time);
+    assert(system.get_grid().get_value(47, 60) == 148 && "On road: +20");
+    assert(system.get_grid().get_value(50, 60) == 133 && "Three tiles away (next block): +5");
+    assert(system.get_grid().get_value(51, 60) == 128 && "Beyond reach: neutral");
+
+    // Penalty blocks follow the previous-tick activity, including clearing
+    disorder_grid.set_level(100, 100, 255);
+    disorder_grid.swap_buffers();
+    system.tick(time);
+    assert(system.get_grid().get_value(100, 100) == 88 && "Disorder applied: 128 - 40");
+    disorder_grid.swap_buffers();  // previous buffer is zero again
+    system.tick(time);
+    assert(system.get_grid().get_value(100, 100) == 128 && "Cleared disorder restores value");
+
+    // Unreported change is repaired by the sweep within one cycle
+    terrain.tiles[120 * 128 + 3].terrain_type = 7;  // +15
+    for (int i = 0; i < 8; ++i) {
+        system.tick(time);
+    }
+    assert(system.get_grid().get_value(3, 120) == 143 && "Sweep reconciles unreported change");
+
+    std::printf("  PASS: incremental recomputation of dirty blocks\n");
+}
+
 // --------------------------------------------------------------------------
 // Test: tick() runs without crash
 // --------------------------------------------------------------------------
@@ -252,6 +382,8 @@ int main() {
     test_get_land_value_out_of_bounds();
     test_tick_resets_values();
     test_tick_no_crash();
+    test_tick_uses_sources();
+    test_incremental_dirty_blocks();
     test_terrain_bonus_preserved();
     test_isimulatable_polymorphism();
 
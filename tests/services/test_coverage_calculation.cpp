@@ -9,6 +9,9 @@
  * - Inactive building skip
  * - Max-value overlap from multiple buildings
  * - Edge cases: zero radius, out-of-bounds position, empty buildings
+ * - Coverage stamps match the per-tile falloff formula
+ * - Stamp and distance-transform paths match a per-tile reference
+ * - Incremental add/remove of single buildings matches a full recalculation
  */
 
 #include <sims3000/services/CoverageCalculation.h>
@@ -17,6 +20,7 @@
 #include <cassert>
 #include <cstdio>
 #include <cmath>
+#include <cstdlib>
 #include <vector>
 
 using namespace sims3000::services;
@@ -439,6 +443,156 @@ void test_grid_cleared_before_calculation() {
     printf("  PASS: Grid is cleared before calculation\n");
 }
 
+// =============================================================================
+// Stamps and distance transform
+// =============================================================================
+
+/// Per-tile reference: the original building x radius^2 loop
+static void reference_coverage(std::vector<uint8_t>& out, int32_t w, int32_t h,
+                               const std::vector<ServiceBuildingData>& buildings) {
+    out.assign(static_cast<size_t>(w) * h, 0);
+    for (const auto& b : buildings) {
+        if (!b.is_active || !isValidServiceTier(b.tier)) {
+            continue;
+        }
+        int radius = get_service_config(b.type, static_cast<ServiceTier>(b.tier)).base_radius;
+        float eff = static_cast<float>(b.effectiveness) / 255.0f;
+        for (int32_t ty = 0; ty < h; ++ty) {
+            for (int32_t tx = 0; tx < w; ++tx) {
+                int distance = std::abs(tx - b.x) + std::abs(ty - b.y);
+                if (distance > radius) {
+                    continue;
+                }
+                float strength = calculate_falloff(eff, distance, radius);
+                uint8_t value = static_cast<uint8_t>(std::min(255.0f, strength * 255.0f + 0.5f));
+                uint8_t& cell = out[static_cast<size_t>(ty) * w + tx];
+                if (value > cell) {
+                    cell = value;
+                }
+            }
+        }
+    }
+}
+
+void test_stamp_matches_falloff() {
+    printf("Testing coverage stamp matches falloff formula...\n");
+
+    for (int radius : {1, 8, 15, 20}) {
+        for (int eff : {0, 1, 128, 200, 255}) {
+            CoverageStamp stamp = build_coverage_stamp(radius, static_cast<uint8_t>(eff));
+            assert(stamp.radius == radius);
+            assert(stamp.profile.size() == static_cast<size_t>(radius) + 1);
+            int size = 2 * radius + 1;
+            assert(stamp.mask.size() == static_cast<size_t>(size) * size);
+            for (int dy = -radius; dy <= radius; ++dy) {
+                for (int dx = -radius; dx <= radius; ++dx) {
+                    int distance = std::abs(dx) + std::abs(dy);
+                    float strength = calculate_falloff(eff / 255.0f, distance, radius);
+                    uint8_t expected = distance > radius ? 0 :
+                        static_cast<uint8_t>(std::min(255.0f, strength * 255.0f + 0.5f));
+                    assert(stamp.mask[(dy + radius) * size + (dx + radius)] == expected);
+                }
+            }
+            assert(stamp.profile[radius] == 0);
+        }
+    }
+
+    assert(build_coverage_stamp(0, 255).mask.empty());
+
+    printf("  PASS: Stamp values equal per-tile falloff\n");
+}
+
+void test_stamp_and_transform_match_reference() {
+    printf("Testing stamp and distance-transform paths match reference...\n");
+
+    const int32_t w = 67;
+    const int32_t h = 53;
+    std::vector<ServiceBuildingData> buildings;
+    uint32_t seed = 12345;
+    auto next = [&seed]() { seed = seed * 1103515245u + 12345u; return (seed >> 16) & 0x7FFF; };
+    for (int i = 0; i < 300; ++i) {
+        ServiceBuildingData b;
+        b.x = static_cast<int32_t>(next() % (w + 20)) - 10;  // some off the map
+        b.y = static_cast<int32_t>(next() % (h + 20)) - 10;
+        b.type = (next() & 1) ? ServiceType::Enforcer : ServiceType::HazardResponse;
+        b.tier = static_cast<uint8_t>(1 + next() % 3);
+        b.effectiveness = (next() % 4 == 0) ? static_cast<uint8_t>(next() % 256) : 255;
+        b.is_active = (next() % 8) != 0;
+        b.owner_id = 0;
+        buildings.push_back(b);
+    }
+
+    std::vector<uint8_t> expected;
+    reference_coverage(expected, w, h, buildings);
+
+    const CoverageMethod methods[] = {
+        CoverageMethod::Auto, CoverageMethod::Stamp, CoverageMethod::DistanceTransform
+    };
+    for (CoverageMethod method : methods) {
+        ServiceCoverageGrid grid(w, h);
+        calculate_radius_coverage(grid, buildings, method);
+        for (int32_t y = 0; y < h; ++y) {
+            for (int32_t x = 0; x < w; ++x) {
+                assert(grid.get_coverage_at(x, y) == expected[static_cast<size_t>(y) * w + x]);
+            }
+        }
+    }
+
+    printf("  PASS: All coverage methods match the per-tile reference\n");
+}
+
+void test_incremental_add_remove_matches_full() {
+    printf("Testing incremental add/remove matches full recalculation...\n");
+
+    const int32_t w = 48;
+    const int32_t h = 40;
+    std::vector<ServiceBuildingData> pool;
+    uint32_t seed = 777;
+    auto next = [&seed]() { seed = seed * 1103515245u + 12345u; return (seed >> 16) & 0x7FFF; };
+    for (int i = 0; i < 60; ++i) {
+        ServiceBuildingData b;
+        b.x = static_cast<int32_t>(next() % (w + 10)) - 5;
+        b.y = static_cast<int32_t>(next() % (h + 10)) - 5;
+        b.type = ServiceType::Enforcer;
+        b.tier = static_cast<uint8_t>(1 + next() % 3);
+        b.effectiveness = (next() % 3 == 0) ? static_cast<uint8_t>(next() % 256) : 255;
+        b.is_active = true;
+        b.owner_id = 0;
+        pool.push_back(b);
+    }
+    // Exact duplicates tie on every tile
+    pool[1] = pool[0];
+
+    ServiceCoverageGrid grid(w, h);
+    ServiceCoverageGrid full(w, h);
+    std::vector<ServiceBuildingData> live;
+    std::vector<size_t> live_ids;
+    for (int step = 0; step < 200; ++step) {
+        bool add = live.empty() || (live.size() < pool.size() && next() % 3 != 0);
+        if (add) {
+            size_t id = next() % pool.size();
+            live.push_back(pool[id]);
+            live_ids.push_back(id);
+            add_building_coverage(grid, pool[id]);
+        } else {
+            size_t k = next() % live.size();
+            ServiceBuildingData removed = live[k];
+            live[k] = live.back();
+            live.pop_back();
+            remove_building_coverage(grid, removed, live);
+        }
+
+        calculate_radius_coverage(full, live);
+        for (int32_t y = 0; y < h; ++y) {
+            for (int32_t x = 0; x < w; ++x) {
+                assert(grid.get_coverage_at(x, y) == full.get_coverage_at(x, y));
+            }
+        }
+    }
+
+    printf("  PASS: Incremental updates match full recalculation\n");
+}
+
 // =============================================================================
 // Main
 // =============================================================================
@@ -467,6 +621,11 @@ int main() {
     test_manhattan_distance_pattern();
     test_grid_cleared_before_calculation();
 
+    // Stamp / distance transform tests
+    test_stamp_matches_falloff();
+    test_stamp_and_transform_match_reference();
+    test_incremental_add_remove_matches_full();
+
     printf("\n=== All Coverage Calculation Tests Passed ===\n");
     return 0;
 }
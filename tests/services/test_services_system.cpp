@@ -9,9 +9,16 @@
  * - Tick doesn't crash (empty stub)
  * - Double init/cleanup safety
  * - Destructor cleanup
+ * - Parallel recalculation of dirty grids on a TaskScheduler
+ * - Provider registry: placement, removal and state updates are applied
+ *   to the grid without whole-grid rebuilds
  */
 
 #include <sims3000/services/ServicesSystem.h>
+#include <sims3000/services/ServiceCoverageGrid.h>
+#include <sims3000/services/ServiceEvents.h>
+#include <sims3000/services/CoverageCalculation.h>
+#include <sims3000/sim/TaskScheduler.h>
 #include <cassert>
 #include <cstdio>
 #include <cstring>
@@ -223,6 +230,176 @@ void test_isimulatable_interface() {
     printf("  PASS: ISimulatable interface conformance correct\n");
 }
 
+// =============================================================================
+// Parallel recalculation tests
+// =============================================================================
+
+void test_parallel_recalculation() {
+    printf("Testing dirty grids recalculate on a TaskScheduler...\n");
+
+    sims3000::sim::TaskScheduler scheduler(3);
+    ServicesSystem system;
+    system.init(64, 64);
+    system.set_task_scheduler(&scheduler);
+
+    for (uint8_t p = 0; p < ServicesSystem::MAX_PLAYERS; ++p) {
+        system.mark_all_dirty(p);
+    }
+    MockSimulationTime time;
+    system.tick(time);
+
+    assert(!system.isCoverageDirty());
+    for (uint8_t t = 0; t < SERVICE_TYPE_COUNT; ++t) {
+        for (uint8_t p = 0; p < ServicesSystem::MAX_PLAYERS; ++p) {
+            ServiceCoverageGrid* grid = system.get_coverage_grid(static_cast<ServiceType>(t), p);
+            assert(grid != nullptr);
+            assert(grid->get_width() == 64);
+            assert(grid->get_coverage_at(10, 10) == 0);
+        }
+    }
+
+    // Only the dirty grid is allocated when one combination changes
+    system.init(64, 64);
+    system.mark_dirty(ServiceType::Enforcer, 2);
+    system.tick(time);
+    assert(system.get_coverage_grid(ServiceType::Enforcer, 2) != nullptr);
+    assert(system.get_coverage_grid(ServiceType::Enforcer, 1) == nullptr);
+    assert(!system.is_dirty(ServiceType::Enforcer, 2));
+
+    printf("  PASS: Parallel recalculation covers every dirty grid\n");
+}
+
+// =============================================================================
+// Provider registry tests
+// =============================================================================
+
+/// True if the system's grid equals a full recalculation from its registry
+static bool grid_matches_registry(const ServicesSystem& system, ServiceType type, uint8_t player) {
+    const ServiceCoverageGrid* grid = system.get_coverage_grid(type, player);
+    ServiceCoverageGrid expected(system.getMapWidth(), system.getMapHeight());
+    calculate_radius_coverage(expected, system.get_providers(type, player));
+    for (uint32_t y = 0; y < expected.get_height(); ++y) {
+        for (uint32_t x = 0; x < expected.get_width(); ++x) {
+            if (grid->get_coverage_at(x, y) != expected.get_coverage_at(x, y)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void test_provider_registry_incremental() {
+    printf("Testing provider registry applies single-provider updates...\n");
+
+    ServicesSystem system;
+    system.init(128, 128);
+    MockSimulationTime time;
+
+    // First provider allocates the grid with one rebuild
+    system.on_service_building_placed(ServiceBuildingPlacedEvent(
+        1, 0, ServiceType::Enforcer, ServiceTier::Station, 40, 40));
+    system.tick(time);
+    assert(system.get_full_rebuild_count() == 1);
+    assert(system.get_providers(ServiceType::Enforcer, 0).size() == 1);
+    assert(system.get_coverage_grid(ServiceType::Enforcer, 0)->get_coverage_at(40, 40) == 255);
+
+    // Further placements, a removal and a state change are incremental
+    system.on_service_building_placed(ServiceBuildingPlacedEvent(
+        2, 0, ServiceType::Enforcer, ServiceTier::Post, 46, 40));
+    system.on_service_building_placed(ServiceBuildingPlacedEvent(
+        3, 0, ServiceType::Enforcer, ServiceTier::Nexus, 90, 90));
+    system.tick(time);
+    assert(grid_matches_registry(system, ServiceType::Enforcer, 0));
+
+    ServiceBuildingRemovedEvent removed;
+    removed.entity_id = 1;
+    system.on_service_building_removed(removed);
+    system.tick(time);
+    assert(system.get_providers(ServiceType::Enforcer, 0).size() == 2);
+    assert(grid_matches_registry(system, ServiceType::Enforcer, 0));
+    assert(system.get_coverage_grid(ServiceType::Enforcer, 0)->get_coverage_at(40, 40) < 255);
+
+    assert(system.set_provider_state(3, 128, true));
+    assert(system.set_provider_state(2, 255, false));
+    assert(!system.set_provider_state(1, 255, true));  // removed
+    system.tick(time);
+    assert(grid_matches_registry(system, ServiceType::Enforcer, 0));
+    assert(system.get_coverage_grid(ServiceType::Enforcer, 0)->get_coverage_at(46, 40) == 0);
+
+    assert(system.get_full_rebuild_count() == 1);
+    assert(!system.is_dirty(ServiceType::Enforcer, 0));
+
+    // Other players' grids are untouched
+    assert(system.get_coverage_grid(ServiceType::Enforcer, 1) == nullptr);
+
+    // Duplicate IDs and unknown removals are ignored
+    system.on_service_building_placed(ServiceBuildingPlacedEvent(
+        3, 0, ServiceType::Enforcer, ServiceTier::Post, 10, 10));
+    removed.entity_id = 99;
+    system.on_service_building_removed(removed);
+    assert(system.get_providers(ServiceType::Enforcer, 0).size() == 2);
+
+    // A dirty grid is rebuilt from the registry
+    system.mark_dirty(ServiceType::Enforcer, 0);
+    system.tick(time);
+    assert(system.get_full_rebuild_count() == 2);
+    assert(grid_matches_registry(system, ServiceType::Enforcer, 0));
+
+    system.cleanup();
+    assert(system.get_providers(ServiceType::Enforcer, 0).empty());
+
+    printf("  PASS: Provider updates are applied incrementally\n");
+}
+
+void test_building_events_feed_registry() {
+    printf("Testing building events update registered providers incrementally...\n");
+
+    ServicesSystem system;
+    system.init(128, 128);
+    MockSimulationTime time;
+
+    system.on_service_building_placed(ServiceBuildingPlacedEvent(
+        1, 0, ServiceType::Medical, ServiceTier::Station, 30, 30));
+    system.on_service_building_placed(ServiceBuildingPlacedEvent(
+        2, 0, ServiceType::Medical, ServiceTier::Post, 60, 30));
+    system.on_building_constructed(1, 0);
+    system.on_building_constructed(2, 0);
+    system.tick(time);
+    assert(system.get_full_rebuild_count() == 1);
+
+    // Constructing a registered provider dirties only its own type
+    system.on_service_building_placed(ServiceBuildingPlacedEvent(
+        3, 0, ServiceType::Medical, ServiceTier::Post, 90, 90));
+    system.on_building_constructed(3, 0);
+    assert(system.is_dirty(ServiceType::Medical, 0));
+    assert(!system.is_dirty(ServiceType::Enforcer, 0));
+    system.tick(time);
+    assert(grid_matches_registry(system, ServiceType::Medical, 0));
+
+    // Power change re-stamps the provider in place
+    system.on_building_power_changed(2, 0);
+    assert(system.is_dirty(ServiceType::Medical, 0));
+    assert(!system.is_dirty(ServiceType::Education, 0));
+    system.tick(time);
+    assert(grid_matches_registry(system, ServiceType::Medical, 0));
+
+    // Deconstruction unregisters the provider
+    system.on_building_deconstructed(1, 0);
+    assert(system.get_providers(ServiceType::Medical, 0).size() == 2);
+    assert(!system.is_dirty(ServiceType::HazardResponse, 0));
+    system.tick(time);
+    assert(grid_matches_registry(system, ServiceType::Medical, 0));
+    assert(system.get_full_rebuild_count() == 1);
+
+    // Unregistered entities still mark every type dirty
+    system.on_building_power_changed(42, 0);
+    assert(system.is_dirty(ServiceType::Enforcer, 0));
+    assert(system.is_dirty(ServiceType::Medical, 0));
+
+    system.cleanup();
+    printf("  PASS: Building events update registered providers incrementally\n");
+}
+
 // =============================================================================
 // Main
 // =============================================================================
@@ -243,6 +420,9 @@ int main() {
     test_tick_multiple_calls();
     test_max_players();
     test_isimulatable_interface();
+    test_parallel_recalculation();
+    test_provider_registry_incremental();
+    test_building_events_feed_registry();
 
     printf("\n=== All ServicesSystem Tests Passed ===\n");
     return 0;
@@ -11,9 +11,12 @@
  * - Interpolation between ticks
  * - Multiple ticks fire when delta is large
  * - No ticks fire when accumulated time is below threshold
+ * - Declared access groups non-conflicting systems into shared stages
+ * - Worker-thread ticking matches serial results
  */
 
 #include "sims3000/sim/SimulationCore.h"
+#include <atomic>
 #include <cassert>
 #include <cmath>
 #include <cstdio>
@@ -397,6 +400,160 @@ void test_empty_update() {
     printf("  PASS: Empty core updates without crash\n");
 }
 
+// =========================================================================
+// Test helper: system with declared access
+// =========================================================================
+
+class AccessSystem : public ISimulatable {
+public:
+    AccessSystem(int priority, const char* name, SystemAccess access,
+                 std::vector<int>* cells, size_t read_cell, size_t write_cell)
+        : m_priority(priority), m_name(name), m_access(access)
+        , m_cells(cells), m_read_cell(read_cell), m_write_cell(write_cell) {}
+
+    void tick(const ISimulationTime& /*time*/) override {
+        // write_cell = f(read_cell): result depends on execution order
+        // whenever a conflicting system touches the same cells.
+        (*m_cells)[m_write_cell] = (*m_cells)[m_read_cell] * 3 + m_priority;
+        m_ticks.fetch_add(1);
+    }
+
+    int getPriority() const override { return m_priority; }
+    const char* getName() const override { return m_name; }
+    SystemAccess getAccess() const override { return m_access; }
+
+    std::atomic<int> m_ticks{0};
+
+private:
+    int m_priority;
+    const char* m_name;
+    SystemAccess m_access;
+    std::vector<int>* m_cells;
+    size_t m_read_cell;
+    size_t m_write_cell;
+};
+
+// =========================================================================
+// Test: Stage grouping from declared access
+// =========================================================================
+
+void test_stage_grouping() {
+    printf("Testing stage grouping from declared access...\n");
+
+    std::vector<int> cells(4, 1);
+    SimulationCore core;
+
+    // Contamination and disorder write separate grids -> same stage.
+    AccessSystem contam(80, "Contam",
+        SystemAccess::declare(SimResource::Terrain, SimResource::ContaminationGrid),
+        &cells, 0, 0);
+    AccessSystem disorder(70, "Disorder",
+        SystemAccess::declare(SimResource::Terrain, SimResource::DisorderGrid),
+        &cells, 1, 1);
+    // Land value reads both -> next stage.
+    AccessSystem landvalue(85, "LandValue",
+        SystemAccess::declare(SimResource::DisorderGrid | SimResource::ContaminationGrid,
+                              SimResource::LandValueGrid),
+        &cells, 0, 2);
+
+    core.register_system(&landvalue);
+    core.register_system(&contam);
+    core.register_system(&disorder);
+    core.update(0.05f);
+    assert(core.get_stage_count() == 2);
+
+    // An undeclared (exclusive) system always gets its own stage.
+    MockSystem legacy(75, "Legacy");
+    core.register_system(&legacy);
+    core.update(0.05f);
+    // Disorder(70) | Legacy(75) | Contam(80) | LandValue(85)
+    assert(core.get_stage_count() == 4);
+
+    core.unregister_system(&legacy);
+    core.update(0.05f);
+    assert(core.get_stage_count() == 2);
+
+    printf("  PASS: Stages follow declared conflicts\n");
+}
+
+// =========================================================================
+// Test: Parallel ticking matches serial results
+// =========================================================================
+
+static std::vector<int> run_pipeline(uint32_t workers, int ticks) {
+    std::vector<int> cells(6, 1);
+    SimulationCore core;
+    core.set_worker_count(workers);
+
+    // Two independent chains plus a reader of both.
+    AccessSystem a(10, "A", SystemAccess::declare(SimResource::None, SimResource::EnergyCoverage),
+                   &cells, 0, 0);
+    AccessSystem b(20, "B", SystemAccess::declare(SimResource::EnergyCoverage, SimResource::FluidCoverage),
+                   &cells, 0, 1);
+    AccessSystem c(15, "C", SystemAccess::declare(SimResource::None, SimResource::DisorderGrid),
+                   &cells, 2, 2);
+    AccessSystem d(25, "D", SystemAccess::declare(SimResource::DisorderGrid, SimResource::ContaminationGrid),
+                   &cells, 2, 3);
+    AccessSystem e(30, "E", SystemAccess::declare(SimResource::FluidCoverage | SimResource::ContaminationGrid,
+                                                  SimResource::LandValueGrid),
+                   &cells, 1, 4);
+    AccessSystem f(30, "F", SystemAccess::declare(SimResource::ContaminationGrid, SimResource::Economy),
+                   &cells, 3, 5);
+
+    core.register_system(&e);
+    core.register_system(&a);
+    core.register_system(&f);
+    core.register_system(&d);
+    core.register_system(&b);
+    core.register_system(&c);
+
+    for (int i = 0; i < ticks; ++i) {
+        core.update(0.05f);
+    }
+
+    assert(a.m_ticks.load() == ticks);
+    assert(f.m_ticks.load() == ticks);
+    return cells;
+}
+
+void test_parallel_matches_serial() {
+    printf("Testing parallel ticking matches serial results...\n");
+
+    std::vector<int> serial = run_pipeline(0, 5);
+    for (int run = 0; run < 20; ++run) {
+        std::vector<int> parallel = run_pipeline(3, 5);
+        assert(parallel == serial);
+    }
+
+    printf("  PASS: Parallel results identical to serial\n");
+}
+
+// =========================================================================
+// Test: Worker count configuration
+// =========================================================================
+
+void test_worker_count() {
+    printf("Testing worker count configuration...\n");
+
+    SimulationCore core;
+    assert(core.get_worker_count() == 0);
+
+    core.set_worker_count(2);
+    assert(core.get_worker_count() == 2);
+
+    MockSystem sys(10, "Sys");
+    core.register_system(&sys);
+    core.update(0.1f);
+    assert(sys.m_tick_count == 2);
+
+    core.set_worker_count(0);
+    assert(core.get_worker_count() == 0);
+    core.update(0.05f);
+    assert(sys.m_tick_count == 3);
+
+    printf("  PASS: Worker count can be changed between updates\n");
+}
+
 // =========================================================================
 // Main
 // =========================================================================
@@ -417,6 +574,9 @@ int main() {
     test_interpolation();
     test_system_receives_time();
     test_empty_update();
+    test_stage_grouping();
+    test_parallel_matches_serial();
+    test_worker_count();
 
     printf("\n=== All SimulationCore tests passed ===\n");
     return 0;
@@ -0,0 +1,137 @@
+/**
+ * @file test_task_scheduler.cpp
+ * @brief Tests for the work-stealing TaskScheduler
+ *
+ * Verifies:
+ * - Zero-worker scheduler runs tasks inline in index order
+ * - Every index runs exactly once with workers enabled
+ * - Uneven task costs complete (work stealing)
+ * - Many consecutive batches reuse the same pool
+ * - Exceptions are rethrown on the calling thread after the batch
+ */
+
+#include "sims3000/sim/TaskScheduler.h"
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace sims3000::sim;
+
+void test_zero_workers_inline_order() {
+    printf("Testing zero-worker scheduler runs inline in order...\n");
+
+    TaskScheduler scheduler(0);
+    assert(scheduler.worker_count() == 0);
+
+    std::vector<size_t> order;
+    scheduler.parallel_for(5, [&order](size_t i) { order.push_back(i); });
+
+    assert(order.size() == 5);
+    for (size_t i = 0; i < order.size(); ++i) {
+        assert(order[i] == i);
+    }
+
+    printf("  PASS: Inline execution preserves index order\n");
+}
+
+void test_each_index_runs_once() {
+    printf("Testing every index runs exactly once...\n");
+
+    TaskScheduler scheduler(3);
+    assert(scheduler.worker_count() == 3);
+
+    const size_t count = 1000;
+    std::vector<std::atomic<int>> hits(count);
+    for (auto& h : hits) {
+        h.store(0);
+    }
+
+    scheduler.parallel_for(count, [&hits](size_t i) { hits[i].fetch_add(1); });
+
+    for (size_t i = 0; i < count; ++i) {
+        assert(hits[i].load() == 1);
+    }
+
+    printf("  PASS: All %zu indices executed once\n", count);
+}
+
+void test_uneven_work_completes() {
+    printf("Testing uneven task costs complete...\n");
+
+    TaskScheduler scheduler(2);
+    std::atomic<int> done{0};
+
+    // Index 0 is slow; the rest are trivial and get stolen around it.
+    scheduler.parallel_for(32, [&done](size_t i) {
+        if (i == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        done.fetch_add(1);
+    });
+
+    assert(done.load() == 32);
+
+    printf("  PASS: Batch with a slow task completed\n");
+}
+
+void test_repeated_batches() {
+    printf("Testing repeated batches on one pool...\n");
+
+    TaskScheduler scheduler(2);
+    std::atomic<uint64_t> sum{0};
+
+    for (int batch = 0; batch < 200; ++batch) {
+        scheduler.parallel_for(8, [&sum](size_t i) { sum.fetch_add(i + 1); });
+    }
+
+    // 200 batches * (1 + 2 + ... + 8)
+    assert(sum.load() == 200u * 36u);
+
+    printf("  PASS: 200 batches completed with correct sum\n");
+}
+
+void test_exception_rethrown() {
+    printf("Testing exception propagation...\n");
+
+    TaskScheduler scheduler(2);
+    std::atomic<int> ran{0};
+    bool caught = false;
+
+    try {
+        scheduler.parallel_for(16, [&ran](size_t i) {
+            ran.fetch_add(1);
+            if (i == 7) {
+                throw std::runtime_error("task failed");
+            }
+        });
+    } catch (const std::runtime_error&) {
+        caught = true;
+    }
+
+    assert(caught);
+    assert(ran.load() == 16);  // batch still runs to completion
+
+    // Pool remains usable afterwards
+    std::atomic<int> after{0};
+    scheduler.parallel_for(4, [&after](size_t) { after.fetch_add(1); });
+    assert(after.load() == 4);
+
+    printf("  PASS: Exception rethrown after batch, pool still usable\n");
+}
+
+int main() {
+    printf("=== TaskScheduler Tests ===\n\n");
+
+    test_zero_workers_inline_order();
+    test_each_index_runs_once();
+    test_uneven_work_completes();
+    test_repeated_batches();
+    test_exception_rethrown();
+
+    printf("\n=== All TaskScheduler tests passed ===\n");
+    return 0;
+}
@@ -9,6 +9,8 @@
  * - Many small components
  * - get_network_positions() and get_network_count() API
  * - O(1) connectivity check via network_id comparison
+ * - Incremental add/remove: merge, split and relabel reporting
+ * - Tile edits keep neighbor lists current; manual edges cannot be mixed in
  */
 
 #include <sims3000/transport/NetworkGraph.h>
@@ -16,6 +18,8 @@
 #include <cstdio>
 #include <cstdlib>
 #include <set>
+#include <utility>
+#include <vector>
 #include <algorithm>
 
 using namespace sims3000::transport;
@@ -66,7 +70,7 @@ TEST(single_component_horizontal_line) {
     ASSERT_EQ(graph.get_network_count(), 1);
 
     // All should share the same network_id
-    uint16_t first_id = graph.get_network_id(GridPosition{0, 5});
+    NetworkId first_id = graph.get_network_id(GridPosition{0, 5});
     ASSERT(first_id != 0);
     for (int32_t x = 1; x < 10; ++x) {
         ASSERT_EQ(graph.get_network_id(GridPosition{x, 5}), first_id);
@@ -145,8 +149,8 @@ TEST(two_separate_components) {
     ASSERT_EQ(graph.node_count(), 10u);
     ASSERT_EQ(graph.get_network_count(), 2);
 
-    uint16_t nid1 = graph.get_network_id(GridPosition{0, 2});
-    uint16_t nid2 = graph.get_network_id(GridPosition{10, 20});
+    NetworkId nid1 = graph.get_network_id(GridPosition{0, 2});
+    NetworkId nid2 = graph.get_network_id(GridPosition{10, 20});
 
     ASSERT(nid1 != 0);
     ASSERT(nid2 != 0);
@@ -174,8 +178,8 @@ TEST(two_isolated_single_tiles) {
     ASSERT_EQ(graph.node_count(), 2u);
     ASSERT_EQ(graph.get_network_count(), 2);
 
-    uint16_t nid1 = graph.get_network_id(GridPosition{0, 0});
-    uint16_t nid2 = graph.get_network_id(GridPosition{15, 15});
+    NetworkId nid1 = graph.get_network_id(GridPosition{0, 0});
+    NetworkId nid2 = graph.get_network_id(GridPosition{15, 15});
 
     ASSERT(nid1 != 0);
     ASSERT(nid2 != 0);
@@ -323,7 +327,7 @@ TEST(get_network_positions_single) {
 
     ASSERT_EQ(graph.get_network_count(), 1);
 
-    uint16_t nid = graph.get_network_id(GridPosition{2, 2});
+    NetworkId nid = graph.get_network_id(GridPosition{2, 2});
     auto positions = graph.get_network_positions(nid);
 
     ASSERT_EQ(positions.size(), 3u);
@@ -356,8 +360,8 @@ TEST(get_network_positions_two_networks) {
 
     ASSERT_EQ(graph.get_network_count(), 2);
 
-    uint16_t nid1 = graph.get_network_id(GridPosition{0, 0});
-    uint16_t nid2 = graph.get_network_id(GridPosition{10, 10});
+    NetworkId nid1 = graph.get_network_id(GridPosition{0, 0});
+    NetworkId nid2 = graph.get_network_id(GridPosition{10, 10});
 
     auto pos1 = graph.get_network_positions(nid1);
     auto pos2 = graph.get_network_positions(nid2);
@@ -435,6 +439,182 @@ TEST(o1_connectivity_check) {
 // Main
 // ============================================================================
 
+// ============================================================================
+// Incremental maintenance
+// ============================================================================
+
+TEST(incremental_merge_relabels_smaller_side) {
+    PathwayGrid grid(16, 16);
+    NetworkGraph graph;
+    graph.rebuild_from_grid(grid);
+
+    // Long line on the left, short line on the right
+    for (int32_t x = 0; x < 6; ++x) {
+        graph.add_pathway_tile(GridPosition{x, 0});
+    }
+    graph.add_pathway_tile(GridPosition{7, 0});
+    graph.add_pathway_tile(GridPosition{8, 0});
+    ASSERT_EQ(graph.get_network_count(), 2u);
+    NetworkId big = graph.get_network_id(GridPosition{0, 0});
+
+    std::vector<GridPosition> relabeled;
+    graph.add_pathway_tile(GridPosition{6, 0}, &relabeled);
+    ASSERT_EQ(graph.get_network_count(), 1u);
+    ASSERT_EQ(graph.get_network_id(GridPosition{8, 0}), big);
+    // Bridge tile plus the two tiles of the smaller side
+    ASSERT_EQ(relabeled.size(), 3u);
+}
+
+TEST(incremental_remove_splits_component) {
+    PathwayGrid grid(16, 16);
+    for (int32_t x = 0; x < 9; ++x) {
+        grid.set_pathway(x, 3, static_cast<uint32_t>(x + 1));
+    }
+    NetworkGraph graph;
+    graph.rebuild_from_grid(grid);
+    NetworkId before = graph.get_network_id(GridPosition{0, 3});
+
+    std::vector<GridPosition> relabeled;
+    ASSERT(graph.remove_pathway_tile(GridPosition{6, 3}, &relabeled));
+    ASSERT_EQ(graph.node_count(), 8u);
+    ASSERT_EQ(graph.get_network_count(), 2u);
+    ASSERT(!graph.is_connected(GridPosition{0, 3}, GridPosition{8, 3}));
+    // The larger left side keeps its ID; only the 2-tile right side moves
+    ASSERT_EQ(graph.get_network_id(GridPosition{0, 3}), before);
+    ASSERT_EQ(relabeled.size(), 2u);
+
+    // Removing a tile inside a loop does not split it
+    relabeled.clear();
+    NetworkGraph loop;
+    PathwayGrid ring(8, 8);
+    for (int32_t i = 0; i < 4; ++i) {
+        ring.set_pathway(i, 0, 1);
+        ring.set_pathway(i, 3, 1);
+        ring.set_pathway(0, i, 1);
+        ring.set_pathway(3, i, 1);
+    }
+    loop.rebuild_from_grid(ring);
+    ASSERT(loop.remove_pathway_tile(GridPosition{2, 0}, &relabeled));
+    ASSERT_EQ(loop.get_network_count(), 1u);
+    ASSERT(relabeled.empty());
+    ASSERT(!loop.remove_pathway_tile(GridPosition{2, 0}));
+}
+
+TEST(incremental_edits_match_rebuild) {
+    const int32_t size = 24;
+    PathwayGrid grid(size, size);
+    NetworkGraph graph;
+    graph.rebuild_from_grid(grid);
+
+    uint32_t state = 2024;
+    auto next = [&state]() {
+        state = state * 1664525u + 1013904223u;
+        return state >> 16;
+    };
+    for (int step = 0; step < 3000; ++step) {
+        const int32_t x = static_cast<int32_t>(next() % size);
+        const int32_t y = static_cast<int32_t>(next() % size);
+        std::vector<NetworkId> before(static_cast<size_t>(size) * size, 0);
+        for (int32_t ty = 0; ty < size; ++ty) {
+            for (int32_t tx = 0; tx < size; ++tx) {
+                before[ty * size + tx] = graph.get_network_id(GridPosition{tx, ty});
+            }
+        }
+
+        std::vector<GridPosition> relabeled;
+        // Bias towards placement so networks grow before they are cut
+        if (grid.has_pathway(x, y) && next() % 3 != 0) {
+            grid.clear_pathway(x, y);
+            graph.remove_pathway_tile(GridPosition{x, y}, &relabeled);
+        } else if (!grid.has_pathway(x, y)) {
+            grid.set_pathway(x, y, 1);
+            graph.add_pathway_tile(GridPosition{x, y}, &relabeled);
+        }
+
+        NetworkGraph reference;
+        reference.rebuild_from_grid(grid);
+        ASSERT_EQ(graph.node_count(), reference.node_count());
+        ASSERT_EQ(graph.get_network_count(), reference.get_network_count());
+
+        std::set<std::pair<int32_t, int32_t>> reported;
+        for (const GridPosition& pos : relabeled) {
+            reported.insert(std::make_pair(pos.x, pos.y));
+        }
+        for (int32_t ty = 0; ty < size; ++ty) {
+            for (int32_t tx = 0; tx < size; ++tx) {
+                const NetworkId id = graph.get_network_id(GridPosition{tx, ty});
+                ASSERT_EQ(id != 0, grid.has_pathway(tx, ty));
+                // Same partition as a full rebuild
+                if (tx + 1 < size && grid.has_pathway(tx, ty) && grid.has_pathway(tx + 1, ty)) {
+                    ASSERT_EQ(id, graph.get_network_id(GridPosition{tx + 1, ty}));
+                }
+                if (ty + 1 < size && grid.has_pathway(tx, ty) && grid.has_pathway(tx, ty + 1)) {
+                    ASSERT_EQ(id, graph.get_network_id(GridPosition{tx, ty + 1}));
+                }
+                // Every changed ID (other than a removed tile) was reported
+                if (id != 0 && id != before[ty * size + tx]) {
+                    ASSERT(reported.count(std::make_pair(tx, ty)) == 1);
+                }
+            }
+        }
+        // Distinct components carry distinct IDs
+        for (NetworkId id = 1; id <= reference.get_network_count(); ++id) {
+            std::vector<GridPosition> members = reference.get_network_positions(id);
+            NetworkId mapped = graph.get_network_id(members.front());
+            ASSERT_EQ(graph.get_network_positions(mapped).size(), members.size());
+        }
+        // Patched neighbor lists match the rebuilt ones (N, W, E, S order)
+        for (NodeIndex n = 0; n < graph.node_count(); ++n) {
+            const NetworkNode node = graph.get_node(n);
+            const NetworkNode expected =
+                reference.get_node(reference.get_node_index(node.position));
+            ASSERT_EQ(node.neighbor_indices.size(), expected.neighbor_indices.size());
+            for (size_t i = 0; i < node.neighbor_indices.size(); ++i) {
+                ASSERT(graph.get_node(node.neighbor_indices[i]).position ==
+                       reference.get_node(expected.neighbor_indices[i]).position);
+            }
+        }
+    }
+}
+
+TEST(manual_edges_and_tile_edits_do_not_mix) {
+    // Tile edits on a graph built with add_edge() are rejected
+    NetworkGraph manual;
+    NodeIndex a = manual.add_node(GridPosition{0, 0});
+    NodeIndex b = manual.add_node(GridPosition{5, 5});
+    ASSERT(manual.add_edge(a, b));
+    ASSERT_EQ(manual.add_pathway_tile(GridPosition{1, 0}), INVALID_NODE_INDEX);
+    ASSERT(!manual.remove_pathway_tile(GridPosition{0, 0}));
+    ASSERT_EQ(manual.node_count(), 2u);
+    // The staged edge survives the rejected edits
+    ASSERT_EQ(manual.get_neighbors(a).size(), 1u);
+    ASSERT_EQ(manual.get_neighbors(a)[0], b);
+
+    // add_edge() on a tile-built graph is rejected
+    PathwayGrid grid(8, 8);
+    grid.set_pathway(0, 0, 1);
+    grid.set_pathway(1, 0, 1);
+    grid.set_pathway(5, 5, 1);
+    NetworkGraph tiles;
+    tiles.rebuild_from_grid(grid);
+    NodeIndex far = tiles.get_node_index(GridPosition{5, 5});
+    ASSERT(!tiles.add_edge(tiles.get_node_index(GridPosition{0, 0}), far));
+    ASSERT(tiles.get_neighbors(far).empty());
+    ASSERT_EQ(tiles.add_pathway_tile(GridPosition{2, 0}), 3u);
+    ASSERT_EQ(tiles.get_neighbors(tiles.get_node_index(GridPosition{1, 0})).size(), 2u);
+
+    // Nodes added before the first tile edit are linked by adjacency
+    NetworkGraph plain;
+    plain.add_node(GridPosition{3, 3});
+    ASSERT(plain.add_pathway_tile(GridPosition{3, 4}) != INVALID_NODE_INDEX);
+    ASSERT_EQ(plain.get_neighbors(0).size(), 1u);
+    ASSERT_EQ(plain.get_network_count(), 1u);
+
+    // clear() lifts the restriction
+    manual.clear();
+    ASSERT(manual.add_pathway_tile(GridPosition{1, 0}) != INVALID_NODE_INDEX);
+}
+
 int main() {
     printf("=== Connected Component (network_id) Tests (Ticket E7-010) ===\n\n");
 
@@ -466,6 +646,12 @@ int main() {
     // O(1) connectivity
     RUN_TEST(o1_connectivity_check);
 
+    // Incremental maintenance
+    RUN_TEST(incremental_merge_relabels_smaller_side);
+    RUN_TEST(incremental_remove_splits_component);
+    RUN_TEST(incremental_edits_match_rebuild);
+    RUN_TEST(manual_edges_and_tile_edits_do_not_mix);
+
     printf("\n=== Results ===\n");
     printf("Passed: %d\n", tests_passed);
     printf("Failed: %d\n", tests_failed);
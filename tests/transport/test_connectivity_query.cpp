@@ -149,9 +149,9 @@ TEST(single_network_same_id) {
     setup_grid_and_graph(grid, graph);
     ConnectivityQuery query;
 
-    uint16_t id0 = query.get_network_id_at(grid, graph, 0, 0);
-    uint16_t id1 = query.get_network_id_at(grid, graph, 1, 0);
-    uint16_t id2 = query.get_network_id_at(grid, graph, 2, 0);
+    NetworkId id0 = query.get_network_id_at(grid, graph, 0, 0);
+    NetworkId id1 = query.get_network_id_at(grid, graph, 1, 0);
+    NetworkId id2 = query.get_network_id_at(grid, graph, 2, 0);
 
     ASSERT(id0 != 0);
     ASSERT_EQ(id0, id1);
@@ -197,8 +197,8 @@ TEST(two_networks_different_ids) {
     setup_grid_and_graph(grid, graph);
     ConnectivityQuery query;
 
-    uint16_t id_a = query.get_network_id_at(grid, graph, 0, 0);
-    uint16_t id_b = query.get_network_id_at(grid, graph, 10, 10);
+    NetworkId id_a = query.get_network_id_at(grid, graph, 0, 0);
+    NetworkId id_b = query.get_network_id_at(grid, graph, 10, 10);
 
     ASSERT(id_a != 0);
     ASSERT(id_b != 0);
@@ -76,8 +76,8 @@ TEST(two_players_horizontal_adjacent) {
     // They should be in the same network despite different "owners"
     ASSERT(graph.is_connected(GridPosition{5, 5}, GridPosition{6, 5}));
 
-    uint16_t nid_a = graph.get_network_id(GridPosition{5, 5});
-    uint16_t nid_b = graph.get_network_id(GridPosition{6, 5});
+    NetworkId nid_a = graph.get_network_id(GridPosition{5, 5});
+    NetworkId nid_b = graph.get_network_id(GridPosition{6, 5});
     ASSERT(nid_a != 0);
     ASSERT_EQ(nid_a, nid_b);
 }
@@ -143,9 +143,9 @@ TEST(three_players_single_network) {
     ASSERT_EQ(graph.get_network_count(), 1);
 
     // All three players' tiles share the same network
-    uint16_t nid_a = graph.get_network_id(GridPosition{2, 5});
-    uint16_t nid_b = graph.get_network_id(GridPosition{4, 5});
-    uint16_t nid_c = graph.get_network_id(GridPosition{6, 5});
+    NetworkId nid_a = graph.get_network_id(GridPosition{2, 5});
+    NetworkId nid_b = graph.get_network_id(GridPosition{4, 5});
+    NetworkId nid_c = graph.get_network_id(GridPosition{6, 5});
 
     ASSERT(nid_a != 0);
     ASSERT_EQ(nid_a, nid_b);
@@ -232,8 +232,8 @@ TEST(two_players_disconnected) {
     ASSERT_EQ(graph.node_count(), 5u);
     ASSERT_EQ(graph.get_network_count(), 2);
 
-    uint16_t nid_a = graph.get_network_id(GridPosition{2, 2});
-    uint16_t nid_b = graph.get_network_id(GridPosition{20, 20});
+    NetworkId nid_a = graph.get_network_id(GridPosition{2, 2});
+    NetworkId nid_b = graph.get_network_id(GridPosition{20, 20});
 
     ASSERT(nid_a != 0);
     ASSERT(nid_b != 0);
@@ -9,6 +9,7 @@
  * - Combined cost calculation
  * - Custom config values
  * - Edge cases (zero congestion, full health, zero health)
+ * - EdgeCostPlane storage and minimum cost tracking
  */
 
 #include <sims3000/transport/EdgeCost.h>
@@ -205,6 +206,49 @@ TEST(zero_penalties) {
     ASSERT_EQ(calculate_edge_cost(PathwayType::Tunnel, 0, 255), 10u);
 }
 
+// ============================================================================
+// EdgeCostPlane storage and minimum tracking
+// ============================================================================
+
+TEST(cost_plane_set_and_get) {
+    EdgeCostPlane plane(8, 8);
+    ASSERT_EQ(plane.get_cost(3, 3), 0u);
+    ASSERT_EQ(plane.min_cost(), 0u);
+
+    ASSERT(plane.set_cost(3, 3, 15));
+    ASSERT(!plane.set_cost(3, 3, 15));  // unchanged
+    ASSERT_EQ(plane.get_cost(3, 3), 15u);
+
+    // Out of bounds is ignored
+    ASSERT(!plane.set_cost(-1, 0, 5));
+    ASSERT(!plane.set_cost(8, 0, 5));
+    ASSERT_EQ(plane.get_cost(8, 0), 0u);
+}
+
+TEST(cost_plane_min_tracking) {
+    EdgeCostPlane plane(8, 8);
+    plane.set_cost(0, 0, 15);
+    plane.set_cost(1, 0, 5);
+    plane.set_cost(2, 0, 5);
+    plane.set_cost(3, 0, 25);
+    ASSERT_EQ(plane.min_cost(), 5u);
+
+    // One of the two cheapest tiles gets congested: minimum unchanged
+    plane.set_cost(1, 0, 12);
+    ASSERT_EQ(plane.min_cost(), 5u);
+
+    // Last cheapest tile removed: minimum moves up
+    plane.clear_cost(2, 0);
+    ASSERT_EQ(plane.min_cost(), 12u);
+
+    plane.set_cost(1, 0, 30);
+    ASSERT_EQ(plane.min_cost(), 15u);
+
+    plane.clear();
+    ASSERT_EQ(plane.min_cost(), 0u);
+    ASSERT_EQ(plane.get_cost(0, 0), 0u);
+}
+
 // ============================================================================
 // Main
 // ============================================================================
@@ -226,6 +270,8 @@ int main() {
     RUN_TEST(custom_config_base_costs);
     RUN_TEST(custom_config_penalties);
     RUN_TEST(zero_penalties);
+    RUN_TEST(cost_plane_set_and_get);
+    RUN_TEST(cost_plane_min_tracking);
 
     printf("\n=== Results ===\n");
     printf("Passed: %d\n", tests_passed);
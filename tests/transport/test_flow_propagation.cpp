@@ -12,6 +12,8 @@
  * - Disconnected segments don't share flow
  * - Zero flow tiles don't spread
  * - Multiple source tiles
+ * - FlowPlane neighbour masks and slot swap-and-pop
+ * - FlowPlane propagation matches the map form
  */
 
 #include <sims3000/transport/FlowPropagation.h>
@@ -331,6 +333,100 @@ TEST(small_flow_integer_rounding) {
     ASSERT_EQ(flow_map[pack_pos(5, 5)], 3u);
 }
 
+// ============================================================================
+// FlowPlane
+// ============================================================================
+
+TEST(flow_plane_masks_and_slots) {
+    FlowPlane plane(8, 8);
+    plane.add_tile(3, 3);
+    plane.add_tile(4, 3);
+    plane.add_tile(3, 4);
+
+    ASSERT_EQ(plane.tile_count(), 3u);
+    ASSERT_EQ(plane.get_neighbor_mask(3, 3), FLOW_NEIGHBOR_E | FLOW_NEIGHBOR_S);
+    ASSERT_EQ(plane.get_neighbor_mask(4, 3), FLOW_NEIGHBOR_W);
+    ASSERT_EQ(plane.get_neighbor_mask(3, 4), FLOW_NEIGHBOR_N);
+    ASSERT_EQ(plane.get_neighbor_mask(4, 4), FLOW_NEIGHBOR_N | FLOW_NEIGHBOR_W);
+
+    plane.set_flow(3, 4, 77);
+    plane.set_flow(5, 5, 99);  // Not a pathway: ignored
+    ASSERT_EQ(plane.get_flow(5, 5), 0u);
+
+    // Removing slot 0 moves the last slot (3, 4) into it
+    plane.remove_tile(3, 3);
+    ASSERT_EQ(plane.tile_count(), 2u);
+    ASSERT_EQ(plane.get_slot(3, 3), FlowPlane::NO_SLOT);
+    ASSERT_EQ(plane.get_slot(3, 4), 0u);
+    ASSERT_EQ(plane.get_slot_tile(0), 4u * 8u + 3u);
+    ASSERT_EQ(plane.get_slot_flow(0), 77u);
+    ASSERT_EQ(plane.get_neighbor_mask(4, 3), 0u);
+    ASSERT_EQ(plane.get_neighbor_mask(3, 4), 0u);
+}
+
+TEST(flow_plane_matches_map_propagation) {
+    const int32_t size = 48;
+    PathwayGrid grid(size, size);
+    FlowPlane plane(size, size);
+
+    // Roads on most tiles of a lattice, including the map edges
+    srand(7);
+    for (int32_t y = 0; y < size; ++y) {
+        for (int32_t x = 0; x < size; ++x) {
+            if ((x % 3 == 0 || y % 4 == 0) && rand() % 10 != 0) {
+                grid.set_pathway(x, y, 1);
+                plane.add_tile(x, y);
+            }
+        }
+    }
+
+    std::unordered_map<uint64_t, uint32_t> flow_map;
+    for (int32_t y = 0; y < size; ++y) {
+        for (int32_t x = 0; x < size; ++x) {
+            if (grid.has_pathway(x, y) && rand() % 3 == 0) {
+                uint32_t flow = static_cast<uint32_t>(rand() % 5000);
+                flow_map[pack_pos(x, y)] = flow;
+                plane.set_flow(x, y, flow);
+            }
+        }
+    }
+
+    FlowPropagation prop;
+    FlowPropagationConfig config;
+    config.spread_rate = 0.35f;
+    for (int tick = 0; tick < 5; ++tick) {
+        prop.propagate(flow_map, grid, config);
+        prop.propagate(plane, config);
+    }
+
+    for (int32_t y = 0; y < size; ++y) {
+        for (int32_t x = 0; x < size; ++x) {
+            auto it = flow_map.find(pack_pos(x, y));
+            uint32_t expected = (it != flow_map.end()) ? it->second : 0u;
+            ASSERT_EQ(plane.get_flow(x, y), expected);
+        }
+    }
+}
+
+TEST(flow_plane_removed_tile_stops_flow) {
+    FlowPlane plane(16, 16);
+    for (int32_t x = 3; x <= 7; ++x) {
+        plane.add_tile(x, 5);
+    }
+    plane.set_flow(5, 5, 1000);
+
+    // Cut the east side; only (4,5) can receive
+    plane.remove_tile(6, 5);
+
+    FlowPropagation prop;
+    prop.propagate(plane);
+
+    ASSERT_EQ(plane.get_flow(5, 5), 800u);
+    ASSERT_EQ(plane.get_flow(4, 5), 200u);
+    ASSERT_EQ(plane.get_flow(6, 5), 0u);
+    ASSERT_EQ(plane.get_flow(7, 5), 0u);
+}
+
 // ============================================================================
 // Main
 // ============================================================================
@@ -350,6 +446,9 @@ int main() {
     RUN_TEST(multiple_sources_both_spread);
     RUN_TEST(flow_at_non_pathway_skipped);
     RUN_TEST(small_flow_integer_rounding);
+    RUN_TEST(flow_plane_masks_and_slots);
+    RUN_TEST(flow_plane_matches_map_propagation);
+    RUN_TEST(flow_plane_removed_tile_stops_flow);
 
     printf("\n=== Results ===\n");
     printf("Passed: %d\n", tests_passed);
@@ -11,6 +11,7 @@
  * - Empty grid (no nodes)
  * - L-shaped and complex topologies
  * - Performance target: <50ms on 256x256 with 15,000 segments
+ * - Graphs beyond 65,535 nodes and networks
  */
 
 #include <sims3000/transport/NetworkGraph.h>
@@ -75,7 +76,7 @@ TEST(single_tile) {
 
     ASSERT_EQ(graph.node_count(), 1u);
 
-    uint16_t nid = graph.get_network_id(GridPosition{3, 3});
+    NetworkId nid = graph.get_network_id(GridPosition{3, 3});
     ASSERT(nid != 0);
 }
 
@@ -88,8 +89,8 @@ TEST(single_tile_no_neighbors) {
 
     ASSERT_EQ(graph.node_count(), 1u);
 
-    uint16_t idx = graph.get_node_index(GridPosition{4, 4});
-    ASSERT(idx != UINT16_MAX);
+    NodeIndex idx = graph.get_node_index(GridPosition{4, 4});
+    ASSERT(idx != INVALID_NODE_INDEX);
 
     const NetworkNode& node = graph.get_node(idx);
     ASSERT_EQ(node.neighbor_indices.size(), 0u);
@@ -191,8 +192,8 @@ TEST(two_disconnected_components) {
     ASSERT(!graph.is_connected(GridPosition{2, 2}, GridPosition{11, 10}));
 
     // Different network IDs
-    uint16_t nid1 = graph.get_network_id(GridPosition{0, 2});
-    uint16_t nid2 = graph.get_network_id(GridPosition{10, 10});
+    NetworkId nid1 = graph.get_network_id(GridPosition{0, 2});
+    NetworkId nid2 = graph.get_network_id(GridPosition{10, 10});
     ASSERT(nid1 != 0);
     ASSERT(nid2 != 0);
     ASSERT(nid1 != nid2);
@@ -219,9 +220,9 @@ TEST(three_components) {
 
     ASSERT_EQ(graph.node_count(), 7u);
 
-    uint16_t nid1 = graph.get_network_id(GridPosition{0, 0});
-    uint16_t nid2 = graph.get_network_id(GridPosition{8, 0});
-    uint16_t nid3 = graph.get_network_id(GridPosition{0, 10});
+    NetworkId nid1 = graph.get_network_id(GridPosition{0, 0});
+    NetworkId nid2 = graph.get_network_id(GridPosition{8, 0});
+    NetworkId nid3 = graph.get_network_id(GridPosition{0, 10});
 
     ASSERT(nid1 != 0);
     ASSERT(nid2 != 0);
@@ -248,7 +249,7 @@ TEST(network_ids_non_zero) {
     NetworkGraph graph;
     graph.rebuild_from_grid(grid);
 
-    uint16_t nid = graph.get_network_id(GridPosition{0, 0});
+    NetworkId nid = graph.get_network_id(GridPosition{0, 0});
     ASSERT(nid != 0);
 }
 
@@ -262,9 +263,9 @@ TEST(same_component_same_id) {
     NetworkGraph graph;
     graph.rebuild_from_grid(grid);
 
-    uint16_t nid_a = graph.get_network_id(GridPosition{2, 4});
-    uint16_t nid_b = graph.get_network_id(GridPosition{3, 4});
-    uint16_t nid_c = graph.get_network_id(GridPosition{4, 4});
+    NetworkId nid_a = graph.get_network_id(GridPosition{2, 4});
+    NetworkId nid_b = graph.get_network_id(GridPosition{3, 4});
+    NetworkId nid_c = graph.get_network_id(GridPosition{4, 4});
 
     ASSERT_EQ(nid_a, nid_b);
     ASSERT_EQ(nid_b, nid_c);
@@ -291,11 +292,11 @@ TEST(rebuild_clears_previous) {
     ASSERT_EQ(graph.node_count(), 1u);
 
     // Old positions should no longer exist
-    ASSERT_EQ(graph.get_node_index(GridPosition{0, 0}), UINT16_MAX);
-    ASSERT_EQ(graph.get_node_index(GridPosition{1, 0}), UINT16_MAX);
+    ASSERT_EQ(graph.get_node_index(GridPosition{0, 0}), INVALID_NODE_INDEX);
+    ASSERT_EQ(graph.get_node_index(GridPosition{1, 0}), INVALID_NODE_INDEX);
 
     // New position should exist
-    ASSERT(graph.get_node_index(GridPosition{5, 5}) != UINT16_MAX);
+    ASSERT(graph.get_node_index(GridPosition{5, 5}) != INVALID_NODE_INDEX);
 }
 
 // ============================================================================
@@ -314,10 +315,10 @@ TEST(neighbor_counts_straight_line) {
     graph.rebuild_from_grid(grid);
 
     // End tiles have 1 neighbor, middle tiles have 2
-    uint16_t idx0 = graph.get_node_index(GridPosition{0, 0});
-    uint16_t idx1 = graph.get_node_index(GridPosition{1, 0});
-    uint16_t idx2 = graph.get_node_index(GridPosition{2, 0});
-    uint16_t idx3 = graph.get_node_index(GridPosition{3, 0});
+    NodeIndex idx0 = graph.get_node_index(GridPosition{0, 0});
+    NodeIndex idx1 = graph.get_node_index(GridPosition{1, 0});
+    NodeIndex idx2 = graph.get_node_index(GridPosition{2, 0});
+    NodeIndex idx3 = graph.get_node_index(GridPosition{3, 0});
 
     ASSERT_EQ(graph.get_node(idx0).neighbor_indices.size(), 1u);
     ASSERT_EQ(graph.get_node(idx1).neighbor_indices.size(), 2u);
@@ -341,7 +342,7 @@ TEST(cross_intersection_4_neighbors) {
 
     ASSERT_EQ(graph.node_count(), 5u);
 
-    uint16_t center_idx = graph.get_node_index(GridPosition{3, 3});
+    NodeIndex center_idx = graph.get_node_index(GridPosition{3, 3});
     ASSERT_EQ(graph.get_node(center_idx).neighbor_indices.size(), 4u);
 }
 
@@ -370,7 +371,7 @@ TEST(l_shape) {
     ASSERT(graph.is_connected(GridPosition{0, 0}, GridPosition{2, 2}));
 
     // Corner tile (0,2) should have 2 neighbors
-    uint16_t corner_idx = graph.get_node_index(GridPosition{0, 2});
+    NodeIndex corner_idx = graph.get_node_index(GridPosition{0, 2});
     ASSERT_EQ(graph.get_node(corner_idx).neighbor_indices.size(), 2u);
 }
 
@@ -416,6 +417,51 @@ TEST(performance_256x256_15k_segments) {
 // Main
 // ============================================================================
 
+// ============================================================================
+// Beyond 16-bit indices
+// ============================================================================
+
+TEST(fully_paved_512x512) {
+    // 262,144 nodes: indices and neighbor entries above 65,535 must survive
+    PathwayGrid grid(512, 512);
+    for (int32_t y = 0; y < 512; ++y) {
+        for (int32_t x = 0; x < 512; ++x) {
+            grid.set_pathway(x, y, 1);
+        }
+    }
+
+    NetworkGraph graph;
+    graph.rebuild_from_grid(grid);
+
+    ASSERT_EQ(graph.node_count(), 262144u);
+    ASSERT_EQ(graph.get_network_count(), 1u);
+    ASSERT(graph.is_connected(GridPosition{0, 0}, GridPosition{511, 511}));
+
+    NodeIndex last = graph.get_node_index(GridPosition{511, 511});
+    ASSERT_EQ(last, 262143u);
+    NetworkNode corner = graph.get_node(last);
+    ASSERT_EQ(corner.neighbor_indices.size(), 2u);
+    ASSERT_EQ(corner.neighbor_indices[0], 262143u - 512u);
+    ASSERT_EQ(corner.neighbor_indices[1], 262142u);
+}
+
+TEST(many_components_checkerboard) {
+    // 131,072 isolated tiles need network IDs above 65,535
+    PathwayGrid grid(512, 512);
+    for (int32_t y = 0; y < 512; ++y) {
+        for (int32_t x = (y & 1); x < 512; x += 2) {
+            grid.set_pathway(x, y, 1);
+        }
+    }
+
+    NetworkGraph graph;
+    graph.rebuild_from_grid(grid);
+
+    ASSERT_EQ(graph.get_network_count(), 131072u);
+    ASSERT(!graph.is_connected(GridPosition{510, 510}, GridPosition{511, 511}));
+    ASSERT(graph.get_network_id(GridPosition{511, 511}) == 131072u);
+}
+
 int main() {
     printf("=== NetworkGraph rebuild_from_grid Unit Tests (Ticket E7-009) ===\n\n");
 
@@ -453,6 +499,10 @@ int main() {
     RUN_TEST(l_shape);
 
     // Performance
+    // 32-bit indices
+    RUN_TEST(fully_paved_512x512);
+    RUN_TEST(many_components_checkerboard);
+
     RUN_TEST(performance_256x256_15k_segments);
 
     printf("\n=== Results ===\n");
@@ -0,0 +1,226 @@
+/**
+ * @file test_hierarchical_pathfinding.cpp
+ * @brief Unit tests for chunked (HPA*) pathfinding
+ *
+ * Tests:
+ * - Long straight route across many chunks
+ * - Same-chunk routes use flat A*
+ * - Portal detection on chunk borders
+ * - Reachability and path validity match flat A* on a random lattice
+ * - Chunk updates after pathway removal and placement
+ */
+
+#include <sims3000/transport/HierarchicalPathfinding.h>
+#include <sims3000/transport/PathwayGrid.h>
+#include <sims3000/transport/NetworkGraph.h>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace sims3000::transport;
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST(name) void test_##name()
+#define RUN_TEST(name) do { \
+    printf("Running %s...", #name); \
+    test_##name(); \
+    printf(" PASSED\n"); \
+    tests_passed++; \
+} while(0)
+
+#define ASSERT(condition) do { \
+    if (!(condition)) { \
+        printf("\n  FAILED: %s (line %d)\n", #condition, __LINE__); \
+        tests_failed++; \
+        return; \
+    } \
+} while(0)
+
+#define ASSERT_EQ(a, b) do { \
+    if ((a) != (b)) { \
+        printf("\n  FAILED: %s == %s (line %d, got %lld vs %lld)\n", \
+               #a, #b, __LINE__, (long long)(a), (long long)(b)); \
+        tests_failed++; \
+        return; \
+    } \
+} while(0)
+
+/// True if the path runs from start to end through adjacent pathway tiles
+static bool path_is_valid(const PathResult& result, const GridPosition& start,
+                          const GridPosition& end, const PathwayGrid& grid) {
+    if (result.path.empty() || result.path.front() != start || result.path.back() != end) {
+        return false;
+    }
+    for (size_t i = 1; i < result.path.size(); ++i) {
+        const GridPosition& a = result.path[i - 1];
+        const GridPosition& b = result.path[i];
+        if (std::abs(a.x - b.x) + std::abs(a.y - b.y) != 1 || !grid.has_pathway(b.x, b.y)) {
+            return false;
+        }
+    }
+    return result.total_cost == (result.path.size() - 1) * 10;
+}
+
+// ============================================================================
+// Long straight route
+// ============================================================================
+
+TEST(long_straight_route) {
+    PathwayGrid grid(128, 128);
+    for (int x = 0; x < 128; ++x) {
+        grid.set_pathway(x, 70, 1);
+    }
+    NetworkGraph graph;
+    graph.rebuild_from_grid(grid);
+
+    HierarchicalPathfinding hpf(128, 128);
+    PathResult result = hpf.find_path({0, 70}, {127, 70}, grid, graph);
+
+    ASSERT(result.found);
+    ASSERT_EQ(result.total_cost, 1270u);
+    ASSERT_EQ(result.path.size(), 128u);
+    ASSERT(path_is_valid(result, {0, 70}, {127, 70}, grid));
+    ASSERT_EQ(hpf.get_dirty_chunk_count(), 0u);
+}
+
+// ============================================================================
+// Same chunk falls back to flat A*
+// ============================================================================
+
+TEST(same_chunk_route) {
+    PathwayGrid grid(64, 64);
+    for (int x = 16; x < 32; ++x) {
+        grid.set_pathway(x, 20, 1);
+    }
+    NetworkGraph graph;
+    graph.rebuild_from_grid(grid);
+
+    HierarchicalPathfinding hpf;
+    PathResult result = hpf.find_path({16, 20}, {31, 20}, grid, graph);
+    ASSERT(result.found);
+    ASSERT_EQ(result.total_cost, 150u);
+
+    PathResult trivial = hpf.find_path({20, 20}, {20, 20}, grid, graph);
+    ASSERT(trivial.found);
+    ASSERT_EQ(trivial.path.size(), 1u);
+}
+
+// ============================================================================
+// Portals on chunk borders
+// ============================================================================
+
+TEST(portals_on_borders) {
+    PathwayGrid grid(32, 32);
+    // One road crossing the vertical border between chunk (0,0) and (1,0)
+    for (int x = 10; x < 22; ++x) {
+        grid.set_pathway(x, 5, 1);
+    }
+    // Road along the border on both sides: a single 3-tile run
+    for (int y = 20; y < 23; ++y) {
+        grid.set_pathway(15, y, 1);
+        grid.set_pathway(16, y, 1);
+    }
+
+    HierarchicalPathfinding hpf(32, 32);
+    hpf.rebuild_dirty_chunks(grid);
+    // Two runs, one portal per side each
+    ASSERT_EQ(hpf.get_portal_count(), 4u);
+    ASSERT_EQ(hpf.get_dirty_chunk_count(), 0u);
+}
+
+// ============================================================================
+// Random lattice agrees with flat A* on reachability
+// ============================================================================
+
+TEST(matches_flat_reachability) {
+    PathwayGrid grid(96, 96);
+    srand(4321);
+    for (int y = 0; y < 96; ++y) {
+        for (int x = 0; x < 96; ++x) {
+            if ((x % 5 == 0 || y % 5 == 0) && (rand() % 25) != 0) {
+                grid.set_pathway(x, y, 1);
+            }
+        }
+    }
+    NetworkGraph graph;
+    graph.rebuild_from_grid(grid);
+
+    HierarchicalPathfinding hpf;
+    Pathfinding flat;
+    int found = 0;
+    for (int i = 0; i < 300; ++i) {
+        GridPosition a{(rand() % 20) * 5, rand() % 96};
+        GridPosition b{rand() % 96, (rand() % 20) * 5};
+        PathResult expected = flat.find_path(a, b, grid, graph);
+        PathResult result = hpf.find_path(a, b, grid, graph);
+        ASSERT_EQ(result.found, expected.found);
+        if (!result.found) {
+            continue;
+        }
+        ++found;
+        ASSERT(path_is_valid(result, a, b, grid));
+        ASSERT(result.total_cost >= expected.total_cost);
+    }
+    ASSERT(found > 100);
+}
+
+// ============================================================================
+// Updates after removal and placement
+// ============================================================================
+
+TEST(updates_after_edits) {
+    PathwayGrid grid(64, 64);
+    for (int x = 0; x < 64; ++x) {
+        grid.set_pathway(x, 8, 1);
+    }
+    NetworkGraph graph;
+    graph.rebuild_from_grid(grid);
+
+    HierarchicalPathfinding hpf(64, 64);
+    PathResult before = hpf.find_path({0, 8}, {63, 8}, grid, graph);
+    ASSERT(before.found);
+    ASSERT_EQ(before.total_cost, 630u);
+
+    // Cut the road on a chunk border, then route around it
+    grid.clear_pathway(32, 8);
+    hpf.on_pathway_removed(PathwayRemovedEvent(1, 32, 8, 0));
+    ASSERT(hpf.get_dirty_chunk_count() > 0);
+    graph.rebuild_from_grid(grid);
+    ASSERT(!hpf.find_path({0, 8}, {63, 8}, grid, graph).found);
+
+    const GridPosition detour[] = { {31, 9}, {31, 10}, {32, 10}, {33, 10}, {33, 9} };
+    for (const GridPosition& p : detour) {
+        grid.set_pathway(p.x, p.y, 1);
+        hpf.on_pathway_placed(PathwayPlacedEvent(1, p.x, p.y, PathwayType::BasicPathway, 0));
+    }
+    graph.rebuild_from_grid(grid);
+
+    PathResult after = hpf.find_path({0, 8}, {63, 8}, grid, graph);
+    ASSERT(after.found);
+    ASSERT_EQ(after.total_cost, 670u);
+    ASSERT(path_is_valid(after, {0, 8}, {63, 8}, grid));
+    ASSERT_EQ(hpf.get_dirty_chunk_count(), 0u);
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main() {
+    printf("=== Hierarchical Pathfinding Unit Tests ===\n\n");
+
+    RUN_TEST(long_straight_route);
+    RUN_TEST(same_chunk_route);
+    RUN_TEST(portals_on_borders);
+    RUN_TEST(matches_flat_reachability);
+    RUN_TEST(updates_after_edits);
+
+    printf("\n=== Results ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+
+    return tests_failed > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -89,7 +89,7 @@ void test_graph_clear() {
 
     graph.clear();
     assert(graph.node_count() == 0);
-    assert(graph.get_node_index({0, 0}) == UINT16_MAX);
+    assert(graph.get_node_index({0, 0}) == INVALID_NODE_INDEX);
 
     printf("  PASS: clear() resets graph\n");
 }
@@ -99,16 +99,16 @@ void test_graph_add_node() {
 
     NetworkGraph graph;
 
-    uint16_t idx0 = graph.add_node({5, 10});
+    NodeIndex idx0 = graph.add_node({5, 10});
     assert(idx0 == 0);
     assert(graph.node_count() == 1);
 
-    uint16_t idx1 = graph.add_node({6, 10});
+    NodeIndex idx1 = graph.add_node({6, 10});
     assert(idx1 == 1);
     assert(graph.node_count() == 2);
 
     // Adding duplicate position should return existing index
-    uint16_t idx_dup = graph.add_node({5, 10});
+    NodeIndex idx_dup = graph.add_node({5, 10});
     assert(idx_dup == 0);
     assert(graph.node_count() == 2);
 
@@ -125,9 +125,9 @@ void test_graph_add_edge() {
     printf("Testing NetworkGraph::add_edge()...\n");
 
     NetworkGraph graph;
-    uint16_t a = graph.add_node({0, 0});
-    uint16_t b = graph.add_node({1, 0});
-    uint16_t c = graph.add_node({2, 0});
+    NodeIndex a = graph.add_node({0, 0});
+    NodeIndex b = graph.add_node({1, 0});
+    NodeIndex c = graph.add_node({2, 0});
 
     graph.add_edge(a, b);
 
@@ -184,7 +184,7 @@ void test_graph_get_node_index() {
 
     assert(graph.get_node_index({3, 7}) == 0);
     assert(graph.get_node_index({4, 8}) == 1);
-    assert(graph.get_node_index({99, 99}) == UINT16_MAX);
+    assert(graph.get_node_index({99, 99}) == INVALID_NODE_INDEX);
 
     printf("  PASS: get_node_index() works correctly\n");
 }
@@ -197,9 +197,9 @@ void test_graph_assign_network_ids_single_component() {
     printf("Testing assign_network_ids() with single component...\n");
 
     NetworkGraph graph;
-    uint16_t a = graph.add_node({0, 0});
-    uint16_t b = graph.add_node({1, 0});
-    uint16_t c = graph.add_node({2, 0});
+    NodeIndex a = graph.add_node({0, 0});
+    NodeIndex b = graph.add_node({1, 0});
+    NodeIndex c = graph.add_node({2, 0});
 
     graph.add_edge(a, b);
     graph.add_edge(b, c);
@@ -219,34 +219,34 @@ void test_graph_assign_network_ids_multiple_components() {
     NetworkGraph graph;
 
     // Component 1: A-B
-    uint16_t a = graph.add_node({0, 0});
-    uint16_t b = graph.add_node({1, 0});
+    NodeIndex a = graph.add_node({0, 0});
+    NodeIndex b = graph.add_node({1, 0});
     graph.add_edge(a, b);
 
     // Component 2: C-D
-    uint16_t c = graph.add_node({10, 10});
-    uint16_t d = graph.add_node({11, 10});
+    NodeIndex c = graph.add_node({10, 10});
+    NodeIndex d = graph.add_node({11, 10});
     graph.add_edge(c, d);
 
     // Component 3: E (isolated)
-    uint16_t e = graph.add_node({50, 50});
+    NodeIndex e = graph.add_node({50, 50});
     (void)e;
 
     graph.assign_network_ids();
 
     // A and B should share same network_id
-    uint16_t id_ab = graph.get_node(a).network_id;
+    NetworkId id_ab = graph.get_node(a).network_id;
     assert(id_ab != 0);
     assert(graph.get_node(b).network_id == id_ab);
 
     // C and D should share same network_id (different from A-B)
-    uint16_t id_cd = graph.get_node(c).network_id;
+    NetworkId id_cd = graph.get_node(c).network_id;
     assert(id_cd != 0);
     assert(graph.get_node(d).network_id == id_cd);
     assert(id_cd != id_ab);
 
     // E should have its own network_id
-    uint16_t id_e = graph.get_node(e).network_id;
+    NetworkId id_e = graph.get_node(e).network_id;
     assert(id_e != 0);
     assert(id_e != id_ab);
     assert(id_e != id_cd);
@@ -269,9 +269,9 @@ void test_graph_assign_network_ids_reassignment() {
     printf("Testing assign_network_ids() reassignment after topology change...\n");
 
     NetworkGraph graph;
-    uint16_t a = graph.add_node({0, 0});
-    uint16_t b = graph.add_node({1, 0});
-    uint16_t c = graph.add_node({2, 0});
+    NodeIndex a = graph.add_node({0, 0});
+    NodeIndex b = graph.add_node({1, 0});
+    NodeIndex c = graph.add_node({2, 0});
 
     // Initially two separate components: A-B and C
     graph.add_edge(a, b);
@@ -298,9 +298,9 @@ void test_graph_is_connected() {
     printf("Testing NetworkGraph::is_connected()...\n");
 
     NetworkGraph graph;
-    uint16_t a = graph.add_node({0, 0});
-    uint16_t b = graph.add_node({1, 0});
-    uint16_t c = graph.add_node({10, 10});
+    NodeIndex a = graph.add_node({0, 0});
+    NodeIndex b = graph.add_node({1, 0});
+    NodeIndex c = graph.add_node({10, 10});
 
     graph.add_edge(a, b);
     graph.assign_network_ids();
@@ -326,7 +326,7 @@ void test_graph_get_network_id() {
     graph.add_node({5, 5});
     graph.assign_network_ids();
 
-    uint16_t id = graph.get_network_id({5, 5});
+    NetworkId id = graph.get_network_id({5, 5});
     assert(id != 0);
 
     // Non-existent position
@@ -347,15 +347,15 @@ void test_graph_linear_chain() {
         graph.add_node({i, 0});
     }
     for (int i = 0; i < 99; ++i) {
-        uint16_t a = graph.get_node_index({i, 0});
-        uint16_t b = graph.get_node_index({i + 1, 0});
+        NodeIndex a = graph.get_node_index({i, 0});
+        NodeIndex b = graph.get_node_index({i + 1, 0});
         graph.add_edge(a, b);
     }
 
     graph.assign_network_ids();
 
     // All should be in same component
-    uint16_t first_id = graph.get_network_id({0, 0});
+    NetworkId first_id = graph.get_network_id({0, 0});
     assert(first_id != 0);
     for (int i = 1; i < 100; ++i) {
         assert(graph.get_network_id({i, 0}) == first_id);
@@ -382,8 +382,8 @@ void test_graph_grid_network() {
     // Connect horizontal neighbors
     for (int y = 0; y < 10; ++y) {
         for (int x = 0; x < 9; ++x) {
-            uint16_t a = graph.get_node_index({x, y});
-            uint16_t b = graph.get_node_index({x + 1, y});
+            NodeIndex a = graph.get_node_index({x, y});
+            NodeIndex b = graph.get_node_index({x + 1, y});
             graph.add_edge(a, b);
         }
     }
@@ -391,8 +391,8 @@ void test_graph_grid_network() {
     // Connect vertical neighbors
     for (int y = 0; y < 9; ++y) {
         for (int x = 0; x < 10; ++x) {
-            uint16_t a = graph.get_node_index({x, y});
-            uint16_t b = graph.get_node_index({x, y + 1});
+            NodeIndex a = graph.get_node_index({x, y});
+            NodeIndex b = graph.get_node_index({x, y + 1});
             graph.add_edge(a, b);
         }
     }
@@ -402,7 +402,7 @@ void test_graph_grid_network() {
     graph.assign_network_ids();
 
     // All nodes in same component
-    uint16_t first_id = graph.get_network_id({0, 0});
+    NetworkId first_id = graph.get_network_id({0, 0});
     assert(first_id != 0);
     assert(graph.is_connected({0, 0}, {9, 9}));
     assert(graph.is_connected({0, 9}, {9, 0}));
@@ -410,6 +410,27 @@ void test_graph_grid_network() {
     printf("  PASS: 10x10 grid network connectivity correct\n");
 }
 
+void test_graph_tile_index_growth() {
+    printf("Testing NetworkGraph tile index growth...\n");
+
+    NetworkGraph graph;
+    NodeIndex a = graph.add_node({3, 7});
+    NodeIndex b = graph.add_node({1000, 2});   // grows the index width
+    NodeIndex c = graph.add_node({2, 300});    // grows the index height
+
+    assert(graph.get_node_index({3, 7}) == a);
+    assert(graph.get_node_index({1000, 2}) == b);
+    assert(graph.get_node_index({2, 300}) == c);
+    assert(graph.get_node_index({999, 2}) == INVALID_NODE_INDEX);
+
+    // Negative positions are never nodes
+    assert(graph.add_node({-1, 0}) == INVALID_NODE_INDEX);
+    assert(graph.get_node_index({-1, 0}) == INVALID_NODE_INDEX);
+    assert(graph.node_count() == 3);
+
+    printf("  PASS: Tile index grows without losing nodes\n");
+}
+
 // ============================================================================
 // Main
 // ============================================================================
@@ -431,6 +452,7 @@ int main() {
     test_graph_add_edge();
     test_graph_add_edge_invalid();
     test_graph_get_node_index();
+    test_graph_tile_index_growth();
 
     // Network ID assignment
     test_graph_assign_network_ids_single_component();
@@ -8,11 +8,20 @@
  * - Expiration after max_age_ticks
  * - Invalidation on network change
  * - Size tracking
+ * - LRU bound and eviction counters
+ * - Hit/miss counters
+ * - Region invalidation keeps unrelated entries
+ * - Network invalidation by endpoint network
+ * - Region sizing covers the map without shared bits
+ * - Indexed eviction matches a scan over all entries
  */
 
 #include <sims3000/transport/PathCache.h>
+#include <sims3000/transport/PathwayGrid.h>
 #include <cassert>
 #include <cstdio>
+#include <map>
+#include <utility>
 
 using namespace sims3000::transport;
 
@@ -289,6 +298,251 @@ static void test_symmetric_keys() {
     PASS();
 }
 
+static PathResult make_straight_path(GridPosition start, GridPosition end) {
+    // Horizontal or vertical run from start to end inclusive
+    PathResult result;
+    result.found = true;
+    GridPosition pos = start;
+    result.path.push_back(pos);
+    while (!(pos == end)) {
+        pos.x += (end.x > pos.x) - (end.x < pos.x);
+        pos.y += (end.y > pos.y) - (end.y < pos.y);
+        result.path.push_back(pos);
+    }
+    result.total_cost = static_cast<uint32_t>(result.path.size() - 1) * 10;
+    return result;
+}
+
+static void test_lru_bound() {
+    TEST("LRU bound evicts least recently used entry");
+    PathCache cache(100, 2);
+    assert(cache.max_entries() == 2);
+
+    GridPosition a{0, 0}, b{1, 0}, c{2, 0}, d{3, 0};
+    cache.put(a, b, make_straight_path(a, b), 0);
+    cache.put(b, c, make_straight_path(b, c), 0);
+
+    // Touch (a, b) so (b, c) becomes least recently used
+    assert(cache.get(a, b, 0) != nullptr);
+    cache.put(c, d, make_straight_path(c, d), 0);
+
+    assert(cache.size() == 2);
+    assert(cache.get(a, b, 0) != nullptr);
+    assert(cache.get(b, c, 0) == nullptr);
+    assert(cache.get(c, d, 0) != nullptr);
+    assert(cache.get_stats().evictions == 1);
+
+    // Overwriting an existing key does not evict
+    cache.put(a, b, make_straight_path(a, b), 1);
+    assert(cache.size() == 2);
+    assert(cache.get_stats().evictions == 1);
+    PASS();
+}
+
+static void test_stats_counters() {
+    TEST("Hits, misses and invalidations are counted");
+    PathCache cache(10);
+    GridPosition a{0, 0}, b{5, 0};
+    cache.put(a, b, make_straight_path(a, b), 0);
+
+    cache.get(a, b, 5);     // hit
+    cache.get(b, a, 5);     // miss (unknown)
+    cache.get(a, b, 10);    // miss (expired)
+    cache.invalidate();
+
+    const PathCacheStats& stats = cache.get_stats();
+    assert(stats.hits == 1);
+    assert(stats.misses == 2);
+    assert(stats.invalidations == 1);
+    assert(stats.evictions == 0);
+    PASS();
+}
+
+static void test_region_invalidation() {
+    TEST("Region invalidation keeps routes in other regions");
+    PathCache cache;
+
+    // Route along row 0 within the first region
+    GridPosition a{0, 0}, b{10, 0};
+    // Route along row 40 in a different region row
+    GridPosition c{0, 40}, d{10, 40};
+    // Route through the middle of the first region
+    GridPosition e{5, 0}, f{5, 12};
+
+    cache.put(a, b, make_straight_path(a, b), 0);
+    cache.put(c, d, make_straight_path(c, d), 0);
+    cache.put(e, f, make_straight_path(e, f), 0);
+
+    assert(cache.region_bit({0, 0}) == cache.region_bit({15, 15}));
+    assert(cache.region_bit({0, 0}) != cache.region_bit({16, 0}));
+
+    size_t evicted = cache.invalidate_region(GridPosition{3, 3});
+    assert(evicted == 2);
+    assert(cache.get(a, b, 0) == nullptr);
+    assert(cache.get(e, f, 0) == nullptr);
+    assert(cache.get(c, d, 0) != nullptr);
+
+    // Nothing cached touches this region
+    assert(cache.invalidate_region(GridPosition{100, 20}) == 0);
+    assert(cache.size() == 1);
+    PASS();
+}
+
+static void test_network_invalidation() {
+    TEST("Network invalidation evicts only routes in that network");
+    PathwayGrid grid(32, 32);
+    // Two separate horizontal roads
+    for (int32_t x = 0; x < 10; ++x) {
+        grid.set_pathway(x, 0, static_cast<uint32_t>(x + 1));
+        grid.set_pathway(x, 20, static_cast<uint32_t>(x + 100));
+    }
+    NetworkGraph graph;
+    graph.rebuild_from_grid(grid);
+
+    GridPosition a{0, 0}, b{9, 0}, c{0, 20}, d{9, 20};
+    const NetworkId net_ab = graph.get_network_id(a);
+    const NetworkId net_cd = graph.get_network_id(c);
+    assert(net_ab != 0 && net_cd != 0 && net_ab != net_cd);
+
+    PathCache cache;
+    cache.put(a, b, make_straight_path(a, b), 0, graph);
+    cache.put(c, d, make_straight_path(c, d), 0, graph);
+
+    // Not-found route between the two networks
+    PathResult none;
+    cache.put(a, c, none, 0, graph);
+
+    // Entry without network info
+    GridPosition e{30, 30}, f{31, 30};
+    cache.put(e, f, make_straight_path(e, f), 0);
+
+    size_t evicted = cache.invalidate_network(net_cd);
+    assert(evicted == 3);
+    assert(cache.get(a, b, 0) != nullptr);
+    assert(cache.get(c, d, 0) == nullptr);
+    assert(cache.get(a, c, 0) == nullptr);
+    assert(cache.get(e, f, 0) == nullptr);
+    PASS();
+}
+
+static void test_region_sizing() {
+    TEST("Regions are sized so the map uses each bit once");
+    PathCache cache;
+    cache.put(GridPosition{0, 0}, GridPosition{1, 0},
+              make_straight_path(GridPosition{0, 0}, GridPosition{1, 0}), 0);
+
+    cache.set_map_size(512, 512);
+    assert(cache.region_size() == 64);
+    assert(cache.size() == 0);
+
+    // Every region of a 512x512 map gets its own bit
+    uint64_t seen = 0;
+    for (int32_t ry = 0; ry < 8; ++ry) {
+        for (int32_t rx = 0; rx < 8; ++rx) {
+            const uint64_t bit = cache.region_bit(GridPosition{rx * 64 + 63, ry * 64});
+            assert((seen & bit) == 0);
+            seen |= bit;
+        }
+    }
+    assert(seen == ~uint64_t{0});
+    // Tiles 128 apart no longer alias
+    assert(cache.region_bit({0, 0}) != cache.region_bit({128, 0}));
+
+    // Non-square maps size by the longer side; edges clamp into the grid
+    cache.set_map_size(100, 60);
+    assert(cache.region_size() == 13);
+    assert(cache.region_bit({99, 59}) == cache.region_bit({91, 52}));
+    assert(cache.region_bit({-5, 0}) == cache.region_bit({0, 0}));
+    PASS();
+}
+
+static void test_indexed_eviction_matches_scan() {
+    TEST("Indexed eviction matches a scan over all entries");
+    PathwayGrid grid(64, 64);
+    // One road per eighth row, each its own network
+    for (int32_t y = 0; y < 64; y += 8) {
+        for (int32_t x = 0; x < 64; ++x) {
+            grid.set_pathway(x, y, 1);
+        }
+    }
+    NetworkGraph graph;
+    graph.rebuild_from_grid(grid);
+
+    PathCache cache(1000, 100000);
+    cache.set_map_size(64, 64);
+
+    struct Expected { uint64_t mask; NetworkId start; NetworkId end; };
+    std::map<std::pair<int, int>, Expected> expected;   // (start tile, end tile)
+
+    uint32_t state = 77;
+    auto next = [&state](uint32_t bound) {
+        state = state * 1664525u + 1013904223u;
+        return (state >> 8) % bound;
+    };
+    auto tile = [](const GridPosition& p) { return p.y * 64 + p.x; };
+
+    for (int step = 0; step < 5000; ++step) {
+        const uint32_t op = next(10);
+        if (op < 7) {
+            // Straight run along a row or a column
+            GridPosition a{ static_cast<int32_t>(next(64)), static_cast<int32_t>(next(64)) };
+            GridPosition b = a;
+            if (next(2) == 0) {
+                b.x = static_cast<int32_t>(next(64));
+            } else {
+                b.y = static_cast<int32_t>(next(64));
+            }
+            const PathResult path = make_straight_path(a, b);
+            uint64_t mask = 0;
+            for (const GridPosition& pos : path.path) {
+                mask |= cache.region_bit(pos);
+            }
+            if (next(4) == 0) {
+                cache.put(a, b, path, 0);
+                expected[{tile(a), tile(b)}] = Expected{ mask, 0, 0 };
+            } else {
+                cache.put(a, b, path, 0, graph);
+                expected[{tile(a), tile(b)}] =
+                    Expected{ mask, graph.get_network_id(a), graph.get_network_id(b) };
+            }
+        } else if (op < 9) {
+            const GridPosition pos{ static_cast<int32_t>(next(64)), static_cast<int32_t>(next(64)) };
+            const uint64_t bit = cache.region_bit(pos);
+            size_t removed = 0;
+            for (auto it = expected.begin(); it != expected.end();) {
+                if (it->second.mask & bit) {
+                    it = expected.erase(it);
+                    ++removed;
+                } else {
+                    ++it;
+                }
+            }
+            assert(cache.invalidate_region(pos) == removed);
+        } else {
+            const NetworkId id = static_cast<NetworkId>(1 + next(8));
+            size_t removed = 0;
+            for (auto it = expected.begin(); it != expected.end();) {
+                const Expected& e = it->second;
+                if (e.start == id || e.end == id || e.start == 0 || e.end == 0) {
+                    it = expected.erase(it);
+                    ++removed;
+                } else {
+                    ++it;
+                }
+            }
+            assert(cache.invalidate_network(id) == removed);
+        }
+        assert(cache.size() == expected.size());
+    }
+
+    for (const auto& item : expected) {
+        const GridPosition a{ item.first.first % 64, item.first.first / 64 };
+        const GridPosition b{ item.first.second % 64, item.first.second / 64 };
+        assert(cache.get(a, b, 0) != nullptr);
+    }
+    PASS();
+}
+
 // =============================================================================
 // Main
 // =============================================================================
@@ -309,6 +563,12 @@ int main() {
     test_not_found_result_cached();
     test_max_age_1();
     test_symmetric_keys();
+    test_lru_bound();
+    test_stats_counters();
+    test_region_invalidation();
+    test_network_invalidation();
+    test_region_sizing();
+    test_indexed_eviction_matches_scan();
 
     printf("\n=== Results: %d/%d passed ===\n", tests_passed, tests_total);
     return (tests_passed == tests_total) ? 0 : 1;
@@ -11,6 +11,8 @@
  * - Path cost calculation
  * - Early exit via network_id check
  * - Larger grid path
+ * - Instance reuse across grids and batched queries
+ * - Cost-plane weighting and heuristic admissibility
  */
 
 #include <sims3000/transport/Pathfinding.h>
@@ -19,6 +21,7 @@
 #include <cassert>
 #include <cstdio>
 #include <cstdlib>
+#include <vector>
 
 using namespace sims3000::transport;
 
@@ -321,6 +324,211 @@ TEST(vertical_path) {
     ASSERT_EQ(result.path.back().y, 9);
 }
 
+// ============================================================================
+// Reusing one instance across queries and grid sizes
+// ============================================================================
+
+TEST(reused_instance_across_grids) {
+    PathwayGrid small(16, 16);
+    for (int x = 0; x < 10; ++x) {
+        small.set_pathway(x, 3, 1);
+    }
+    NetworkGraph small_graph;
+    small_graph.rebuild_from_grid(small);
+
+    PathwayGrid large(64, 48);
+    for (int y = 0; y < 40; ++y) {
+        large.set_pathway(20, y, 1);
+    }
+    NetworkGraph large_graph;
+    large_graph.rebuild_from_grid(large);
+
+    Pathfinding pf;
+    PathResult a = pf.find_path({0, 3}, {9, 3}, small, small_graph);
+    ASSERT(a.found);
+    ASSERT_EQ(a.total_cost, 90u);
+
+    PathResult b = pf.find_path({20, 0}, {20, 39}, large, large_graph);
+    ASSERT(b.found);
+    ASSERT_EQ(b.total_cost, 390u);
+    ASSERT_EQ(b.path.size(), 40u);
+
+    // Back to the small grid; stale state from the larger search must not leak
+    PathResult c = pf.find_path({9, 3}, {0, 3}, small, small_graph);
+    ASSERT(c.found);
+    ASSERT_EQ(c.total_cost, 90u);
+    ASSERT_EQ(c.path.front().x, 9);
+    ASSERT_EQ(c.path.back().x, 0);
+}
+
+// ============================================================================
+// Batched queries match individual queries
+// ============================================================================
+
+TEST(batch_matches_single_queries) {
+    PathwayGrid grid(48, 48);
+    // Lattice of roads with every other block joined, plus random gaps
+    srand(1234);
+    for (int y = 0; y < 48; ++y) {
+        for (int x = 0; x < 48; ++x) {
+            if ((x % 4 == 0 || y % 4 == 0) && (rand() % 10) != 0) {
+                grid.set_pathway(x, y, 1);
+            }
+        }
+    }
+
+    NetworkGraph graph;
+    graph.rebuild_from_grid(grid);
+
+    std::vector<PathQuery> queries;
+    for (int i = 0; i < 200; ++i) {
+        GridPosition a{(rand() % 12) * 4, rand() % 48};
+        GridPosition b{rand() % 48, (rand() % 12) * 4};
+        queries.push_back({a, b});
+    }
+
+    Pathfinding batch_pf;
+    std::vector<PathResult> results;
+    batch_pf.find_paths(queries, grid, graph, results);
+    ASSERT_EQ(results.size(), queries.size());
+
+    int found = 0;
+    for (size_t i = 0; i < queries.size(); ++i) {
+        Pathfinding fresh;
+        PathResult expected = fresh.find_path(queries[i].first, queries[i].second, grid, graph);
+        ASSERT_EQ(results[i].found, expected.found);
+        ASSERT_EQ(results[i].total_cost, expected.total_cost);
+        ASSERT_EQ(results[i].path.size(), expected.path.size());
+        if (!results[i].found) {
+            continue;
+        }
+        ++found;
+
+        // Path runs start to end through adjacent pathway tiles
+        ASSERT(results[i].path.front() == queries[i].first);
+        ASSERT(results[i].path.back() == queries[i].second);
+        for (size_t k = 1; k < results[i].path.size(); ++k) {
+            const GridPosition& p = results[i].path[k - 1];
+            const GridPosition& q = results[i].path[k];
+            ASSERT_EQ(std::abs(p.x - q.x) + std::abs(p.y - q.y), 1);
+            ASSERT(grid.has_pathway(q.x, q.y));
+        }
+    }
+    ASSERT(found > 0);
+
+    // Re-running a batch reuses the result slots and gives the same answers
+    std::vector<PathQuery> reversed;
+    for (const auto& q : queries) {
+        reversed.push_back({q.second, q.first});
+    }
+    batch_pf.find_paths(reversed, grid, graph, results);
+    for (size_t i = 0; i < queries.size(); ++i) {
+        Pathfinding fresh;
+        PathResult expected = fresh.find_path(queries[i].first, queries[i].second, grid, graph);
+        ASSERT_EQ(results[i].found, expected.found);
+        ASSERT_EQ(results[i].total_cost, expected.total_cost);
+    }
+}
+
+// ============================================================================
+// Weighted routing with a cost plane
+// ============================================================================
+
+TEST(cost_plane_prefers_cheaper_parallel_route) {
+    // Two parallel roads from (0,0) to (8,0): the direct row and a
+    // detour two rows down. Congest the direct row.
+    PathwayGrid grid(16, 16);
+    EdgeCostPlane plane(16, 16);
+    for (int x = 0; x <= 8; ++x) {
+        grid.set_pathway(x, 0, 1);
+        grid.set_pathway(x, 2, 1);
+        plane.set_cost(x, 0, 15);
+        plane.set_cost(x, 2, 15);
+    }
+    grid.set_pathway(0, 1, 1);
+    grid.set_pathway(8, 1, 1);
+    plane.set_cost(0, 1, 15);
+    plane.set_cost(8, 1, 15);
+
+    NetworkGraph graph;
+    graph.rebuild_from_grid(grid);
+
+    Pathfinding pf;
+    pf.set_cost_plane(&plane);
+    PathResult free_flow = pf.find_path({0, 0}, {8, 0}, grid, graph);
+    ASSERT(free_flow.found);
+    ASSERT_EQ(free_flow.total_cost, 8u * 15u);
+
+    for (int x = 1; x < 8; ++x) {
+        plane.set_cost(x, 0, 25);
+    }
+    PathResult rerouted = pf.find_path({0, 0}, {8, 0}, grid, graph);
+    ASSERT(rerouted.found);
+    // Detour: 12 steps at 15 (7 x 25 + 15 = 190 on the direct row)
+    ASSERT_EQ(rerouted.total_cost, 180u);
+    ASSERT_EQ(rerouted.path[1].y, 1);
+
+    // Detaching the plane restores uniform costs
+    pf.set_cost_plane(nullptr);
+    ASSERT_EQ(pf.find_path({0, 0}, {8, 0}, grid, graph).total_cost, 80u);
+}
+
+TEST(cost_plane_matches_dijkstra) {
+    // Random costs on a full grid; A* with the scaled heuristic must
+    // return the same cost as an exhaustive Dijkstra-style relaxation.
+    const int size = 20;
+    PathwayGrid grid(size, size);
+    EdgeCostPlane plane(size, size);
+    srand(99);
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            grid.set_pathway(x, y, 1);
+            plane.set_cost(x, y, static_cast<uint16_t>(5 + rand() % 25));
+        }
+    }
+    NetworkGraph graph;
+    graph.rebuild_from_grid(grid);
+
+    Pathfinding pf;
+    pf.set_cost_plane(&plane);
+    for (int q = 0; q < 20; ++q) {
+        GridPosition a{rand() % size, rand() % size};
+        GridPosition b{rand() % size, rand() % size};
+
+        // Bellman-Ford style relaxation to a fixed point
+        std::vector<uint32_t> dist(size * size, UINT32_MAX);
+        dist[a.y * size + a.x] = 0;
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (int y = 0; y < size; ++y) {
+                for (int x = 0; x < size; ++x) {
+                    const uint32_t d = dist[y * size + x];
+                    if (d == UINT32_MAX) {
+                        continue;
+                    }
+                    const int nx[] = { x, x, x + 1, x - 1 };
+                    const int ny[] = { y - 1, y + 1, y, y };
+                    for (int k = 0; k < 4; ++k) {
+                        if (nx[k] < 0 || ny[k] < 0 || nx[k] >= size || ny[k] >= size) {
+                            continue;
+                        }
+                        const uint32_t nd = d + plane.get_cost(nx[k], ny[k]);
+                        if (nd < dist[ny[k] * size + nx[k]]) {
+                            dist[ny[k] * size + nx[k]] = nd;
+                            changed = true;
+                        }
+                    }
+                }
+            }
+        }
+
+        PathResult result = pf.find_path(a, b, grid, graph);
+        ASSERT(result.found);
+        ASSERT_EQ(result.total_cost, dist[b.y * size + b.x]);
+    }
+}
+
 // ============================================================================
 // Main
 // ============================================================================
@@ -339,6 +547,10 @@ int main() {
     RUN_TEST(larger_grid_path);
     RUN_TEST(early_exit_different_network_ids);
     RUN_TEST(vertical_path);
+    RUN_TEST(reused_instance_across_grids);
+    RUN_TEST(batch_matches_single_queries);
+    RUN_TEST(cost_plane_prefers_cheaper_parallel_route);
+    RUN_TEST(cost_plane_matches_dijkstra);
 
     printf("\n=== Results ===\n");
     printf("Passed: %d\n", tests_passed);
@@ -14,6 +14,7 @@
  * - Empty grid (all distances 255)
  * - Single pathway tile
  * - Multiple pathway tiles (multi-source)
+ * - Incremental placement/removal updates match a full rebuild
  */
 
 #include <sims3000/transport/ProximityCache.h>
@@ -398,6 +399,79 @@ TEST(full_grid_all_zero) {
     }
 }
 
+// ============================================================================
+// Incremental updates
+// ============================================================================
+
+TEST(incremental_add_and_remove) {
+    ProximityCache cache(8, 8);
+    PathwayGrid grid(8, 8);
+
+    grid.set_pathway(0, 0, 1);
+    cache.rebuild_if_dirty(grid);
+
+    grid.set_pathway(7, 7, 2);
+    cache.on_pathway_added(7, 7);
+    ASSERT(!cache.is_dirty());
+    ASSERT_EQ(cache.get_distance(7, 7), 0);
+    ASSERT_EQ(cache.get_distance(4, 4), 6);
+    ASSERT_EQ(cache.get_distance(1, 1), 2);
+
+    grid.clear_pathway(0, 0);
+    cache.on_pathway_removed(0, 0);
+    ASSERT(!cache.is_dirty());
+    ASSERT_EQ(cache.get_distance(0, 0), 14);
+    ASSERT_EQ(cache.get_distance(4, 4), 6);
+
+    grid.clear_pathway(7, 7);
+    cache.on_pathway_removed(7, 7);
+    ASSERT_EQ(cache.get_distance(7, 7), 255);
+    ASSERT_EQ(cache.get_distance(0, 0), 255);
+}
+
+TEST(incremental_ignored_while_dirty) {
+    ProximityCache cache(8, 8);
+    cache.on_pathway_added(3, 3);
+    ASSERT(cache.is_dirty());
+    ASSERT_EQ(cache.get_distance(3, 3), 255);
+}
+
+TEST(incremental_matches_rebuild) {
+    // Wide enough that some distances exceed the 254 cap
+    const int32_t width = 300;
+    const int32_t height = 24;
+    PathwayGrid grid(width, height);
+    ProximityCache cache(width, height);
+
+    srand(11);
+    for (int i = 0; i < 40; ++i) {
+        grid.set_pathway(rand() % 60, rand() % height, 1);
+    }
+    cache.rebuild_if_dirty(grid);
+
+    for (int step = 0; step < 400; ++step) {
+        int32_t x = (step % 50 == 0) ? width - 1 - rand() % 20 : rand() % 80;
+        int32_t y = rand() % height;
+        if (grid.has_pathway(x, y)) {
+            grid.clear_pathway(x, y);
+            cache.on_pathway_removed(x, y);
+        } else {
+            grid.set_pathway(x, y, 1);
+            cache.on_pathway_added(x, y);
+        }
+
+        if (step % 20 == 0) {
+            ProximityCache reference(width, height);
+            reference.rebuild_if_dirty(grid);
+            for (int32_t ty = 0; ty < height; ++ty) {
+                for (int32_t tx = 0; tx < width; ++tx) {
+                    ASSERT_EQ(cache.get_distance(tx, ty), reference.get_distance(tx, ty));
+                }
+            }
+        }
+    }
+}
+
 // ============================================================================
 // Main
 // ============================================================================
@@ -447,6 +521,11 @@ int main() {
     // Full grid
     RUN_TEST(full_grid_all_zero);
 
+    // Incremental updates
+    RUN_TEST(incremental_add_and_remove);
+    RUN_TEST(incremental_ignored_while_dirty);
+    RUN_TEST(incremental_matches_rebuild);
+
     printf("\n=== Results ===\n");
     printf("Passed: %d\n", tests_passed);
     printf("Failed: %d\n", tests_failed);
@@ -0,0 +1,301 @@
+/**
+ * @file test_traffic_assignment.cpp
+ * @brief Unit tests for TrafficAssignment (origin-destination trips)
+ *
+ * Tests:
+ * - All-or-nothing loads every trip along the corridor
+ * - Trips split across destinations by attraction
+ * - Destinations in other networks attract no trips
+ * - Frank-Wolfe spreads congested trips over parallel routes
+ * - Budgeted stepping spans several calls
+ * - Parallel, sliced rounds match a serial round exactly
+ */
+
+#include <sims3000/transport/TrafficAssignment.h>
+#include <sims3000/transport/PathwayGrid.h>
+#include <sims3000/sim/TaskScheduler.h>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace sims3000;
+using namespace sims3000::transport;
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST(name) void test_##name()
+#define RUN_TEST(name) do { \
+    printf("Running %s...", #name); \
+    test_##name(); \
+    printf(" PASSED\n"); \
+    tests_passed++; \
+} while(0)
+
+#define ASSERT(condition) do { \
+    if (!(condition)) { \
+        printf("\n  FAILED: %s (line %d)\n", #condition, __LINE__); \
+        tests_failed++; \
+        return; \
+    } \
+} while(0)
+
+#define ASSERT_EQ(a, b) do { \
+    if ((a) != (b)) { \
+        printf("\n  FAILED: %s == %s (line %d, got %lld vs %lld)\n", \
+               #a, #b, __LINE__, (long long)(a), (long long)(b)); \
+        tests_failed++; \
+        return; \
+    } \
+} while(0)
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+/// Graph plus uniform per-node costs for a set of pathway tiles
+struct TestNetwork {
+    PathwayGrid grid;
+    NetworkGraph graph;
+    std::vector<uint32_t> free_flow;
+    std::vector<uint32_t> capacity;
+
+    TestNetwork(uint32_t width, uint32_t height) : grid(width, height) {}
+
+    void add(int32_t x, int32_t y) {
+        grid.set_pathway(x, y, static_cast<uint32_t>(y * 100 + x + 1));
+    }
+
+    void build(uint32_t cost, uint32_t cap) {
+        graph.rebuild_from_grid(grid);
+        free_flow.assign(graph.node_count(), cost);
+        capacity.assign(graph.node_count(), cap);
+    }
+};
+
+static uint32_t volume_at(const TrafficAssignment& assignment, int32_t x, int32_t y) {
+    const std::vector<GridPosition>& positions = assignment.get_result_positions();
+    for (size_t i = 0; i < positions.size(); ++i) {
+        if (positions[i].x == x && positions[i].y == y) {
+            return assignment.get_result_volumes()[i];
+        }
+    }
+    return 0;
+}
+
+static TrafficAssignmentConfig unbudgeted(uint32_t iterations) {
+    TrafficAssignmentConfig config;
+    config.iterations = iterations;
+    config.time_budget_us = 0;
+    return config;
+}
+
+// ============================================================================
+// Tests
+// ============================================================================
+
+TEST(all_or_nothing_corridor) {
+    TestNetwork net(16, 4);
+    for (int32_t x = 0; x < 10; ++x) {
+        net.add(x, 1);
+    }
+    net.build(10, 100);
+
+    TrafficAssignment assignment;
+    assignment.set_config(unbudgeted(1));
+    assignment.begin_round(net.graph, net.free_flow, net.capacity,
+                           { TripZone{ GridPosition{0, 1}, 100 } },
+                           { TripZone{ GridPosition{9, 1}, 1 } });
+    ASSERT(assignment.is_running());
+    ASSERT(assignment.step());
+    ASSERT(!assignment.is_running());
+    ASSERT_EQ(assignment.get_round_count(), 1u);
+
+    for (int32_t x = 0; x < 10; ++x) {
+        ASSERT_EQ(volume_at(assignment, x, 1), 100u);
+    }
+}
+
+TEST(trips_split_by_attraction) {
+    TestNetwork net(16, 4);
+    for (int32_t x = 0; x < 10; ++x) {
+        net.add(x, 1);
+    }
+    net.build(10, 100);
+
+    TrafficAssignment assignment;
+    assignment.set_config(unbudgeted(1));
+    assignment.begin_round(net.graph, net.free_flow, net.capacity,
+                           { TripZone{ GridPosition{5, 1}, 100 } },
+                           { TripZone{ GridPosition{0, 1}, 1 },
+                             TripZone{ GridPosition{9, 1}, 3 } });
+    ASSERT(assignment.step());
+
+    ASSERT_EQ(volume_at(assignment, 5, 1), 100u);
+    ASSERT_EQ(volume_at(assignment, 0, 1), 25u);
+    ASSERT_EQ(volume_at(assignment, 4, 1), 25u);
+    ASSERT_EQ(volume_at(assignment, 6, 1), 75u);
+    ASSERT_EQ(volume_at(assignment, 9, 1), 75u);
+}
+
+TEST(other_networks_attract_no_trips) {
+    TestNetwork net(16, 4);
+    for (int32_t x = 0; x < 4; ++x) {
+        net.add(x, 1);        // network A
+        net.add(x + 8, 1);    // network B
+    }
+    net.build(10, 100);
+
+    // Only destination is unreachable: nothing is assigned
+    TrafficAssignment assignment;
+    assignment.set_config(unbudgeted(1));
+    assignment.begin_round(net.graph, net.free_flow, net.capacity,
+                           { TripZone{ GridPosition{0, 1}, 100 } },
+                           { TripZone{ GridPosition{11, 1}, 1 } });
+    ASSERT(assignment.step());
+    ASSERT(assignment.get_result_positions().empty());
+
+    // A reachable destination takes all of the origin's trips
+    assignment.begin_round(net.graph, net.free_flow, net.capacity,
+                           { TripZone{ GridPosition{0, 1}, 100 } },
+                           { TripZone{ GridPosition{3, 1}, 1 },
+                             TripZone{ GridPosition{11, 1}, 1 } });
+    ASSERT(assignment.step());
+    ASSERT_EQ(volume_at(assignment, 3, 1), 100u);
+    ASSERT_EQ(volume_at(assignment, 8, 1), 0u);
+    ASSERT_EQ(volume_at(assignment, 11, 1), 0u);
+}
+
+TEST(frank_wolfe_spreads_parallel_routes) {
+    // Two equal routes from (0,1) to (6,1): along y = 0 and along y = 2
+    TestNetwork net(8, 4);
+    for (int32_t x = 0; x < 7; ++x) {
+        net.add(x, 0);
+        net.add(x, 2);
+    }
+    net.add(0, 1);
+    net.add(6, 1);
+    net.build(10, 20);
+
+    const std::vector<TripZone> origins = { TripZone{ GridPosition{0, 1}, 100 } };
+    const std::vector<TripZone> destinations = { TripZone{ GridPosition{6, 1}, 1 } };
+
+    // All-or-nothing puts every trip on one route
+    TrafficAssignment aon;
+    aon.set_config(unbudgeted(1));
+    aon.begin_round(net.graph, net.free_flow, net.capacity, origins, destinations);
+    ASSERT(aon.step());
+    ASSERT_EQ(volume_at(aon, 3, 0) + volume_at(aon, 3, 2), 100u);
+    ASSERT(volume_at(aon, 3, 0) == 0u || volume_at(aon, 3, 2) == 0u);
+
+    // Equilibrium balances the congested routes
+    TrafficAssignment fw;
+    fw.set_config(unbudgeted(20));
+    fw.begin_round(net.graph, net.free_flow, net.capacity, origins, destinations);
+    ASSERT(fw.step());
+    const uint32_t top = volume_at(fw, 3, 0);
+    const uint32_t bottom = volume_at(fw, 3, 2);
+    ASSERT(top + bottom >= 99u && top + bottom <= 101u);
+    ASSERT(top >= 40u && top <= 60u);
+    ASSERT(bottom >= 40u && bottom <= 60u);
+    ASSERT(fw.get_relative_gap() < 0.05);
+    ASSERT_EQ(volume_at(fw, 6, 1), 100u);
+}
+
+TEST(budgeted_round_spans_steps) {
+    TestNetwork net(16, 4);
+    for (int32_t x = 0; x < 10; ++x) {
+        net.add(x, 1);
+    }
+    net.build(10, 100);
+
+    TrafficAssignmentConfig config = unbudgeted(2);
+    config.max_origins_per_step = 1;
+    TrafficAssignment assignment;
+    assignment.set_config(config);
+    assignment.begin_round(net.graph, net.free_flow, net.capacity,
+                           { TripZone{ GridPosition{0, 1}, 10 },
+                             TripZone{ GridPosition{1, 1}, 10 },
+                             TripZone{ GridPosition{2, 1}, 10 } },
+                           { TripZone{ GridPosition{9, 1}, 1 } });
+
+    // 3 origin trees x 2 iterations, one tree per step
+    for (int i = 0; i < 5; ++i) {
+        ASSERT(!assignment.step());
+        ASSERT(assignment.is_running());
+    }
+    ASSERT(assignment.step());
+    ASSERT(!assignment.step());
+    ASSERT_EQ(volume_at(assignment, 1, 1), 20u);
+    ASSERT_EQ(volume_at(assignment, 5, 1), 30u);
+}
+
+TEST(parallel_sliced_round_matches_serial) {
+    // 24x24 lattice with every fourth tile of each odd row missing
+    TestNetwork net(24, 24);
+    for (int32_t y = 0; y < 24; ++y) {
+        for (int32_t x = 0; x < 24; ++x) {
+            if (y % 2 == 1 && x % 4 == 2) {
+                continue;
+            }
+            net.add(x, y);
+        }
+    }
+    net.build(10, 30);
+
+    std::vector<TripZone> origins;
+    std::vector<TripZone> destinations;
+    for (int32_t i = 0; i < 12; ++i) {
+        origins.push_back({ GridPosition{(i * 7) % 24, (i * 5) % 24 & ~1}, 40u + static_cast<uint32_t>(i) });
+        destinations.push_back({ GridPosition{(i * 11 + 3) % 24, (i * 13 + 2) % 24 & ~1}, 1u + static_cast<uint32_t>(i % 3) });
+    }
+
+    TrafficAssignment serial;
+    serial.set_config(unbudgeted(4));
+    serial.begin_round(net.graph, net.free_flow, net.capacity, origins, destinations);
+    ASSERT(serial.step());
+
+    sim::TaskScheduler scheduler(3);
+    TrafficAssignmentConfig config = unbudgeted(4);
+    config.max_origins_per_step = 5;
+    TrafficAssignment parallel;
+    parallel.set_config(config);
+    parallel.set_task_scheduler(&scheduler);
+    parallel.begin_round(net.graph, net.free_flow, net.capacity, origins, destinations);
+    int steps = 1;
+    while (!parallel.step()) {
+        ++steps;
+        ASSERT(steps < 100);
+    }
+    ASSERT(steps > 1);
+
+    ASSERT(!serial.get_result_positions().empty());
+    ASSERT_EQ(parallel.get_result_positions().size(), serial.get_result_positions().size());
+    for (size_t i = 0; i < serial.get_result_positions().size(); ++i) {
+        ASSERT(parallel.get_result_positions()[i] == serial.get_result_positions()[i]);
+        ASSERT_EQ(parallel.get_result_volumes()[i], serial.get_result_volumes()[i]);
+    }
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main() {
+    printf("=== TrafficAssignment Unit Tests ===\n\n");
+
+    RUN_TEST(all_or_nothing_corridor);
+    RUN_TEST(trips_split_by_attraction);
+    RUN_TEST(other_networks_attract_no_trips);
+    RUN_TEST(frank_wolfe_spreads_parallel_routes);
+    RUN_TEST(budgeted_round_spans_steps);
+    RUN_TEST(parallel_sliced_round_matches_serial);
+
+    printf("\n=== Results ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+
+    return tests_failed > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
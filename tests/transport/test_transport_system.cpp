@@ -8,6 +8,12 @@
  * - Pathway placement and removal
  * - ITransportProvider delegation
  * - Tick phases (rebuild, flow, congestion, decay)
+ * - Incremental network updates on placement/removal
+ * - Route queries through the chunked planner
+ * - Edge cost plane maintenance and weighted routing
+ * - Path cache eviction limited to affected routes
+ * - Packed store stays consistent across removals
+ * - Trip assignment writes zone-to-zone volumes to traffic
  * - Event emission
  * - Grace period
  */
@@ -16,6 +22,7 @@
 #include <cassert>
 #include <cstdio>
 #include <cmath>
+#include <vector>
 
 using namespace sims3000::transport;
 
@@ -225,6 +232,154 @@ static void test_network_id_at() {
     PASS();
 }
 
+static void test_edits_update_network_incrementally() {
+    TEST("Edits after the first build update network IDs in place");
+    TransportSystem sys(32, 32);
+
+    sys.place_pathway(0, 0, PathwayType::BasicPathway, 0);
+    sys.place_pathway(2, 0, PathwayType::BasicPathway, 0);
+    sys.tick(0.05f);
+    assert(!sys.are_connected(0, 0, 2, 0));
+
+    // Bridge merges without waiting for a tick or a full rebuild
+    uint32_t bridge = sys.place_pathway(1, 0, PathwayType::BasicPathway, 0);
+    assert(!sys.get_pathway_grid().is_network_dirty());
+    assert(sys.are_connected(0, 0, 2, 0));
+    assert(sys.get_network_id_at(0, 0) == sys.get_network_id_at(2, 0));
+
+    // Removing it splits them again
+    assert(sys.remove_pathway(bridge, 1, 0, 0));
+    assert(!sys.get_pathway_grid().is_network_dirty());
+    assert(!sys.are_connected(0, 0, 2, 0));
+    assert(sys.get_network_graph().get_network_count() == 2);
+    PASS();
+}
+
+static void test_find_path_follows_edits() {
+    TEST("find_path routes across chunks and follows edits");
+    TransportSystem sys(64, 64);
+
+    std::vector<uint32_t> ids;
+    for (int32_t x = 0; x < 40; ++x) {
+        ids.push_back(sys.place_pathway(x, 5, PathwayType::BasicPathway, 0));
+    }
+    sys.tick(0.05f);
+
+    PathResult route = sys.find_path({0, 5}, {39, 5});
+    assert(route.found);
+    assert(route.total_cost == 390);
+    assert(route.path.size() == 40);
+
+    // Cut the road where it crosses a chunk border
+    assert(sys.remove_pathway(ids[16], 16, 5, 0));
+    assert(!sys.find_path({0, 5}, {39, 5}).found);
+
+    // Detour one row down
+    sys.place_pathway(15, 6, PathwayType::BasicPathway, 0);
+    sys.place_pathway(16, 6, PathwayType::BasicPathway, 0);
+    sys.place_pathway(17, 6, PathwayType::BasicPathway, 0);
+    route = sys.find_path({0, 5}, {39, 5});
+    assert(route.found);
+    assert(route.total_cost == 410);
+    PASS();
+}
+
+static void test_path_cache_selective_invalidation() {
+    TEST("find_path cache evicts only routes an edit can affect");
+    TransportSystem sys(64, 64);
+
+    // Road A along y=2 and road B along y=50, far apart
+    std::vector<uint32_t> road_a;
+    for (int32_t x = 0; x < 40; ++x) {
+        road_a.push_back(sys.place_pathway(x, 2, PathwayType::BasicPathway, 0));
+        sys.place_pathway(x, 50, PathwayType::BasicPathway, 0);
+    }
+    sys.tick(0.05f);
+
+    assert(sys.find_path({0, 2}, {39, 2}).found);
+    assert(sys.find_path({0, 50}, {39, 50}).found);
+    assert(sys.get_path_cache().size() == 2);
+    assert(sys.find_path({0, 50}, {39, 50}).found);
+    assert(sys.get_path_cache().get_stats().hits == 1);
+
+    // Extending road A leaves road B's route cached
+    sys.place_pathway(40, 2, PathwayType::BasicPathway, 0);
+    assert(sys.get_path_cache().size() == 1);
+
+    // Splitting road A does not touch road B's route either
+    assert(sys.remove_pathway(road_a[20], 20, 2, 0));
+    assert(sys.get_path_cache().size() == 1);
+    PathResult far_half = sys.find_path({24, 2}, {36, 2});
+    assert(far_half.found && far_half.total_cost == 120);
+    assert(!sys.find_path({0, 2}, {39, 2}).found);
+
+    // Reconnecting merges the halves; the cached miss must not survive
+    sys.place_pathway(20, 2, PathwayType::BasicPathway, 0);
+    assert(sys.find_path({0, 2}, {39, 2}).found);
+    assert(sys.find_path({0, 50}, {39, 50}).found);
+    PASS();
+}
+
+static void test_relabel_evicts_wide_network_ids() {
+    TEST("Split evicts cached routes by full 32-bit network ID");
+    TransportSystem sys(520, 520);
+
+    // 65536 isolated tiles use up every 16-bit network ID
+    for (int32_t y = 0; y < 512; y += 2) {
+        for (int32_t x = 0; x < 512; x += 2) {
+            sys.place_pathway(x, y, PathwayType::BasicPathway, 0);
+        }
+    }
+    sys.tick(0.05f);
+
+    std::vector<uint32_t> line;
+    for (int32_t x = 0; x <= 80; ++x) {
+        line.push_back(sys.place_pathway(x, 515, PathwayType::BasicPathway, 0));
+    }
+    assert(sys.get_network_graph().get_network_id(GridPosition{0, 515}) > 0xFFFF);
+
+    // Route outside the cut's cache region, tagged with the line's network
+    assert(sys.find_path({70, 515}, {80, 515}).found);
+    assert(sys.get_path_cache().size() == 1);
+
+    // The split relabels one half; routes tagged with the old ID go
+    assert(sys.remove_pathway(line[5], 5, 515, 0));
+    assert(sys.get_path_cache().size() == 0);
+    PASS();
+}
+
+static void test_edge_cost_plane_tracks_pathways() {
+    TEST("Edge cost plane follows placement, removal and pathway type");
+    TransportSystem sys(32, 32);
+
+    // Basic row y=0 and a transit corridor detour via y=1
+    std::vector<uint32_t> row;
+    for (int32_t x = 0; x <= 4; ++x) {
+        row.push_back(sys.place_pathway(x, 0, PathwayType::BasicPathway, 0));
+    }
+    sys.place_pathway(0, 1, PathwayType::TransitCorridor, 0);
+    for (int32_t x = 1; x <= 4; ++x) {
+        sys.place_pathway(x, 1, PathwayType::TransitCorridor, 0);
+    }
+
+    const EdgeCostPlane& plane = sys.get_edge_cost_plane();
+    assert(plane.get_cost(2, 0) == calculate_edge_cost(PathwayType::BasicPathway, 0, 255));
+    assert(plane.get_cost(2, 1) == calculate_edge_cost(PathwayType::TransitCorridor, 0, 255));
+    assert(plane.min_cost() == 5);
+
+    sys.tick(0.05f);
+
+    // Unweighted route stays on the row; weighted route takes the corridor
+    assert(sys.find_path({0, 0}, {4, 0}).total_cost == 40);
+    PathResult weighted = sys.find_weighted_path({0, 0}, {4, 0});
+    assert(weighted.found);
+    assert(weighted.total_cost == 5 * 5 + 15);  // down, 4 along the corridor, up
+
+    assert(sys.remove_pathway(row[2], 2, 0, 0));
+    assert(plane.get_cost(2, 0) == 0);
+    PASS();
+}
+
 static void test_placed_events() {
     TEST("Placed events emitted on placement");
     TransportSystem sys(32, 32);
@@ -362,6 +517,62 @@ static void test_decay_runs_periodically() {
     PASS();
 }
 
+static void test_removal_keeps_other_pathways_intact() {
+    TEST("Removing a pathway leaves the others' data in place");
+    TransportSystem sys(32, 32);
+
+    uint32_t a = sys.place_pathway(1, 1, PathwayType::BasicPathway, 0);
+    uint32_t b = sys.place_pathway(2, 1, PathwayType::TransitCorridor, 1);
+    uint32_t c = sys.place_pathway(3, 1, PathwayType::BasicPathway, 2);
+    sys.tick(0.05f);
+
+    // Removing the first pathway moves the last one's storage
+    assert(sys.remove_pathway(a, 1, 1, 0));
+    assert(sys.get_pathway_count() == 2);
+    assert(!sys.remove_pathway(a, 1, 1, 0));
+
+    // The moved pathway keeps its owner, position and cost
+    assert(!sys.remove_pathway(c, 3, 1, 0));
+    assert(!sys.remove_pathway(c, 2, 1, 2));
+    assert(sys.get_edge_cost_plane().get_cost(3, 1) ==
+           calculate_edge_cost(PathwayType::BasicPathway, 0, 255));
+    assert(sys.get_edge_cost_plane().get_cost(2, 1) ==
+           calculate_edge_cost(PathwayType::TransitCorridor, 0, 255));
+    assert(sys.are_connected(2, 1, 3, 1));
+
+    sys.tick(0.05f);
+    assert(sys.remove_pathway(c, 3, 1, 2));
+    assert(sys.remove_pathway(b, 2, 1, 1));
+    assert(sys.get_pathway_count() == 0);
+    PASS();
+}
+
+static void test_trip_assignment_sets_traffic_volume() {
+    TEST("Trip assignment writes zone-to-zone volumes to traffic");
+    TransportSystem sys(32, 32);
+    for (int32_t x = 0; x < 10; ++x) {
+        sys.place_pathway(x, 5, PathwayType::BasicPathway, 0);
+    }
+
+    // Centroids one tile off the road snap onto it
+    TrafficAssignmentConfig config;
+    config.iterations = 1;
+    config.time_budget_us = 0;
+    sys.set_assignment_config(config);
+    sys.set_trip_zones({ TripZone{ GridPosition{2, 6}, 50 } },
+                       { TripZone{ GridPosition{8, 4}, 1 },
+                         TripZone{ GridPosition{20, 20}, 1 } });  // out of reach
+
+    sys.tick(0.05f);
+    assert(sys.get_traffic_assignment().get_round_count() == 1);
+    assert(sys.get_traffic_volume_at(2, 5) == 50);
+    assert(sys.get_traffic_volume_at(5, 5) == 50);
+    assert(sys.get_traffic_volume_at(8, 5) == 50);
+    assert(sys.get_traffic_volume_at(9, 5) == 0);
+    assert(sys.get_traffic_volume_at(0, 5) == 0);
+    PASS();
+}
+
 static void test_unique_entity_ids() {
     TEST("Entity IDs are unique and increasing");
     TransportSystem sys(32, 32);
@@ -470,6 +681,11 @@ int main() {
     test_is_road_accessible_at();
     test_disconnected_networks();
     test_network_id_at();
+    test_edits_update_network_incrementally();
+    test_find_path_follows_edits();
+    test_path_cache_selective_invalidation();
+    test_relabel_evicts_wide_network_ids();
+    test_edge_cost_plane_tracks_pathways();
     test_placed_events();
     test_removed_events();
     test_events_cleared_on_tick();
@@ -479,6 +695,8 @@ int main() {
     test_congestion_no_pathway();
     test_multiple_ticks();
     test_decay_runs_periodically();
+    test_removal_keeps_other_pathways_intact();
+    test_trip_assignment_sets_traffic_volume();
     test_unique_entity_ids();
     test_pathway_grid_accessor();
     test_network_graph_accessor();
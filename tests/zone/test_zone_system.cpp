@@ -252,3 +252,41 @@ TEST(ZoneSystemTest, SetZoneStateOnEmpty) {
     bool result = system.set_zone_state(5, 5, ZoneState::Occupied);
     EXPECT_FALSE(result);
 }
+
+// ============================================================================
+// Spawn Candidate Tests
+// ============================================================================
+
+TEST(ZoneSystemTest, SpawnCandidatesTrackDesignatedTiles) {
+    ZoneSystem system(nullptr, nullptr, 128);
+    system.place_zone(5, 5, ZoneType::Habitation, ZoneDensity::LowDensity, 0, 1);
+    system.place_zone(6, 5, ZoneType::Habitation, ZoneDensity::LowDensity, 0, 2);
+    system.place_zone(7, 5, ZoneType::Exchange, ZoneDensity::LowDensity, 0, 3);
+    system.place_zone(8, 5, ZoneType::Habitation, ZoneDensity::LowDensity, 1, 4);
+
+    EXPECT_EQ(system.get_spawn_candidates(0, ZoneType::Habitation).size(), 2u);
+    EXPECT_EQ(system.get_spawn_candidates(0, ZoneType::Exchange).size(), 1u);
+    ASSERT_EQ(system.get_spawn_candidates(1, ZoneType::Habitation).size(), 1u);
+    EXPECT_EQ(system.get_spawn_candidates(1, ZoneType::Habitation)[0], 5u * 128u + 8u);
+
+    // Occupied and Stalled tiles leave the set; Designated again rejoins
+    system.set_zone_state(5, 5, ZoneState::Occupied);
+    system.set_zone_state(6, 5, ZoneState::Stalled);
+    EXPECT_TRUE(system.get_spawn_candidates(0, ZoneType::Habitation).empty());
+    system.set_zone_state(5, 5, ZoneState::Designated);
+    ASSERT_EQ(system.get_spawn_candidates(0, ZoneType::Habitation).size(), 1u);
+    EXPECT_EQ(system.get_spawn_candidates(0, ZoneType::Habitation)[0], 5u * 128u + 5u);
+
+    // Redesignation moves the tile between type sets
+    system.redesignate_zone(7, 5, ZoneType::Fabrication, ZoneDensity::LowDensity, 0);
+    EXPECT_TRUE(system.get_spawn_candidates(0, ZoneType::Exchange).empty());
+    EXPECT_EQ(system.get_spawn_candidates(0, ZoneType::Fabrication).size(), 1u);
+
+    // Removal drops it
+    system.remove_zones(5, 5, 4, 1, 0);
+    EXPECT_TRUE(system.get_spawn_candidates(0, ZoneType::Habitation).empty());
+    EXPECT_TRUE(system.get_spawn_candidates(0, ZoneType::Fabrication).empty());
+    EXPECT_EQ(system.get_spawn_candidates(1, ZoneType::Habitation).size(), 1u);
+
+    EXPECT_TRUE(system.get_spawn_candidates(MAX_OVERSEERS, ZoneType::Habitation).empty());
+}